@@ -0,0 +1,55 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+
+namespace {
+	std::atomic<long long> allocationCount(0);
+}
+
+/**
+	Counts the allocation and allocates input amount of bytes
+
+	@param size
+	@return memory
+*/
+void* operator new(std::size_t size)
+{
+	++allocationCount;
+	void* memory = std::malloc(size > 0 ? size : 1);
+	if (memory == nullptr) {
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+/**
+	Frees memory allocated by operator new
+
+	@param memory
+*/
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+/**
+	Frees memory allocated by operator new (the size is not needed)
+
+	@param memory
+*/
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+/**
+	Returns the amount of allocations made since the program started
+
+	@return allocationCount
+*/
+long long AllocationCounter::getCount()
+{
+	return allocationCount;
+}
@@ -0,0 +1,12 @@
+/**
+	Counter of the heap allocations of the program, so the tests can check that a piece of code never allocates
+
+	The global operator new is replaced by one counting its calls (operator new[] and the nothrow forms go through it),
+	so the count covers every allocation of every thread.
+*/
+
+#pragma once
+
+namespace AllocationCounter {
+	long long getCount();
+}
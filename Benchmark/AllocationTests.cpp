@@ -0,0 +1,148 @@
+#include "AllocationTests.h"
+#include "AllocationCounter.h"
+#include "Positions.h"
+#include "Minefield.h"
+#include "DigitalDisplay.h"
+#include "Graphics.h"
+#include "MemoryBackend.h"
+#include "CounterRng.h"
+#include "Vei2.h"
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+namespace {
+	constexpr std::uint64_t testSeed = 2026;
+	constexpr int warmUpGameCount = 300;
+	constexpr int testedGameCount = 2700;
+	constexpr int maxClicksPerGame = 200;
+	constexpr int firstShownValue = -120;	// The values a display test shows every frame, one after the other
+	constexpr int lastShownValue = 1100;
+
+	/**
+		Clicks random tiles of a field until the game is won, lost or input amount of clicks were made: mostly reveals,
+		and every eighth click flags a hidden tile or chords a revealed one
+
+		@param field
+		@param seed Seed of the clicks
+	*/
+	void playRandomGame(Minefield& field, std::uint64_t seed)
+	{
+		const Vei2 boardSize = field.getCamera().getBoardSize();
+		const int halfTile = field.getCamera().getTileScreenSize() / 2;
+		for (int click = 0; click < maxClicksPerGame && !field.isExploded && !field.revealedAll(); ++click) {
+			const std::uint64_t random = CounterRng::get(seed, std::uint64_t(click));
+			const Vei2 tile(int((random & 0xFFFF) % std::uint32_t(boardSize.x)),
+				int((random >> 32) % std::uint32_t(boardSize.y)));
+			const Vei2 location = field.getCamera().toScreen(tile) + Vei2(halfTile, halfTile);
+			if ((random >> 16) % 8 == 0) {
+				field.revealSurroundingTilesOrFlagTileAtLocation(location);
+			}
+			else {
+				field.revealTileAtLocation(location);
+			}
+		}
+	}
+
+	/**
+		Plays games on a field: each one resets the field to the next board of a list, plays it, restarts it, plays it
+		again and restarts it
+
+		@param field
+		@param boards Boards the field is reset to in turn
+		@param nBoards
+		@param firstGame Number of the first game (the games are seeded from their number)
+		@param nGames
+	*/
+	void playGames(Minefield& field, const Positions::Difficulty* boards, int nBoards, int firstGame, int nGames)
+	{
+		for (int game = firstGame; game < firstGame + nGames; ++game) {
+			const Positions::Difficulty& board = boards[game % nBoards];
+			const std::uint64_t seed = CounterRng::get(testSeed, std::uint64_t(game));
+			field.reset(board.width, board.height, board.nMines, seed);
+			playRandomGame(field, seed);
+			field.restart();
+			playRandomGame(field, ~seed);
+			field.restart();
+		}
+	}
+
+	/**
+		Plays games on a field after warming it up, prints whether they allocated
+
+		@param name
+		@param boards Boards the field is reset to in turn
+		@param nBoards
+		@return passed
+	*/
+	bool checkGamesDoNotAllocate(const char* name, const Positions::Difficulty* boards, int nBoards)
+	{
+		Minefield field(boards[0].width, boards[0].height, boards[0].nMines, testSeed);
+		playGames(field, boards, nBoards, 0, warmUpGameCount);
+		const long long before = AllocationCounter::getCount();
+		playGames(field, boards, nBoards, warmUpGameCount, testedGameCount);
+		const long long nAllocations = AllocationCounter::getCount() - before;
+		std::printf("%-50s %-6s (%lld allocations over %d games)\n", name, nAllocations == 0 ? "passed" : "FAILED",
+			nAllocations, testedGameCount);
+		return nAllocations == 0;
+	}
+}
+
+/**
+	Checks that resetting a minefield to a board of the same size, playing it and restarting it never allocates, and
+	neither does switching between the standard difficulties once each of them was played
+
+	@return passed
+*/
+bool AllocationTests::testMinefieldReset()
+{
+	const bool sameSizePassed = checkGamesDoNotAllocate("Minefield reset to the same size (Expert)",
+		&Positions::standardDifficulties[2], 1);
+	const int nDifficulties = int(sizeof(Positions::standardDifficulties) / sizeof(Positions::standardDifficulties[0]));
+	const bool everySizePassed = checkGamesDoNotAllocate("Minefield reset to every standard difficulty",
+		Positions::standardDifficulties, nDifficulties);
+	return sameSizePassed && everySizePassed;
+}
+
+/**
+	Checks that setting the value of a digital display and drawing it never allocates once every value was drawn once,
+	for every value from firstShownValue to lastShownValue (so capped and negative values are covered too)
+
+	@return passed
+*/
+bool AllocationTests::testDigitalDisplay()
+{
+	Graphics gfx(std::make_unique<MemoryBackend>());
+	DigitalDisplay display;
+	long long nAllocations = 0;
+	int nFrames = 0;
+	for (int pass = 0; pass < 2; ++pass) {
+		for (int value = firstShownValue; value <= lastShownValue; ++value) {
+			gfx.BeginFrame();
+			const long long before = AllocationCounter::getCount();
+			display.setValue(value);
+			display.draw(gfx, 0, 0);
+			if (pass > 0) {
+				nAllocations += AllocationCounter::getCount() - before;
+				++nFrames;
+			}
+			gfx.EndFrame();
+		}
+	}
+	std::printf("%-50s %-6s (%lld allocations over %d frames)\n", "DigitalDisplay setValue() and draw()",
+		nAllocations == 0 ? "passed" : "FAILED", nAllocations, nFrames);
+	return nAllocations == 0;
+}
+
+/**
+	Runs every test
+
+	@return failedTestCount
+*/
+int AllocationTests::runAll()
+{
+	int nFailed = 0;
+	nFailed += !testMinefieldReset();
+	nFailed += !testDigitalDisplay();
+	return nFailed;
+}
@@ -0,0 +1,11 @@
+/**
+	Tests checking that the loops of a game stop allocating once they are warmed up, run with: Benchmark test
+*/
+
+#pragma once
+
+namespace AllocationTests {
+	bool testMinefieldReset();
+	bool testDigitalDisplay();
+	int runAll();
+}
@@ -0,0 +1,543 @@
+#include "BoardBenchmarks.h"
+#include "Positions.h"
+#include "Timing.h"
+#include "TileGrid.h"
+#include "Minefield.h"
+#include "BasicMinefield.h"
+#include "ThreadPool.h"
+#include "CounterRng.h"
+#include "Vei2.h"
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <functional>
+#include <assert.h>
+
+namespace {
+	constexpr std::uint64_t boardSeed = 2026;
+	constexpr Positions::Difficulty hugeBoard = { "4096x4096", 4096, 4096, 3460300 };	// Mine density of Expert
+	constexpr Positions::Difficulty hugeBeginnerBoard = { "4096x4096 Beg", 4096, 4096, 2072000 };	// Mine density of Beginner
+	constexpr Positions::Difficulty hugeGenerationBoard = { "10000x10000", 10000, 10000, 20625000 };	// Mine density of Expert
+	constexpr Positions::Difficulty hugeOpeningBoard = { "10000x10000", 10000, 10000, 20000 };	// One opening covers it
+	constexpr int firstClickBoardCount = 1000;
+	constexpr int laterClickCount = 200;	// Openings clicked after the first click in the opening index benchmark
+	constexpr int fieldGameCount = 100;	// Boards played in turn by the fixed and the dynamic field
+
+	/**
+		Layout of a tile before the bit-packed planes of TileGrid (Minefield::Tile), one object per tile
+	*/
+	struct ObjectTile {
+		Vei2 position;
+		int adjacentMineCount;
+		TileGrid::State state;
+		bool mine;
+	};
+
+	// The scans start from a tile read before every scan and their checksums are stored, so the compiler can neither
+	// run a scan once for every time nor leave it out
+	volatile int firstScannedTile = 0;
+	volatile long long scanChecksum = 0;
+
+	/**
+		Runs a scan of the tiles over and over for at least input time
+
+		@param scan Takes the first tile to scan, returns a checksum of the tiles it read
+		@param nTiles
+		@param minSeconds
+		@return nanosecondsPerTile
+	*/
+	template<typename Scan>
+	double timeScan(const Scan& scan, int nTiles, double minSeconds)
+	{
+		long long nScans = 0;
+		long long checksum = 0;
+		const auto start = std::chrono::steady_clock::now();
+		double seconds = 0.0;
+		do {
+			checksum += scan(firstScannedTile);
+			++nScans;
+			seconds = Timing::secondsSince(start);
+		} while (seconds < minSeconds);
+		scanChecksum = checksum;
+		return 1e9 * seconds / (double(nScans) * nTiles);
+	}
+
+	/**
+		Places the mines of a board clicked at the centre, reveals the opening there and flags every mine
+
+		@param grid Resized to the board
+		@param difficulty
+	*/
+	void setUpBoard(TileGrid& grid, const Positions::Difficulty& difficulty)
+	{
+		grid.resize(difficulty.width, difficulty.height);
+		const int clickedIndex = grid.indexOf(difficulty.width / 2, difficulty.height / 2);
+		grid.placeMines(difficulty.nMines, clickedIndex, boardSeed);
+		grid.countAdjacentMines();
+		grid.floodReveal(clickedIndex);
+		grid.flagHiddenMines();
+	}
+
+	/**
+		Reveals the first click at the centre of boards, over and over for at least input time, prints how many tiles a
+		click revealed and how long it took
+
+		@param difficulty
+		@param nBoards Boards clicked in turn (each from its own seed)
+		@param minSeconds
+	*/
+	void benchmarkFirstClicks(const Positions::Difficulty& difficulty, int nBoards, double minSeconds)
+	{
+		std::vector<TileGrid> grids(nBoards);
+		const int clickedIndex = difficulty.height / 2 * difficulty.width + difficulty.width / 2;
+		for (int i = 0; i < nBoards; ++i) {
+			grids[i].resize(difficulty.width, difficulty.height);
+			grids[i].placeMines(difficulty.nMines, clickedIndex, CounterRng::get(boardSeed, std::uint64_t(i)));
+			grids[i].countAdjacentMines();
+		}
+
+		long long nClicks = 0;
+		long long nRevealed = 0;
+		double revealSeconds = 0.0;
+		const auto start = std::chrono::steady_clock::now();
+		do {
+			for (TileGrid& grid : grids) {
+				grid.hideAll();
+				const auto clickStart = std::chrono::steady_clock::now();
+				nRevealed += grid.floodReveal(clickedIndex);
+				revealSeconds += Timing::secondsSince(clickStart);
+				++nClicks;
+			}
+		} while (Timing::secondsSince(start) < minSeconds);
+		std::printf("%-14s %10lld %14.1f %10.2f %12.2f\n", difficulty.name, nClicks, double(nRevealed) / nClicks,
+			1e9 * revealSeconds / nRevealed, 1e6 * revealSeconds / nClicks);
+	}
+
+	/**
+		Compares the memory and the scan speed of the tiles of a board kept as one object per tile and as bit-packed
+		planes, prints a row of the table
+
+		@param difficulty
+		@param minSeconds
+	*/
+	void benchmarkTileLayouts(const Positions::Difficulty& difficulty, double minSeconds)
+	{
+		TileGrid grid;
+		setUpBoard(grid, difficulty);
+		const int nTiles = grid.getTileCount();
+		std::vector<ObjectTile> objects(nTiles);
+		for (int index = 0; index < nTiles; ++index) {
+			objects[index] = { { index % difficulty.width, index / difficulty.width }, grid.getAdjacentMineCount(index),
+				grid.getState(index), grid.hasMine(index) };
+		}
+
+		// Counting the revealed tiles, and reading what each tile is drawn from (its state, then its mine or its number)
+		auto scanObjectStates = [&objects, nTiles](int begin) {
+			long long nRevealed = 0;
+			for (int index = begin; index < nTiles; ++index) {
+				nRevealed += objects[index].state == TileGrid::State::Revealed;
+			}
+			return nRevealed;
+		};
+		auto scanPlaneStates = [&grid, nTiles](int begin) {
+			long long nRevealed = 0;
+			for (int index = begin; index < nTiles; ++index) {
+				nRevealed += grid.getState(index) == TileGrid::State::Revealed;
+			}
+			return nRevealed;
+		};
+		auto scanObjectLooks = [&objects, nTiles](int begin) {
+			long long looks = 0;
+			for (int index = begin; index < nTiles; ++index) {
+				const ObjectTile& tile = objects[index];
+				looks += tile.state != TileGrid::State::Revealed ? (int)tile.state :
+					tile.mine ? 9 : tile.adjacentMineCount;
+			}
+			return looks;
+		};
+		auto scanPlaneLooks = [&grid, nTiles](int begin) {
+			long long looks = 0;
+			for (int index = begin; index < nTiles; ++index) {
+				const TileGrid::State state = grid.getState(index);
+				looks += state != TileGrid::State::Revealed ? (int)state :
+					grid.hasMine(index) ? 9 : grid.getAdjacentMineCount(index);
+			}
+			return looks;
+		};
+		if (scanObjectStates(0) != scanPlaneStates(0) || scanObjectLooks(0) != scanPlaneLooks(0)) {
+			std::printf("%-14s the layouts differ\n", difficulty.name);
+			return;
+		}
+
+		const double objectStates = timeScan(scanObjectStates, nTiles, minSeconds);
+		const double planeStates = timeScan(scanPlaneStates, nTiles, minSeconds);
+		const double objectLooks = timeScan(scanObjectLooks, nTiles, minSeconds);
+		const double planeLooks = timeScan(scanPlaneLooks, nTiles, minSeconds);
+		std::printf("%-14s %12zu %12zu %10.2f %10.2f %10.2f %10.2f\n", difficulty.name, objects.size() * sizeof(ObjectTile),
+			grid.getMemoryUsage(), objectStates, planeStates, objectLooks, planeLooks);
+	}
+
+	/**
+		Places the mines of a huge board and counts its numbers on a pool of input size, over and over for at least
+		input time, prints a row of the table
+
+		@param grid Sized to hugeGenerationBoard
+		@param nThreads
+		@param minSeconds
+		@param serialMilliseconds Time of a whole generation on a single thread (set by the first row)
+	*/
+	void benchmarkGenerationThreads(TileGrid& grid, int nThreads, double minSeconds, double& serialMilliseconds)
+	{
+		ThreadPool pool(nThreads);
+		const int clickedIndex = grid.indexOf(hugeGenerationBoard.width / 2, hugeGenerationBoard.height / 2);
+		int nGenerations = 0;
+		double placeSeconds = 0.0;
+		double countSeconds = 0.0;
+		do {
+			const auto placeStart = std::chrono::steady_clock::now();
+			const std::uint64_t seed = CounterRng::get(boardSeed, std::uint64_t(nGenerations));
+			grid.placeMines(hugeGenerationBoard.nMines, clickedIndex, seed, &pool);
+			placeSeconds += Timing::secondsSince(placeStart);
+			const auto countStart = std::chrono::steady_clock::now();
+			grid.countAdjacentMines(&pool);
+			countSeconds += Timing::secondsSince(countStart);
+			++nGenerations;
+		} while (placeSeconds + countSeconds < minSeconds);
+
+		const double placeMilliseconds = 1e3 * placeSeconds / nGenerations;
+		const double countMilliseconds = 1e3 * countSeconds / nGenerations;
+		if (nThreads == 1) {
+			serialMilliseconds = placeMilliseconds + countMilliseconds;
+		}
+		std::printf("%-14d %10d %10.1f %10.1f %10.1f %10.2f\n", nThreads, nGenerations, placeMilliseconds, countMilliseconds,
+			placeMilliseconds + countMilliseconds, serialMilliseconds / (placeMilliseconds + countMilliseconds));
+	}
+
+	/**
+		Moves the view of a field over a tile and returns where to click it
+
+		@param field
+		@param tile
+		@return globalLocation
+	*/
+	Vei2 showTile(Minefield& field, const Vei2& tile)
+	{
+		const RectI& viewport = field.getCamera().getViewport();
+		field.pan(field.getCamera().toScreen(tile) - Vei2((viewport.left + viewport.right) / 2, (viewport.top + viewport.bottom) / 2));
+		const int halfTile = field.getCamera().getTileScreenSize() / 2;
+		return field.getCamera().toScreen(tile) + Vei2(halfTile, halfTile);
+	}
+
+	/**
+		Clicks the centre of a field, then an empty tile of each of the largest openings left, over and over for at least
+		input time, prints how long the clicks took with the flood fill and with the opening index
+
+		@param difficulty
+		@param minSeconds
+	*/
+	void benchmarkOpeningClicks(const Positions::Difficulty& difficulty, double minSeconds)
+	{
+		// The same mines as the field, to find an empty tile in each of the openings left after the first click
+		const Vei2 clickedTile(difficulty.width / 2, difficulty.height / 2);
+		std::vector<std::pair<int, int>> openings;	// Size and first empty tile of each opening
+		{
+			TileGrid grid(difficulty.width, difficulty.height);
+			grid.placeMines(difficulty.nMines, grid.indexOf(clickedTile.x, clickedTile.y), boardSeed);
+			grid.countAdjacentMines();
+			grid.floodReveal(grid.indexOf(clickedTile.x, clickedTile.y));
+			for (int index = 0; index < grid.getTileCount(); ++index) {
+				if (grid.isRevealable(index) && !grid.hasMine(index) && grid.getAdjacentMineCount(index) == 0) {
+					openings.emplace_back(grid.floodReveal(index), index);
+				}
+			}
+		}
+		const int nLaterClicks = std::min(laterClickCount, int(openings.size()));
+		std::partial_sort(openings.begin(), openings.begin() + nLaterClicks, openings.end(),
+			std::greater<std::pair<int, int>>());
+		std::vector<Vei2> laterTiles;
+		for (int i = 0; i < nLaterClicks; ++i) {
+			laterTiles.emplace_back(openings[i].second % difficulty.width, openings[i].second / difficulty.width);
+		}
+
+		for (bool usesOpeningIndex : { false, true }) {
+			Minefield field(difficulty.width, difficulty.height, difficulty.nMines, boardSeed);
+			field.setUsesOpeningIndex(usesOpeningIndex);
+			int nFirstClicks = 0;
+			double firstSeconds = 0.0;
+			std::vector<double> latencies;
+			const auto start = std::chrono::steady_clock::now();
+			do {
+				field.restart();
+				const Vei2 firstLocation = showTile(field, clickedTile);
+				const auto firstStart = std::chrono::steady_clock::now();
+				field.revealTileAtLocation(firstLocation);
+				firstSeconds += Timing::secondsSince(firstStart);
+				++nFirstClicks;
+				for (const Vei2& tile : laterTiles) {
+					const Vei2 location = showTile(field, tile);
+					const auto clickStart = std::chrono::steady_clock::now();
+					field.revealTileAtLocation(location);
+					latencies.push_back(1e6 * Timing::secondsSince(clickStart));
+				}
+			} while (Timing::secondsSince(start) < minSeconds);
+
+			std::sort(latencies.begin(), latencies.end());
+			double total = 0.0;
+			for (double latency : latencies) {
+				total += latency;
+			}
+			std::printf("%-14s %-8s %12.1f %10d %10d", difficulty.name, usesOpeningIndex ? "index" : "flood",
+				1e3 * firstSeconds / nFirstClicks, field.getRevealedCounter(), int(laterTiles.size()));
+			if (latencies.empty()) {
+				std::printf(" %10s %10s\n", "-", "-");
+			}
+			else {
+				std::printf(" %10.1f %10.1f\n", total / latencies.size(), Timing::percentile(latencies, 0.99));
+			}
+		}
+	}
+
+	/**
+		Times of the phases of the games played by a field, summed over the games
+	*/
+	struct GameTimes {
+		double firstClickSeconds = 0.0;
+		double revealSeconds = 0.0;
+		double chordSeconds = 0.0;
+		long long nGames = 0;
+		long long nReveals = 0;
+		long long nRevealed = 0;	// Tiles revealed by the end of each phase, both fields must reveal as many
+	};
+
+	/**
+		Returns the centre of a tile of a field of fixed size (BasicMinefield centres the field on the screen)
+
+		@param tile
+		@return globalLocation
+	*/
+	template<int W, int H, int Mines>
+	Vei2 getTileCentre(const BasicMinefield<W, H, Mines>&, const Vei2& tile)
+	{
+		constexpr int tileSize = BasicMinefield<W, H, Mines>::tileSize;
+		const Vei2 topLeft((Graphics::ScreenWidth - W * tileSize) / 2, (Graphics::ScreenHeight - H * tileSize) / 2);
+		return topLeft + tile * tileSize + Vei2(tileSize / 2, tileSize / 2);
+	}
+
+	/**
+		Returns the centre of a tile of a field
+
+		@param field
+		@param tile
+		@return globalLocation
+	*/
+	Vei2 getTileCentre(const Minefield& field, const Vei2& tile)
+	{
+		const int halfTile = field.getCamera().getTileScreenSize() / 2;
+		return field.getCamera().toScreen(tile) + Vei2(halfTile, halfTile);
+	}
+
+	template<int W, int H, int Mines>
+	void resetField(BasicMinefield<W, H, Mines>& field, const Positions::Difficulty&, std::uint64_t seed)
+	{
+		field.reset(seed);
+	}
+
+	void resetField(Minefield& field, const Positions::Difficulty& difficulty, std::uint64_t seed)
+	{
+		field.reset(difficulty.width, difficulty.height, difficulty.nMines, seed);
+	}
+
+	/**
+		Plays a game on each board with a field: the first click at the centre (which generates the mines), a click on
+		every other safe tile, then the same board again with every mine flagged after the first click and chorded
+		until no tile can be
+
+		@param field
+		@param difficulty
+		@param safeTiles The safe tiles of each board, but the one clicked first
+		@param mineTiles The mines of each board
+		@param times Receives the times of the games
+	*/
+	template<typename Field>
+	void playGames(Field& field, const Positions::Difficulty& difficulty, const std::vector<std::vector<Vei2>>& safeTiles,
+		const std::vector<std::vector<Vei2>>& mineTiles, GameTimes& times)
+	{
+		std::vector<Vei2> safeLocations;
+		std::vector<Vei2> mineLocations;
+		const Vei2 clickedLocation = getTileCentre(field, Vei2(difficulty.width / 2, difficulty.height / 2));
+		for (int game = 0; game < int(safeTiles.size()); ++game) {
+			resetField(field, difficulty, CounterRng::get(boardSeed, std::uint64_t(game)));
+			safeLocations.clear();
+			for (const Vei2& tile : safeTiles[game]) {
+				safeLocations.push_back(getTileCentre(field, tile));
+			}
+			mineLocations.clear();
+			for (const Vei2& tile : mineTiles[game]) {
+				mineLocations.push_back(getTileCentre(field, tile));
+			}
+
+			auto start = std::chrono::steady_clock::now();
+			field.revealTileAtLocation(clickedLocation);
+			times.firstClickSeconds += Timing::secondsSince(start);
+			start = std::chrono::steady_clock::now();
+			for (const Vei2& location : safeLocations) {
+				field.revealTileAtLocation(location);
+			}
+			times.revealSeconds += Timing::secondsSince(start);
+			times.nReveals += safeLocations.size();
+			times.nRevealed += field.getRevealedCounter();
+
+			field.restart();
+			field.revealTileAtLocation(clickedLocation);
+			for (const Vei2& location : mineLocations) {
+				field.toggleTileFlagAtLocation(location);
+			}
+			start = std::chrono::steady_clock::now();
+			field.chordAll();
+			times.chordSeconds += Timing::secondsSince(start);
+			times.nRevealed += field.getRevealedCounter();
+			++times.nGames;
+		}
+	}
+
+	/**
+		Plays the same games with a field of fixed size and with a Minefield, in turn for at least input time (so both
+		get slowed down alike by the rest of the machine), prints a row of the table
+
+		@param difficulty Has the size of the fixed field
+		@param minSeconds
+	*/
+	template<int W, int H, int Mines>
+	void benchmarkFieldKinds(const Positions::Difficulty& difficulty, double minSeconds)
+	{
+		assert(difficulty.width == W && difficulty.height == H && difficulty.nMines == Mines);
+		std::vector<std::vector<Vei2>> safeTiles(fieldGameCount);
+		std::vector<std::vector<Vei2>> mineTiles(fieldGameCount);
+		TileGrid grid(W, H);
+		const int clickedIndex = grid.indexOf(W / 2, H / 2);
+		for (int game = 0; game < fieldGameCount; ++game) {
+			grid.placeMines(Mines, clickedIndex, CounterRng::get(boardSeed, std::uint64_t(game)));
+			for (int index = 0; index < grid.getTileCount(); ++index) {
+				const Vei2 tile(index % W, index / W);
+				if (grid.hasMine(index)) {
+					mineTiles[game].push_back(tile);
+				}
+				else if (index != clickedIndex) {
+					safeTiles[game].push_back(tile);
+				}
+			}
+		}
+
+		auto pFixedField = std::make_unique<BasicMinefield<W, H, Mines>>();
+		Minefield dynamicField(W, H, Mines, boardSeed);
+		GameTimes fixedTimes;
+		GameTimes dynamicTimes;
+		const auto start = std::chrono::steady_clock::now();
+		do {
+			playGames(*pFixedField, difficulty, safeTiles, mineTiles, fixedTimes);
+			playGames(dynamicField, difficulty, safeTiles, mineTiles, dynamicTimes);
+		} while (Timing::secondsSince(start) < minSeconds);
+
+		if (fixedTimes.nRevealed != dynamicTimes.nRevealed) {
+			std::printf("%-14s the fields played different games\n", difficulty.name);
+			return;
+		}
+		std::printf("%-14s %10.2f %10.2f %10.1f %10.1f %10.2f %10.2f\n", difficulty.name,
+			1e6 * fixedTimes.firstClickSeconds / fixedTimes.nGames, 1e6 * dynamicTimes.firstClickSeconds / dynamicTimes.nGames,
+			1e9 * fixedTimes.revealSeconds / fixedTimes.nReveals, 1e9 * dynamicTimes.revealSeconds / dynamicTimes.nReveals,
+			1e6 * fixedTimes.chordSeconds / fixedTimes.nGames, 1e6 * dynamicTimes.chordSeconds / dynamicTimes.nGames);
+	}
+}
+
+/**
+	Compares the tiles kept as one object each to the bit-packed planes of TileGrid on the standard difficulties and a
+	huge board: the memory they take and the time to scan them
+
+	@param minSeconds Time each scan is run for
+*/
+void BoardBenchmarks::benchmarkTileStorage(double minSeconds)
+{
+	std::printf("Tile storage (bytes, and ns per tile to count the revealed tiles and to read how each tile looks)\n");
+	std::printf("%-14s %25s %21s %21s\n", "", "memory", "revealed count", "looks");
+	std::printf("%-14s %12s %12s %10s %10s %10s %10s\n", "", "Tile[]", "planes", "Tile[]", "planes", "Tile[]", "planes");
+	for (const Positions::Difficulty& difficulty : Positions::standardDifficulties) {
+		benchmarkTileLayouts(difficulty, minSeconds);
+	}
+	benchmarkTileLayouts(hugeBoard, minSeconds);
+}
+
+/**
+	Reveals the opening of the first click on the standard difficulties and on a huge board made of one opening, which
+	a recursive fill could not reveal without overflowing the stack
+
+	@param minSeconds Time each board size is clicked for
+*/
+void BoardBenchmarks::benchmarkFloodFill(double minSeconds)
+{
+	std::printf("Flood fill (first click at the centre)\n");
+	std::printf("%-14s %10s %14s %10s %12s\n", "", "clicks", "tiles/click", "ns/tile", "us/click");
+	for (const Positions::Difficulty& difficulty : Positions::standardDifficulties) {
+		benchmarkFirstClicks(difficulty, firstClickBoardCount, minSeconds);
+	}
+	benchmarkFirstClicks(hugeOpeningBoard, 1, minSeconds);
+}
+
+/**
+	Generates a board of 100M tiles (placeMines() and countAdjacentMines()) on pools of 1 thread up to a thread per
+	core, doubling the threads every step
+
+	@param minSeconds Time each pool generates boards for
+*/
+void BoardBenchmarks::benchmarkGenerationScaling(double minSeconds)
+{
+	const int maxThreads = std::max(1, (int)std::thread::hardware_concurrency());
+	std::vector<int> threadCounts;
+	for (int nThreads = 1; nThreads < maxThreads; nThreads *= 2) {
+		threadCounts.push_back(nThreads);
+	}
+	threadCounts.push_back(maxThreads);
+
+	std::printf("Generation of a %s board with %d mines (time in ms)\n", hugeGenerationBoard.name,
+		hugeGenerationBoard.nMines);
+	std::printf("%-14s %10s %10s %10s %10s %10s\n", "threads", "boards", "place", "count", "total", "speedup");
+	TileGrid grid(hugeGenerationBoard.width, hugeGenerationBoard.height);
+	double serialMilliseconds = 0.0;
+	for (int nThreads : threadCounts) {
+		benchmarkGenerationThreads(grid, nThreads, minSeconds, serialMilliseconds);
+	}
+}
+
+/**
+	Clicks huge fields with the flood fill and with the opening index (Minefield::setUsesOpeningIndex()): the first
+	click, which places the mines (and builds the index), then a click in each of the largest openings left
+
+	@param minSeconds Time each field is clicked for
+*/
+void BoardBenchmarks::benchmarkOpeningIndex(double minSeconds)
+{
+	std::printf("Opening index (first click in ms, the tiles it revealed, later clicks in us)\n");
+	std::printf("%-14s %-8s %12s %10s %10s %10s %10s\n", "", "", "first click", "revealed", "later", "mean", "p99");
+	benchmarkOpeningClicks(hugeBoard, minSeconds);
+	benchmarkOpeningClicks(hugeBeginnerBoard, minSeconds);
+	benchmarkOpeningClicks(hugeOpeningBoard, minSeconds);
+}
+
+/**
+	Plays the same games on the standard difficulties with the fields of fixed size (BasicMinefield) and with Minefield:
+	the first click, which generates the mines, a click on each safe tile, and chords over a fully flagged board
+
+	@param minSeconds Time each difficulty is played for
+*/
+void BoardBenchmarks::benchmarkFixedFields(double minSeconds)
+{
+	std::printf("Fixed against dynamic fields (first click and chords in us per game, reveal in ns per click)\n");
+	std::printf("%-14s %21s %21s %21s\n", "", "first click", "reveal", "chord");
+	std::printf("%-14s %10s %10s %10s %10s %10s %10s\n", "", "fixed", "dynamic", "fixed", "dynamic", "fixed", "dynamic");
+	benchmarkFieldKinds<9, 9, 10>(Positions::standardDifficulties[0], minSeconds);
+	benchmarkFieldKinds<16, 16, 40>(Positions::standardDifficulties[1], minSeconds);
+	benchmarkFieldKinds<30, 16, 99>(Positions::standardDifficulties[2], minSeconds);
+}
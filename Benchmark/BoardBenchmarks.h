@@ -0,0 +1,13 @@
+/**
+	Benchmarks of the storage, generation and reveal of the minefields
+*/
+
+#pragma once
+
+namespace BoardBenchmarks {
+	void benchmarkTileStorage(double minSeconds);
+	void benchmarkFloodFill(double minSeconds);
+	void benchmarkGenerationScaling(double minSeconds);
+	void benchmarkOpeningIndex(double minSeconds);
+	void benchmarkFixedFields(double minSeconds);
+}
@@ -0,0 +1,295 @@
+/**
+	Benchmarks of the board logic, run from the command line: Benchmark [secondsPerBenchmark] [sections]
+
+	sections is a comma separated list of the sections to run (every section by default):
+		tiles			Tile storage, see BoardBenchmarks
+		flood			Flood fill
+		generation		Generation of a 100M tile board on 1 thread up to a thread per core
+		openings		Clicks on huge fields with and without the opening index
+		fields			Games on the fields of fixed size against Minefield
+		sprites			Sprite drawing, see RenderBenchmarks
+		bands			Redraw of a field larger than the screen on 1 thread up to a thread per core
+		solver			Logic solver
+		probabilities	Mine probabilities
+		generator		No-guess generation
+		metrics			Board metrics
+
+	Every benchmark works on boards and positions recorded with fixed seeds, so the numbers of two builds can be
+	compared.
+
+	Benchmark test runs the allocation tests instead (See AllocationTests), the exit code is the amount of failed tests.
+*/
+
+#include "Positions.h"
+#include "BoardBenchmarks.h"
+#include "RenderBenchmarks.h"
+#include "AllocationTests.h"
+#include "Timing.h"
+#include "LogicSolver.h"
+#include "MineProbabilities.h"
+#include "NoGuessGenerator.h"
+#include "MetricsBatch.h"
+#include "CounterRng.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <limits>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+	constexpr int positionsPerDifficulty = 2000;
+	constexpr std::uint64_t positionSeed = 2026;
+	constexpr int metricsBoardCount = 5000;
+
+	/**
+		Solves the positions over and over for at least input time, prints how many positions a second got solved
+
+		@param difficulty
+		@param positions
+		@param minSeconds
+	*/
+	void benchmarkSolver(const Positions::Difficulty& difficulty, const std::vector<VisibleBoard>& positions,
+		double minSeconds)
+	{
+		LogicSolver solver;
+		long long constraints = 0;
+		long long deductions = 0;
+		for (const VisibleBoard& position : positions) {
+			solver.solve(position);
+			constraints += solver.getConstraintCount();
+			deductions += solver.getSafeTiles().size() + solver.getMineTiles().size();
+		}
+
+		long long solved = 0;
+		const auto start = std::chrono::steady_clock::now();
+		double seconds = 0.0;
+		do {
+			for (const VisibleBoard& position : positions) {
+				solver.solve(position);
+			}
+			solved += positions.size();
+			seconds = Timing::secondsSince(start);
+		} while (seconds < minSeconds);
+
+		std::printf("%-14s %12.0f %10.2f %12.1f %12.1f\n", difficulty.name, solved / seconds, 1e6 * seconds / solved,
+			double(constraints) / positions.size(), double(deductions) / positions.size());
+	}
+
+	/**
+		Computes the probabilities of every position, timing each one, for at least input time, prints the latency
+		percentiles and the largest components met
+
+		@param difficulty
+		@param positions
+		@param minSeconds
+		@param pool
+	*/
+	void benchmarkProbabilities(const Positions::Difficulty& difficulty, const std::vector<VisibleBoard>& positions,
+		double minSeconds, ThreadPool& pool)
+	{
+		MineProbabilities probabilities;
+		std::vector<double> latencies;
+		int largestComponent = 0;
+		int mostStates = 0;
+		const auto start = std::chrono::steady_clock::now();
+		do {
+			for (const VisibleBoard& position : positions) {
+				const auto computeStart = std::chrono::steady_clock::now();
+				probabilities.compute(position, &pool);
+				latencies.push_back(1e6 * Timing::secondsSince(computeStart));
+				largestComponent = std::max(largestComponent, probabilities.getLargestComponentSize());
+				mostStates = std::max(mostStates, probabilities.getStateCount());
+			}
+		} while (Timing::secondsSince(start) < minSeconds);
+
+		std::sort(latencies.begin(), latencies.end());
+		double total = 0.0;
+		for (double latency : latencies) {
+			total += latency;
+		}
+		std::printf("%-14s %10.1f %10.1f %10.1f %10.1f %10d %10d\n", difficulty.name, total / latencies.size(),
+			Timing::percentile(latencies, 0.5), Timing::percentile(latencies, 0.99), latencies.back(), largestComponent,
+			mostStates);
+	}
+
+	/**
+		Generates fields without guesses, clicked at the centre, for at least input time, prints the generation time
+		percentiles and how often a field needed another candidate or a repair
+
+		@param label
+		@param difficulty
+		@param minSeconds
+		@param pool
+		@param minBbbv Band of 3BV of the fields
+		@param maxBbbv
+	*/
+	void benchmarkGenerator(const char* label, const Positions::Difficulty& difficulty, double minSeconds,
+		ThreadPool& pool, int minBbbv = 0, int maxBbbv = std::numeric_limits<int>::max())
+	{
+		NoGuessGenerator generator(&pool);
+		generator.setBbbvBand(minBbbv, maxBbbv);
+		const int clickedIndex = difficulty.height / 2 * difficulty.width + difficulty.width / 2;
+		std::vector<double> latencies;
+		int nNoGuess = 0;
+		long long candidates = 0;
+		long long repairs = 0;
+		const auto start = std::chrono::steady_clock::now();
+		do {
+			const std::uint64_t seed = CounterRng::get(positionSeed, latencies.size());
+			const auto generateStart = std::chrono::steady_clock::now();
+			nNoGuess += generator.generate(difficulty.width, difficulty.height, difficulty.nMines, clickedIndex, seed);
+			latencies.push_back(1e3 * Timing::secondsSince(generateStart));
+			candidates += generator.getCandidateCount();
+			repairs += generator.getRepairCount();
+		} while (Timing::secondsSince(start) < minSeconds);
+
+		std::sort(latencies.begin(), latencies.end());
+		const double nFields = double(latencies.size());
+		std::printf("%-20s %8.2f %8.2f %8.2f %8.2f %9.1f%% %10.2f %10.2f\n", label, Timing::percentile(latencies, 0.5),
+			Timing::percentile(latencies, 0.9), Timing::percentile(latencies, 0.99), latencies.back(), 100.0 * nNoGuess / nFields, candidates / nFields,
+			repairs / nFields);
+	}
+
+	/**
+		Computes the metrics of a batch of random boards, clicked at the centre, over and over for at least input time,
+		on the calling thread and on the pool, prints how many boards a second got measured and their mean metrics
+
+		@param difficulty
+		@param minSeconds
+		@param pool
+	*/
+	void benchmarkMetrics(const Positions::Difficulty& difficulty, double minSeconds, ThreadPool& pool)
+	{
+		std::vector<TileGrid> grids(metricsBoardCount);
+		const int clickedIndex = difficulty.height / 2 * difficulty.width + difficulty.width / 2;
+		for (int i = 0; i < metricsBoardCount; ++i) {
+			grids[i].resize(difficulty.width, difficulty.height);
+			grids[i].placeMines(difficulty.nMines, clickedIndex, CounterRng::get(positionSeed, std::uint64_t(i)));
+			grids[i].countAdjacentMines();
+		}
+
+		std::vector<BoardMetrics::Metrics> metrics;
+		auto measure = [&grids, &metrics, minSeconds](MetricsBatch& batch) {
+			long long measured = 0;
+			const auto start = std::chrono::steady_clock::now();
+			double seconds = 0.0;
+			do {
+				batch.compute(grids, metrics);
+				measured += grids.size();
+				seconds = Timing::secondsSince(start);
+			} while (seconds < minSeconds);
+			return measured / seconds;
+		};
+		MetricsBatch serialBatch;
+		MetricsBatch poolBatch(&pool);
+		const double serialRate = measure(serialBatch);
+		const double poolRate = measure(poolBatch);
+
+		double bbbv = 0.0;
+		double openings = 0.0;
+		double isolatedNumbers = 0.0;
+		double zini = 0.0;
+		for (const BoardMetrics::Metrics& board : metrics) {
+			bbbv += board.bbbv;
+			openings += board.openings;
+			isolatedNumbers += board.isolatedNumbers;
+			zini += board.zini;
+		}
+		std::printf("%-14s %12.0f %12.0f %8.1f %8.1f %8.1f %8.1f\n", difficulty.name, serialRate, poolRate,
+			bbbv / metrics.size(), openings / metrics.size(), isolatedNumbers / metrics.size(), zini / metrics.size());
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc > 1 && std::strcmp(argv[1], "test") == 0) {
+		return AllocationTests::runAll();
+	}
+
+	const double secondsPerBenchmark = argc > 1 ? std::atof(argv[1]) : 1.0;
+	const char* sections = argc > 2 ? argv[2] : nullptr;
+	auto runs = [sections](const char* section) {
+		return sections == nullptr || std::strstr(sections, section) != nullptr;
+	};
+	ThreadPool pool;
+	std::vector<VisibleBoard> positions;
+
+	if (runs("tiles")) {
+		BoardBenchmarks::benchmarkTileStorage(secondsPerBenchmark);
+		std::printf("\n");
+	}
+
+	if (runs("flood")) {
+		BoardBenchmarks::benchmarkFloodFill(secondsPerBenchmark);
+		std::printf("\n");
+	}
+
+	if (runs("generation")) {
+		BoardBenchmarks::benchmarkGenerationScaling(secondsPerBenchmark);
+		std::printf("\n");
+	}
+
+	if (runs("openings")) {
+		BoardBenchmarks::benchmarkOpeningIndex(secondsPerBenchmark);
+		std::printf("\n");
+	}
+
+	if (runs("fields")) {
+		BoardBenchmarks::benchmarkFixedFields(secondsPerBenchmark);
+		std::printf("\n");
+	}
+
+	if (runs("sprites")) {
+		RenderBenchmarks::benchmarkSprites(secondsPerBenchmark);
+		std::printf("\n");
+	}
+
+	if (runs("bands")) {
+		RenderBenchmarks::benchmarkBandScaling(secondsPerBenchmark);
+		std::printf("\n");
+	}
+
+	if (runs("solver")) {
+		std::printf("Logic solver (%d positions per difficulty)\n", positionsPerDifficulty);
+		std::printf("%-14s %12s %10s %12s %12s\n", "", "positions/s", "us/pos", "constraints", "deductions");
+		for (const Positions::Difficulty& difficulty : Positions::standardDifficulties) {
+			Positions::collect(difficulty, positionsPerDifficulty, positionSeed, positions);
+			benchmarkSolver(difficulty, positions, secondsPerBenchmark);
+		}
+		std::printf("\n");
+	}
+
+	if (runs("probabilities")) {
+		std::printf("Mine probabilities (%d threads, latency in us)\n", pool.getThreadCount());
+		std::printf("%-14s %10s %10s %10s %10s %10s %10s\n", "", "mean", "p50", "p99", "max", "component", "states");
+		for (const Positions::Difficulty& difficulty : Positions::standardDifficulties) {
+			Positions::collect(difficulty, positionsPerDifficulty, positionSeed, positions);
+			benchmarkProbabilities(difficulty, positions, secondsPerBenchmark, pool);
+		}
+		std::printf("\n");
+	}
+
+	if (runs("generator")) {
+		std::printf("No-guess generation (%d threads, time in ms)\n", pool.getThreadCount());
+		std::printf("%-20s %8s %8s %8s %8s %10s %10s %10s\n", "", "p50", "p90", "p99", "max", "no-guess", "candidates",
+			"repairs");
+		for (const Positions::Difficulty& difficulty : Positions::standardDifficulties) {
+			benchmarkGenerator(difficulty.name, difficulty, secondsPerBenchmark, pool);
+		}
+		benchmarkGenerator("Expert 3BV 120-150", Positions::standardDifficulties[2], secondsPerBenchmark, pool, 120, 150);
+		std::printf("\n");
+	}
+
+	if (runs("metrics")) {
+		std::printf("Board metrics (%d boards per difficulty)\n", metricsBoardCount);
+		std::printf("%-14s %12s %12s %8s %8s %8s %8s\n", "", "boards/s", "pool", "3BV", "openings", "isolated", "ZiNi");
+		for (const Positions::Difficulty& difficulty : Positions::standardDifficulties) {
+			benchmarkMetrics(difficulty, secondsPerBenchmark, pool);
+		}
+		std::printf("\n");
+	}
+	return 0;
+}
@@ -0,0 +1,65 @@
+#include "Positions.h"
+#include "TileGrid.h"
+#include "LogicSolver.h"
+#include "CounterRng.h"
+#include <assert.h>
+
+/**
+	Plays games until input amount of positions were recorded
+
+	@param difficulty
+	@param count Positions to record
+	@param seed Seed of the mines and of the guesses (the same seed records the same positions)
+	@param positions Filled with the positions (cleared first)
+*/
+void Positions::collect(const Difficulty& difficulty, int count, std::uint64_t seed, std::vector<VisibleBoard>& positions)
+{
+	positions.clear();
+	TileGrid grid(difficulty.width, difficulty.height);
+	VisibleBoard board;
+	LogicSolver solver;
+	std::uint64_t randomCounter = 0;
+	for (std::uint64_t game = 0; (int)positions.size() < count; ++game) {
+		grid.clear();
+		const int firstIndex = grid.indexOf(difficulty.width / 2, difficulty.height / 2);
+		grid.placeMines(difficulty.nMines, firstIndex, CounterRng::get(seed, game));
+		grid.countAdjacentMines();
+		int revealed = grid.floodReveal(firstIndex);
+
+		const int nonMineTiles = grid.getTileCount() - difficulty.nMines;
+		while (revealed < nonMineTiles && (int)positions.size() < count) {
+			board.read(grid, difficulty.nMines);
+			positions.push_back(board);
+			solver.solve(board, true);	// The flags were all placed by the solver
+			for (int index : solver.getMineTiles()) {
+				grid.setState(index, TileGrid::State::Flagged);
+			}
+			for (int index : solver.getSafeTiles()) {
+				if (grid.isRevealable(index)) {
+					revealed += grid.floodReveal(index);
+				}
+			}
+			if (!solver.getSafeTiles().empty()) {
+				continue;
+			}
+
+			// Stuck: guess one of the undecided hidden tiles
+			int nUndecided = 0;
+			for (int index = 0; index < grid.getTileCount(); ++index) {
+				nUndecided += grid.getState(index) == TileGrid::State::Hidden;
+			}
+			assert(nUndecided > 0);
+			int guess = (int)CounterRng::getBelow(seed ^ 0x5EED, randomCounter++, std::uint32_t(nUndecided));
+			int index = 0;
+			for (;; ++index) {
+				if (grid.getState(index) == TileGrid::State::Hidden && guess-- == 0) {
+					break;
+				}
+			}
+			if (grid.hasMine(index)) {
+				break;
+			}
+			revealed += grid.floodReveal(index);
+		}
+	}
+}
@@ -0,0 +1,32 @@
+/**
+	Positions of real games for the benchmarks, recorded while the logic solver plays them
+
+	Each game opens at the centre of the board, then reveals every tile the solver proves safe and flags every tile it
+	proves to be a mine, and guesses a random undecided tile when the solver is stuck, until the game is won or lost.
+	The board is recorded before every move, so the positions cover the whole course of a game.
+*/
+
+#pragma once
+#include "VisibleBoard.h"
+#include <vector>
+#include <cstdint>
+
+namespace Positions {
+	/**
+		Size and amount of mines of a board
+	*/
+	struct Difficulty {
+		const char* name;
+		int width;
+		int height;
+		int nMines;
+	};
+
+	constexpr Difficulty standardDifficulties[] = {
+		{ "Beginner", 9, 9, 10 },
+		{ "Intermediate", 16, 16, 40 },
+		{ "Expert", 30, 16, 99 }
+	};
+
+	void collect(const Difficulty& difficulty, int count, std::uint64_t seed, std::vector<VisibleBoard>& positions);
+}
@@ -0,0 +1,300 @@
+#include "RenderBenchmarks.h"
+#include "Positions.h"
+#include "Timing.h"
+#include "Graphics.h"
+#include "MemoryBackend.h"
+#include "SpriteCodex.h"
+#include "SpriteAtlas.h"
+#include "TileGrid.h"
+#include "Minefield.h"
+#include "Camera.h"
+#include "ThreadPool.h"
+#include "Vei2.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+	constexpr std::uint64_t boardSeed = 2026;
+	constexpr int tileRowCount = 16;	// The buttons and numbers drawn alone cover an Expert board (30 x 16)
+	constexpr int tileColumnCount = 30;
+	const Vei2 boardTopLeft = { (Graphics::ScreenWidth - tileColumnCount * SpriteCodex::tileSize) / 2, 100 };
+	constexpr int lossOverlayOffset = tileRowCount * SpriteCodex::tileSize / 2 + 10;	// As Game draws it under a board
+	constexpr int bandBoardSide = 1024;	// Board redrawn in bands, larger than the screen at every zoom benchmarked
+	constexpr int bandBoardMines = 216000;	// Mine density of Expert
+	constexpr int bandZooms[] = { Camera::nativeZoom, 2, 0 };	// 16, 4 and 1 pixels per tile
+
+	/**
+		Sprite drawn at a position of the screen
+	*/
+	struct DrawnSprite {
+		SpriteAtlas::Id id;
+		Vei2 position;
+	};
+
+	/**
+		Draws a sprite through the SpriteCodex entry point which draws it (span by span)
+
+		@param sprite
+		@param gfx
+	*/
+	void drawWithCodex(const DrawnSprite& sprite, Graphics& gfx)
+	{
+		switch (sprite.id) {
+		case SpriteAtlas::Id::TileButton: SpriteCodex::drawTileButton(sprite.position, gfx); break;
+		case SpriteAtlas::Id::TileCross: SpriteCodex::drawTileCross(sprite.position, gfx); break;
+		case SpriteAtlas::Id::TileFlag: SpriteCodex::drawTileFlag(sprite.position, gfx); break;
+		case SpriteAtlas::Id::TileMine: SpriteCodex::drawTileMine(sprite.position, gfx); break;
+		case SpriteAtlas::Id::TileMineRed: SpriteCodex::drawTileMineRed(sprite.position, gfx); break;
+		case SpriteAtlas::Id::GameLoss: SpriteCodex::drawGameLoss(gfx, sprite.position.y - Graphics::ScreenHeight / 2); break;
+		case SpriteAtlas::Id::GameWin: SpriteCodex::drawGameWin(gfx, sprite.position.y - Graphics::ScreenHeight / 2); break;
+		default: SpriteCodex::drawTileNumber(int(sprite.id) - int(SpriteAtlas::Id::Tile0), sprite.position, gfx); break;
+		}
+	}
+
+	/**
+		Draws a sprite with a Graphics::PutPixel() call per pixel, as the sprites were drawn before the SpriteAtlas
+
+		@param sprite
+		@param gfx
+	*/
+	void drawPerPixel(const DrawnSprite& sprite, Graphics& gfx)
+	{
+		const SpriteAtlas::Sprite& atlasSprite = SpriteAtlas::getSprite(sprite.id);
+		const SpriteAtlas::Span* spans = SpriteAtlas::getSpans() + atlasSprite.firstSpan;
+		const Color* pixels = SpriteAtlas::getPixels();
+		for (int i = 0; i < atlasSprite.nSpans; ++i) {
+			for (int pixel = 0; pixel < spans[i].length; ++pixel) {
+				gfx.PutPixel(sprite.position.x + spans[i].x + pixel, sprite.position.y + spans[i].y,
+					pixels[spans[i].firstPixel + pixel]);
+			}
+		}
+	}
+
+	/**
+		Returns where a banner drawn by SpriteCodex::drawGameLoss() or drawGameWin() goes
+
+		@param id
+		@param yOffset
+		@return sprite
+	*/
+	DrawnSprite getBanner(SpriteAtlas::Id id, int yOffset)
+	{
+		return { id, Vei2((Graphics::ScreenWidth - SpriteAtlas::getSprite(id).width) / 2, Graphics::ScreenHeight / 2 + yOffset) };
+	}
+
+	/**
+		Returns the sprites of a lost Expert board, as a full redraw of the board draws them, followed by the loss overlay
+
+		@return sprites
+	*/
+	std::vector<DrawnSprite> getLostBoardSprites()
+	{
+		const Positions::Difficulty& expert = Positions::standardDifficulties[2];
+		TileGrid grid(expert.width, expert.height);
+		const int clickedIndex = grid.indexOf(expert.width / 2, expert.height / 2);
+		grid.placeMines(expert.nMines, clickedIndex, boardSeed);
+		grid.countAdjacentMines();
+		grid.floodReveal(clickedIndex);
+		int explodedIndex = -1;
+		for (int index = 0; index < grid.getTileCount(); ++index) {
+			if (grid.getState(index) == TileGrid::State::Hidden && grid.hasMine(index) == (explodedIndex < 0) && index % 3 == 0) {
+				if (grid.hasMine(index)) {
+					explodedIndex = index;
+				}
+				grid.setState(index, TileGrid::State::Revealed);
+			}
+			else if (grid.getState(index) == TileGrid::State::Hidden && index % 7 == 0) {
+				grid.setState(index, TileGrid::State::Flagged);
+			}
+		}
+
+		std::vector<DrawnSprite> sprites;
+		for (int index = 0; index < grid.getTileCount(); ++index) {
+			const Vei2 position = boardTopLeft + Vei2(index % expert.width, index / expert.width) * SpriteCodex::tileSize;
+			switch (grid.getState(index)) {
+			case TileGrid::State::Revealed:
+				sprites.push_back({ index == explodedIndex ? SpriteAtlas::Id::TileMineRed :
+					SpriteAtlas::Id(int(SpriteAtlas::Id::Tile0) + grid.getAdjacentMineCount(index)), position });
+				break;
+			case TileGrid::State::Flagged:
+				sprites.push_back({ SpriteAtlas::Id::TileButton, position });
+				sprites.push_back({ SpriteAtlas::Id::TileFlag, position });
+				if (!grid.hasMine(index)) {
+					sprites.push_back({ SpriteAtlas::Id::TileCross, position });
+				}
+				break;
+			default:
+				sprites.push_back({ grid.hasMine(index) ? SpriteAtlas::Id::TileMine : SpriteAtlas::Id::TileButton, position });
+				break;
+			}
+		}
+		sprites.push_back(getBanner(SpriteAtlas::Id::GameLoss, lossOverlayOffset));
+		return sprites;
+	}
+
+	/**
+		Returns the sprites of an Expert board covered by a single kind of tile
+
+		@param id
+		@return sprites
+	*/
+	std::vector<DrawnSprite> getTileSprites(SpriteAtlas::Id id)
+	{
+		std::vector<DrawnSprite> sprites;
+		for (int index = 0; index < tileRowCount * tileColumnCount; ++index) {
+			sprites.push_back({ id, boardTopLeft + Vei2(index % tileColumnCount, index / tileColumnCount) * SpriteCodex::tileSize });
+		}
+		return sprites;
+	}
+
+	/**
+		Starts a frame and draws sprites, returns how long it took
+
+		@param gfx
+		@param sprites
+		@param drawSprite Called as drawSprite(sprite, gfx)
+		@return microseconds
+	*/
+	template<typename DrawSprite>
+	double timeFrame(Graphics& gfx, const std::vector<DrawnSprite>& sprites, DrawSprite drawSprite)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		gfx.BeginFrame();
+		for (const DrawnSprite& sprite : sprites) {
+			drawSprite(sprite, gfx);
+		}
+		return 1e6 * Timing::secondsSince(start);
+	}
+
+	/**
+		Draws sprites per pixel and span by span, a frame of each in turn for at least input time (so both get slowed
+		down alike by the rest of the machine), checks that both draw the same frame, prints the median time of a frame
+		of each
+
+		@param name
+		@param sprites
+		@param minSeconds
+	*/
+	void benchmarkScene(const char* name, const std::vector<DrawnSprite>& sprites, double minSeconds)
+	{
+		auto pPixelBackend = std::make_unique<MemoryBackend>();
+		auto pSpanBackend = std::make_unique<MemoryBackend>();
+		const MemoryBackend& pixelBackend = *pPixelBackend;
+		const MemoryBackend& spanBackend = *pSpanBackend;
+		Graphics pixelGfx(std::move(pPixelBackend));
+		Graphics spanGfx(std::move(pSpanBackend));
+		std::vector<double> pixelLatencies;
+		std::vector<double> spanLatencies;
+		const auto start = std::chrono::steady_clock::now();
+		do {
+			pixelLatencies.push_back(timeFrame(pixelGfx, sprites, drawPerPixel));
+			spanLatencies.push_back(timeFrame(spanGfx, sprites, drawWithCodex));
+		} while (Timing::secondsSince(start) < minSeconds);
+		pixelGfx.EndFrame();
+		spanGfx.EndFrame();
+
+		const Surface& pixelFrame = pixelBackend.getFrame();
+		const Surface& spanFrame = spanBackend.getFrame();
+		if (std::memcmp(pixelFrame.getPixels(), spanFrame.getPixels(),
+			sizeof(Color) * pixelFrame.getWidth() * pixelFrame.getHeight()) != 0) {
+			std::printf("%-20s the paths draw different frames\n", name);
+			return;
+		}
+		std::sort(pixelLatencies.begin(), pixelLatencies.end());
+		std::sort(spanLatencies.begin(), spanLatencies.end());
+		const double pixelMicroseconds = Timing::percentile(pixelLatencies, 0.5);
+		const double spanMicroseconds = Timing::percentile(spanLatencies, 0.5);
+		std::printf("%-20s %10zu %12.2f %12.2f %10.2f\n", name, sprites.size(), pixelMicroseconds, spanMicroseconds,
+			pixelMicroseconds / spanMicroseconds);
+	}
+
+	/**
+		Redraws the whole view of a field (panned by a tile back and forth, so every tile is drawn) on the calling
+		thread or in bands on a pool, for at least input time, prints a row of the table
+
+		@param field Clicked, zoomed to the zoom of the row
+		@param gfx
+		@param pool Threads drawing the bands (nullptr to draw on the calling thread)
+		@param minSeconds
+		@param serialMicroseconds Time of a frame drawn on the calling thread (set by the first row of the zoom)
+	*/
+	void benchmarkBandThreads(Minefield& field, Graphics& gfx, ThreadPool* pool, double minSeconds,
+		double& serialMicroseconds)
+	{
+		const Vei2 step(field.getCamera().getTileScreenSize(), 0);
+		std::vector<double> latencies;
+		const auto start = std::chrono::steady_clock::now();
+		do {
+			field.pan(latencies.size() % 2 == 0 ? step : Vei2(0, 0) - step);
+			const auto frameStart = std::chrono::steady_clock::now();
+			gfx.BeginFrame();
+			field.draw(gfx, pool);
+			latencies.push_back(1e6 * Timing::secondsSince(frameStart));
+		} while (Timing::secondsSince(start) < minSeconds);
+		gfx.EndFrame();
+
+		std::sort(latencies.begin(), latencies.end());
+		const double microseconds = Timing::percentile(latencies, 0.5);
+		if (!pool) {
+			serialMicroseconds = microseconds;
+		}
+		char threads[16];
+		std::snprintf(threads, sizeof(threads), "%d", pool ? pool->getThreadCount() : 0);
+		std::printf("%10d %-14s %12.1f %10.2f\n", field.getCamera().getTileScreenSize(), pool ? threads : "game thread",
+			microseconds, serialMicroseconds / microseconds);
+	}
+}
+
+/**
+	Draws the sprites of typical frames with a PutPixel() call per pixel and span by span (SpriteCodex)
+
+	@param minSeconds Time each frame is drawn for with each path
+*/
+void RenderBenchmarks::benchmarkSprites(double minSeconds)
+{
+	std::printf("Sprites (median us per frame)\n");
+	std::printf("%-20s %10s %12s %12s %10s\n", "", "sprites", "per pixel", "spans", "speedup");
+	benchmarkScene("Lost Expert board", getLostBoardSprites(), minSeconds);
+	benchmarkScene("Loss overlay", { getBanner(SpriteAtlas::Id::GameLoss, lossOverlayOffset) }, minSeconds);
+	benchmarkScene("Win overlay", { getBanner(SpriteAtlas::Id::GameWin, lossOverlayOffset) }, minSeconds);
+	benchmarkScene("480 buttons", getTileSprites(SpriteAtlas::Id::TileButton), minSeconds);
+	benchmarkScene("480 flags", getTileSprites(SpriteAtlas::Id::TileFlag), minSeconds);
+	benchmarkScene("480 threes", getTileSprites(SpriteAtlas::Id::Tile3), minSeconds);
+}
+
+/**
+	Redraws every tile of a field larger than the screen, at several zooms, on the calling thread and in bands on pools
+	of 1 thread up to a thread per core, doubling the threads every step (See BoardLayer)
+
+	@param minSeconds Time each zoom is drawn for on each pool
+*/
+void RenderBenchmarks::benchmarkBandScaling(double minSeconds)
+{
+	const int maxThreads = std::max(1, (int)std::thread::hardware_concurrency());
+	std::vector<std::unique_ptr<ThreadPool>> pools;
+	for (int nThreads = 1; nThreads < maxThreads; nThreads *= 2) {
+		pools.push_back(std::make_unique<ThreadPool>(nThreads));
+	}
+	pools.push_back(std::make_unique<ThreadPool>(maxThreads));
+
+	std::printf("Banded redraw of a %dx%d field (median us per frame)\n", bandBoardSide, bandBoardSide);
+	std::printf("%10s %-14s %12s %10s\n", "px/tile", "threads", "frame", "speedup");
+	Graphics gfx(std::make_unique<MemoryBackend>());
+	Minefield field(bandBoardSide, bandBoardSide, bandBoardMines, boardSeed);
+	const RectI& viewport = field.getCamera().getViewport();
+	const Vei2 centre((viewport.left + viewport.right) / 2, (viewport.top + viewport.bottom) / 2);
+	field.revealTileAtLocation(centre);
+	for (int zoom : bandZooms) {
+		field.zoomAt(zoom - field.getCamera().getZoom(), centre);
+		double serialMicroseconds = 0.0;
+		benchmarkBandThreads(field, gfx, nullptr, minSeconds, serialMicroseconds);
+		for (const std::unique_ptr<ThreadPool>& pool : pools) {
+			benchmarkBandThreads(field, gfx, pool.get(), minSeconds, serialMicroseconds);
+		}
+	}
+}
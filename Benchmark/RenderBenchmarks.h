@@ -0,0 +1,10 @@
+/**
+	Benchmarks of the drawing of the sprites and of the minefield
+*/
+
+#pragma once
+
+namespace RenderBenchmarks {
+	void benchmarkSprites(double minSeconds);
+	void benchmarkBandScaling(double minSeconds);
+}
@@ -0,0 +1,34 @@
+/**
+	Timing helpers shared by the benchmarks
+*/
+
+#pragma once
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+namespace Timing {
+	/**
+		Returns the seconds passed since input time
+
+		@param start
+		@return seconds
+	*/
+	inline double secondsSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	/**
+		Returns the value below which input fraction of the values are
+
+		@param sorted Values sorted in increasing order (not empty)
+		@param fraction
+		@return value
+	*/
+	inline double percentile(const std::vector<double>& sorted, double fraction)
+	{
+		return sorted[std::min(sorted.size() - 1, std::size_t(fraction * sorted.size()))];
+	}
+}
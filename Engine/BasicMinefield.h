@@ -0,0 +1,812 @@
+/**
+	Minefield with its size and amount of mines fixed at compile time (Used for the standard difficulties)
+
+	Plays exactly like Minefield (the same seed and first click give the same field), but keeps every tile inline
+	in a std::array instead of on the heap. The tiles are stored with a 1 tile border around the field: border tiles
+	count as revealed, so a flood fill or a chord never needs a bounds check and the 8 neighbours of any tile are
+	at fixed offsets, taken from a constexpr table.
+*/
+
+#pragma once
+
+#include "Graphics.h"
+#include "Vei2.h"
+#include "RectI.h"
+#include "DigitalDisplay.h"
+#include "SpriteCodex.h"
+#include "TileGrid.h"
+#include "MinePlacement.h"
+#include "BoardLayer.h"
+#include "DirtyTiles.h"
+#include "VisibleBoard.h"
+#include "NoGuessGenerator.h"
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <assert.h>
+
+template<int W, int H, int Mines>
+class BasicMinefield {
+public:
+	BasicMinefield();
+	BasicMinefield(std::uint64_t seedIn);
+
+	void partiallyRevealTileAtLocation(const Vei2& globalLocation);
+	void revealTileAtLocation(const Vei2& globalLocation);
+	void revealSurroundingTilesOrFlagTileAtLocation(const Vei2& globalLocation);
+	void toggleTileFlagAtLocation(const Vei2& globalLocation);
+	void hidePartiallyRevealedTile();
+	void flagRemainingTiles();
+	int chordAll();
+	void restart();
+	void reset(std::uint64_t seedIn);
+	void setNoGuessGenerator(NoGuessGenerator* noGuessGeneratorIn);
+
+	void draw(Graphics& gfx);
+	bool revealedAll() const;
+	bool tileExistsAtLocation(const Vei2& globalLocation) const;
+	bool tileAtLocationIsPartiallyRevealed(const Vei2& globalLocation) const;
+	bool tileAtLocationIsSatisfied(const Vei2& globalLocation) const;
+	bool tileAtLocationCanBeChorded(const Vei2& globalLocation) const;
+	int getRevealedCounter() const;
+	void readVisibleBoard(VisibleBoard& board) const;
+	int getWidth() const;
+	int getHeight() const;
+	std::uint64_t getSeed() const;
+	const BoardLayer& getBoardLayer() const;
+	static bool hasSize(int widthIn, int heightIn, int nMinesIn);
+
+	bool isExploded = false;
+	static constexpr int displayOffset = 5;
+	static constexpr int tileSize = SpriteCodex::tileSize;
+
+private:
+	using State = TileGrid::State;
+
+	static constexpr int stride = W + 2;	// Tiles per stored row (the field plus the border on both sides)
+	static constexpr int tileCount = W * H;
+	static constexpr int storedTileCount = stride * (H + 2);
+	static constexpr int noTile = -1;
+
+	// Layout of a stored tile
+	static constexpr std::uint8_t countMask = 0x0F;	// Adjacent mine count
+	static constexpr int stateShift = 4;	// 2 bits of state
+	static constexpr std::uint8_t stateMask = 0x30;
+	static constexpr std::uint8_t mineBit = 0x40;
+	static constexpr std::uint8_t borderBit = 0x80;
+
+	// Steps of a neighbour count (the flagged neighbours are kept in the low 4 bits, the hidden ones in the high 4 bits)
+	static constexpr std::uint8_t flaggedNeighbour = 0x01;
+	static constexpr std::uint8_t hiddenNeighbour = 0x10;
+
+	static constexpr int neighbourOffsets[8] = {
+		-stride - 1, -stride, -stride + 1,
+		-1, 1,
+		stride - 1, stride, stride + 1
+	};
+
+	/**
+		Stored tiles and neighbour counts of a field without mines where every tile is hidden, built at compile time
+	*/
+	struct EmptyField {
+		constexpr EmptyField()
+			:
+			tiles(),
+			neighbours()
+		{
+			for (int tile = 0; tile < storedTileCount; ++tile) {
+				const int x = tile % stride;
+				const int y = tile / stride;
+				const bool isBorder = x == 0 || x == stride - 1 || y == 0 || y == H + 1;
+				tiles[tile] = isBorder ? std::uint8_t(borderBit | (int(State::Revealed) << stateShift)) : std::uint8_t(0);
+			}
+			for (int tile = 0; tile < storedTileCount; ++tile) {
+				if ((tiles[tile] & borderBit) == 0) {
+					for (int i = 0; i < 8; ++i) {
+						neighbours[tile] += (tiles[tile + neighbourOffsets[i]] & borderBit) == 0 ? hiddenNeighbour : 0;
+					}
+				}
+			}
+		}
+		std::uint8_t tiles[storedTileCount];
+		std::uint8_t neighbours[storedTileCount];
+	};
+	static const EmptyField emptyField;
+
+	static_assert(Mines > 0 && Mines < tileCount, "A minefield needs at least one mine and one safe tile");
+	static_assert(Graphics::ScreenWidth >= tileSize * W && Graphics::ScreenHeight >= tileSize * H, "The minefield must fit on the screen");
+
+private:
+	int getTileAtLocation(const Vei2& globalLocation) const;
+	Vei2 getTilePosition(int tile) const;
+	void drawTile(Graphics& gfx, int tile) const;
+
+	State getState(int tile) const;
+	void setState(int tile, State stateIn);
+	bool isRevealable(int tile) const;
+	bool hasMine(int tile) const;
+	int getAdjacentMineCount(int tile) const;
+
+	void updateDisplay();
+	void generateMines(int clickedTile);
+	void revealTile(int tile);
+	int floodReveal(int tile);
+	bool revealSurroundingTiles(int tile);
+	bool isSatisfied(int tile) const;
+	bool canChord(int tile) const;
+
+private:
+	std::array<std::uint8_t, storedTileCount> tiles;
+	std::array<std::uint8_t, storedTileCount> neighbours;	// Flagged and hidden neighbours of every tile
+	std::array<int, tileCount> candidates;	// Shuffled positions used by generateMines()
+	std::array<int, tileCount> fillStack;	// Tiles still to be expanded by floodReveal() (a tile is pushed at most once)
+	bool minesAreGenerated = false;
+	int partiallyRevealedTile = noTile;
+	int revealedCounter = 0;
+	int flaggedCount = 0;
+	std::uint64_t seed = 0;	// The mines only depend on the seed and the first clicked tile
+	NoGuessGenerator* noGuessGenerator = nullptr;	// Places the mines so the field can be solved without guessing (nullptr for random mines)
+	Vei2 topLeft;	// Screen position of the top-left tile
+	RectI rectangle;	// Rectangle representing the minefield (location, dimensions)
+	Camera camera;	// Shows the whole field at the size of the sprites (the standard difficulties fit the screen)
+	DigitalDisplay minesLeftDisplay;
+	DirtyTiles dirtyTiles;	// Tiles (by index y * W + x) which changed since the last frame
+	BoardLayer layer;	// Image of the tiles kept between frames
+};
+
+template<int W, int H, int Mines>
+constexpr int BasicMinefield<W, H, Mines>::neighbourOffsets[8];
+
+template<int W, int H, int Mines>
+constexpr typename BasicMinefield<W, H, Mines>::EmptyField BasicMinefield<W, H, Mines>::emptyField = EmptyField();
+
+/**
+	Constructs a minefield with the seed 0
+*/
+template<int W, int H, int Mines>
+BasicMinefield<W, H, Mines>::BasicMinefield()
+	:
+	BasicMinefield(0)
+{
+}
+
+/**
+	Constructs a minefield object
+
+	@param seedIn Seed from which the mines are generated (the same seed and first click always give the same field)
+*/
+template<int W, int H, int Mines>
+BasicMinefield<W, H, Mines>::BasicMinefield(std::uint64_t seedIn)
+	:
+	topLeft((Graphics::ScreenWidth - W * tileSize) / 2, (Graphics::ScreenHeight - H * tileSize) / 2),
+	rectangle(topLeft, W * tileSize, H * tileSize),
+	camera(rectangle, Vei2(W, H))
+{
+	dirtyTiles.resize(tileCount);
+	reset(seedIn);
+}
+
+/**
+	Returns true if a field of input size and amount of mines is a BasicMinefield of this type
+
+	@param widthIn Width of the field (in tiles)
+	@param heightIn Height of the field (in tiles)
+	@param nMinesIn
+	@return bool
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::hasSize(int widthIn, int heightIn, int nMinesIn)
+{
+	return widthIn == W && heightIn == H && nMinesIn == Mines;
+}
+
+/**
+	Turns the minefield into a new one in place
+
+	@param seedIn Seed from which the mines are generated
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::reset(std::uint64_t seedIn)
+{
+	seed = seedIn;
+	restart();
+}
+
+/**
+	Sets the generator placing the mines after the first click, so the field can be solved without guessing
+
+	@param noGuessGeneratorIn nullptr to place random mines
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::setNoGuessGenerator(NoGuessGenerator* noGuessGeneratorIn)
+{
+	assert(!minesAreGenerated);
+	noGuessGenerator = noGuessGeneratorIn;
+}
+
+/**
+	Restarts the minefield back to its default values (Copies the empty field built at compile time)
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::restart()
+{
+	std::copy(std::begin(emptyField.tiles), std::end(emptyField.tiles), tiles.begin());
+	std::copy(std::begin(emptyField.neighbours), std::end(emptyField.neighbours), neighbours.begin());
+	minesAreGenerated = false;
+	isExploded = false;
+	partiallyRevealedTile = noTile;
+	revealedCounter = 0;
+	flaggedCount = 0;
+	dirtyTiles.markAll();
+	updateDisplay();
+}
+
+/**
+	Generates mines accross the field from the seed after a tile was clicked
+	(Draws exactly the same mines as TileGrid::placeMines() does for a field of this size, or takes them from the
+	no-guess generator if one is set)
+
+	@param clickedTile The tile which was clicked (it and its surrounding tiles are kept free of mines)
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::generateMines(int clickedTile)
+{
+	assert(!minesAreGenerated);
+	auto placeMine = [this](int index) {
+		const int tile = (index / W + 1) * stride + index % W + 1;
+		tiles[tile] |= mineBit;
+		for (int offset : neighbourOffsets) {
+			++tiles[tile + offset];	// The count is kept in the low bits (Border tiles get counted too, but never read)
+		}
+	};
+	const int safeX = clickedTile % stride - 1;
+	const int safeY = clickedTile / stride - 1;
+	if (noGuessGenerator) {
+		noGuessGenerator->generate(W, H, Mines, safeY * W + safeX, seed);
+		for (int index = 0; index < tileCount; ++index) {
+			if (noGuessGenerator->hasMine(index)) {
+				placeMine(index);
+			}
+		}
+		minesAreGenerated = true;
+		return;
+	}
+
+	// Sorted indices (y * W + x) of the tiles which must stay free of mines
+	int excluded[9];
+	const int nExcluded = MinePlacement::getExcludedTiles(W, H, Mines, safeY * W + safeX, excluded);
+
+	// Every mine counts up its neighbours as it is placed
+	MinePlacement::shuffleMines(tileCount, Mines, excluded, nExcluded, seed, candidates.data(), placeMine);
+
+	minesAreGenerated = true;
+}
+
+/**
+	Draws the minefield (Only the tiles which changed since the last frame get redrawn, see BoardLayer)
+
+	@param gfx Graphics processor
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::draw(Graphics& gfx)
+{
+	// Tiles over the background rectangle
+	layer.draw(gfx, camera, dirtyTiles, [this](Graphics& target, int index, const Vei2&) {
+		drawTile(target, (index / W + 1) * stride + index % W + 1);
+	});
+
+	// Display
+	minesLeftDisplay.draw(gfx, topLeft.x, topLeft.y - DigitalDisplay::getHeight() - displayOffset);
+}
+
+/**
+	Draws a Tile to the screen (If minefield is exploded, draws hidden mines as well)
+
+	@param gfx Graphics processor
+	@param tile The tile to be drawn
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::drawTile(Graphics& gfx, int tile) const
+{
+	const Vei2 position = getTilePosition(tile);
+	switch (getState(tile)) {
+	case State::Hidden:
+		if (hasMine(tile) && isExploded) {
+			SpriteCodex::drawTileMine(position, gfx);
+		}
+		SpriteCodex::drawTileButton(position, gfx);
+		break;
+	case State::PartiallyRevealed:
+		SpriteCodex::drawTile0(position, gfx);
+		break;
+	case State::Revealed:
+		if (!hasMine(tile)) {
+			SpriteCodex::drawTileNumber(getAdjacentMineCount(tile), position, gfx);
+		}
+		else /* hasMine */ {
+			isExploded ?
+				SpriteCodex::drawTileMineRed(position, gfx) : SpriteCodex::drawTileButton(position, gfx);
+		}
+		break;
+	case State::Flagged:
+		SpriteCodex::drawTileButton(position, gfx);
+		SpriteCodex::drawTileFlag(position, gfx);
+		if (isExploded && !hasMine(tile)) {
+			SpriteCodex::drawTileCross(position, gfx);
+		}
+		break;
+	}
+}
+
+/**
+	Returns the screen position of a tile
+
+	@param tile
+	@return position
+*/
+template<int W, int H, int Mines>
+Vei2 BasicMinefield<W, H, Mines>::getTilePosition(int tile) const
+{
+	return topLeft + Vei2(tile % stride - 1, tile / stride - 1) * tileSize;
+}
+
+/**
+	Returns the tile at input location
+
+	@param globalLocation
+	@return tile
+*/
+template<int W, int H, int Mines>
+int BasicMinefield<W, H, Mines>::getTileAtLocation(const Vei2& globalLocation) const
+{
+	assert(rectangle.ContainsPoint(globalLocation));
+	const int x = (globalLocation.x - topLeft.x) / tileSize;
+	const int y = (globalLocation.y - topLeft.y) / tileSize;
+	return (y + 1) * stride + x + 1;
+}
+
+/**
+	Partially reveals a tile at given location
+
+	@param globalLocation Location where the tile to be revealed is
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::partiallyRevealTileAtLocation(const Vei2& globalLocation)
+{
+	const int tile = getTileAtLocation(globalLocation);
+	if (getState(tile) == State::Hidden) {
+		setState(tile, State::PartiallyRevealed);
+		partiallyRevealedTile = tile;
+	}
+}
+
+/**
+	Reveals a tile at input location
+
+	@param globalLocation
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::revealTileAtLocation(const Vei2& globalLocation)
+{
+	if (!isExploded) {
+		const int tile = getTileAtLocation(globalLocation);
+		if (isRevealable(tile)) {
+			revealTile(tile);	// Reveals the whole opening for tiles with 0 adjacent mines
+			partiallyRevealedTile = noTile;
+		}
+	}
+}
+
+/**
+	Reveals input tile and if it has 0 adjacent mines, also reveals the whole opening around it
+
+	@param tile The tile to be revealed
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::revealTile(int tile)
+{
+	if (!minesAreGenerated) {
+		generateMines(tile);	// Mines are generated after first click
+	}
+	if (isRevealable(tile)) {
+		if (hasMine(tile)) {
+			setState(tile, State::Revealed);
+			isExploded = true;
+			dirtyTiles.markAll();	// Every mine and wrong flag gets shown
+		}
+		else {
+			revealedCounter += floodReveal(tile);
+		}
+	}
+}
+
+/**
+	Reveals a tile without a mine and, if it is empty, the whole opening around it
+	Every tile is revealed before it gets pushed, so the stack never holds more than all the tiles of the field
+
+	@param tile A revealable tile without a mine
+	@return revealed The amount of tiles which got revealed
+*/
+template<int W, int H, int Mines>
+int BasicMinefield<W, H, Mines>::floodReveal(int tile)
+{
+	setState(tile, State::Revealed);
+	if (getAdjacentMineCount(tile) != 0) {
+		return 1;
+	}
+
+	int revealed = 1;
+	int nStacked = 0;
+	fillStack[nStacked++] = tile;
+	while (nStacked > 0) {
+		const int expanded = fillStack[--nStacked];
+		for (int offset : neighbourOffsets) {
+			const int neighbour = expanded + offset;
+			if (isRevealable(neighbour)) {	// Never true for the border, nor for flagged tiles (which stop the fill)
+				setState(neighbour, State::Revealed);
+				++revealed;
+				if (getAdjacentMineCount(neighbour) == 0) {
+					fillStack[nStacked++] = neighbour;
+				}
+			}
+		}
+	}
+	return revealed;
+}
+
+/**
+	Reveals all surrounding tiles, if the surrounding flags match the number of the tile
+
+	@param tile The tile of which the surrounding tiles should be revealed
+	@return bool true if the flags matched the number
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::revealSurroundingTiles(int tile)
+{
+	if (!isSatisfied(tile)) {
+		return false;
+	}
+	for (int offset : neighbourOffsets) {
+		if (getState(tile + offset) == State::Hidden) {
+			revealTile(tile + offset);
+		}
+	}
+	return true;
+}
+
+/**
+	Returns true if a tile is revealed and has as many flags around it as its number
+
+	@param tile
+	@return bool
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::isSatisfied(int tile) const
+{
+	// Revealed, without a mine and not part of the border (whose neighbour counts are never kept up to date)
+	constexpr std::uint8_t revealedSafeTile = std::uint8_t(int(State::Revealed) << stateShift);
+	return (tiles[tile] & (stateMask | mineBit | borderBit)) == revealedSafeTile
+		&& (neighbours[tile] & 0xF) == getAdjacentMineCount(tile);
+}
+
+/**
+	Returns true if chording a tile would reveal something (it is satisfied and has hidden tiles around it)
+
+	@param tile
+	@return bool
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::canChord(int tile) const
+{
+	return isSatisfied(tile) && (neighbours[tile] >> 4) > 0;
+}
+
+/**
+	Chords every tile which can be chorded, over and over until no tile can (See Minefield::chordAll())
+
+	@return revealed The amount of tiles which got revealed
+*/
+template<int W, int H, int Mines>
+int BasicMinefield<W, H, Mines>::chordAll()
+{
+	const int revealedBefore = revealedCounter;
+	bool chorded = true;
+	while (chorded && !isExploded) {
+		chorded = false;
+		for (int tile = stride + 1; tile < storedTileCount - stride - 1 && !isExploded; ++tile) {
+			if (canChord(tile)) {
+				revealSurroundingTiles(tile);
+				chorded = true;
+			}
+		}
+	}
+	return revealedCounter - revealedBefore;
+}
+
+/**
+	Reveals tiles surrounding the tile at input location if it is revealed, flags the tile otherwise
+
+	@param globalLocation Location of the tile to be flagged / have surrounding tiles revealed
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::revealSurroundingTilesOrFlagTileAtLocation(const Vei2& globalLocation)
+{
+	const int tile = getTileAtLocation(globalLocation);
+	const State state = getState(tile);
+	if (state == State::Revealed) {
+		revealSurroundingTiles(tile);
+	}
+	else if (state == State::Hidden || state == State::Flagged) {
+		toggleTileFlagAtLocation(globalLocation);
+	}
+}
+
+/**
+	Toggles flag of tile at input location
+
+	@param globalLocation
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::toggleTileFlagAtLocation(const Vei2& globalLocation)
+{
+	const int tile = getTileAtLocation(globalLocation);
+	if (getState(tile) == State::Hidden) {
+		setState(tile, State::Flagged);
+		++flaggedCount;
+	}
+	else if (getState(tile) == State::Flagged) {
+		setState(tile, State::Hidden);
+		--flaggedCount;
+	}
+	updateDisplay();
+}
+
+/**
+	Hides the tile that was partially revealed
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::hidePartiallyRevealedTile()
+{
+	if (partiallyRevealedTile != noTile) {
+		setState(partiallyRevealedTile, State::Hidden);
+		partiallyRevealedTile = noTile;
+	}
+}
+
+/**
+	Flags all the remaining hidden mines (called once the game is won)
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::flagRemainingTiles()
+{
+	for (int tile = stride + 1; tile < storedTileCount - stride - 1; ++tile) {
+		if (hasMine(tile) && getState(tile) == State::Hidden) {
+			setState(tile, State::Flagged);
+			++flaggedCount;
+		}
+	}
+	updateDisplay();
+}
+
+/**
+	Returns the state of a tile
+
+	@param tile
+	@return state
+*/
+template<int W, int H, int Mines>
+typename BasicMinefield<W, H, Mines>::State BasicMinefield<W, H, Mines>::getState(int tile) const
+{
+	return State((tiles[tile] & stateMask) >> stateShift);
+}
+
+/**
+	Sets the state of a tile, updates the neighbour counts of the tiles around it and lists the tile as changed
+
+	@param tile
+	@param stateIn
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::setState(int tile, State stateIn)
+{
+	assert((tiles[tile] & borderBit) == 0);
+	const State state = getState(tile);
+	tiles[tile] = std::uint8_t((tiles[tile] & ~stateMask) | (int(stateIn) << stateShift));
+	dirtyTiles.mark((tile / stride - 1) * W + tile % stride - 1);
+
+	// Hidden and PartiallyRevealed both count as hidden, so only flagging and revealing change the neighbours
+	const int flaggedChange = int(stateIn == State::Flagged) - int(state == State::Flagged);
+	const int hiddenChange = int(int(stateIn) < int(State::Revealed)) - int(int(state) < int(State::Revealed));
+	const std::uint8_t delta = std::uint8_t(flaggedChange * flaggedNeighbour + hiddenChange * hiddenNeighbour);
+	if (delta != 0) {
+		for (int offset : neighbourOffsets) {
+			neighbours[tile + offset] += delta;
+		}
+	}
+}
+
+/**
+	Returns true if a tile can be revealed (it is hidden or partially revealed)
+
+	@param tile
+	@return bool
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::isRevealable(int tile) const
+{
+	return int(getState(tile)) < int(State::Revealed);
+}
+
+/**
+	Returns true if a tile has a mine
+
+	@param tile
+	@return bool
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::hasMine(int tile) const
+{
+	return (tiles[tile] & mineBit) != 0;
+}
+
+/**
+	Returns the amount of mines adjacent to a tile
+
+	@param tile
+	@return adjacentMineCount
+*/
+template<int W, int H, int Mines>
+int BasicMinefield<W, H, Mines>::getAdjacentMineCount(int tile) const
+{
+	return tiles[tile] & countMask;
+}
+
+/**
+	Returns true if tile exists at input location
+
+	@param globalLocation
+	@return bool
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::tileExistsAtLocation(const Vei2& globalLocation) const
+{
+	return rectangle.ContainsPoint(globalLocation);
+}
+
+/**
+	Returns true if tile at input location is partially revealed
+
+	@param globalLocation
+	@return bool
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::tileAtLocationIsPartiallyRevealed(const Vei2& globalLocation) const
+{
+	return getState(getTileAtLocation(globalLocation)) == State::PartiallyRevealed;
+}
+
+/**
+	Returns true if tile at input location is revealed and has as many flags around it as its number
+
+	@param globalLocation
+	@return bool
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::tileAtLocationIsSatisfied(const Vei2& globalLocation) const
+{
+	return isSatisfied(getTileAtLocation(globalLocation));
+}
+
+/**
+	Returns true if chording the tile at input location would reveal the tiles around it
+
+	@param globalLocation
+	@return bool
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::tileAtLocationCanBeChorded(const Vei2& globalLocation) const
+{
+	return canChord(getTileAtLocation(globalLocation));
+}
+
+/**
+	Returns true if all tiles have been revealed
+
+	@return bool
+*/
+template<int W, int H, int Mines>
+bool BasicMinefield<W, H, Mines>::revealedAll() const
+{
+	assert(revealedCounter <= tileCount - Mines);
+	return revealedCounter == tileCount - Mines;
+}
+
+/**
+	Returns the amount of revealed tiles
+
+	@return revealedCounter
+*/
+template<int W, int H, int Mines>
+int BasicMinefield<W, H, Mines>::getRevealedCounter() const
+{
+	return revealedCounter;
+}
+
+/**
+	Copies what the player sees of the field (partially revealed tiles count as hidden)
+
+	@param board
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::readVisibleBoard(VisibleBoard& board) const
+{
+	board.resize(W, H, Mines);
+	for (int y = 0; y < H; ++y) {
+		for (int x = 0; x < W; ++x) {
+			const int tile = (y + 1) * stride + x + 1;
+			switch (getState(tile)) {
+			case State::Revealed:
+				board.setTile(board.indexOf(x, y), getAdjacentMineCount(tile));
+				break;
+			case State::Flagged:
+				board.setTile(board.indexOf(x, y), VisibleBoard::flagged);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+}
+
+/**
+	Returns the width of the minefield (in pixels)
+
+	@return width
+*/
+template<int W, int H, int Mines>
+int BasicMinefield<W, H, Mines>::getWidth() const
+{
+	return W * tileSize;
+}
+
+/**
+	Returns the height of the minefield (in pixels)
+
+	@return height
+*/
+template<int W, int H, int Mines>
+int BasicMinefield<W, H, Mines>::getHeight() const
+{
+	return H * tileSize;
+}
+
+/**
+	Returns the seed from which the mines are generated
+
+	@return seed
+*/
+template<int W, int H, int Mines>
+std::uint64_t BasicMinefield<W, H, Mines>::getSeed() const
+{
+	return seed;
+}
+
+/**
+	Returns the image of the tiles kept between frames (to see how much the last frame redrew)
+
+	@return layer
+*/
+template<int W, int H, int Mines>
+const BoardLayer& BasicMinefield<W, H, Mines>::getBoardLayer() const
+{
+	return layer;
+}
+
+/**
+	Updates the display non-flagged mines counter display
+*/
+template<int W, int H, int Mines>
+void BasicMinefield<W, H, Mines>::updateDisplay()
+{
+	minesLeftDisplay.setValue(Mines - flaggedCount);
+}
@@ -0,0 +1,58 @@
+/**
+	Bit manipulation helpers shared by the bit-packed planes
+*/
+
+#pragma once
+#include <cstdint>
+#include <assert.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Bits {
+	/**
+		Returns the position of the lowest set bit of a non-zero word
+
+		@param word
+		@return bit
+	*/
+	inline int lowestSetBit(std::uint64_t word)
+	{
+		assert(word != 0);
+	#if defined(_MSC_VER) && defined(_M_X64)
+		unsigned long bit;
+		_BitScanForward64(&bit, word);
+		return (int)bit;
+	#elif defined(__GNUC__)
+		return __builtin_ctzll(word);
+	#else
+		int bit = 0;
+		while (!(word & 1u)) {
+			word >>= 1;
+			++bit;
+		}
+		return bit;
+	#endif
+	}
+
+	/**
+		Returns the number of set bits of a word
+		(The popcnt instruction is only used where the build targets AVX2, which implies it)
+
+		@param word
+		@return count
+	*/
+	inline int countSetBits(std::uint64_t word)
+	{
+	#if defined(_MSC_VER) && defined(_M_X64) && defined(__AVX2__)
+		return (int)__popcnt64(word);
+	#elif defined(__GNUC__)
+		return __builtin_popcountll(word);
+	#else
+		word = word - ((word >> 1) & 0x5555555555555555ull);
+		word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+		word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+		return (int)((word * 0x0101010101010101ull) >> 56);
+	#endif
+	}
+}
@@ -0,0 +1,91 @@
+#include "BoardLayer.h"
+
+/**
+	Makes the next draw() redraw every tile
+*/
+void BoardLayer::invalidate()
+{
+	isValid = false;
+}
+
+/**
+	Returns the amount of tiles the last draw() redrew
+
+	@return redrawnTileCount
+*/
+int BoardLayer::getRedrawnTileCount() const
+{
+	return redrawnTileCount;
+}
+
+/**
+	Returns the amount of memory held by the layer (in bytes)
+
+	@return bytes
+*/
+std::size_t BoardLayer::getMemoryUsage() const
+{
+	return image.getMemoryUsage();
+}
+
+/**
+	Returns true if every tile has to be redrawn: the image is not valid yet, every tile changed or the view changed
+
+	@param camera The view of the board
+	@param dirtyTiles Changed tiles of the board
+	@return bool
+*/
+bool BoardLayer::needsFullRedraw(const Camera& camera, const DirtyTiles& dirtyTiles) const
+{
+	return !isValid || dirtyTiles.hasAll() || !camera.showsSameAs(drawnCamera);
+}
+
+/**
+	Returns the amount of tiles the camera shows (the amount of pixels when a pixel covers several tiles)
+
+	@param camera The view of the board
+	@return count
+*/
+int BoardLayer::countShownTiles(const Camera& camera)
+{
+	if (camera.getZoom() >= 0) {
+		const RectI tiles = camera.getVisibleTiles();
+		return (tiles.right - tiles.left) * (tiles.bottom - tiles.top);
+	}
+	const RectI area = camera.getVisibleArea();
+	return (area.right - area.left) * (area.bottom - area.top);
+}
+
+/**
+	Sizes the image to the board (which invalidates it if the size changed) and redirects drawing into it
+
+	@param gfx Graphics processor
+	@param area Area of the screen covered by the board
+*/
+void BoardLayer::beginRedraw(Graphics& gfx, const RectI& area)
+{
+	const int width = area.right - area.left;
+	const int height = area.bottom - area.top;
+	if (image.getWidth() != width || image.getHeight() != height) {
+		image.resize(width, height);
+		isValid = false;
+	}
+	gfx.SetRenderTarget(image, Vei2(area.left, area.top));
+}
+
+/**
+	Marks the tiles as drawn with the view of the camera, draws to the screen again and copies the image onto it
+
+	@param gfx Graphics processor
+	@param camera The view the image was drawn with
+	@param dirtyTiles Changed tiles of the board (cleared)
+*/
+void BoardLayer::endRedraw(Graphics& gfx, const Camera& camera, DirtyTiles& dirtyTiles)
+{
+	dirtyTiles.clear();
+	drawnCamera = camera;
+	isValid = true;
+	const RectI area = camera.getVisibleArea();
+	gfx.ResetRenderTarget();
+	gfx.DrawSurface(image, Vei2(area.left, area.top));
+}
@@ -0,0 +1,187 @@
+/**
+	Image of the tiles of a board kept between frames, so a frame only redraws the tiles which changed
+
+	The tiles are drawn into an offscreen surface covering the part of the board the camera shows (through
+	Graphics::SetRenderTarget(), so the usual tile drawing code is used unchanged), which is then copied onto the frame.
+	As long as nothing changes, drawing the board is a single copy of that surface. Only the tiles the camera shows are
+	ever drawn, so the cost of a frame depends on the size of the screen and not on the size of the board.
+	Redrawing every tile can be split between the threads of a pool: the image is cut into horizontal bands, each drawn
+	through a Canvas clipped to its band, so a tile crossing the edge of a band is drawn in part by each of them.
+*/
+
+#pragma once
+#include "Graphics.h"
+#include "Surface.h"
+#include "DirtyTiles.h"
+#include "SpriteCodex.h"
+#include "RectI.h"
+#include "Camera.h"
+#include "Canvas.h"
+#include "ThreadPool.h"
+#include <functional>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+class BoardLayer {
+public:
+	template<typename DrawTile>
+	void draw(Graphics& gfx, const Camera& camera, DirtyTiles& dirtyTiles, DrawTile drawTile);
+	template<typename DrawTile>
+	void draw(Graphics& gfx, const Camera& camera, DirtyTiles& dirtyTiles, ThreadPool& pool, DrawTile drawTile);
+	void invalidate();
+
+	int getRedrawnTileCount() const;
+	std::size_t getMemoryUsage() const;
+
+	static constexpr int tileSize = SpriteCodex::tileSize;
+	static constexpr int bandsPerThread = 4;	// Bands the image is split into per thread of the pool
+
+private:
+	bool needsFullRedraw(const Camera& camera, const DirtyTiles& dirtyTiles) const;
+	template<typename Target, typename DrawTile>
+	static void drawTiles(Target& target, const Camera& camera, const RectI& clip, DrawTile& drawTile);
+	template<typename DrawTile>
+	void redrawDirtyTiles(Graphics& gfx, const Camera& camera, const DirtyTiles& dirtyTiles, DrawTile& drawTile);
+	static int countShownTiles(const Camera& camera);
+	void beginRedraw(Graphics& gfx, const RectI& area);
+	void endRedraw(Graphics& gfx, const Camera& camera, DirtyTiles& dirtyTiles);
+
+private:
+	Surface image;
+	Camera drawnCamera;	// The view the image was drawn with
+	bool isValid = false;	// The image shows every tile (it was drawn at least once and never invalidated)
+	int redrawnTileCount = 0;	// Tiles redrawn by the last draw() (for profiling)
+};
+
+/**
+	Redraws the changed tiles the camera shows into the image (every shown tile if the image is not valid yet or the
+	view changed), marks the tiles as drawn and copies the image onto the frame
+
+	When a pixel covers several tiles (zoom below 0), the tile drawn for it is the one at its top-left.
+
+	@param gfx Graphics processor
+	@param camera The view of the board, the tile at index i is at (i % width, i / width) of the board
+	@param dirtyTiles Changed tiles of the board (cleared once they are drawn)
+	@param drawTile Called as drawTile(gfx, index, position) to draw a tile over the base color, with its top-left corner
+		at position (camera.toScreen() of its location)
+*/
+template<typename DrawTile>
+void BoardLayer::draw(Graphics& gfx, const Camera& camera, DirtyTiles& dirtyTiles, DrawTile drawTile)
+{
+	const RectI area = camera.getVisibleArea();
+	beginRedraw(gfx, area);
+	if (needsFullRedraw(camera, dirtyTiles)) {
+		drawTiles(gfx, camera, area, drawTile);
+		redrawnTileCount = countShownTiles(camera);
+	}
+	else {
+		redrawDirtyTiles(gfx, camera, dirtyTiles, drawTile);
+	}
+	endRedraw(gfx, camera, dirtyTiles);
+}
+
+/**
+	Same as draw(), with a redraw of every tile split into bands drawn by the threads of the pool (the changed tiles
+	alone are few enough to be drawn on the calling thread)
+
+	@param gfx Graphics processor
+	@param camera The view of the board, the tile at index i is at (i % width, i / width) of the board
+	@param dirtyTiles Changed tiles of the board (cleared once they are drawn)
+	@param pool Threads drawing the bands
+	@param drawTile Called as drawTile(target, index, position) to draw a tile over the base color, with its top-left
+		corner at position, where target is gfx or the Canvas of a band (it is called from every thread of the pool)
+*/
+template<typename DrawTile>
+void BoardLayer::draw(Graphics& gfx, const Camera& camera, DirtyTiles& dirtyTiles, ThreadPool& pool, DrawTile drawTile)
+{
+	const RectI area = camera.getVisibleArea();
+	beginRedraw(gfx, area);
+	if (needsFullRedraw(camera, dirtyTiles)) {
+		const int height = area.bottom - area.top;
+		const int nBands = std::max(1, std::min(pool.getThreadCount() * bandsPerThread, height));
+		const auto drawBand = [&](int band) {
+			const RectI clip(area.left, area.right, area.top + height * band / nBands, area.top + height * (band + 1) / nBands);
+			Canvas canvas(image, Vei2(area.left, area.top), clip);
+			drawTiles(canvas, camera, clip, drawTile);
+		};
+		pool.parallelFor(nBands, std::cref(drawBand));
+		redrawnTileCount = countShownTiles(camera);
+	}
+	else {
+		redrawDirtyTiles(gfx, camera, dirtyTiles, drawTile);
+	}
+	endRedraw(gfx, camera, dirtyTiles);
+}
+
+/**
+	Fills an area of the image with the base color and draws every tile shown in it
+
+	@param target Graphics processor drawing into the image, or Canvas of the image (tiles are clipped to it)
+	@param camera The view of the board
+	@param clip Area of the screen redrawn (inside of the visible area of the camera)
+	@param drawTile See draw()
+*/
+template<typename Target, typename DrawTile>
+void BoardLayer::drawTiles(Target& target, const Camera& camera, const RectI& clip, DrawTile& drawTile)
+{
+	if (clip.left >= clip.right || clip.top >= clip.bottom) {
+		return;
+	}
+	const int widthInTiles = camera.getBoardSize().x;
+	target.DrawRect(clip, SpriteCodex::baseColor);
+	if (camera.getZoom() >= 0) {
+		const Vei2 first = camera.toTile(Vei2(clip.left, clip.top));
+		const Vei2 last = camera.toTile(Vei2(clip.right - 1, clip.bottom - 1));
+		const int tileScreenSize = camera.getTileScreenSize();
+		for (int y = first.y; y <= last.y; ++y) {
+			Vei2 position = camera.toScreen(Vei2(first.x, y));
+			for (int x = first.x; x <= last.x; ++x, position.x += tileScreenSize) {
+				drawTile(target, y * widthInTiles + x, position);
+			}
+		}
+	}
+	else {
+		// A pixel per tile drawn, stepping over the tiles the pixels after it cover
+		const int tilesPerPixel = 1 << -camera.getZoom();
+		for (int y = clip.top; y < clip.bottom; ++y) {
+			const Vei2 first = camera.toTile(Vei2(clip.left, y));
+			int index = first.y * widthInTiles + first.x;
+			for (int x = clip.left; x < clip.right; ++x, index += tilesPerPixel) {
+				drawTile(target, index, Vei2(x, y));
+			}
+		}
+	}
+}
+
+/**
+	Redraws the changed tiles the camera shows (the others are drawn once the camera shows them)
+
+	@param gfx Graphics processor drawing into the image
+	@param camera The view of the board
+	@param dirtyTiles Changed tiles of the board
+	@param drawTile See draw()
+*/
+template<typename DrawTile>
+void BoardLayer::redrawDirtyTiles(Graphics& gfx, const Camera& camera, const DirtyTiles& dirtyTiles, DrawTile& drawTile)
+{
+	const RectI area = camera.getVisibleArea();
+	const RectI tiles = camera.getVisibleTiles();
+	const int widthInTiles = camera.getBoardSize().x;
+	const int tileScreenSize = camera.getTileScreenSize();
+	redrawnTileCount = 0;
+	for (int index : dirtyTiles.getTiles()) {
+		const Vei2 tile(index % widthInTiles, index / widthInTiles);
+		if (tile.x < tiles.left || tile.x >= tiles.right || tile.y < tiles.top || tile.y >= tiles.bottom) {
+			continue;
+		}
+		const Vei2 position = camera.toScreen(tile);
+		gfx.DrawRect(std::max(position.x, area.left), std::max(position.y, area.top),
+			std::min(position.x + tileScreenSize, area.right), std::min(position.y + tileScreenSize, area.bottom),
+			SpriteCodex::baseColor);
+		// The pixel of a tile shows the tile at its top-left when it covers several
+		const Vei2 shownTile = camera.getZoom() >= 0 ? tile : camera.toTile(position);
+		drawTile(gfx, shownTile.y * widthInTiles + shownTile.x, position);
+		++redrawnTileCount;
+	}
+}
@@ -0,0 +1,174 @@
+#include "BoardMetrics.h"
+#include <algorithm>
+#include <assert.h>
+
+/**
+	Computes the metrics of a board
+
+	@param grid Mines and adjacent mine counts set (the states of the tiles are not looked at)
+	@return metrics
+*/
+const BoardMetrics::Metrics& BoardMetrics::compute(const TileGrid& grid)
+{
+	width = grid.getWidth();
+	height = grid.getHeight();
+	paddedWidth = width + 2;
+	const int offsets[8] = {
+		-paddedWidth - 1, -paddedWidth, -paddedWidth + 1,
+		-1, 1,
+		paddedWidth - 1, paddedWidth, paddedWidth + 1
+	};
+	std::copy(std::begin(offsets), std::end(offsets), neighbourOffsets);
+
+	openings.build(grid);
+	const int paddedTileCount = paddedWidth * (height + 2);
+	kinds.assign(paddedTileCount, TileKind::Outside);
+	openingOfTile.resize(paddedTileCount);	// The border is never read
+	isFlagged.assign(paddedTileCount, std::uint8_t(0));
+	isRevealed.assign(paddedTileCount, std::uint8_t(0));
+	openingIsRevealed.assign(openings.getOpeningCount(), std::uint8_t(0));
+	nClicks = 0;
+	nClearedUnits = 0;
+	metrics = {};
+	metrics.openings = openings.getOpeningCount();
+
+	// The kinds are read two rows ahead (mine, empty or number) and the numbers get sorted one row ahead
+	readRow(grid, 0);
+	if (height > 1) {
+		readRow(grid, 1);
+	}
+	sortNumbers(0);
+	for (int y = 0; y < height; ++y) {
+		if (y + 2 < height) {
+			readRow(grid, y + 2);
+		}
+		if (y + 1 < height) {
+			sortNumbers(y + 1);
+		}
+		for (int tile = (y + 1) * paddedWidth + 1; tile < (y + 2) * paddedWidth - 1; ++tile) {
+			const TileKind kind = kinds[tile];
+			if (kind == TileKind::IsolatedNumber) {
+				++metrics.isolatedNumbers;
+			}
+			if (kind == TileKind::Number || kind == TileKind::IsolatedNumber) {
+				chordIfWorth(tile, kind);
+			}
+		}
+	}
+
+	metrics.bbbv = metrics.openings + metrics.isolatedNumbers;
+	metrics.zini = nClicks + metrics.bbbv - nClearedUnits;
+	assert(metrics.zini <= metrics.bbbv);
+	return metrics;
+}
+
+/**
+	Reads the kinds and openings of the tiles of a row, every number as isolated (see sortNumbers())
+
+	@param grid
+	@param y
+*/
+void BoardMetrics::readRow(const TileGrid& grid, int y)
+{
+	TileKind* row = &kinds[(y + 1) * paddedWidth + 1];
+	int* rowOpenings = &openingOfTile[(y + 1) * paddedWidth + 1];
+	for (int x = 0; x < width; ++x) {
+		const int index = y * width + x;
+		row[x] = grid.hasMine(index) ? TileKind::Mine :
+			grid.getAdjacentMineCount(index) == 0 ? TileKind::Empty : TileKind::IsolatedNumber;
+		rowOpenings[x] = openings.getOpening(index);
+	}
+}
+
+/**
+	Turns the numbers of a row which border an empty tile into numbers of an opening (the rows above and below it must
+	have been read)
+
+	@param y
+*/
+void BoardMetrics::sortNumbers(int y)
+{
+	for (int tile = (y + 1) * paddedWidth + 1; tile < (y + 2) * paddedWidth - 1; ++tile) {
+		if (kinds[tile] == TileKind::IsolatedNumber) {
+			for (int offset : neighbourOffsets) {
+				if (kinds[tile + offset] == TileKind::Empty) {
+					kinds[tile] = TileKind::Number;
+					break;
+				}
+			}
+		}
+	}
+}
+
+/**
+	Chords a number if that takes fewer clicks than clicking what it reveals one by one: the openings around it which
+	are still hidden and the isolated numbers around it (and itself) which are (The number gets revealed and its mines
+	flagged first if needed)
+
+	@param tile Tile of the number (in the padded grid)
+	@param kind
+*/
+void BoardMetrics::chordIfWorth(int tile, TileKind kind)
+{
+	// Openings (at most 4 around a tile) and isolated numbers the chord would reveal, and the flags it needs
+	int newOpenings[8];
+	int nNewOpenings = 0;
+	int nIsolated = 0;
+	int nFlags = 0;
+	bool isShown = isRevealed[tile] != 0;
+	for (int offset : neighbourOffsets) {
+		const int neighbour = tile + offset;
+		switch (kinds[neighbour]) {
+		case TileKind::Mine:
+			nFlags += isFlagged[neighbour] == 0;
+			break;
+		case TileKind::Empty: {
+			const int opening = openingOfTile[neighbour];
+			if (openingIsRevealed[opening]) {
+				isShown = true;
+			}
+			else if (std::find(newOpenings, newOpenings + nNewOpenings, opening) == newOpenings + nNewOpenings) {
+				newOpenings[nNewOpenings++] = opening;
+			}
+		}
+			break;
+		case TileKind::IsolatedNumber:
+			nIsolated += isRevealed[neighbour] == 0;
+			break;
+		default:
+			break;
+		}
+	}
+	const bool revealsItself = !isShown && kind == TileKind::IsolatedNumber;
+	const int saved = nNewOpenings + nIsolated + revealsItself;
+	const int cost = (isShown ? 0 : 1) + nFlags + 1;
+	if (saved <= cost) {
+		return;
+	}
+
+	nClicks += cost;
+	nClearedUnits += saved;
+	isRevealed[tile] = 1;
+	for (int offset : neighbourOffsets) {
+		const int neighbour = tile + offset;
+		if (kinds[neighbour] == TileKind::Mine) {
+			isFlagged[neighbour] = 1;
+		}
+		else {
+			isRevealed[neighbour] = 1;
+		}
+	}
+	for (int i = 0; i < nNewOpenings; ++i) {
+		openingIsRevealed[newOpenings[i]] = 1;
+	}
+}
+
+/**
+	Returns the metrics of the last board
+
+	@return metrics
+*/
+const BoardMetrics::Metrics& BoardMetrics::getMetrics() const
+{
+	return metrics;
+}
@@ -0,0 +1,66 @@
+/**
+	Difficulty metrics of a generated board: 3BV, openings, isolated numbers and ZiNi
+
+	3BV is the fewest left clicks which clear the board without chording: one per opening (see OpeningIndex) and one per
+	isolated number (a numbered tile bordering no opening). ZiNi is the clicks of a player who also flags and chords,
+	found greedily in one pass in tile order (the one-way ZiNi): every number is chorded, after revealing it and flagging
+	its mines if needed, when that saves clicks over clicking the openings and isolated numbers around it one by one.
+	Whatever is still hidden after the pass costs one click per opening or isolated number, so ZiNi never exceeds 3BV.
+
+	The openings come from the labeling of OpeningIndex, then a single pass over the tiles does the rest: the tiles of
+	each row are sorted into mines, empty tiles, and numbers bordering an opening or not one row ahead of the row being
+	chorded, since a chord looks at the row below.
+*/
+
+#pragma once
+#include "TileGrid.h"
+#include "OpeningIndex.h"
+#include <vector>
+#include <cstdint>
+
+class BoardMetrics {
+public:
+	/**
+		Metrics of a board
+	*/
+	struct Metrics {
+		int bbbv;	// 3BV
+		int openings;
+		int isolatedNumbers;
+		int zini;
+	};
+
+public:
+	const Metrics& compute(const TileGrid& grid);
+
+	const Metrics& getMetrics() const;
+
+private:
+	enum class TileKind : std::uint8_t {
+		Outside,	// Border of the padded grid
+		Mine,
+		Empty,	// No mine and 0 adjacent mines
+		Number,	// Borders an opening, so it gets revealed with it
+		IsolatedNumber
+	};
+
+private:
+	void readRow(const TileGrid& grid, int y);
+	void sortNumbers(int y);
+	void chordIfWorth(int tile, TileKind kind);
+
+private:
+	int width = 0;
+	int height = 0;
+	int paddedWidth = 0;	// The grids below have a 1 tile border around the board
+	int neighbourOffsets[8] = {};
+	OpeningIndex openings;
+	std::vector<TileKind> kinds;	// Per tile of the padded grid (these vectors never shrink)
+	std::vector<int> openingOfTile;	// Per tile of the padded grid (see OpeningIndex::getOpening())
+	std::vector<std::uint8_t> isFlagged;	// Per tile of the padded grid, while chording
+	std::vector<std::uint8_t> isRevealed;	// Per tile of the padded grid: revealed on its own while chording
+	std::vector<std::uint8_t> openingIsRevealed;	// Per opening, while chording
+	int nClicks = 0;	// Clicks of the chords so far
+	int nClearedUnits = 0;	// Openings and isolated numbers the chords so far revealed
+	Metrics metrics = {};
+};
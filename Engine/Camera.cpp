@@ -0,0 +1,212 @@
+#include "Camera.h"
+#include <algorithm>
+#include <assert.h>
+
+// Definitions of the zoom limits (std::min and std::max take them by reference)
+constexpr int Camera::minZoom;
+constexpr int Camera::maxZoom;
+
+/**
+	Constructs a camera showing a board
+
+	@param viewportIn Area of the screen the board is shown in
+	@param boardSizeIn Size of the board (in tiles)
+	@param zoomIn Initial zoom (the board is centered, or shown from its top-left corner if it does not fit)
+*/
+Camera::Camera(const RectI& viewportIn, const Vei2& boardSizeIn, int zoomIn)
+	:
+	viewport(viewportIn),
+	boardSize(boardSizeIn),
+	zoom(std::min(std::max(zoomIn, minZoom), maxZoom)),
+	origin(viewportIn.left, viewportIn.top)
+{
+	assert(boardSize.x > 0 && boardSize.y > 0);
+	clampOrigin();
+}
+
+/**
+	Moves the view over the board
+
+	@param screenDelta How far to move the view (in pixels, positive moves towards the bottom-right of the board)
+*/
+void Camera::pan(const Vei2& screenDelta)
+{
+	origin -= screenDelta;
+	clampOrigin();
+}
+
+/**
+	Zooms in or out, keeping the point of the board under input screen point where it is
+
+	@param steps Zoom levels to zoom in by (negative zooms out), clamped to [minZoom, maxZoom]
+	@param screenPoint The point to zoom at (e.g. the mouse position)
+*/
+void Camera::zoomAt(int steps, const Vei2& screenPoint)
+{
+	for (; steps > 0 && zoom < maxZoom; --steps) {
+		origin = screenPoint - (screenPoint - origin) * 2;
+		++zoom;
+	}
+	for (; steps < 0 && zoom > minZoom; ++steps) {
+		origin.x = screenPoint.x - ((screenPoint.x - origin.x) >> 1);
+		origin.y = screenPoint.y - ((screenPoint.y - origin.y) >> 1);
+		--zoom;
+	}
+	clampOrigin();
+}
+
+/**
+	Moves the view so that a tile is at the center of the viewport (as far as the edges of the board allow)
+
+	@param tile Location of the tile on the board
+*/
+void Camera::lookAt(const Vei2& tile)
+{
+	const Vei2 center((viewport.left + viewport.right) / 2, (viewport.top + viewport.bottom) / 2);
+	origin = center - (toScreen(tile) - origin);
+	clampOrigin();
+}
+
+/**
+	Returns the zoom (a tile is 2^zoom pixels wide)
+
+	@return zoom
+*/
+int Camera::getZoom() const
+{
+	return zoom;
+}
+
+/**
+	Returns the width of the area a tile is drawn in (in pixels, 1 when a pixel covers several tiles)
+
+	@return tileScreenSize
+*/
+int Camera::getTileScreenSize() const
+{
+	return zoom >= 0 ? 1 << zoom : 1;
+}
+
+/**
+	Returns the size of the board (in tiles)
+
+	@return boardSize
+*/
+const Vei2& Camera::getBoardSize() const
+{
+	return boardSize;
+}
+
+/**
+	Returns the area of the screen the board is shown in
+
+	@return viewport
+*/
+const RectI& Camera::getViewport() const
+{
+	return viewport;
+}
+
+/**
+	Returns the area of the screen covered by the board (the viewport, or less if the board is smaller)
+
+	@return visibleArea
+*/
+RectI Camera::getVisibleArea() const
+{
+	return RectI(
+		std::max(origin.x, viewport.left), std::min(origin.x + getBoardScreenSize(boardSize.x), viewport.right),
+		std::max(origin.y, viewport.top), std::min(origin.y + getBoardScreenSize(boardSize.y), viewport.bottom));
+}
+
+/**
+	Returns the tiles which are (at least partially) shown: left <= x < right, top <= y < bottom
+
+	@return visibleTiles
+*/
+RectI Camera::getVisibleTiles() const
+{
+	const RectI area = getVisibleArea();
+	const Vei2 topLeft = toTile(Vei2(area.left, area.top));
+	// The last pixel covers 2^-zoom tiles from the one it maps to when zoomed out
+	const int lastTileOffset = zoom >= 0 ? 0 : (1 << -zoom) - 1;
+	const Vei2 bottomRight = toTile(Vei2(area.right - 1, area.bottom - 1)) + Vei2(lastTileOffset, lastTileOffset);
+	return RectI(std::max(topLeft.x, 0), std::min(bottomRight.x + 1, boardSize.x),
+		std::max(topLeft.y, 0), std::min(bottomRight.y + 1, boardSize.y));
+}
+
+/**
+	Returns the screen position of the top-left corner of a tile (the pixel showing it when zoomed out below zoom 0)
+
+	@param tile Location of the tile on the board
+	@return screenPosition
+*/
+Vei2 Camera::toScreen(const Vei2& tile) const
+{
+	if (zoom >= 0) {
+		return origin + Vei2(tile.x << zoom, tile.y << zoom);
+	}
+	return origin + Vei2(tile.x >> -zoom, tile.y >> -zoom);
+}
+
+/**
+	Returns the location of the tile under a screen point (it can be outside of the board)
+
+	@param screenPoint
+	@return tile
+*/
+Vei2 Camera::toTile(const Vei2& screenPoint) const
+{
+	// Shifting a negative offset right rounds towards negative infinity, so pixels left of the board map to negative tiles
+	const Vei2 offset = screenPoint - origin;
+	if (zoom >= 0) {
+		return Vei2(offset.x >> zoom, offset.y >> zoom);
+	}
+	return offset * (1 << -zoom);
+}
+
+/**
+	Returns true if both cameras draw the board at the same place of the screen at the same zoom
+
+	@param other
+	@return bool
+*/
+bool Camera::showsSameAs(const Camera& other) const
+{
+	return zoom == other.zoom && origin.x == other.origin.x && origin.y == other.origin.y
+		&& boardSize.x == other.boardSize.x && boardSize.y == other.boardSize.y
+		&& viewport.left == other.viewport.left && viewport.right == other.viewport.right
+		&& viewport.top == other.viewport.top && viewport.bottom == other.viewport.bottom;
+}
+
+/**
+	Returns the length of a side of the board on the screen at the current zoom
+
+	@param tiles Length of the side (in tiles)
+	@return pixels
+*/
+int Camera::getBoardScreenSize(int tiles) const
+{
+	if (zoom >= 0) {
+		return tiles << zoom;
+	}
+	return (tiles + (1 << -zoom) - 1) >> -zoom;
+}
+
+/**
+	Keeps the board centered in the viewport along the axes it fits on, and covering the viewport along the others
+*/
+void Camera::clampOrigin()
+{
+	auto clampAxis = [](int& originAxis, int viewMin, int viewMax, int boardPixels) {
+		const int viewSize = viewMax - viewMin;
+		if (boardPixels <= viewSize) {
+			originAxis = viewMin + (viewSize - boardPixels) / 2;
+		}
+		else {
+			originAxis = std::min(viewMin, std::max(originAxis, viewMax - boardPixels));
+		}
+	};
+	clampAxis(origin.x, viewport.left, viewport.right, getBoardScreenSize(boardSize.x));
+	clampAxis(origin.y, viewport.top, viewport.bottom, getBoardScreenSize(boardSize.y));
+}
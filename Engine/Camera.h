@@ -0,0 +1,45 @@
+/**
+	View of a board in tiles: which part of it is shown in which area of the screen, and at which zoom
+
+	The zoom is an integer, a tile is 2^zoom pixels wide (nativeZoom draws the tiles at the size of their sprites).
+	Below zoom 0 a pixel covers 2^-zoom x 2^-zoom tiles and shows the tile at its top-left.
+	A board smaller than the viewport is centered in it, a larger one always covers it.
+*/
+
+#pragma once
+#include "Vei2.h"
+#include "RectI.h"
+
+class Camera {
+public:
+	Camera() = default;
+	Camera(const RectI& viewportIn, const Vei2& boardSizeIn, int zoomIn = nativeZoom);
+
+	void pan(const Vei2& screenDelta);
+	void zoomAt(int steps, const Vei2& screenPoint);
+	void lookAt(const Vei2& tile);
+
+	int getZoom() const;
+	int getTileScreenSize() const;
+	const Vei2& getBoardSize() const;
+	const RectI& getViewport() const;
+	RectI getVisibleArea() const;
+	RectI getVisibleTiles() const;
+	Vei2 toScreen(const Vei2& tile) const;
+	Vei2 toTile(const Vei2& screenPoint) const;
+	bool showsSameAs(const Camera& other) const;
+
+	static constexpr int nativeZoom = 4;	// 16 pixels per tile (SpriteCodex::tileSize)
+	static constexpr int minZoom = -7;	// 128 x 128 tiles per pixel, a 10000 x 10000 board fits the screen
+	static constexpr int maxZoom = 6;
+
+private:
+	int getBoardScreenSize(int tiles) const;
+	void clampOrigin();
+
+private:
+	RectI viewport = RectI(0, 0, 0, 0);
+	Vei2 boardSize = { 0, 0 };	// In tiles
+	int zoom = nativeZoom;
+	Vei2 origin = { 0, 0 };	// Screen position of the top-left corner of the board
+};
@@ -0,0 +1,91 @@
+#include "Canvas.h"
+#include <algorithm>
+#include <cstring>
+#include <assert.h>
+
+/**
+	Constructs a canvas
+
+	@param surface Surface drawn into
+	@param originIn Screen position of the top-left corner of the surface
+	@param clipIn Area of the screen the canvas writes to (inside of the surface)
+*/
+Canvas::Canvas(Surface& surface, const Vei2& originIn, const RectI& clipIn)
+	:
+	pixels(surface.getPixels()),
+	pitch(surface.getWidth()),
+	origin(originIn),
+	clip(clipIn)
+{
+	assert(clip.left >= origin.x && clip.right <= origin.x + surface.getWidth());
+	assert(clip.top >= origin.y && clip.bottom <= origin.y + surface.getHeight());
+}
+
+/**
+	Sets a pixel (which must be inside of the clip rectangle)
+
+	@param x Screen position
+	@param y Screen position
+	@param c Color
+*/
+void Canvas::PutPixel(int x, int y, Color c)
+{
+	assert(x >= clip.left && x < clip.right);
+	assert(y >= clip.top && y < clip.bottom);
+	pixels[pitch * (y - origin.y) + x - origin.x] = c;
+}
+
+/**
+	Copies a surface with its top-left at pos, a row at a time (clipped to the clip rectangle)
+
+	@param surface Surface to be copied
+	@param pos Screen position of its top-left corner
+*/
+void Canvas::DrawSurface(const Surface& surface, const Vei2& pos)
+{
+	const int left = std::max(pos.x, clip.left);
+	const int right = std::min(pos.x + surface.getWidth(), clip.right);
+	const int top = std::max(pos.y, clip.top);
+	const int bottom = std::min(pos.y + surface.getHeight(), clip.bottom);
+	if (left >= right || top >= bottom) {
+		return;
+	}
+	for (int y = top; y < bottom; ++y) {
+		std::memcpy(&pixels[pitch * (y - origin.y) + left - origin.x],
+			&surface.getPixels()[surface.getWidth() * (y - pos.y) + left - pos.x],
+			sizeof(Color) * (right - left));
+	}
+}
+
+/**
+	Fills a rectangle (which must be inside of the clip rectangle)
+
+	@param x0 Left edge (included)
+	@param y0 Top edge (included)
+	@param x1 Right edge (excluded)
+	@param y1 Bottom edge (excluded)
+	@param c Color
+*/
+void Canvas::DrawRect(int x0, int y0, int x1, int y1, Color c)
+{
+	if (x0 >= x1 || y0 >= y1) {
+		return;
+	}
+	assert(x0 >= clip.left && x1 <= clip.right);
+	assert(y0 >= clip.top && y1 <= clip.bottom);
+	for (int y = y0; y < y1; ++y) {
+		std::fill_n(&pixels[pitch * (y - origin.y) + x0 - origin.x], x1 - x0, c);
+	}
+}
+
+/**
+	Fills a rectangle (which must be inside of the clip rectangle)
+
+	@param rect Area of the screen
+	@param c Color
+*/
+void Canvas::DrawRect(const RectI& rect, Color c)
+{
+	DrawRect(rect.left, rect.top, rect.right, rect.bottom, c);
+}
+
@@ -0,0 +1,29 @@
+/**
+	Part of a surface which can be drawn into on its own, with the same drawing calls as Graphics
+
+	The surface stands for the area of the screen with its top-left at origin (drawing uses screen coordinates, like
+	Graphics::SetRenderTarget()), and the canvas only writes to the pixels inside of its clip rectangle. Canvases of the
+	same surface with clip rectangles which do not overlap can be drawn into from different threads at the same time.
+*/
+
+#pragma once
+#include "Surface.h"
+#include "Colors.h"
+#include "RectI.h"
+#include "Vei2.h"
+
+class Canvas {
+public:
+	Canvas(Surface& surface, const Vei2& originIn, const RectI& clipIn);
+
+	void PutPixel(int x, int y, Color c);
+	void DrawSurface(const Surface& surface, const Vei2& pos);
+	void DrawRect(int x0, int y0, int x1, int y1, Color c);
+	void DrawRect(const RectI& rect, Color c);
+
+private:
+	Color* pixels;
+	int pitch;
+	Vei2 origin;
+	RectI clip;
+};
@@ -0,0 +1,29 @@
+#include "CaptureBackend.h"
+#include <utility>
+
+/**
+	Constructs the backend
+
+	@param pShownIn Backend showing the frames
+	@param captureIn Capture which gets the frames while it is capturing (it has to outlive the backend)
+*/
+CaptureBackend::CaptureBackend(std::unique_ptr<GraphicsBackend> pShownIn, FrameCapture& captureIn)
+	:
+	pShown(std::move(pShownIn)),
+	capture(captureIn)
+{
+}
+
+/**
+	Shows the finished frame, then copies it for the capture
+
+	@param pPixels The frame (Graphics::ScreenHeight rows of Graphics::ScreenWidth pixels)
+	@param damage The areas which changed since the last frame
+*/
+void CaptureBackend::Present(const Color* pPixels, const std::vector<RectI>& damage)
+{
+	pShown->Present(pPixels, damage);
+	if (capture.isCapturing()) {
+		capture.captureFrame(pPixels, damage);
+	}
+}
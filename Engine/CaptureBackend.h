@@ -0,0 +1,21 @@
+/**
+	Backend which hands every finished frame to a FrameCapture while it is capturing, on top of showing it with another
+	backend (so a capture records exactly what is presented, without reading it back from the window)
+*/
+
+#pragma once
+#include "GraphicsBackend.h"
+#include "FrameCapture.h"
+#include <memory>
+#include <vector>
+
+class CaptureBackend : public GraphicsBackend {
+public:
+	CaptureBackend(std::unique_ptr<GraphicsBackend> pShownIn, FrameCapture& captureIn);
+
+	void Present(const Color* pPixels, const std::vector<RectI>& damage) override;
+
+private:
+	std::unique_ptr<GraphicsBackend> pShown;	// Shows the frames (D3D11 swap chain, memory, ...)
+	FrameCapture& capture;
+};
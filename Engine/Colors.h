@@ -19,6 +19,7 @@
 *	along with The Chili DirectX Framework.  If not, see <http://www.gnu.org/licenses/>.  *
 ******************************************************************************************/
 #pragma once
+#include <type_traits>
 
 class Color
 {
@@ -26,10 +27,7 @@ public:
 	unsigned int dword;
 public:
 	constexpr Color() : dword() {}
-	constexpr Color( const Color& col )
-		:
-		dword( col.dword )
-	{}
+	constexpr Color( const Color& col ) = default;
 	constexpr Color( unsigned int dw )
 		:
 		dword( dw )
@@ -46,11 +44,7 @@ public:
 		:
 		Color( (x << 24u) | col.dword )
 	{}
-	Color& operator =( Color color )
-	{
-		dword = color.dword;
-		return *this;
-	}
+	Color& operator =( const Color& color ) = default;
 	constexpr unsigned char GetX() const
 	{
 		return dword >> 24u;
@@ -93,6 +87,9 @@ public:
 	}
 };
 
+// rows of pixels are copied with memcpy
+static_assert( std::is_trivially_copyable<Color>::value,"Color must stay trivially copyable" );
+
 namespace Colors
 {
 	static constexpr Color MakeRGB( unsigned char r,unsigned char g,unsigned char b )
@@ -0,0 +1,50 @@
+/**
+	Counter-based random numbers (SplitMix64)
+
+	The n-th number of a sequence is computed directly from the seed and n, without any state to advance,
+	so any part of a sequence can be generated in any order (or on any thread) and still give the same numbers.
+*/
+
+#pragma once
+#include <cstdint>
+
+namespace CounterRng {
+	/**
+		SplitMix64 finalizer, turns any 64 bit value into a well mixed 64 bit hash
+
+		@param x
+		@return hash
+	*/
+	inline std::uint64_t mix(std::uint64_t x)
+	{
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+		return x ^ (x >> 31);
+	}
+
+	/**
+		Returns the number at input position of the sequence of input seed (the counter-th output of SplitMix64)
+
+		@param seed
+		@param counter Position in the sequence
+		@return number
+	*/
+	inline std::uint64_t get(std::uint64_t seed, std::uint64_t counter)
+	{
+		return mix(seed + (counter + 1) * 0x9E3779B97F4A7C15ull);
+	}
+
+	/**
+		Returns the number at input position of the sequence of input seed, reduced to [0, bound)
+		(Uses the high half of a 32x32 bit product instead of a modulo, the bias is at most bound / 2^32)
+
+		@param seed
+		@param counter Position in the sequence
+		@param bound
+		@return number
+	*/
+	inline std::uint32_t getBelow(std::uint64_t seed, std::uint64_t counter, std::uint32_t bound)
+	{
+		return std::uint32_t(((get(seed, counter) >> 32) * bound) >> 32);
+	}
+}
@@ -1,6 +1,8 @@
 #include "DigitalDisplay.h"
 #include <algorithm>
 
+constexpr int DigitalDisplay::maxDisplayedValue;	// Taken by reference by std::min
+
 /**
 	Constructs a DigitalDisplay object with 0 as the default value
 */
@@ -69,7 +71,7 @@ int DigitalDisplay::getHeight()
 */
 void DigitalDisplay::operator++()
 {
-	displayedNumber = NumberSprite(displayedNumber.getValue() + 1, displayedDigits);
+	setValue(displayedNumber.getValue() + 1);
 }
 
 /**
@@ -77,5 +79,19 @@ void DigitalDisplay::operator++()
 */
 void DigitalDisplay::operator--()
 {
-	displayedNumber = NumberSprite(displayedNumber.getValue() - 1, displayedDigits);
+	setValue(displayedNumber.getValue() - 1);
+}
+
+/**
+	Changes the number drawn on the display, an unchanged number does nothing
+	(so the timer can be set every frame)
+
+	@param value Value to be shown on the display (capped at 999)
+*/
+void DigitalDisplay::setValue(int value)
+{
+	value = std::min(value, maxDisplayedValue);
+	if (value != displayedNumber.getValue()) {
+		displayedNumber = NumberSprite(value, displayedDigits);
+	}
 }
@@ -17,6 +17,7 @@ public:
 
 	void operator++();
 	void operator--();
+	void setValue(int value);
 
 	void draw(Graphics& gfx, int x, int y) const;
 	int getValue() const;
@@ -0,0 +1,99 @@
+#include "DirtyTiles.h"
+#include <algorithm>
+#include <assert.h>
+
+constexpr int DirtyTiles::maxListedTiles;	// Taken by reference by std::min
+
+/**
+	Changes the amount of tiles of the board and marks every tile as changed
+	The list reserves room for every tile it can hold up front, so marking tiles never allocates
+
+	@param tileCountIn
+*/
+void DirtyTiles::resize(int tileCountIn)
+{
+	assert(tileCountIn >= 0);
+	tileCount = tileCountIn;
+	isListed.assign((tileCount + bitsPerWord - 1) / bitsPerWord, 0);
+	tiles.clear();
+	tiles.reserve(std::min(tileCount, maxListedTiles));
+	all = true;
+}
+
+/**
+	Marks the tile at input index as changed (Marks every tile if the list is full)
+
+	@param index
+*/
+void DirtyTiles::mark(int index)
+{
+	assert(index >= 0 && index < tileCount);
+	if (all) {
+		return;
+	}
+	const std::uint64_t bit = std::uint64_t(1) << (index % bitsPerWord);
+	std::uint64_t& word = isListed[index / bitsPerWord];
+	if ((word & bit) == 0) {
+		if ((int)tiles.size() == maxListedTiles) {
+			markAll();
+			return;
+		}
+		word |= bit;
+		tiles.push_back(index);
+	}
+}
+
+/**
+	Marks every tile as changed
+*/
+void DirtyTiles::markAll()
+{
+	all = true;
+}
+
+/**
+	Marks every tile as unchanged (Called once the changes were drawn)
+*/
+void DirtyTiles::clear()
+{
+	if (all) {
+		std::fill(isListed.begin(), isListed.end(), std::uint64_t(0));
+	}
+	else {
+		for (int index : tiles) {
+			isListed[index / bitsPerWord] = 0;
+		}
+	}
+	tiles.clear();
+	all = false;
+}
+
+/**
+	Returns true if every tile changed (getTiles() is not kept then)
+
+	@return bool
+*/
+bool DirtyTiles::hasAll() const
+{
+	return all;
+}
+
+/**
+	Returns the changed tiles, each listed once (Only if not every tile changed)
+
+	@return tiles
+*/
+const std::vector<int>& DirtyTiles::getTiles() const
+{
+	return tiles;
+}
+
+/**
+	Returns the amount of memory held by the list (in bytes)
+
+	@return bytes
+*/
+std::size_t DirtyTiles::getMemoryUsage() const
+{
+	return isListed.capacity() * sizeof(std::uint64_t) + tiles.capacity() * sizeof(int);
+}
@@ -0,0 +1,33 @@
+/**
+	List of the tiles of a board which changed since the board was last drawn (See BoardLayer)
+
+	Every tile is listed at most once (a bit per tile remembers which tiles are listed), and the list holds at most
+	maxListedTiles entries: once more tiles change, every tile is marked as changed instead. A change to the whole board
+	is kept as a single flag instead of a list.
+*/
+
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class DirtyTiles {
+public:
+	void resize(int tileCountIn);
+	void mark(int index);
+	void markAll();
+	void clear();
+
+	bool hasAll() const;
+	const std::vector<int>& getTiles() const;
+	std::size_t getMemoryUsage() const;
+
+	static constexpr int bitsPerWord = 64;
+	static constexpr int maxListedTiles = 1 << 16;	// 256 KB, about 35 screens of tiles at the size of the sprites
+
+private:
+	int tileCount = 0;
+	bool all = true;	// Every tile changed (the list is not kept)
+	std::vector<std::uint64_t> isListed;	// 1 bit per tile
+	std::vector<int> tiles;	// Changed tiles in the order they first changed
+};
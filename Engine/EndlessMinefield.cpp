@@ -0,0 +1,556 @@
+#include "EndlessMinefield.h"
+#include "ScanlineFill.h"
+#include "SpriteCodex.h"
+#include "CounterRng.h"
+#include <algorithm>
+#include <cstdlib>
+#include <assert.h>
+
+/**
+	Constructs an endless minefield
+
+	@param seedIn Seed from which the mines of every chunk are generated
+	@param mineDensityIn Probability of a tile having a mine (clamped to [minMineDensity, maxMineDensity])
+*/
+EndlessMinefield::EndlessMinefield(std::uint64_t seedIn, float mineDensityIn)
+	:
+	countScratch(chunkSize + 2, chunkSize + 2),
+	seed(seedIn)
+{
+	const float density = std::min(std::max(mineDensityIn, minMineDensity), maxMineDensity);
+	mineThreshold = std::uint32_t(density * float(1 << 24));
+	dirtyTiles.resize(viewColumns * viewRows);
+}
+
+/**
+	Splits a tile location into the chunk which holds the tile and the index of the tile inside of the chunk
+
+	@param x
+	@param y
+	@return chunkLocation
+*/
+EndlessMinefield::ChunkLocation EndlessMinefield::toChunkLocation(int x, int y)
+{
+	// Round towards negative infinity, so tile -1 lands in chunk -1
+	const int chunkX = (x >= 0 ? x : x - (chunkSize - 1)) / chunkSize;
+	const int chunkY = (y >= 0 ? y : y - (chunkSize - 1)) / chunkSize;
+	return { chunkX, chunkY, (y - chunkY * chunkSize) * chunkSize + (x - chunkX * chunkSize) };
+}
+
+/**
+	Returns the key of a chunk in the chunk map
+
+	@param chunkX
+	@param chunkY
+	@return key
+*/
+std::uint64_t EndlessMinefield::getChunkKey(int chunkX, int chunkY)
+{
+	return (std::uint64_t(std::uint32_t(chunkX)) << 32) | std::uint32_t(chunkY);
+}
+
+/**
+	Returns the chunk coordinates of a key of the chunk map
+
+	@param key
+	@return chunkCoordinates
+*/
+Vei2 EndlessMinefield::getChunkCoordinates(std::uint64_t key)
+{
+	return { int(std::int32_t(key >> 32)), int(std::int32_t(key & 0xFFFFFFFFu)) };
+}
+
+/**
+	Returns true if the tile at input location has a mine (Computed from the seed, does not need the chunk to exist)
+
+	@param x
+	@param y
+	@return bool
+*/
+bool EndlessMinefield::hasMine(int x, int y) const
+{
+	if (hasSafeZone && std::abs(x - safeCenter.x) <= 1 && std::abs(y - safeCenter.y) <= 1) {
+		return false;
+	}
+	const ChunkLocation location = toChunkLocation(x, y);
+	const std::uint64_t chunkSeed = CounterRng::get(seed, getChunkKey(location.chunkX, location.chunkY));
+	return std::uint32_t(CounterRng::get(chunkSeed, std::uint64_t(location.index)) >> 40) < mineThreshold;
+}
+
+/**
+	Returns the state of the tile at input location (Tiles of chunks which were never touched are hidden)
+
+	@param x
+	@param y
+	@return state
+*/
+EndlessMinefield::State EndlessMinefield::getState(int x, int y) const
+{
+	const ChunkLocation location = toChunkLocation(x, y);
+	const TileGrid* chunk = findChunk(location.chunkX, location.chunkY);
+	if (chunk != nullptr) {
+		return chunk->getState(location.index);
+	}
+	const auto stored = storedChunks.find(getChunkKey(location.chunkX, location.chunkY));
+	if (stored != storedChunks.end()) {
+		const int shift = (location.index % TileGrid::statesPerByte) * 2;
+		return State((stored->second[location.index / TileGrid::statesPerByte] >> shift) & 3);
+	}
+	return State::Hidden;
+}
+
+/**
+	Sets the state of the tile at input location, allocating its chunk if needed (and marks the tile as changed if it
+	is in view)
+
+	@param x
+	@param y
+	@param stateIn
+*/
+void EndlessMinefield::setState(int x, int y, State stateIn)
+{
+	const ChunkLocation location = toChunkLocation(x, y);
+	getChunk(location.chunkX, location.chunkY).setState(location.index, stateIn);
+	const Vei2 viewLocation = Vei2(x, y) - viewOrigin;
+	if (viewLocation.x >= 0 && viewLocation.x < viewColumns && viewLocation.y >= 0 && viewLocation.y < viewRows) {
+		dirtyTiles.mark(viewLocation.y * viewColumns + viewLocation.x);
+	}
+}
+
+/**
+	Ends the game, the hidden mines and the wrong flags are shown from now on
+*/
+void EndlessMinefield::explode()
+{
+	isExploded = true;
+	dirtyTiles.markAll();
+}
+
+/**
+	Returns the amount of mines adjacent to the tile at input location (Read from its chunk if it exists, computed from
+	the seed otherwise, so reading never allocates a chunk)
+
+	@param x
+	@param y
+	@return adjacentMineCount
+*/
+int EndlessMinefield::getAdjacentMineCount(int x, int y) const
+{
+	const ChunkLocation location = toChunkLocation(x, y);
+	const TileGrid* chunk = findChunk(location.chunkX, location.chunkY);
+	if (chunk != nullptr) {
+		return chunk->getAdjacentMineCount(location.index);
+	}
+	int adjacentMineCount = 0;
+	for (int yy = y - 1; yy <= y + 1; ++yy) {
+		for (int xx = x - 1; xx <= x + 1; ++xx) {
+			if ((xx != x || yy != y) && hasMine(xx, yy)) {
+				++adjacentMineCount;
+			}
+		}
+	}
+	return adjacentMineCount;
+}
+
+/**
+	Returns the chunk at input chunk coordinates, generating it if it does not exist yet (with the states it had if it
+	was evicted)
+
+	@param chunkX
+	@param chunkY
+	@return chunk
+*/
+TileGrid & EndlessMinefield::getChunk(int chunkX, int chunkY)
+{
+	const std::uint64_t key = getChunkKey(chunkX, chunkY);
+	auto it = chunks.find(key);
+	if (it == chunks.end()) {
+		it = chunks.emplace(key, TileGrid(chunkSize, chunkSize)).first;
+		TileGrid& chunk = it->second;
+		generateChunk(chunk, chunkX, chunkY);
+		const auto stored = storedChunks.find(key);
+		if (stored != storedChunks.end()) {
+			for (int index = 0; index < chunk.getTileCount(); ++index) {
+				const int shift = (index % TileGrid::statesPerByte) * 2;
+				const State state = State((stored->second[index / TileGrid::statesPerByte] >> shift) & 3);
+				if (state != State::Hidden) {
+					chunk.setState(index, state);
+				}
+			}
+			storedChunks.erase(stored);
+		}
+	}
+	return it->second;
+}
+
+/**
+	Returns the chunk at input chunk coordinates, or nullptr if it was never allocated
+
+	@param chunkX
+	@param chunkY
+	@return chunk
+*/
+const TileGrid * EndlessMinefield::findChunk(int chunkX, int chunkY) const
+{
+	const auto it = chunks.find(getChunkKey(chunkX, chunkY));
+	return it != chunks.end() ? &it->second : nullptr;
+}
+
+/**
+	Fills in the mines and adjacent mine counts of a chunk (The states of its tiles are left untouched)
+
+	@param chunk
+	@param chunkX
+	@param chunkY
+*/
+void EndlessMinefield::generateChunk(TileGrid & chunk, int chunkX, int chunkY)
+{
+	const int originX = chunkX * chunkSize;
+	const int originY = chunkY * chunkSize;
+
+	// Lay the mines of the chunk and of a 1 tile halo around it out in the scratch grid,
+	// so the mines of the neighbouring chunks are counted without allocating those chunks
+	countScratch.clearMines();
+	for (int y = 0; y < chunkSize + 2; ++y) {
+		for (int x = 0; x < chunkSize + 2; ++x) {
+			if (hasMine(originX + x - 1, originY + y - 1)) {
+				countScratch.setMine(countScratch.indexOf(x, y), true);
+			}
+		}
+	}
+	countScratch.countAdjacentMines();
+
+	chunk.clearMines();
+	for (int y = 0; y < chunkSize; ++y) {
+		for (int x = 0; x < chunkSize; ++x) {
+			const int scratchIndex = countScratch.indexOf(x + 1, y + 1);
+			if (countScratch.hasMine(scratchIndex)) {
+				chunk.setMine(chunk.indexOf(x, y), true);
+			}
+			chunk.setAdjacentMineCount(chunk.indexOf(x, y), countScratch.getAdjacentMineCount(scratchIndex));
+		}
+	}
+}
+
+/**
+	Evicts the chunks further than evictionDistance chunks from the view: a chunk whose tiles are all hidden is dropped,
+	any other one is replaced by the states of its tiles. Frees the fill stack if a huge opening grew it
+*/
+void EndlessMinefield::evictFarChunks()
+{
+	const ChunkLocation first = toChunkLocation(viewOrigin.x, viewOrigin.y);
+	const ChunkLocation last = toChunkLocation(viewOrigin.x + viewColumns - 1, viewOrigin.y + viewRows - 1);
+	for (auto it = chunks.begin(); it != chunks.end();) {
+		const Vei2 chunkCoordinates = getChunkCoordinates(it->first);
+		if (chunkCoordinates.x >= first.chunkX - evictionDistance && chunkCoordinates.x <= last.chunkX + evictionDistance
+			&& chunkCoordinates.y >= first.chunkY - evictionDistance && chunkCoordinates.y <= last.chunkY + evictionDistance) {
+			++it;
+			continue;
+		}
+
+		const TileGrid& chunk = it->second;
+		std::vector<std::uint8_t> states(chunk.getTileCount() / TileGrid::statesPerByte, 0);
+		bool isTouched = false;
+		for (int index = 0; index < chunk.getTileCount(); ++index) {
+			const State state = chunk.getState(index);
+			states[index / TileGrid::statesPerByte] |= std::uint8_t(int(state) << ((index % TileGrid::statesPerByte) * 2));
+			isTouched = isTouched || state != State::Hidden;
+		}
+		if (isTouched) {
+			storedChunks.emplace(it->first, std::move(states));
+		}
+		it = chunks.erase(it);
+	}
+
+	if (fillStack.capacity() > maxKeptFillStackSize) {
+		std::vector<Vei2>().swap(fillStack);
+	}
+}
+
+/**
+	Keeps the 3x3 box around the first revealed tile free of mines, so the first click always opens an area
+
+	@param tileLocation
+*/
+void EndlessMinefield::setSafeZone(const Vei2 & tileLocation)
+{
+	assert(!hasSafeZone);
+	hasSafeZone = true;
+	safeCenter = tileLocation;
+
+	// Chunks touched before the first reveal (by flags) were generated without the safe zone (evicted ones get it once
+	// they are touched again)
+	for (auto& keyAndChunk : chunks) {
+		const Vei2 chunkCoordinates = getChunkCoordinates(keyAndChunk.first);
+		generateChunk(keyAndChunk.second, chunkCoordinates.x, chunkCoordinates.y);
+	}
+}
+
+/**
+	Reveals the tile at input location and, if it has 0 adjacent mines, the whole opening around it (across chunks)
+
+	@param x
+	@param y
+*/
+void EndlessMinefield::revealTile(int x, int y)
+{
+	const State state = getState(x, y);
+	if (state != State::Hidden && state != State::PartiallyRevealed) {
+		return;
+	}
+	if (!hasSafeZone) {
+		setSafeZone({ x, y });	// Mines are settled after the first click
+	}
+
+	if (hasMine(x, y)) {
+		setState(x, y, State::Revealed);
+		explode();
+		return;
+	}
+
+	// Exposes the endless field to the scanline fill, chunks get allocated as the fill reaches them
+	struct FillView {
+		EndlessMinefield& field;
+		bool contains(int, int) const { return true; }
+		bool isRevealable(int x, int y) const {
+			const State state = field.getState(x, y);
+			return state == State::Hidden || state == State::PartiallyRevealed;
+		}
+		bool isEmpty(int x, int y) const { return field.getAdjacentMineCount(x, y) == 0; }
+		void reveal(int x, int y) { field.setState(x, y, State::Revealed); }
+	} view = { *this };
+
+	revealedCounter += ScanlineFill::reveal(view, x, y, fillStack);
+}
+
+/**
+	Reveals the tiles surrounding a revealed number, if the number of flags around it matches the number
+
+	@param x
+	@param y
+*/
+void EndlessMinefield::revealSurroundingTiles(int x, int y)
+{
+	int surroundingFlagsCount = 0;
+	for (int yy = y - 1; yy <= y + 1; ++yy) {
+		for (int xx = x - 1; xx <= x + 1; ++xx) {
+			if (getState(xx, yy) == State::Flagged) {
+				++surroundingFlagsCount;
+			}
+		}
+	}
+
+	if (surroundingFlagsCount == getAdjacentMineCount(x, y)) {
+		for (int yy = y - 1; yy <= y + 1; ++yy) {
+			for (int xx = x - 1; xx <= x + 1; ++xx) {
+				if (getState(xx, yy) == State::Hidden) {
+					revealTile(xx, yy);
+				}
+			}
+		}
+	}
+}
+
+/**
+	Converts a global location input to the location of the tile drawn there
+
+	@param globalLocation
+	@return tileLocation
+*/
+Vei2 EndlessMinefield::getTileLocation(const Vei2 & globalLocation) const
+{
+	assert(tileExistsAtLocation(globalLocation));
+	return viewOrigin + Vei2(globalLocation.x / SpriteCodex::tileSize, (globalLocation.y - boardTop) / SpriteCodex::tileSize);
+}
+
+/**
+	Returns true if a tile is drawn at input location (Everywhere below the displays)
+
+	@param globalLocation
+	@return bool
+*/
+bool EndlessMinefield::tileExistsAtLocation(const Vei2 & globalLocation) const
+{
+	return globalLocation.x >= 0 && globalLocation.x < Graphics::ScreenWidth
+		&& globalLocation.y >= boardTop && globalLocation.y < Graphics::ScreenHeight;
+}
+
+/**
+	Partially reveals a tile at given location
+
+	@param globalLocation
+*/
+void EndlessMinefield::partiallyRevealTileAtLocation(const Vei2 & globalLocation)
+{
+	const Vei2 tile = getTileLocation(globalLocation);
+	if (getState(tile.x, tile.y) == State::Hidden) {
+		setState(tile.x, tile.y, State::PartiallyRevealed);
+		hasPartiallyRevealedTile = true;
+		partiallyRevealedTile = tile;
+	}
+}
+
+/**
+	Reveals a tile at input location
+
+	@param globalLocation
+*/
+void EndlessMinefield::revealTileAtLocation(const Vei2 & globalLocation)
+{
+	if (!isExploded) {
+		const Vei2 tile = getTileLocation(globalLocation);
+		revealTile(tile.x, tile.y);
+		hasPartiallyRevealedTile = false;
+	}
+}
+
+/**
+	Reveals tiles surrounding the tile at input location if it is revealed, flags the tile otherwise
+
+	@param globalLocation
+*/
+void EndlessMinefield::revealSurroundingTilesOrFlagTileAtLocation(const Vei2 & globalLocation)
+{
+	const Vei2 tile = getTileLocation(globalLocation);
+	const State state = getState(tile.x, tile.y);
+	if (state == State::Revealed) {
+		revealSurroundingTiles(tile.x, tile.y);
+	}
+	else if (state == State::Hidden || state == State::Flagged) {
+		toggleTileFlagAtLocation(globalLocation);
+	}
+}
+
+/**
+	Toggles flag of tile at input location
+
+	@param globalLocation
+*/
+void EndlessMinefield::toggleTileFlagAtLocation(const Vei2 & globalLocation)
+{
+	const Vei2 tile = getTileLocation(globalLocation);
+	const State state = getState(tile.x, tile.y);
+	if (state == State::Hidden) {
+		setState(tile.x, tile.y, State::Flagged);
+	}
+	else if (state == State::Flagged) {
+		setState(tile.x, tile.y, State::Hidden);
+	}
+}
+
+/**
+	Hides the tile that was partially revealed
+*/
+void EndlessMinefield::hidePartiallyRevealedTile()
+{
+	if (hasPartiallyRevealedTile) {
+		setState(partiallyRevealedTile.x, partiallyRevealedTile.y, State::Hidden);
+		hasPartiallyRevealedTile = false;
+	}
+}
+
+/**
+	Returns true if tile at input location is partially revealed
+
+	@param globalLocation
+	@return bool
+*/
+bool EndlessMinefield::tileAtLocationIsPartiallyRevealed(const Vei2 & globalLocation) const
+{
+	const Vei2 tile = getTileLocation(globalLocation);
+	return getState(tile.x, tile.y) == State::PartiallyRevealed;
+}
+
+/**
+	Moves the view over the field
+
+	@param tiles The amount of tiles to move the view by
+*/
+void EndlessMinefield::pan(const Vei2 & tiles)
+{
+	viewOrigin += tiles;
+	dirtyTiles.markAll();	// Every tile in view is another tile of the field now
+	evictFarChunks();
+}
+
+/**
+	Draws the part of the field which is in view (Only the tiles which changed since the last frame get redrawn, see
+	BoardLayer)
+
+	@param gfx Graphics processor
+*/
+void EndlessMinefield::draw(Graphics & gfx)
+{
+	layer.draw(gfx, camera, dirtyTiles, [this](Graphics& target, int index, const Vei2&) {
+		drawTile(target, viewOrigin.x + index % viewColumns, viewOrigin.y + index / viewColumns);
+	});
+}
+
+/**
+	Draws a single tile (If the field is exploded, draws hidden mines as well)
+
+	@param gfx Graphics processor
+	@param x
+	@param y Location of the tile
+*/
+void EndlessMinefield::drawTile(Graphics & gfx, int x, int y) const
+{
+	const Vei2 position = (Vei2(x, y) - viewOrigin) * SpriteCodex::tileSize + Vei2(0, boardTop);
+	// The chunk of a tile in view may still be evicted (the view came back to it), so the tile is read through the getters
+	switch (getState(x, y)) {
+	case State::Hidden:
+		if (isExploded && hasMine(x, y)) {
+			SpriteCodex::drawTileMine(position, gfx);
+		}
+		SpriteCodex::drawTileButton(position, gfx);
+		break;
+	case State::PartiallyRevealed:
+		SpriteCodex::drawTile0(position, gfx);
+		break;
+	case State::Revealed:
+		if (!hasMine(x, y)) {
+			SpriteCodex::drawTileNumber(getAdjacentMineCount(x, y), position, gfx);
+		}
+		else {
+			SpriteCodex::drawTileMineRed(position, gfx);
+		}
+		break;
+	case State::Flagged:
+		SpriteCodex::drawTileButton(position, gfx);
+		SpriteCodex::drawTileFlag(position, gfx);
+		if (isExploded && !hasMine(x, y)) {
+			SpriteCodex::drawTileCross(position, gfx);
+		}
+		break;
+	}
+}
+
+/**
+	Returns the amount of revealed tiles
+
+	@return revealedCounter
+*/
+int EndlessMinefield::getRevealedCounter() const
+{
+	return revealedCounter;
+}
+
+/**
+	Returns the amount of chunks which have been allocated so far
+
+	@return chunkCount
+*/
+int EndlessMinefield::getAllocatedChunkCount() const
+{
+	return (int)chunks.size();
+}
+
+/**
+	Returns the amount of evicted chunks whose states are kept
+
+	@return chunkCount
+*/
+int EndlessMinefield::getStoredChunkCount() const
+{
+	return (int)storedChunks.size();
+}
@@ -0,0 +1,108 @@
+/**
+	Manages an endless minefield (a minefield without edges)
+
+	The field is split into chunks of chunkSize x chunkSize tiles, kept in a hash map by their chunk coordinates.
+	Mines are never stored up front: whether a tile has a mine is a hash of the seed, the chunk coordinates and
+	the position of the tile inside the chunk. A chunk is only allocated once one of its tiles changes state,
+	so the memory used stays proportional to the explored area.
+	Once the view moves away, chunks far from it are evicted: a chunk whose tiles are all hidden again is dropped, any
+	other one keeps only the states of its tiles (its mines and numbers are generated again when it is touched).
+	The screen shows a window of the field, drawn as a board of viewColumns x viewRows tiles through a BoardLayer, so a
+	frame only redraws the tiles which changed (every tile once the view moves).
+*/
+
+#pragma once
+
+#include "Graphics.h"
+#include "Vei2.h"
+#include "TileGrid.h"
+#include "DigitalDisplay.h"
+#include "SpriteCodex.h"
+#include "BoardLayer.h"
+#include "DirtyTiles.h"
+#include "Camera.h"
+#include "RectI.h"
+#include <unordered_map>
+#include <cstdint>
+#include <vector>
+
+class EndlessMinefield {
+public:
+	EndlessMinefield() = default;
+	EndlessMinefield(std::uint64_t seedIn, float mineDensityIn = defaultMineDensity);
+
+	void partiallyRevealTileAtLocation(const Vei2& globalLocation);
+	void revealTileAtLocation(const Vei2& globalLocation);
+	void revealSurroundingTilesOrFlagTileAtLocation(const Vei2& globalLocation);
+	void toggleTileFlagAtLocation(const Vei2& globalLocation);
+	void hidePartiallyRevealedTile();
+	void pan(const Vei2& tiles);
+
+	void draw(Graphics& gfx);
+	bool tileExistsAtLocation(const Vei2& globalLocation) const;
+	bool tileAtLocationIsPartiallyRevealed(const Vei2& globalLocation) const;
+	int getRevealedCounter() const;
+	int getAllocatedChunkCount() const;
+	int getStoredChunkCount() const;
+
+	bool isExploded = false;
+	static constexpr int chunkSize = 64;
+	static constexpr int evictionDistance = 2;	// Chunks further than this many chunks from the view get evicted
+	static constexpr int maxKeptFillStackSize = 4 * chunkSize;	// The fill stack is freed above this size on eviction
+	static constexpr float defaultMineDensity = 0.2f;
+	// Below this density the openings could grow without end (0 tiles would percolate)
+	static constexpr float minMineDensity = 0.15f;
+	static constexpr float maxMineDensity = 0.9f;
+	static constexpr int boardTop = 40;	// The board fills the screen below the displays
+	static constexpr int viewColumns = Graphics::ScreenWidth / SpriteCodex::tileSize;	// Tiles shown across the screen
+	static constexpr int viewRows = (Graphics::ScreenHeight - boardTop) / SpriteCodex::tileSize;
+
+private:
+	using State = TileGrid::State;
+
+	/**
+		Location of a tile in chunk coordinates
+	*/
+	struct ChunkLocation {
+		int chunkX;
+		int chunkY;
+		int index;	// Index of the tile inside the chunk
+	};
+
+private:
+	static ChunkLocation toChunkLocation(int x, int y);
+	static std::uint64_t getChunkKey(int chunkX, int chunkY);
+	static Vei2 getChunkCoordinates(std::uint64_t key);
+
+	Vei2 getTileLocation(const Vei2& globalLocation) const;
+	bool hasMine(int x, int y) const;
+	State getState(int x, int y) const;
+	void setState(int x, int y, State stateIn);
+	void explode();
+	int getAdjacentMineCount(int x, int y) const;
+	TileGrid& getChunk(int chunkX, int chunkY);
+	const TileGrid* findChunk(int chunkX, int chunkY) const;
+	void generateChunk(TileGrid& chunk, int chunkX, int chunkY);
+	void evictFarChunks();
+	void setSafeZone(const Vei2& tileLocation);
+	void revealTile(int x, int y);
+	void revealSurroundingTiles(int x, int y);
+	void drawTile(Graphics& gfx, int x, int y) const;
+
+	std::unordered_map<std::uint64_t, TileGrid> chunks;
+	std::unordered_map<std::uint64_t, std::vector<std::uint8_t>> storedChunks;	// States of the evicted chunks, 2 bits per tile
+	TileGrid countScratch;	// Chunk with a 1 tile halo used to count the mines around the chunk edges
+	std::vector<Vei2> fillStack;
+	std::uint64_t seed = 0;
+	std::uint32_t mineThreshold = 0;	// A tile has a mine if its 24 bit hash is below this value
+	bool hasSafeZone = false;
+	Vei2 safeCenter = { 0, 0 };	// The first revealed tile, it and its surrounding tiles never have mines
+	bool hasPartiallyRevealedTile = false;
+	Vei2 partiallyRevealedTile = { 0, 0 };
+	Vei2 viewOrigin = { 0, 0 };	// Location of the tile drawn at the top-left corner of the board
+	// The tiles in view as a board, the tile at index i is at viewOrigin + (i % viewColumns, i / viewColumns)
+	Camera camera = Camera(RectI(0, Graphics::ScreenWidth, boardTop, Graphics::ScreenHeight), Vei2(viewColumns, viewRows));
+	BoardLayer layer;
+	DirtyTiles dirtyTiles;	// Tiles in view which changed since the last frame
+	int revealedCounter = 0;
+};
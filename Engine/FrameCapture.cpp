@@ -0,0 +1,391 @@
+#include "FrameCapture.h"
+#include "Graphics.h"
+#include <string.h>
+#include <algorithm>
+#include <assert.h>
+
+/**
+	Stops the capture (every queued frame is written first)
+*/
+FrameCapture::~FrameCapture()
+{
+	stop();
+}
+
+/**
+	Creates the file and starts the writer thread
+
+	@param path Path of the file, overwritten if it exists
+	@param formatIn Format of the file
+	@param framesPerSecond Frame rate of the game (the video plays at framesPerSecond / frameIntervalIn)
+	@param frameIntervalIn Keeps one of every frameIntervalIn frames (1 keeps every frame)
+	@param usesDeltaFramesIn Only copy the tiles which changed since the last captured frame
+	@param queueCapacityIn Frames which can wait for the writer (more are dropped)
+	@return If the file could be created
+*/
+bool FrameCapture::start(const std::string& path, Format formatIn, int framesPerSecond, int frameIntervalIn,
+	bool usesDeltaFramesIn, int queueCapacityIn)
+{
+	assert(!isCapturing());
+	assert(framesPerSecond > 0 && frameIntervalIn >= 1 && queueCapacityIn >= 1);
+	constexpr int width = Graphics::ScreenWidth;
+	constexpr int height = Graphics::ScreenHeight;
+	static_assert(width % 2 == 0 && height % 2 == 0 && tileSize % 2 == 0, "4:2:0 chroma needs even tiles");
+	file.open(path, std::ios::binary | std::ios::trunc);
+	if (!file) {
+		return false;
+	}
+	format = formatIn;
+	frameInterval = frameIntervalIn;
+	usesDeltaFrames = usesDeltaFramesIn;
+	widthInTiles = (width + tileSize - 1) / tileSize;
+	heightInTiles = (height + tileSize - 1) / tileSize;
+	changedTiles.assign(std::size_t(widthInTiles) * heightInTiles, 0);
+	needsFullFrame = true;
+	framesUntilKept = 0;
+	droppedSinceQueued = 0;
+
+	queueCapacity = queueCapacityIn;
+	if ((int)buffers.size() < queueCapacity) {
+		buffers.resize(queueCapacity);
+	}
+	for (int i = 0; i < queueCapacity; ++i) {
+		buffers[i].pixels.resize(std::size_t(width) * height);
+		buffers[i].tiles.reserve(changedTiles.size());
+	}
+	firstQueued = 0;
+	queueLength = 0;
+	isStopping = false;
+	stats = Stats();
+
+	const std::string size = "W" + std::to_string(width) + " H" + std::to_string(height);
+	std::string header;
+	if (format == Format::Y4M) {
+		file << "YUV4MPEG2 " << size << " F" << framesPerSecond << ':' << frameInterval << " Ip A1:1 C420jpeg\n";
+		header = "FRAME\n";
+		encodedFrame.resize(std::size_t(width) * height + 2 * std::size_t(width / 2) * (height / 2));
+	}
+	else {
+		header = "P6\n" + std::to_string(width) + ' ' + std::to_string(height) + "\n255\n";
+		encodedFrame.resize(std::size_t(width) * height * 3);
+	}
+	frameHeader.assign(header.begin(), header.end());
+
+	writer = std::thread(&FrameCapture::write, this);
+	return true;
+}
+
+/**
+	Writes the frames still waiting for the writer, then stops the writer thread and closes the file
+	(The frames dropped after the last queued one are written as repeats of it)
+*/
+void FrameCapture::stop()
+{
+	if (!isCapturing()) {
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStopping = true;
+	}
+	frameQueued.notify_one();
+	writer.join();
+
+	for (int i = 0; i < droppedSinceQueued; ++i) {
+		writeEncodedFrame();
+	}
+	stats.writtenFrames += droppedSinceQueued;
+	stats.writtenBytes += std::uint64_t(droppedSinceQueued) * (frameHeader.size() + encodedFrame.size());
+	stats.hasWriteError = stats.hasWriteError || !file;
+	droppedSinceQueued = 0;
+	file.close();
+}
+
+/**
+	Returns true between start() and stop()
+
+	@return bool
+*/
+bool FrameCapture::isCapturing() const
+{
+	return writer.joinable();
+}
+
+/**
+	Copies a finished frame for the writer, unless it is skipped (frameInterval) or dropped (no free buffer)
+
+	@param pPixels The frame (Graphics::ScreenHeight rows of Graphics::ScreenWidth pixels)
+	@param damage The areas which changed since the frame before
+*/
+void FrameCapture::captureFrame(const Color* pPixels, const std::vector<RectI>& damage)
+{
+	assert(isCapturing());
+	const auto start = std::chrono::steady_clock::now();
+	// Skipped and dropped frames still count their changes, the next queued frame holds them
+	markChangedTiles(damage);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	++stats.presentedFrames;
+	if (framesUntilKept > 0) {
+		--framesUntilKept;
+		++stats.skippedFrames;
+		stats.captureSeconds += secondsSince(start);
+		return;
+	}
+	framesUntilKept = frameInterval - 1;
+	if (queueLength == queueCapacity) {
+		++stats.droppedFrames;
+		++droppedSinceQueued;
+		stats.captureSeconds += secondsSince(start);
+		return;
+	}
+	// The buffer after the queue is not read by the writer until it is queued
+	Buffer& buffer = buffers[(firstQueued + queueLength) % queueCapacity];
+	lock.unlock();
+
+	const std::size_t copiedPixels = copyFrame(pPixels, buffer);
+	buffer.droppedBefore = droppedSinceQueued;
+	droppedSinceQueued = 0;
+
+	lock.lock();
+	++queueLength;
+	stats.maxQueueLength = std::max(stats.maxQueueLength, queueLength);
+	++stats.queuedFrames;
+	stats.deltaFrames += buffer.isDelta ? 1 : 0;
+	stats.copiedBytes += sizeof(Color) * copiedPixels;
+	stats.captureSeconds += secondsSince(start);
+	lock.unlock();
+	frameQueued.notify_one();
+}
+
+/**
+	Returns the counters of the capture (of the last one once it is stopped)
+
+	@return stats
+*/
+FrameCapture::Stats FrameCapture::getStats() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return stats;
+}
+
+/**
+	Writes the counters of the capture as a text file, one "name value" line each
+
+	@param path Path of the file, overwritten if it exists
+	@return If the whole file could be written
+*/
+bool FrameCapture::saveStats(const std::string& path) const
+{
+	const Stats s = getStats();
+	std::ofstream statsFile(path);
+	statsFile << "presentedFrames " << s.presentedFrames << '\n'
+		<< "skippedFrames " << s.skippedFrames << '\n'
+		<< "droppedFrames " << s.droppedFrames << '\n'
+		<< "queuedFrames " << s.queuedFrames << '\n'
+		<< "deltaFrames " << s.deltaFrames << '\n'
+		<< "writtenFrames " << s.writtenFrames << '\n'
+		<< "maxQueueLength " << s.maxQueueLength << " of " << queueCapacity << '\n'
+		<< "copiedBytes " << s.copiedBytes << '\n'
+		<< "writtenBytes " << s.writtenBytes << '\n'
+		<< "captureSeconds " << s.captureSeconds << '\n'
+		<< "writerBusySeconds " << s.writerBusySeconds << '\n'
+		<< "hasWriteError " << s.hasWriteError << '\n';
+	return bool(statsFile.flush());
+}
+
+/**
+	Main loop of the writer thread, writes the queued frames in order until the capture stops and none are left
+*/
+void FrameCapture::write()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true) {
+		frameQueued.wait(lock, [this] { return queueLength > 0 || isStopping; });
+		if (queueLength == 0) {
+			return;
+		}
+		const Buffer& buffer = buffers[firstQueued];
+		lock.unlock();
+
+		const auto start = std::chrono::steady_clock::now();
+		writeFrame(buffer);
+		const int nFrames = buffer.droppedBefore + 1;
+		const bool isWritten = bool(file);
+
+		lock.lock();
+		stats.writtenFrames += nFrames;
+		stats.writtenBytes += std::uint64_t(nFrames) * (frameHeader.size() + encodedFrame.size());
+		stats.writerBusySeconds += secondsSince(start);
+		stats.hasWriteError = stats.hasWriteError || !isWritten;
+		firstQueued = (firstQueued + 1) % queueCapacity;
+		--queueLength;
+	}
+}
+
+/**
+	Writes the frames dropped before a buffer (as repeats of the frame before) and then the frame of the buffer
+
+	@param buffer Queued frame
+*/
+void FrameCapture::writeFrame(const Buffer& buffer)
+{
+	for (int i = 0; i < buffer.droppedBefore; ++i) {
+		writeEncodedFrame();
+	}
+	if (buffer.isDelta) {
+		const Color* pTilePixels = buffer.pixels.data();
+		for (int tile : buffer.tiles) {
+			const RectI area = getTileArea(tile);
+			encode(pTilePixels, area.right - area.left, area);
+			pTilePixels += (area.right - area.left) * (area.bottom - area.top);
+		}
+	}
+	else {
+		encode(buffer.pixels.data(), Graphics::ScreenWidth, RectI(0, Graphics::ScreenWidth, 0, Graphics::ScreenHeight));
+	}
+	writeEncodedFrame();
+}
+
+/**
+	Appends the encoded frame to the file
+*/
+void FrameCapture::writeEncodedFrame()
+{
+	file.write((const char*)frameHeader.data(), frameHeader.size());
+	file.write((const char*)encodedFrame.data(), encodedFrame.size());
+}
+
+/**
+	Converts an area of the frame into the encoded frame (BT.601 studio range for Y4M, chroma averaged over 2x2 pixels)
+
+	@param pPixels Pixel at the top-left of the area
+	@param pitch Pixels from one row of the area to the next
+	@param area Area of the screen (left and top even)
+*/
+void FrameCapture::encode(const Color* pPixels, int pitch, const RectI& area)
+{
+	constexpr int width = Graphics::ScreenWidth;
+	constexpr int height = Graphics::ScreenHeight;
+	if (format == Format::PPM) {
+		for (int y = area.top; y < area.bottom; ++y) {
+			const Color* pRow = &pPixels[pitch * (y - area.top)];
+			unsigned char* pDst = &encodedFrame[3 * (std::size_t(width) * y + area.left)];
+			for (int x = 0; x < area.right - area.left; ++x) {
+				pDst[3 * x] = pRow[x].GetR();
+				pDst[3 * x + 1] = pRow[x].GetG();
+				pDst[3 * x + 2] = pRow[x].GetB();
+			}
+		}
+		return;
+	}
+
+	assert(area.left % 2 == 0 && area.top % 2 == 0);
+	unsigned char* const pLuma = encodedFrame.data();
+	unsigned char* const pCb = pLuma + std::size_t(width) * height;
+	unsigned char* const pCr = pCb + std::size_t(width / 2) * (height / 2);
+	for (int y = area.top; y < area.bottom; ++y) {
+		const Color* pRow = &pPixels[pitch * (y - area.top)];
+		unsigned char* pDst = &pLuma[std::size_t(width) * y + area.left];
+		for (int x = 0; x < area.right - area.left; ++x) {
+			const int r = pRow[x].GetR();
+			const int g = pRow[x].GetG();
+			const int b = pRow[x].GetB();
+			pDst[x] = (unsigned char)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+		}
+	}
+	for (int y = area.top; y < area.bottom; y += 2) {
+		const Color* pRow = &pPixels[pitch * (y - area.top)];
+		const std::size_t chromaRow = std::size_t(width / 2) * (y / 2);
+		for (int x = 0; x < area.right - area.left; x += 2) {
+			const Color c[4] = { pRow[x], pRow[x + 1], pRow[pitch + x], pRow[pitch + x + 1] };
+			const int r = (c[0].GetR() + c[1].GetR() + c[2].GetR() + c[3].GetR() + 2) >> 2;
+			const int g = (c[0].GetG() + c[1].GetG() + c[2].GetG() + c[3].GetG() + 2) >> 2;
+			const int b = (c[0].GetB() + c[1].GetB() + c[2].GetB() + c[3].GetB() + 2) >> 2;
+			const std::size_t i = chromaRow + (area.left + x) / 2;
+			pCb[i] = (unsigned char)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+			pCr[i] = (unsigned char)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+		}
+	}
+}
+
+/**
+	Marks the tiles covered by the damage of a frame as changed
+
+	@param damage The areas which changed since the frame before
+*/
+void FrameCapture::markChangedTiles(const std::vector<RectI>& damage)
+{
+	if (!usesDeltaFrames) {
+		return;
+	}
+	for (const RectI& rect : damage) {
+		for (int y = rect.top / tileSize; y <= (rect.bottom - 1) / tileSize; ++y) {
+			for (int x = rect.left / tileSize; x <= (rect.right - 1) / tileSize; ++x) {
+				changedTiles[widthInTiles * y + x] = 1;
+			}
+		}
+	}
+}
+
+/**
+	Copies a frame into a buffer: only its changed tiles when delta frames are used (unless most of them changed),
+	the whole frame otherwise
+
+	@param pPixels The frame
+	@param buffer Free buffer
+	@return The amount of pixels copied
+*/
+std::size_t FrameCapture::copyFrame(const Color* pPixels, Buffer& buffer)
+{
+	buffer.tiles.clear();
+	if (usesDeltaFrames && !needsFullFrame) {
+		for (int tile = 0; tile < (int)changedTiles.size(); ++tile) {
+			if (changedTiles[tile]) {
+				buffer.tiles.push_back(tile);
+			}
+		}
+	}
+	buffer.isDelta = usesDeltaFrames && !needsFullFrame && buffer.tiles.size() <= changedTiles.size() / 2;
+	Color* pDst = buffer.pixels.data();
+	if (buffer.isDelta) {
+		for (int tile : buffer.tiles) {
+			const RectI area = getTileArea(tile);
+			const int areaWidth = area.right - area.left;
+			for (int y = area.top; y < area.bottom; ++y, pDst += areaWidth) {
+				memcpy(pDst, &pPixels[Graphics::ScreenWidth * y + area.left], sizeof(Color) * areaWidth);
+			}
+		}
+	}
+	else {
+		memcpy(pDst, pPixels, sizeof(Color) * buffer.pixels.size());
+		pDst += buffer.pixels.size();
+	}
+	std::fill(changedTiles.begin(), changedTiles.end(), (unsigned char)0);
+	needsFullFrame = false;
+	return std::size_t(pDst - buffer.pixels.data());
+}
+
+/**
+	Returns the area of the screen covered by a tile (the tiles of the last row and column can be cut by the screen)
+
+	@param tile Index of the tile, row after row
+	@return area
+*/
+RectI FrameCapture::getTileArea(int tile) const
+{
+	const int left = tile % widthInTiles * tileSize;
+	const int top = tile / widthInTiles * tileSize;
+	return RectI(left, std::min(left + tileSize, (int)Graphics::ScreenWidth), top, std::min(top + tileSize, (int)Graphics::ScreenHeight));
+}
+
+/**
+	Returns the seconds passed since a point in time
+
+	@param start
+	@return seconds
+*/
+double FrameCapture::secondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,110 @@
+/**
+	Records the finished frames into a raw video file (YUV4MPEG2 or a stream of binary PPM images)
+
+	The game thread only copies a frame into one of a fixed ring of buffers, a writer thread converts and writes them,
+	so a slow disk never stalls the game: when every buffer is still waiting for the writer the frame is dropped (and
+	written as a repeat of the frame before, so the video keeps the timing of the game). Delta frames only copy the
+	tiles of the screen which changed since the last captured frame (from the damage Graphics hands its backend), and
+	the writer only converts those tiles again. The buffers and the encoded frame are allocated by start(), so capturing
+	does not allocate.
+*/
+
+#pragma once
+#include "Colors.h"
+#include "RectI.h"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+class FrameCapture {
+public:
+	enum class Format {
+		Y4M,	// YUV4MPEG2, 4:2:0 (BT.601), what most video tools read as raw video
+		PPM	// One binary PPM (P6) image after the other
+	};
+
+	/**
+		Counters of a capture (since start())
+	*/
+	struct Stats {
+		int presentedFrames = 0;	// Frames handed to captureFrame()
+		int skippedFrames = 0;	// Frames left out on purpose (frameInterval)
+		int droppedFrames = 0;	// Frames lost because no buffer was free (written as repeats)
+		int queuedFrames = 0;	// Frames copied into a buffer for the writer
+		int deltaFrames = 0;	// Queued frames which only hold their changed tiles
+		int writtenFrames = 0;	// Frames in the file (repeats included)
+		int maxQueueLength = 0;	// Most buffers waiting for the writer at once
+		std::uint64_t copiedBytes = 0;	// Bytes of pixels the game thread copied
+		std::uint64_t writtenBytes = 0;
+		double captureSeconds = 0.0;	// Time the game thread spent in captureFrame()
+		double writerBusySeconds = 0.0;	// Time the writer spent converting and writing
+		bool hasWriteError = false;
+	};
+
+public:
+	FrameCapture() = default;
+	FrameCapture(const FrameCapture&) = delete;
+	FrameCapture& operator=(const FrameCapture&) = delete;
+	~FrameCapture();
+
+	bool start(const std::string& path, Format formatIn, int framesPerSecond, int frameIntervalIn = 1,
+		bool usesDeltaFramesIn = true, int queueCapacityIn = defaultQueueCapacity);
+	void stop();
+	bool isCapturing() const;
+	void captureFrame(const Color* pPixels, const std::vector<RectI>& damage);
+	Stats getStats() const;
+	bool saveStats(const std::string& path) const;
+
+	static constexpr int tileSize = 16;	// Side of the squares of the screen a delta frame is made of
+	static constexpr int defaultQueueCapacity = 8;
+
+private:
+	/**
+		Frame waiting for the writer
+	*/
+	struct Buffer {
+		std::vector<Color> pixels;	// The whole frame, or the pixels of the changed tiles one tile after the other
+		std::vector<int> tiles;	// Changed tiles (only used by delta frames)
+		bool isDelta = false;
+		int droppedBefore = 0;	// Frames dropped since the frame before, written as repeats of it
+	};
+
+private:
+	void write();
+	void writeFrame(const Buffer& buffer);
+	void writeEncodedFrame();
+	void encode(const Color* pPixels, int pitch, const RectI& area);
+	void markChangedTiles(const std::vector<RectI>& damage);
+	std::size_t copyFrame(const Color* pPixels, Buffer& buffer);
+	RectI getTileArea(int tile) const;
+	static double secondsSince(std::chrono::steady_clock::time_point start);
+
+private:
+	Format format = Format::Y4M;
+	int frameInterval = 1;	// Keeps one of every frameInterval frames
+	bool usesDeltaFrames = true;
+	int widthInTiles = 0;
+	int heightInTiles = 0;
+	std::vector<unsigned char> changedTiles;	// Per tile: changed since the last queued frame (game thread only)
+	bool needsFullFrame = true;	// The next queued frame has to be a whole one (game thread only)
+	int framesUntilKept = 0;	// Frames to skip before the next kept one (game thread only)
+	int droppedSinceQueued = 0;	// (game thread only)
+	std::vector<Buffer> buffers;	// Ring of buffers, never shrinks (so the memory is kept between captures)
+	int queueCapacity = 0;
+	int firstQueued = 0;	// Oldest buffer waiting for the writer (its buffer is read by the writer outside of the lock)
+	int queueLength = 0;
+	std::vector<unsigned char> encodedFrame;	// Frame as it is written to the file (writer only)
+	std::vector<unsigned char> frameHeader;	// Written before every frame (writer only)
+	std::ofstream file;
+	std::thread writer;
+	bool isStopping = false;
+	mutable std::mutex mutex;
+	std::condition_variable frameQueued;
+	Stats stats;
+};
@@ -0,0 +1,399 @@
+#include "FrontierComponent.h"
+#include <algorithm>
+#include <climits>
+#include <assert.h>
+
+/**
+	Empties the component, so it can be given the tiles and numbers of another one
+*/
+void FrontierComponent::clear()
+{
+	tiles.clear();
+	constraintIds.clear();
+}
+
+/**
+	Adds a frontier tile to the component
+
+	@param tile Index of the tile on the board
+*/
+void FrontierComponent::addTile(int tile)
+{
+	tiles.push_back(tile);
+}
+
+/**
+	Adds a number to the component (every tile of it must be added too)
+
+	@param constraint Index of the number in the list given to count()
+*/
+void FrontierComponent::addConstraint(int constraint)
+{
+	constraintIds.push_back(constraint);
+}
+
+/**
+	Orders the tiles and counts the ways to place their mines, by the amount of mines (See getCount())
+
+	@param constraints Every number of the board
+	@param positionOfTile Per tile of the board: set to the position of the tile in the order (only the tiles of the
+		component are written, so components may be counted on several threads at once)
+	@return isConsistent False if no way of placing the mines satisfies every number
+*/
+bool FrontierComponent::count(const std::vector<Constraint>& constraints, std::vector<int>& positionOfTile)
+{
+	order(constraints, positionOfTile);
+	link();
+
+	const int nTiles = (int)tiles.size();
+	layerStart.assign(1, 0);
+	states.assign(1, { 0, 0, 0, 0 });
+	keys.clear();
+	forward.assign(1, 1.0);
+	transitionStart.clear();
+	transitions.clear();
+	for (int position = 0; position < nTiles; ++position) {
+		const int first = layerStart[position];
+		const int end = (int)states.size();
+		layerStart.push_back(end);
+		transitionStart.push_back((int)transitions.size());
+
+		// Every state leads to at most 2 new ones, the table is kept at most half full
+		int tableSize = 4;
+		while (tableSize < 4 * (end - first)) {
+			tableSize *= 2;
+		}
+		stateTable.assign(tableSize, -1);
+
+		const int nextKeyLength = keyLengths[position + 1];
+		for (int from = first; from < end; ++from) {
+			const State state = states[from];	// A copy, adding states may move them
+			for (int isMine = 0; isMine <= 1; ++isMine) {
+				bool fits = true;
+				for (int l = linkStart[position]; l < linkStart[position + 1]; ++l) {
+					const Link& link = links[l];
+					const int missing = link.sourceSlot >= 0 ? keys[state.key + link.sourceSlot] :
+						constraints[constraintIds[link.constraint]].mines;
+					const int residual = missing - isMine;
+					fits = fits && residual >= 0 && residual <= link.remaining;
+					residuals[l - linkStart[position]] = residual;
+				}
+				if (!fits) {
+					continue;
+				}
+				for (int slot = 0; slot < nextKeyLength; ++slot) {
+					const int recipe = recipes[recipeStart[position] + slot];
+					key[slot] = std::uint8_t(recipe >= 0 ? keys[state.key + recipe] : residuals[-1 - recipe]);
+				}
+				const int to = findOrAddState(key.data(), nextKeyLength);
+				states[to].minMines = std::min(states[to].minMines, state.minMines + isMine);
+				states[to].maxMines = std::max(states[to].maxMines, state.maxMines + isMine);
+				transitions.push_back({ from, to, isMine });
+			}
+		}
+		if ((int)states.size() == end) {
+			return false;
+		}
+
+		for (int to = end; to < (int)states.size(); ++to) {
+			states[to].values = (int)forward.size();
+			forward.resize(forward.size() + states[to].maxMines - states[to].minMines + 1, 0.0);
+		}
+		for (int t = transitionStart[position]; t < (int)transitions.size(); ++t) {
+			const State& from = states[transitions[t].from];
+			const State& to = states[transitions[t].to];
+			const int shift = to.values - to.minMines + transitions[t].isMine;
+			for (int mines = from.minMines; mines <= from.maxMines; ++mines) {
+				forward[shift + mines] += forward[from.values + mines - from.minMines];
+			}
+		}
+	}
+	transitionStart.push_back((int)transitions.size());
+	layerStart.push_back((int)states.size());
+	assert(layerStart[nTiles + 1] - layerStart[nTiles] == 1);	// Every number is closed at the end
+	return true;
+}
+
+/**
+	Computes how likely each tile is to be a mine, given how likely each total amount of mines of the component is
+
+	@param weights Weight of each amount of mines, from getMinMines() to getMaxMines() (any scale)
+	@param probabilities Per tile of the board: set to the probability of the tile (only the tiles of the component)
+*/
+void FrontierComponent::computeProbabilities(const double* weights, std::vector<double>& probabilities)
+{
+	const int nTiles = (int)tiles.size();
+	const State& last = states[layerStart[nTiles]];
+	backward.assign(forward.size(), 0.0);
+	double total = 0.0;
+	for (int mines = last.minMines; mines <= last.maxMines; ++mines) {
+		backward[last.values + mines - last.minMines] = weights[mines - last.minMines];
+		total += forward[last.values + mines - last.minMines] * weights[mines - last.minMines];
+	}
+
+	for (int position = nTiles - 1; position >= 0; --position) {
+		double mineWeight = 0.0;
+		for (int t = transitionStart[position]; t < transitionStart[position + 1]; ++t) {
+			const State& from = states[transitions[t].from];
+			const State& to = states[transitions[t].to];
+			const int shift = to.values - to.minMines + transitions[t].isMine;
+			for (int mines = from.minMines; mines <= from.maxMines; ++mines) {
+				const double after = backward[shift + mines];
+				backward[from.values + mines - from.minMines] += after;
+				if (transitions[t].isMine) {
+					mineWeight += forward[from.values + mines - from.minMines] * after;
+				}
+			}
+		}
+		probabilities[tiles[position]] = total > 0.0 ? mineWeight / total : 0.0;
+	}
+}
+
+/**
+	Orders the tiles by a breadth-first walk through the numbers, starting from a tile as far as possible from the
+	others (the last tile of a first walk), and numbers the tiles of every number by their positions
+
+	@param constraints
+	@param positionOfTile
+*/
+void FrontierComponent::order(const std::vector<Constraint>& constraints, std::vector<int>& positionOfTile)
+{
+	const int nTiles = (int)tiles.size();
+	for (int t = 0; t < nTiles; ++t) {
+		positionOfTile[tiles[t]] = t;
+	}
+
+	// Tiles of every number and numbers around every tile, by the index of the tile in the component
+	constraintTileStart.clear();
+	constraintTiles.clear();
+	tileConstraintStart.assign(nTiles + 1, 0);
+	for (int id : constraintIds) {
+		const Constraint& constraint = constraints[id];
+		constraintTileStart.push_back((int)constraintTiles.size());
+		for (int i = 0; i < constraint.nTiles; ++i) {
+			constraintTiles.push_back(positionOfTile[constraint.tiles[i]]);
+			++tileConstraintStart[positionOfTile[constraint.tiles[i]] + 1];
+		}
+	}
+	constraintTileStart.push_back((int)constraintTiles.size());
+	for (int t = 0; t < nTiles; ++t) {
+		tileConstraintStart[t + 1] += tileConstraintStart[t];
+	}
+	tileConstraints.resize(constraintTiles.size());
+	tileScratch.assign(tileConstraintStart.begin(), tileConstraintStart.end() - 1);	// Next free entry of each tile
+	for (int c = 0; c < (int)constraintIds.size(); ++c) {
+		for (int e = constraintTileStart[c]; e < constraintTileStart[c + 1]; ++e) {
+			tileConstraints[tileScratch[constraintTiles[e]]++] = c;
+		}
+	}
+
+	walk(walk(0));
+	orderedTiles.resize(nTiles);
+	for (int position = 0; position < nTiles; ++position) {
+		orderedTiles[position] = tiles[walkOrder[position]];
+		tileScratch[walkOrder[position]] = position;
+	}
+	tiles.swap(orderedTiles);
+	for (int t = 0; t < nTiles; ++t) {
+		positionOfTile[tiles[t]] = t;
+	}
+	for (int& tile : constraintTiles) {
+		tile = tileScratch[tile];
+	}
+}
+
+/**
+	Walks breadth-first from a tile through the numbers into walkOrder
+
+	@param start Index of the tile in the component
+	@return last Last tile reached
+*/
+int FrontierComponent::walk(int start)
+{
+	const int nTiles = (int)tiles.size();
+	tileScratch.assign(nTiles, 0);	// Only marks the reached tiles here
+	walkOrder.clear();
+	walkOrder.push_back(start);
+	tileScratch[start] = 1;
+	for (int next = 0; next < (int)walkOrder.size(); ++next) {
+		const int tile = walkOrder[next];
+		for (int e = tileConstraintStart[tile]; e < tileConstraintStart[tile + 1]; ++e) {
+			const int c = tileConstraints[e];
+			for (int f = constraintTileStart[c]; f < constraintTileStart[c + 1]; ++f) {
+				if (!tileScratch[constraintTiles[f]]) {
+					tileScratch[constraintTiles[f]] = 1;
+					walkOrder.push_back(constraintTiles[f]);
+				}
+			}
+		}
+	}
+	assert((int)walkOrder.size() == nTiles);	// The tiles of a component are all connected through numbers
+	return walkOrder.back();
+}
+
+/**
+	Builds the links and recipes of every position, and the open numbers of every layer
+*/
+void FrontierComponent::link()
+{
+	const int nTiles = (int)tiles.size();
+	const int nConstraints = (int)constraintIds.size();
+	firstPositions.assign(nConstraints, INT_MAX);
+	lastPositions.assign(nConstraints, -1);
+	for (int c = 0; c < nConstraints; ++c) {
+		for (int e = constraintTileStart[c]; e < constraintTileStart[c + 1]; ++e) {
+			firstPositions[c] = std::min(firstPositions[c], constraintTiles[e]);
+			lastPositions[c] = std::max(lastPositions[c], constraintTiles[e]);
+		}
+	}
+
+	linkStart.clear();
+	links.clear();
+	recipeStart.clear();
+	recipes.clear();
+	openConstraints.clear();
+	slots.assign(nConstraints, -1);
+	linkOfConstraint.assign(nConstraints, -1);
+	keyLengths.assign(1, 0);
+	int maxKeyLength = 0;
+	for (int position = 0; position < nTiles; ++position) {
+		const int tile = walkOrder[position];
+		linkStart.push_back((int)links.size());
+		for (int e = tileConstraintStart[tile]; e < tileConstraintStart[tile + 1]; ++e) {
+			const int c = tileConstraints[e];
+			int remaining = 0;
+			for (int f = constraintTileStart[c]; f < constraintTileStart[c + 1]; ++f) {
+				remaining += constraintTiles[f] > position;
+			}
+			linkOfConstraint[c] = (int)links.size() - linkStart[position];
+			links.push_back({ c, firstPositions[c] < position ? slots[c] : -1, remaining });
+		}
+
+		// The open numbers which go on after this tile keep their slots in order, the ones it opens come last
+		recipeStart.push_back((int)recipes.size());
+		nextOpenConstraints.clear();
+		for (int c : openConstraints) {
+			if (lastPositions[c] > position) {
+				nextOpenConstraints.push_back(c);
+				recipes.push_back(linkOfConstraint[c] >= 0 ? -1 - linkOfConstraint[c] : slots[c]);
+			}
+		}
+		for (int l = linkStart[position]; l < (int)links.size(); ++l) {
+			const int c = links[l].constraint;
+			if (firstPositions[c] == position && lastPositions[c] > position) {
+				nextOpenConstraints.push_back(c);
+				recipes.push_back(-1 - (l - linkStart[position]));
+			}
+		}
+		for (int l = linkStart[position]; l < (int)links.size(); ++l) {
+			linkOfConstraint[links[l].constraint] = -1;
+		}
+		for (int c : openConstraints) {
+			slots[c] = -1;
+		}
+		for (int slot = 0; slot < (int)nextOpenConstraints.size(); ++slot) {
+			slots[nextOpenConstraints[slot]] = slot;
+		}
+		openConstraints.swap(nextOpenConstraints);
+		keyLengths.push_back((int)openConstraints.size());
+		maxKeyLength = std::max(maxKeyLength, (int)openConstraints.size());
+	}
+	linkStart.push_back((int)links.size());
+	recipeStart.push_back((int)recipes.size());
+	assert(openConstraints.empty());
+	key.resize(std::max(1, maxKeyLength));
+	residuals.resize(8);
+}
+
+/**
+	Returns the state of the layer being built with input missing amounts, added if there is none yet
+
+	@param stateKey Missing amount of each open number of the layer
+	@param keyLength
+	@return state
+*/
+int FrontierComponent::findOrAddState(const std::uint8_t* stateKey, int keyLength)
+{
+	const int mask = (int)stateTable.size() - 1;
+	for (int slot = int(hashKey(stateKey, keyLength) & mask);; slot = (slot + 1) & mask) {
+		const int state = stateTable[slot];
+		if (state < 0) {
+			stateTable[slot] = (int)states.size();
+			states.push_back({ (int)keys.size(), -1, INT_MAX, -1 });
+			keys.insert(keys.end(), stateKey, stateKey + keyLength);
+			return stateTable[slot];
+		}
+		if (std::equal(stateKey, stateKey + keyLength, keys.begin() + states[state].key)) {
+			return state;
+		}
+	}
+}
+
+/**
+	Hashes the missing amounts of a state (FNV-1a, then mixed so the low bits depend on every byte)
+
+	@param stateKey
+	@param keyLength
+	@return hash
+*/
+std::uint64_t FrontierComponent::hashKey(const std::uint8_t* stateKey, int keyLength) const
+{
+	std::uint64_t hash = 14695981039346656037ull;
+	for (int i = 0; i < keyLength; ++i) {
+		hash = (hash ^ stateKey[i]) * 1099511628211ull;
+	}
+	return hash ^ (hash >> 29);
+}
+
+/**
+	Returns the amount of tiles of the component
+
+	@return tileCount
+*/
+int FrontierComponent::getTileCount() const
+{
+	return (int)tiles.size();
+}
+
+/**
+	Returns the fewest mines the tiles may hold (after count())
+
+	@return minMines
+*/
+int FrontierComponent::getMinMines() const
+{
+	return states[layerStart[tiles.size()]].minMines;
+}
+
+/**
+	Returns the most mines the tiles may hold (after count())
+
+	@return maxMines
+*/
+int FrontierComponent::getMaxMines() const
+{
+	return states[layerStart[tiles.size()]].maxMines;
+}
+
+/**
+	Returns the amount of ways to place input amount of mines on the tiles (after count())
+
+	@param mines From getMinMines() to getMaxMines()
+	@return count
+*/
+double FrontierComponent::getCount(int mines) const
+{
+	const State& last = states[layerStart[tiles.size()]];
+	assert(mines >= last.minMines && mines <= last.maxMines);
+	return forward[last.values + mines - last.minMines];
+}
+
+/**
+	Returns the amount of states the last count() went through
+
+	@return stateCount
+*/
+int FrontierComponent::getStateCount() const
+{
+	return (int)states.size();
+}
@@ -0,0 +1,113 @@
+/**
+	Counts the ways to place mines on a group of frontier tiles (hidden tiles next to revealed numbers) which no number
+	outside of the group touches, by the amount of mines, and how often each tile holds a mine among them
+
+	The tiles are given an order (a breadth-first walk through the numbers, from one end of the group, so the numbers
+	stay close together in it) and decided one after the other, mine or not. What the undecided rest still depends on
+	is only the amount of mines still missing around each open number (one with tiles on both sides of the decided
+	part): every way of deciding the first tiles which leaves the same missing amounts is the same state. So the
+	backtracking is memoized as layers of states, one layer per decided tile, each state keeping how many ways lead to
+	it with each amount of mines so far. A pass back through the layers then weighs every way by how likely its total
+	amount of mines is (see MineProbabilities) and sums the weights of the ways in which each tile is a mine.
+*/
+
+#pragma once
+#include <vector>
+#include <cstdint>
+
+class FrontierComponent {
+public:
+	/**
+		Amount of mines among the frontier tiles around a revealed number
+	*/
+	struct Constraint {
+		int mines;
+		int nTiles;
+		int tiles[8];
+	};
+
+public:
+	void clear();
+	void addTile(int tile);
+	void addConstraint(int constraint);
+	bool count(const std::vector<Constraint>& constraints, std::vector<int>& positionOfTile);
+	void computeProbabilities(const double* weights, std::vector<double>& probabilities);
+
+	int getTileCount() const;
+	int getMinMines() const;
+	int getMaxMines() const;
+	double getCount(int mines) const;
+	int getStateCount() const;
+
+private:
+	/**
+		Number around the tile at some position of the order
+	*/
+	struct Link {
+		int constraint;	// Of the component
+		int sourceSlot;	// Slot of the number in the states before the tile (-1 if this is its first tile)
+		int remaining;	// Tiles of the number after this one
+	};
+
+	/**
+		Ways of deciding the tiles before a layer which leave the same amount of mines missing around the open numbers
+	*/
+	struct State {
+		int key;	// Start of its missing amounts in keys (one byte per open number of the layer)
+		int values;	// Start of its counts in forward and backward
+		int minMines;	// Fewest mines so far of any way leading to the state
+		int maxMines;
+	};
+
+	/**
+		Decision of the tile of a layer, leading from a state of the layer to a state of the next one
+	*/
+	struct Transition {
+		int from;
+		int to;
+		int isMine;
+	};
+
+private:
+	void order(const std::vector<Constraint>& constraints, std::vector<int>& positionOfTile);
+	int walk(int start);
+	void link();
+	int findOrAddState(const std::uint8_t* key, int keyLength);
+	std::uint64_t hashKey(const std::uint8_t* key, int keyLength) const;
+
+private:
+	std::vector<int> tiles;	// In the order they are decided, once counted (these vectors never shrink)
+	std::vector<int> constraintIds;
+	// Numbers of the component, by the positions of their tiles
+	std::vector<int> constraintTileStart;
+	std::vector<int> constraintTiles;
+	std::vector<int> tileConstraintStart;	// Numbers around each tile (by the index of the tile before it is ordered)
+	std::vector<int> tileConstraints;
+	std::vector<int> walkOrder;	// Tiles (by index) in the order of the last walk
+	std::vector<int> tileScratch;	// Scratch of order() and walk()
+	std::vector<int> orderedTiles;
+	std::vector<int> firstPositions;	// Per number: position of its first and last tile
+	std::vector<int> lastPositions;
+	// Per position: the numbers around the tile, and where each open number of the next layer comes from
+	// (slot >= 0: the same slot of the state before, otherwise -1 - the link whose number the tile changed)
+	std::vector<int> linkStart;
+	std::vector<Link> links;
+	std::vector<int> recipeStart;
+	std::vector<int> recipes;
+	std::vector<int> openConstraints;	// Open numbers after the tiles decided so far, by slot (used by link())
+	std::vector<int> nextOpenConstraints;
+	std::vector<int> slots;	// Per number: its slot in openConstraints (used by link())
+	std::vector<int> linkOfConstraint;	// Per number: its link at the tile being linked, or -1 (used by link())
+	// Layers of states
+	std::vector<int> layerStart;
+	std::vector<int> keyLengths;	// Per layer: open numbers
+	std::vector<State> states;
+	std::vector<std::uint8_t> keys;
+	std::vector<int> transitionStart;	// Per layer: first transition out of it
+	std::vector<Transition> transitions;
+	std::vector<double> forward;	// Per state and amount of mines so far: ways to reach the state with them
+	std::vector<double> backward;	// Per state and amount of mines so far: weight of the ways on from the state
+	std::vector<int> stateTable;	// Open addressing table of the states of the layer being built
+	std::vector<std::uint8_t> key;	// Missing amounts of the state being built
+	std::vector<int> residuals;	// Missing amount of each number around the tile being decided
+};
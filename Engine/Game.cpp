@@ -20,8 +20,14 @@
  ******************************************************************************************/
 #include "MainWindow.h"
 #include "Game.h"
+#include "D3DBackend.h"
+#include "CaptureBackend.h"
 #include "SpriteCodex.h"
 #include "DigitalDisplay.h"
+#include <random>
+#include <algorithm>
+#include <thread>
+#include <fstream>
 
 /**
 	Constructs the game object
@@ -31,22 +37,96 @@
 Game::Game(MainWindow& wnd)
 	:
 	wnd(wnd),
-	gfx(wnd),
+	gfx(makeBackend()),
+	scheduler(ticksPerSecond, framesPerSecond),
+	noGuessGenerator(&threadPool),
 	gameState(State::InMenu),
 	menu(),
 	timeDisplay(0)
 {
+	if (generatesNoGuessFields) {
+		minefield.setNoGuessGenerator(&noGuessGenerator);
+		beginnerField.setNoGuessGenerator(&noGuessGenerator);
+		intermediateField.setNoGuessGenerator(&noGuessGenerator);
+		expertField.setNoGuessGenerator(&noGuessGenerator);
+	}
 }
 
 /**
-	Game loop
+	Iteration of the game loop: runs the ticks which are due, renders a frame if one is due and sleeps until the next
+	tick or frame is (the window messages are processed between iterations)
 */
 void Game::Go()
 {
-	gfx.BeginFrame();
-	UpdateModel();
-	ComposeFrame();
-	gfx.EndFrame();
+	for (int nTicks = scheduler.takeDueTicks(); nTicks > 0; --nTicks) {
+		UpdateModel();
+	}
+	if (scheduler.takeDueFrame()) {
+		gfx.BeginFrame();
+		ComposeFrame();
+		gfx.EndFrame();
+	}
+	scheduler.waitForNextEvent();
+}
+
+/**
+	Creates the backend of gfx: the window's D3D11 swap chain (behind a ThreadedBackend if presentsOnOwnThread),
+	with the frame capture on top
+
+	@return backend
+*/
+std::unique_ptr<GraphicsBackend> Game::makeBackend()
+{
+	std::unique_ptr<GraphicsBackend> pShown = std::make_unique<D3DBackend>(wnd);
+	if (presentsOnOwnThread) {
+		// Stopping its thread keeps the window responsive, in case a present waits on it
+		auto pThreaded = std::make_unique<ThreadedBackend>(std::move(pShown), [this] { wnd.ProcessMessage(); });
+		pPresenter = pThreaded.get();
+		pShown = std::move(pThreaded);
+	}
+	return std::make_unique<CaptureBackend>(std::move(pShown), capture);
+}
+
+/**
+	Calls input function with the minefield being played and returns what it returns
+
+	@param function Function taking any of the minefield types
+	@return result
+*/
+template<typename Function>
+decltype(auto) Game::visitMinefield(Function function)
+{
+	switch (fieldType) {
+	case FieldType::Beginner:
+		return function(beginnerField);
+	case FieldType::Intermediate:
+		return function(intermediateField);
+	case FieldType::Expert:
+		return function(expertField);
+	default:
+		return function(minefield);
+	}
+}
+
+/**
+	Calls input function with the minefield being played and returns what it returns
+
+	@param function Function taking any of the minefield types (as const)
+	@return result
+*/
+template<typename Function>
+decltype(auto) Game::visitMinefield(Function function) const
+{
+	switch (fieldType) {
+	case FieldType::Beginner:
+		return function(beginnerField);
+	case FieldType::Intermediate:
+		return function(intermediateField);
+	case FieldType::Expert:
+		return function(expertField);
+	default:
+		return function(minefield);
+	}
 }
 
 /**
@@ -58,19 +138,19 @@ void Game::UpdateModel()
 
 	switch (gameState) {
 	case State::Playing: {
-		if (minefield.isExploded) {
+		if (isEndless ? endlessField.isExploded : visitMinefield([](const auto& field) { return field.isExploded; })) {
 			gameState = State::Loss;
 		}
-		else if (minefield.revealedAll()) {
+		else if (!isEndless && visitMinefield([](const auto& field) { return field.revealedAll(); })) {
 			gameState = State::Win;
 			gameEndTime = std::chrono::steady_clock::now();
-			minefield.flagRemainingTiles();
+			visitMinefield([](auto& field) { field.flagRemainingTiles(); });
 		}
 		else { // Game is running
 			timeNow = std::chrono::steady_clock::now();
 			if (gameHasStarted()) {
 				elapsedTime = (int)std::chrono::duration_cast<std::chrono::seconds>(timeNow - gameStartTime).count();
-				timeDisplay = DigitalDisplay(elapsedTime);
+				timeDisplay.setValue(elapsedTime);
 			}			
 		}
 
@@ -78,7 +158,7 @@ void Game::UpdateModel()
 	case State::InMenu: {
 		if (menu.getSelectedOption() != Menu::Option::Name::None) {	// Menu option gets selected
 			gameState = State::Playing;
-			minefield = Minefield(menu); // Create minefield based on menu option
+			startMinefieldGame();
 		}
 
 	}  break;
@@ -93,19 +173,36 @@ void Game::ComposeFrame()
 	if (gameState == State::InMenu) {
 		menu.draw(gfx);
 	}
+	else if (isEndless) {
+		endlessField.draw(gfx);
+		int x = Graphics::ScreenWidth - timeDisplay.getWidth() - Minefield::displayOffset;
+		int y = (EndlessMinefield::boardTop - timeDisplay.getHeight()) / 2;
+		timeDisplay.draw(gfx, x, y);
+	}
 	else {
-		minefield.draw(gfx);
-		int x = (Graphics::ScreenWidth + minefield.getWidth()) / 2 - timeDisplay.getWidth();
-		int y = (Graphics::ScreenHeight - minefield.getHeight()) / 2 - timeDisplay.getHeight() - Minefield::displayOffset;
+		if (fieldType == FieldType::Dynamic) {
+			if (!pRenderPool) {
+				pRenderPool = std::make_unique<ThreadPool>(
+					renderThreadCount > 0 ? renderThreadCount : std::max(1, (int)std::thread::hardware_concurrency()));
+			}
+			minefield.draw(gfx, pRenderPool.get());
+		}
+		else {
+			visitMinefield([this](auto& field) { field.draw(gfx); });	// Too small to be worth splitting
+		}
+		const int fieldWidth = visitMinefield([](const auto& field) { return field.getWidth(); });
+		const int fieldHeight = visitMinefield([](const auto& field) { return field.getHeight(); });
+		int x = (Graphics::ScreenWidth + fieldWidth) / 2 - timeDisplay.getWidth();
+		int y = (Graphics::ScreenHeight - fieldHeight) / 2 - timeDisplay.getHeight() - Minefield::displayOffset;
 		timeDisplay.draw(gfx, x, y);
 	}
 
 	constexpr int offsetFromMinefield = 10;
 	switch (gameState) {
 	case State::Win:;
-		SpriteCodex::drawGameWin(gfx, minefield.getHeight() / 2 + offsetFromMinefield); break;
+		SpriteCodex::drawGameWin(gfx, visitMinefield([](const auto& field) { return field.getHeight(); }) / 2 + offsetFromMinefield); break;
 	case State::Loss:;
-		SpriteCodex::drawGameLoss(gfx, minefield.getHeight() / 2 + offsetFromMinefield); break;
+		SpriteCodex::drawGameLoss(gfx, isEndless ? 0 : visitMinefield([](const auto& field) { return field.getHeight(); }) / 2 + offsetFromMinefield); break;
 	}
 }
 
@@ -115,9 +212,72 @@ void Game::ComposeFrame()
 void Game::restartGame()
 {
 	gameState = State::InMenu;
+	isEndless = false;
 	menu.selectOption(Menu::Option::Name::None);
 }
 
+/**
+	Starts a game on the minefield chosen in the menu (Standard difficulties get their compile time sized minefield,
+	any other option turns the dynamic minefield into the chosen one, reusing its memory)
+*/
+void Game::startMinefieldGame()
+{
+	const Menu::Option& option = menu.options[(int)menu.getSelectedOption()];
+	const Vei2 size = option.setsMinefieldSize;
+	if (BeginnerField::hasSize(size.x, size.y, option.setsMines)) {
+		beginnerField.reset(getNewSeed());
+		fieldType = FieldType::Beginner;
+	}
+	else if (IntermediateField::hasSize(size.x, size.y, option.setsMines)) {
+		intermediateField.reset(getNewSeed());
+		fieldType = FieldType::Intermediate;
+	}
+	else if (ExpertField::hasSize(size.x, size.y, option.setsMines)) {
+		expertField.reset(getNewSeed());
+		fieldType = FieldType::Expert;
+	}
+	else {
+		minefield.reset(menu, getNewSeed(), &threadPool);
+		fieldType = FieldType::Dynamic;
+	}
+}
+
+/**
+	Starts a game on a new large minefield (Played on the dynamic minefield, which shows the part of the field in view
+	and a minimap of the whole field)
+*/
+void Game::startLargeGame()
+{
+	minefield.reset(largeFieldWidth, largeFieldHeight, largeFieldMines, getNewSeed(), &threadPool);
+	fieldType = FieldType::Dynamic;
+	gameState = State::Playing;
+	elapsedTime = 0;
+	timeDisplay.setValue(elapsedTime);
+}
+
+/**
+	Starts a game on a new endless minefield
+*/
+void Game::startEndlessGame()
+{
+	endlessField = EndlessMinefield(getNewSeed());
+	isEndless = true;
+	gameState = State::Playing;
+	elapsedTime = 0;
+	timeDisplay.setValue(elapsedTime);
+}
+
+/**
+	Returns a random seed for a new minefield
+
+	@return seed
+*/
+std::uint64_t Game::getNewSeed() const
+{
+	std::random_device rd;
+	return (std::uint64_t(rd()) << 32) | rd();
+}
+
 /**
 	Returns true if at least one mine was revealed
 
@@ -125,7 +285,91 @@ void Game::restartGame()
 */
 bool Game::gameHasStarted() const
 {
-	return minefield.getRevealedCounter() >= 1;
+	return (isEndless ? endlessField.getRevealedCounter() : visitMinefield([](const auto& field) { return field.getRevealedCounter(); })) >= 1;
+}
+
+/**
+	Starts capturing the frames into a new file (captureN.y4m or captureN.ppm in the working directory), or stops the
+	capture and writes its counters next to it (captureN.txt)
+*/
+void Game::toggleCapture()
+{
+	const std::string name = "capture" + std::to_string(captureCount);
+	if (capture.isCapturing()) {
+		capture.stop();
+		capture.saveStats(name + ".txt");
+	}
+	else {
+		++captureCount;
+		const std::string extension = captureFormat == FrameCapture::Format::Y4M ? ".y4m" : ".ppm";
+		capture.start("capture" + std::to_string(captureCount) + extension, captureFormat, captureFramesPerSecond,
+			captureFrameInterval, captureUsesDeltaFrames);
+	}
+}
+
+/**
+	Writes the counters of the game loop (and of the thread presenting the frames) to loop.txt in the working
+	directory, one "name value" line each (times in milliseconds)
+*/
+void Game::saveLoopStats() const
+{
+	const LoopScheduler::Stats loop = scheduler.getStats();
+	std::ofstream file("loop.txt");
+	file << "ticks " << loop.ticks << '\n'
+		<< "droppedTicks " << loop.droppedTicks << '\n'
+		<< "frames " << loop.frames << '\n'
+		<< "skippedFrames " << loop.skippedFrames << '\n'
+		<< "averageFrameTime " << 1000.0 * loop.averageFrameSeconds << '\n'
+		<< "maxFrameTime " << 1000.0 * loop.maxFrameSeconds << '\n'
+		<< "averageWorkTime " << 1000.0 * loop.averageWorkSeconds << '\n'
+		<< "maxWorkTime " << 1000.0 * loop.maxWorkSeconds << '\n'
+		<< "cpuUsage " << loop.cpuUsage << '\n'
+		<< "averageOversleep " << 1000.0 * loop.averageOversleepSeconds << '\n'
+		<< "maxOversleep " << 1000.0 * loop.maxOversleepSeconds << '\n';
+	if (pPresenter) {
+		const ThreadedBackend::Stats present = pPresenter->getStats();
+		file << "presentedFrames " << present.presentedFrames << '\n'
+			<< "replacedFrames " << present.replacedFrames << '\n'
+			<< "averagePresentTime " << (present.presentedFrames > 0 ? 1000.0 * present.presentSeconds / present.presentedFrames : 0.0) << '\n';
+	}
+}
+
+/**
+	Handles the mouse and keyboard input while a game is being played on a board (Minefield or EndlessMinefield)
+
+	@param board The board being played
+	@param mouseEv Last mouse event
+	@param kbrdEv Last keyboard event
+*/
+template<typename Board>
+void Game::handleBoardInput(Board& board, const Mouse::Event& mouseEv, const Keyboard::Event& kbrdEv)
+{
+	if (board.tileExistsAtLocation(lastMousePos)) {
+		if(mouseEv.GetType() == Mouse::Event::Type::LPress) {
+			board.partiallyRevealTileAtLocation(lastMousePos); // Tile not revealed unless the user pressed
+		}													   // and released mouse click on the same tile
+		else if (mouseEv.GetType() == Mouse::Event::Type::LRelease) {
+			if (board.tileAtLocationIsPartiallyRevealed(lastMousePos)) {
+				if (board.getRevealedCounter() == 0) {	// If we are revealing the first tile
+					gameStartTime = std::chrono::steady_clock::now();
+				}
+				board.revealTileAtLocation(lastMousePos);
+			}
+			else {	// Pressed on a tile but released on a different tile
+				board.hidePartiallyRevealedTile();
+			}
+		}
+		else if (
+			   mouseEv.GetType() == Mouse::Event::Type::RLPress // Right + Left click at the same time (right first)
+			|| mouseEv.GetType() == Mouse::Event::Type::MPress 
+			|| kbrdEv.GetCode() == VK_SPACE) 
+		{
+			board.revealSurroundingTilesOrFlagTileAtLocation(lastMousePos);
+		}
+		else if (mouseEv.GetType() == Mouse::Event::Type::RPress) {
+			board.toggleTileFlagAtLocation(mouseEv.GetPos());
+		}
+	}
 }
 
 /**
@@ -151,41 +395,59 @@ void Game::handleUserInput()
 			}
 		}
 
-		
+		if (kbrdEv.GetCode() == VK_F9) {
+			toggleCapture();
+		}
+		else if (kbrdEv.GetCode() == VK_F10) {
+			saveLoopStats();
+		}
+
 		switch (gameState) {
 		case State::InMenu: {
 			menu.highlightOption(menu.PointIsOverOption(lastMousePos));
 			if (mouseEv.GetType() == Mouse::Event::Type::LPress) {
 				menu.selectOption(menu.PointIsOverOption(lastMousePos));	// Selects the option over which the mouse is hovering
 			}
+			else if (kbrdEv.GetCode() == 'L') {
+				startLargeGame();
+			}
+			else if (kbrdEv.GetCode() == 'E') {
+				startEndlessGame();
+			}
 		}
 			break;
 		case State::Playing: {
-			if (minefield.tileExistsAtLocation(lastMousePos)) {
-				if(mouseEv.GetType() == Mouse::Event::Type::LPress) {
-					minefield.partiallyRevealTileAtLocation(lastMousePos); // Tile not revealed unless the user pressed
-				}														   // and released mouse click on the same tile
-				else if (mouseEv.GetType() == Mouse::Event::Type::LRelease) {
-					if (minefield.tileAtLocationIsPartiallyRevealed(lastMousePos)) {
-						if (minefield.getRevealedCounter() == 0) {	// If we are revealing the first tile
-							gameStartTime = std::chrono::steady_clock::now();
-						}
-						minefield.revealTileAtLocation(lastMousePos);
+			if (isEndless) {
+				// Arrow keys move the view over the endless field
+				switch (kbrdEv.GetCode()) {
+				case VK_LEFT: endlessField.pan({ -1, 0 }); break;
+				case VK_RIGHT: endlessField.pan({ 1, 0 }); break;
+				case VK_UP: endlessField.pan({ 0, -1 }); break;
+				case VK_DOWN: endlessField.pan({ 0, 1 }); break;
+				}
+				handleBoardInput(endlessField, mouseEv, kbrdEv);
+			}
+			else {
+				if (fieldType == FieldType::Dynamic) {
+					// Arrow keys and the minimap move the view and the mouse wheel zooms (fields larger than the screen)
+					constexpr int panStep = 4 * Minefield::tileSize;
+					switch (kbrdEv.GetCode()) {
+					case VK_LEFT: minefield.pan({ -panStep, 0 }); break;
+					case VK_RIGHT: minefield.pan({ panStep, 0 }); break;
+					case VK_UP: minefield.pan({ 0, -panStep }); break;
+					case VK_DOWN: minefield.pan({ 0, panStep }); break;
 					}
-					else {	// Pressed on a tile but released on a different tile
-						minefield.hidePartiallyRevealedTile();
+					if (mouseEv.GetType() == Mouse::Event::Type::LPress) {
+						minefield.moveViewToMinimapLocation(lastMousePos);	// A click on the minimap moves the view there
+					}
+					else if (mouseEv.GetType() == Mouse::Event::Type::WheelUp) {
+						minefield.zoomAt(1, lastMousePos);
+					}
+					else if (mouseEv.GetType() == Mouse::Event::Type::WheelDown) {
+						minefield.zoomAt(-1, lastMousePos);
 					}
 				}
-				else if (
-					   mouseEv.GetType() == Mouse::Event::Type::RLPress // Right + Left click at the same time (right first)
-					|| mouseEv.GetType() == Mouse::Event::Type::MPress 
-					|| kbrdEv.GetCode() == VK_SPACE) 
-				{
-					minefield.revealSurroundingTilesOrFlagTileAtLocation(lastMousePos);
-				}
-				else if (mouseEv.GetType() == Mouse::Event::Type::RPress) {
-					minefield.toggleTileFlagAtLocation(mouseEv.GetPos());
-				}
+				visitMinefield([&](auto& field) { handleBoardInput(field, mouseEv, kbrdEv); });
 			}
 		}
 			break;
@@ -201,4 +463,4 @@ void Game::handleUserInput()
 			break;
 		}
 	}
-} 
+}
@@ -39,9 +39,18 @@
 #include "Mouse.h"
 #include "Graphics.h"
 #include "Minefield.h"
+#include "BasicMinefield.h"
+#include "EndlessMinefield.h"
 #include "Menu.h"
 #include <chrono>
 #include "DigitalDisplay.h"
+#include "ThreadPool.h"
+#include "NoGuessGenerator.h"
+#include "FrameCapture.h"
+#include "ThreadedBackend.h"
+#include "LoopScheduler.h"
+#include <memory>
+#include <cstdint>
 
 class Game
 {
@@ -56,6 +65,32 @@ public:
 		Loss,
 		InMenu
 	};
+	// Which of the minefields is being played (the standard difficulties have a minefield of their own, sized at compile time)
+	enum class FieldType {
+		Dynamic,
+		Beginner,
+		Intermediate,
+		Expert
+	};
+	using BeginnerField = BasicMinefield<9, 9, 10>;
+	using IntermediateField = BasicMinefield<16, 16, 40>;
+	using ExpertField = BasicMinefield<30, 16, 99>;
+
+	// Pacing of the game loop (see LoopScheduler), its counters are written to loop.txt with F10
+	static constexpr int ticksPerSecond = 120;	// Rate of UpdateModel(), which reads the input
+	static constexpr int framesPerSecond = 60;	// Highest rate of ComposeFrame()
+	static constexpr bool presentsOnOwnThread = true;	// Frames are presented by a ThreadedBackend instead of waiting for the vertical sync on the game thread
+	// Capture of the frames into a video file, started and stopped with F9 (see FrameCapture)
+	static constexpr FrameCapture::Format captureFormat = FrameCapture::Format::Y4M;
+	static constexpr int captureFramesPerSecond = framesPerSecond;	// Frame rate the video is played at
+	static constexpr int captureFrameInterval = 1;	// Keeps one of every captureFrameInterval frames
+	static constexpr bool captureUsesDeltaFrames = true;
+	static constexpr int renderThreadCount = 0;	// Threads redrawing the minefield in bands (0 for one per hardware thread, 1 to draw it on the game thread alone)
+	static constexpr bool generatesNoGuessFields = false;	// Mines are placed so every minefield can be solved from the first click without guessing (see NoGuessGenerator)
+	// Field started with L from the menu, larger than the screen (played on the dynamic minefield, with the minimap)
+	static constexpr int largeFieldWidth = 128;
+	static constexpr int largeFieldHeight = 128;
+	static constexpr int largeFieldMines = 3380;	// Mine density of Expert
 	
 public:
 	Game( class MainWindow& wnd );
@@ -66,14 +101,40 @@ private:
 	void ComposeFrame();
 	void UpdateModel();
 	void handleUserInput();
+	template<typename Board>
+	void handleBoardInput(Board& board, const Mouse::Event& mouseEv, const Keyboard::Event& kbrdEv);
+	template<typename Function>
+	decltype(auto) visitMinefield(Function function);
+	template<typename Function>
+	decltype(auto) visitMinefield(Function function) const;
+	void startMinefieldGame();
+	void startLargeGame();
+	void startEndlessGame();
+	std::uint64_t getNewSeed() const;
 	void restartGame();
 	bool gameHasStarted() const;
+	void toggleCapture();
+	std::unique_ptr<GraphicsBackend> makeBackend();
+	void saveLoopStats() const;
 private:
 	MainWindow& wnd;
+	FrameCapture capture;	// Gets the frames from the backend of gfx, so it is constructed before it
+	int captureCount = 0;	// Captures started, numbers the files
+	ThreadedBackend* pPresenter = nullptr;	// Presents the frames of gfx (owned by it), nullptr when the game thread does
 	Graphics gfx;
+	LoopScheduler scheduler;
 
+	ThreadPool threadPool;
+	std::unique_ptr<ThreadPool> pRenderPool;	// Threads of renderThreadCount, drawing the bands of the dynamic minefield (created when it is first drawn)
+	NoGuessGenerator noGuessGenerator;	// Runs its candidates on threadPool
 	Menu menu;
-	Minefield minefield;
+	Minefield minefield;	// Used for the menu options which are not one of the standard difficulties
+	BeginnerField beginnerField;
+	IntermediateField intermediateField;
+	ExpertField expertField;
+	FieldType fieldType = FieldType::Dynamic;
+	EndlessMinefield endlessField;
+	bool isEndless = false;	// Playing the endless field instead of the minefield chosen in the menu
 	State gameState;
 	Vei2 lastMousePos = { 0, 0 };
 	DigitalDisplay timeDisplay;
@@ -18,354 +18,266 @@
 *	You should have received a copy of the GNU General Public License					  *
 *	along with The Chili DirectX Framework.  If not, see <http://www.gnu.org/licenses/>.  *
 ******************************************************************************************/
-#include "MainWindow.h"
 #include "Graphics.h"
-#include "DXErr.h"
-#include "ChiliException.h"
 #include <assert.h>
-#include <string>
-#include <array>
+#include <string.h>
+#include <algorithm>
+#include <cstdint>
 
-// Ignore the intellisense error "cannot open source file" for .shh files.
-// They will be created during the build sequence before the preprocessor runs.
-namespace FramebufferShaders
+// definitions of the screen size, which std::min and std::max take by reference
+constexpr int Graphics::ScreenWidth;
+constexpr int Graphics::ScreenHeight;
+
+Graphics::Graphics( std::unique_ptr<GraphicsBackend> pBackendIn )
+	:
+	pBackend( std::move( pBackendIn ) ),
+	sysBuffer( Graphics::ScreenWidth,Graphics::ScreenHeight ),
+	pSysBuffer( sysBuffer.getPixels() ),
+	uploadedBuffer( Graphics::ScreenWidth,Graphics::ScreenHeight ),
+	coverage( Graphics::ScreenWidth * Graphics::ScreenHeight,0u ),
+	drawnRows( Graphics::ScreenHeight,RowSpan{ Graphics::ScreenWidth,0 } ),
+	staleRows( Graphics::ScreenHeight,RowSpan{ Graphics::ScreenWidth,0 } )
 {
-#include "FramebufferPS.shh"
-#include "FramebufferVS.shh"
+	assert( pBackend != nullptr );
+	damage.reserve( Graphics::ScreenHeight );
+	ResetRenderTarget();
 }
 
-#pragma comment( lib,"d3d11.lib" )
-
-#define CHILI_GFX_EXCEPTION( hr,note ) Graphics::Exception( hr,note,_CRT_WIDE(__FILE__),__LINE__ )
-
-using Microsoft::WRL::ComPtr;
-
-Graphics::Graphics( HWNDKey& key )
+void Graphics::EndFrame()
 {
-	assert( key.hWnd != nullptr );
-
-	//////////////////////////////////////////////////////
-	// create device and swap chain/get render target view
-	DXGI_SWAP_CHAIN_DESC sd = {};
-	sd.BufferCount = 1;
-	sd.BufferDesc.Width = Graphics::ScreenWidth;
-	sd.BufferDesc.Height = Graphics::ScreenHeight;
-	sd.BufferDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
-	sd.BufferDesc.RefreshRate.Numerator = 1;
-	sd.BufferDesc.RefreshRate.Denominator = 60;
-	sd.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-	sd.OutputWindow = key.hWnd;
-	sd.SampleDesc.Count = 1;
-	sd.SampleDesc.Quality = 0;
-	sd.Windowed = TRUE;
-
-	HRESULT				hr;
-	UINT				createFlags = 0u;
-#ifdef CHILI_USE_D3D_DEBUG_LAYER
-#ifdef _DEBUG
-	createFlags |= D3D11_CREATE_DEVICE_DEBUG;
-#endif
-#endif
-	
-	// create device and front/back buffers
-	if( FAILED( hr = D3D11CreateDeviceAndSwapChain( 
-		nullptr,
-		D3D_DRIVER_TYPE_HARDWARE,
-		nullptr,
-		createFlags,
-		nullptr,
-		0,
-		D3D11_SDK_VERSION,
-		&sd,
-		&pSwapChain,
-		&pDevice,
-		nullptr,
-		&pImmediateContext ) ) )
+	Color* const pUploaded = uploadedBuffer.getPixels();
+	clearedBytes = 0;
+	damage.clear();
+	for( int y = 0; y < Graphics::ScreenHeight; ++y )
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating device and swap chain" );
+		Color* const pRow = &pSysBuffer[Graphics::ScreenWidth * y];
+		unsigned char* const pCoverage = &coverage[Graphics::ScreenWidth * y];
+		RowSpan& stale = staleRows[y];
+		// clear what the frames before drew and this one did not
+		// (8 stamps at a time, as most of them are usually drawn again or black already)
+		const std::uint64_t drawnAgain = 0x0101010101010101ull * frameStamp;
+		for( int x = stale.left; x < stale.right; x += 8 )
+		{
+			const int end = std::min( x + 8,stale.right );
+			if( end - x == 8 )
+			{
+				std::uint64_t stamps;
+				memcpy( &stamps,&pCoverage[x],sizeof( stamps ) );
+				if( stamps == drawnAgain || stamps == 0u )
+				{
+					continue;
+				}
+			}
+			for( int i = x; i < end; ++i )
+			{
+				if( pCoverage[i] != frameStamp && pCoverage[i] != 0u )
+				{
+					pRow[i] = Color();
+					pCoverage[i] = 0u;
+					clearedBytes += int( sizeof( Color ) );
+				}
+			}
+		}
+		// anything else is black in both frames, so only these pixels can differ from the uploaded frame
+		const int left = std::min( stale.left,drawnRows[y].left );
+		int right = std::max( stale.right,drawnRows[y].right );
+		stale = RowSpan{ Graphics::ScreenWidth,0 };
+		Color* const pUploadedRow = &pUploaded[Graphics::ScreenWidth * y];
+		if( left >= right || memcmp( &pRow[left],&pUploadedRow[left],sizeof( Color ) * (right - left) ) == 0 )
+		{
+			continue;
+		}
+		int first = left;
+		while( pRow[first].dword == pUploadedRow[first].dword )
+		{
+			++first;
+		}
+		while( pRow[right - 1].dword == pUploadedRow[right - 1].dword )
+		{
+			--right;
+		}
+		memcpy( &pUploadedRow[first],&pRow[first],sizeof( Color ) * (right - first) );
+		// grow the damaged area of the rows above when it overlaps, so a changed sprite is one rectangle
+		if( !damage.empty() && damage.back().bottom == y && damage.back().left < right && first < damage.back().right )
+		{
+			RectI& rect = damage.back();
+			rect.left = std::min( rect.left,first );
+			rect.right = std::max( rect.right,right );
+			rect.bottom = y + 1;
+		}
+		else
+		{
+			damage.emplace_back( first,right,y,y + 1 );
+		}
 	}
-
-	// get handle to backbuffer
-	ComPtr<ID3D11Resource> pBackBuffer;
-	if( FAILED( hr = pSwapChain->GetBuffer(
-		0,
-		__uuidof( ID3D11Texture2D ),
-		(LPVOID*)&pBackBuffer ) ) )
+	int damagedPixels = 0;
+	for( const RectI& rect : damage )
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Getting back buffer" );
+		damagedPixels += (rect.right - rect.left) * (rect.bottom - rect.top);
 	}
-
-	// create a view on backbuffer that we can render to
-	if( FAILED( hr = pDevice->CreateRenderTargetView( 
-		pBackBuffer.Get(),
-		nullptr,
-		&pRenderTargetView ) ) )
+	// a mostly changed frame is cheaper to upload in one go
+	if( uploadAll || damagedPixels > FullUploadThreshold )
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating render target view on backbuffer" );
+		damage.clear();
+		damage.emplace_back( 0,Graphics::ScreenWidth,0,Graphics::ScreenHeight );
+		damagedPixels = Graphics::ScreenWidth * Graphics::ScreenHeight;
+		uploadAll = false;
 	}
+	uploadedBytes = damagedPixels * int( sizeof( Color ) );
+	// hand the finished frame to the backend (uploaded and presented, or kept in memory)
+	pBackend->Present( pSysBuffer,damage );
+}
 
-
-	// set backbuffer as the render target using created view
-	pImmediateContext->OMSetRenderTargets( 1,pRenderTargetView.GetAddressOf(),nullptr );
-
-
-	// set viewport dimensions
-	D3D11_VIEWPORT vp;
-	vp.Width = float( Graphics::ScreenWidth );
-	vp.Height = float( Graphics::ScreenHeight );
-	vp.MinDepth = 0.0f;
-	vp.MaxDepth = 1.0f;
-	vp.TopLeftX = 0.0f;
-	vp.TopLeftY = 0.0f;
-	pImmediateContext->RSSetViewports( 1,&vp );
-
-
-	///////////////////////////////////////
-	// create texture for cpu render target
-	D3D11_TEXTURE2D_DESC sysTexDesc;
-	sysTexDesc.Width = Graphics::ScreenWidth;
-	sysTexDesc.Height = Graphics::ScreenHeight;
-	sysTexDesc.MipLevels = 1;
-	sysTexDesc.ArraySize = 1;
-	sysTexDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
-	sysTexDesc.SampleDesc.Count = 1;
-	sysTexDesc.SampleDesc.Quality = 0;
-	sysTexDesc.Usage = D3D11_USAGE_DYNAMIC;
-	sysTexDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-	sysTexDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-	sysTexDesc.MiscFlags = 0;
-	// create the texture
-	if( FAILED( hr = pDevice->CreateTexture2D( &sysTexDesc,nullptr,&pSysBufferTexture ) ) )
+void Graphics::BeginFrame()
+{
+	// nothing is cleared here: this frame overwrites what it draws again and EndFrame clears the rest,
+	// so a frame which draws the same as the one before moves next to no memory
+	for( int y = 0; y < Graphics::ScreenHeight; ++y )
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating sysbuffer texture" );
+		staleRows[y].left = std::min( staleRows[y].left,drawnRows[y].left );
+		staleRows[y].right = std::max( staleRows[y].right,drawnRows[y].right );
+		drawnRows[y] = RowSpan{ Graphics::ScreenWidth,0 };
 	}
+	frameStamp = (unsigned char)( frameStamp % 255u + 1u );
+}
 
-	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-	srvDesc.Format = sysTexDesc.Format;
-	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-	srvDesc.Texture2D.MipLevels = 1;
-	// create the resource view on the texture
-	if( FAILED( hr = pDevice->CreateShaderResourceView( pSysBufferTexture.Get(),
-		&srvDesc,&pSysBufferTextureView ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating view on sysBuffer texture" );
-	}
+// bytes of the sysbuffer which the last EndFrame cleared (pixels the frame before drew and the last one did not)
+int Graphics::GetClearedBytes() const
+{
+	return clearedBytes;
+}
 
+// bytes which the last EndFrame handed to the backend to upload
+int Graphics::GetUploadedBytes() const
+{
+	return uploadedBytes;
+}
 
-	////////////////////////////////////////////////
-	// create pixel shader for framebuffer
-	// Ignore the intellisense error "namespace has no member"
-	if( FAILED( hr = pDevice->CreatePixelShader(
-		FramebufferShaders::FramebufferPSBytecode,
-		sizeof( FramebufferShaders::FramebufferPSBytecode ),
-		nullptr,
-		&pPixelShader ) ) )
+// records that this frame drew count pixels of the screen row y, starting at x
+void Graphics::CoverScreen( int x,int y,int count )
+{
+	unsigned char* const pCoverage = &coverage[Graphics::ScreenWidth * y + x];
+	// most runs are a pixel or a sprite span of a few pixels, which a loop stamps faster than a call to memset
+	if( count <= ShortRunLength )
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating pixel shader" );
+		for( int i = 0; i < count; ++i )
+		{
+			pCoverage[i] = frameStamp;
+		}
 	}
-	
-
-	/////////////////////////////////////////////////
-	// create vertex shader for framebuffer
-	// Ignore the intellisense error "namespace has no member"
-	if( FAILED( hr = pDevice->CreateVertexShader(
-		FramebufferShaders::FramebufferVSBytecode,
-		sizeof( FramebufferShaders::FramebufferVSBytecode ),
-		nullptr,
-		&pVertexShader ) ) )
+	else
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating vertex shader" );
+		memset( pCoverage,frameStamp,count );
 	}
-	
+	drawnRows[y].left = std::min( drawnRows[y].left,x );
+	drawnRows[y].right = std::max( drawnRows[y].right,x + count );
+}
 
-	//////////////////////////////////////////////////////////////
-	// create and fill vertex buffer with quad for rendering frame
-	const FSQVertex vertices[] =
-	{
-		{ -1.0f,1.0f,0.5f,0.0f,0.0f },
-		{ 1.0f,1.0f,0.5f,1.0f,0.0f },
-		{ 1.0f,-1.0f,0.5f,1.0f,1.0f },
-		{ -1.0f,1.0f,0.5f,0.0f,0.0f },
-		{ 1.0f,-1.0f,0.5f,1.0f,1.0f },
-		{ -1.0f,-1.0f,0.5f,0.0f,1.0f },
-	};
-	D3D11_BUFFER_DESC bd = {};
-	bd.Usage = D3D11_USAGE_DEFAULT;
-	bd.ByteWidth = sizeof( FSQVertex ) * 6;
-	bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-	bd.CPUAccessFlags = 0u;
-	D3D11_SUBRESOURCE_DATA initData = {};
-	initData.pSysMem = vertices;
-	if( FAILED( hr = pDevice->CreateBuffer( &bd,&initData,&pVertexBuffer ) ) )
+void Graphics::PutPixel( int x,int y,Color c )
+{
+	assert( x >= targetArea.left );
+	assert( x < targetArea.right );
+	assert( y >= targetArea.top );
+	assert( y < targetArea.bottom );
+	pTarget[(targetArea.right - targetArea.left) * (y - targetArea.top) + x - targetArea.left] = c;
+	if( pTarget == pSysBuffer )
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating vertex buffer" );
+		CoverScreen( x,y,1 );
 	}
+}
 
-	
-	//////////////////////////////////////////
-	// create input layout for fullscreen quad
-	const D3D11_INPUT_ELEMENT_DESC ied[] =
+// copies count pixels into the row y, starting at x (the whole run must be inside of the target area)
+void Graphics::PutPixels( int x,int y,const Color* pixels,int count )
+{
+	assert( x >= targetArea.left );
+	assert( count >= 0 );
+	assert( x + count <= targetArea.right );
+	assert( y >= targetArea.top );
+	assert( y < targetArea.bottom );
+	Color* pDst = &pTarget[(targetArea.right - targetArea.left) * (y - targetArea.top) + x - targetArea.left];
+	if( pTarget == pSysBuffer )
 	{
-		{ "POSITION",0,DXGI_FORMAT_R32G32B32_FLOAT,0,0,D3D11_INPUT_PER_VERTEX_DATA,0 },
-		{ "TEXCOORD",0,DXGI_FORMAT_R32G32_FLOAT,0,12,D3D11_INPUT_PER_VERTEX_DATA,0 }
-	};
-
-	// Ignore the intellisense error "namespace has no member"
-	if( FAILED( hr = pDevice->CreateInputLayout( ied,2,
-		FramebufferShaders::FramebufferVSBytecode,
-		sizeof( FramebufferShaders::FramebufferVSBytecode ),
-		&pInputLayout ) ) )
+		CoverScreen( x,y,count );
+	}
+	// sprite spans are mostly a few pixels long, so copy 4 pixels (one SSE register) at a time
+	// and let the last chunk overlap the one before instead of finishing pixel by pixel
+	if( count < 4 )
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating input layout" );
+		for( int i = 0; i < count; ++i )
+		{
+			pDst[i] = pixels[i];
+		}
+		return;
 	}
-
-
-	////////////////////////////////////////////////////
-	// Create sampler state for fullscreen textured quad
-	D3D11_SAMPLER_DESC sampDesc = {};
-	sampDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT;
-	sampDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
-	sampDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
-	sampDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
-	sampDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
-	sampDesc.MinLOD = 0;
-	sampDesc.MaxLOD = D3D11_FLOAT32_MAX;
-	if( FAILED( hr = pDevice->CreateSamplerState( &sampDesc,&pSamplerState ) ) )
+	for( int i = 0; i < count - 4; i += 4 )
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating sampler state" );
+		memcpy( &pDst[i],&pixels[i],sizeof( Color ) * 4 );
 	}
+	memcpy( &pDst[count - 4],&pixels[count - 4],sizeof( Color ) * 4 );
+}
 
-	// allocate memory for sysbuffer (16-byte aligned for faster access)
-	pSysBuffer = reinterpret_cast<Color*>( 
-		_aligned_malloc( sizeof( Color ) * Graphics::ScreenWidth * Graphics::ScreenHeight,16u ) );
+// redirects every drawing call into target, which stands for the area of the screen with its top left at origin
+// (drawing keeps using screen coordinates, so whatever draws to the screen can draw into a surface unchanged)
+void Graphics::SetRenderTarget( Surface& target,const Vei2& origin )
+{
+	pTarget = target.getPixels();
+	targetArea = RectI( origin,target.getWidth(),target.getHeight() );
 }
 
-Graphics::~Graphics()
+// draws to the screen again
+void Graphics::ResetRenderTarget()
 {
-	// free sysbuffer memory (aligned free)
-	if( pSysBuffer )
-	{
-		_aligned_free( pSysBuffer );
-		pSysBuffer = nullptr;
-	}
-	// clear the state of the device context before destruction
-	if( pImmediateContext ) pImmediateContext->ClearState();
+	pTarget = pSysBuffer;
+	targetArea = RectI( 0,Graphics::ScreenWidth,0,Graphics::ScreenHeight );
 }
 
-void Graphics::EndFrame()
+// returns the area of the screen which the drawing calls can write to
+const RectI& Graphics::GetTargetArea() const
 {
-	HRESULT hr;
+	return targetArea;
+}
 
-	// lock and map the adapter memory for copying over the sysbuffer
-	if( FAILED( hr = pImmediateContext->Map( pSysBufferTexture.Get(),0u,
-		D3D11_MAP_WRITE_DISCARD,0u,&mappedSysBufferTexture ) ) )
+// copies a surface with its top left at pos, a row at a time (clipped to the target area)
+void Graphics::DrawSurface( const Surface& surface,const Vei2& pos )
+{
+	const int left = std::max( pos.x,targetArea.left );
+	const int right = std::min( pos.x + surface.getWidth(),targetArea.right );
+	const int top = std::max( pos.y,targetArea.top );
+	const int bottom = std::min( pos.y + surface.getHeight(),targetArea.bottom );
+	if( left >= right || top >= bottom )
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Mapping sysbuffer" );
+		return;
 	}
-	// setup parameters for copy operation
-	Color* pDst = reinterpret_cast<Color*>(mappedSysBufferTexture.pData );
-	const size_t dstPitch = mappedSysBufferTexture.RowPitch / sizeof( Color );
-	const size_t srcPitch = Graphics::ScreenWidth;
-	const size_t rowBytes = srcPitch * sizeof( Color );
-	// perform the copy line-by-line
-	for( size_t y = 0u; y < Graphics::ScreenHeight; y++ )
+	const int targetPitch = targetArea.right - targetArea.left;
+	for( int y = top; y < bottom; ++y )
 	{
-		memcpy( &pDst[ y * dstPitch ],&pSysBuffer[y * srcPitch],rowBytes );
-	}
-	// release the adapter memory
-	pImmediateContext->Unmap( pSysBufferTexture.Get(),0u );
-
-	// render offscreen scene texture to back buffer
-	pImmediateContext->IASetInputLayout( pInputLayout.Get() );
-	pImmediateContext->VSSetShader( pVertexShader.Get(),nullptr,0u );
-	pImmediateContext->PSSetShader( pPixelShader.Get(),nullptr,0u );
-	pImmediateContext->IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST );
-	const UINT stride = sizeof( FSQVertex );
-	const UINT offset = 0u;
-	pImmediateContext->IASetVertexBuffers( 0u,1u,pVertexBuffer.GetAddressOf(),&stride,&offset );
-	pImmediateContext->PSSetShaderResources( 0u,1u,pSysBufferTextureView.GetAddressOf() );
-	pImmediateContext->PSSetSamplers( 0u,1u,pSamplerState.GetAddressOf() );
-	pImmediateContext->Draw( 6u,0u );
-
-	// flip back/front buffers
-	if( FAILED( hr = pSwapChain->Present( 1u,0u ) ) )
-	{
-		if( hr == DXGI_ERROR_DEVICE_REMOVED )
+		memcpy( &pTarget[targetPitch * (y - targetArea.top) + left - targetArea.left],
+			&surface.getPixels()[surface.getWidth() * (y - pos.y) + left - pos.x],
+			sizeof( Color ) * (right - left) );
+		if( pTarget == pSysBuffer )
 		{
-			throw CHILI_GFX_EXCEPTION( pDevice->GetDeviceRemovedReason(),L"Presenting back buffer [device removed]" );
-		}
-		else
-		{
-			throw CHILI_GFX_EXCEPTION( hr,L"Presenting back buffer" );
+			CoverScreen( left,y,right - left );
 		}
 	}
 }
 
-void Graphics::BeginFrame()
-{
-	// clear the sysbuffer
-	memset( pSysBuffer,0u,sizeof( Color ) * Graphics::ScreenHeight * Graphics::ScreenWidth );
-}
-
-void Graphics::PutPixel( int x,int y,Color c )
-{
-	assert( x >= 0 );
-	assert( x < int( Graphics::ScreenWidth ) );
-	assert( y >= 0 );
-	assert( y < int( Graphics::ScreenHeight ) );
-	pSysBuffer[Graphics::ScreenWidth * y + x] = c;
-}
-
 void Graphics::DrawRect( int x0,int y0,int x1,int y1,Color c )
 {
+	if( x0 >= x1 || y0 >= y1 )
+	{
+		return;
+	}
+	assert( x0 >= targetArea.left );
+	assert( x1 <= targetArea.right );
+	assert( y0 >= targetArea.top );
+	assert( y1 <= targetArea.bottom );
+	const int targetPitch = targetArea.right - targetArea.left;
 	for( int y = y0; y < y1; ++y )
 	{
-		for( int x = x0; x < x1; ++x )
+		std::fill_n( &pTarget[targetPitch * (y - targetArea.top) + x0 - targetArea.left],x1 - x0,c );
+		if( pTarget == pSysBuffer )
 		{
-			PutPixel( x,y,c );
+			CoverScreen( x0,y,x1 - x0 );
 		}
 	}
 }
-
-
-//////////////////////////////////////////////////
-//           Graphics Exception
-Graphics::Exception::Exception( HRESULT hr,const std::wstring& note,const wchar_t* file,unsigned int line )
-	:
-	ChiliException( file,line,note ),
-	hr( hr )
-{}
-
-std::wstring Graphics::Exception::GetFullMessage() const
-{
-	const std::wstring empty = L"";
-	const std::wstring errorName = GetErrorName();
-	const std::wstring errorDesc = GetErrorDescription();
-	const std::wstring& note = GetNote();
-	const std::wstring location = GetLocation();
-	return    (!errorName.empty() ? std::wstring( L"Error: " ) + errorName + L"\n"
-		: empty)
-		+ (!errorDesc.empty() ? std::wstring( L"Description: " ) + errorDesc + L"\n"
-			: empty)
-		+ (!note.empty() ? std::wstring( L"Note: " ) + note + L"\n"
-			: empty)
-		+ (!location.empty() ? std::wstring( L"Location: " ) + location
-			: empty);
-}
-
-std::wstring Graphics::Exception::GetErrorName() const
-{
-	return DXGetErrorString( hr );
-}
-
-std::wstring Graphics::Exception::GetErrorDescription() const
-{
-	std::array<wchar_t,512> wideDescription;
-	DXGetErrorDescription( hr,wideDescription.data(),wideDescription.size() );
-	return wideDescription.data();
-}
-
-std::wstring Graphics::Exception::GetExceptionType() const
-{
-	return L"Chili Graphics Exception";
-}
\ No newline at end of file
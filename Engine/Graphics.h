@@ -19,66 +19,66 @@
 *	along with The Chili DirectX Framework.  If not, see <http://www.gnu.org/licenses/>.  *
 ******************************************************************************************/
 #pragma once
-#include "ChiliWin.h"
-#include <d3d11.h>
-#include <wrl.h>
-#include "ChiliException.h"
 #include "Colors.h"
 #include "RectI.h"
+#include "Surface.h"
+#include "GraphicsBackend.h"
+#include <memory>
+#include <vector>
 
 class Graphics
 {
 public:
-	class Exception : public ChiliException
-	{
-	public:
-		Exception( HRESULT hr,const std::wstring& note,const wchar_t* file,unsigned int line );
-		std::wstring GetErrorName() const;
-		std::wstring GetErrorDescription() const;
-		virtual std::wstring GetFullMessage() const override;
-		virtual std::wstring GetExceptionType() const override;
-	private:
-		HRESULT hr;
-	};
-private:
-	// vertex format for the framebuffer fullscreen textured quad
-	struct FSQVertex
-	{
-		float x,y,z;		// position
-		float u,v;			// texcoords
-	};
-public:
-	Graphics( class HWNDKey& key );
+	Graphics( std::unique_ptr<GraphicsBackend> pBackend );
 	Graphics( const Graphics& ) = delete;
 	Graphics& operator=( const Graphics& ) = delete;
 	void EndFrame();
 	void BeginFrame();
 	void PutPixel( int x,int y,int r,int g,int b )
 	{
-		PutPixel( x,y,{ unsigned char( r ),unsigned char( g ),unsigned char( b ) } );
+		PutPixel( x,y,{ (unsigned char)r,(unsigned char)g,(unsigned char)b } );
 	}
 	void PutPixel( int x,int y,Color c );
+	void PutPixels( int x,int y,const Color* pixels,int count );
+	void SetRenderTarget( Surface& target,const Vei2& origin );
+	void ResetRenderTarget();
+	const RectI& GetTargetArea() const;
+	void DrawSurface( const Surface& surface,const Vei2& pos );
 	void DrawRect( int x0,int y0,int x1,int y1,Color c );
 	void DrawRect( const RectI& rect,Color c )
 	{
 		DrawRect( rect.left,rect.top,rect.right,rect.bottom,c );
 	}
-	~Graphics();
+	int GetClearedBytes() const;
+	int GetUploadedBytes() const;
+private:
+	// pixels [left,right) of a screen row (empty when left >= right)
+	struct RowSpan
+	{
+		int left;
+		int right;
+	};
+	void CoverScreen( int x,int y,int count );
 private:
-	Microsoft::WRL::ComPtr<IDXGISwapChain>				pSwapChain;
-	Microsoft::WRL::ComPtr<ID3D11Device>				pDevice;
-	Microsoft::WRL::ComPtr<ID3D11DeviceContext>			pImmediateContext;
-	Microsoft::WRL::ComPtr<ID3D11RenderTargetView>		pRenderTargetView;
-	Microsoft::WRL::ComPtr<ID3D11Texture2D>				pSysBufferTexture;
-	Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>	pSysBufferTextureView;
-	Microsoft::WRL::ComPtr<ID3D11PixelShader>			pPixelShader;
-	Microsoft::WRL::ComPtr<ID3D11VertexShader>			pVertexShader;
-	Microsoft::WRL::ComPtr<ID3D11Buffer>				pVertexBuffer;
-	Microsoft::WRL::ComPtr<ID3D11InputLayout>			pInputLayout;
-	Microsoft::WRL::ComPtr<ID3D11SamplerState>			pSamplerState;
-	D3D11_MAPPED_SUBRESOURCE							mappedSysBufferTexture;
+	std::unique_ptr<GraphicsBackend>					pBackend;			// shows the finished frames (D3D11 swap chain, memory, ...)
+	Surface												sysBuffer;
 	Color*                                              pSysBuffer = nullptr;
+	Color*                                              pTarget = nullptr;	// pixels the drawing calls write to (pSysBuffer unless redirected)
+	RectI                                               targetArea;			// area of the screen covered by pTarget
+	Surface												uploadedBuffer;		// the frame as the backend has it
+	std::vector<unsigned char>							coverage;			// per pixel: stamp of the frame which drew it (0: black)
+	unsigned char										frameStamp = 1u;
+	std::vector<RowSpan>								drawnRows;			// screen pixels drawn by this frame
+	std::vector<RowSpan>								staleRows;			// screen pixels drawn by the frames before, not cleared yet
+	std::vector<RectI>									damage;				// areas uploaded by the last EndFrame
+	bool												uploadAll = true;	// the backend has no frame yet
+	int													clearedBytes = 0;
+	int													uploadedBytes = 0;
 public:
 	static constexpr int ScreenWidth = 800;
 	static constexpr int ScreenHeight = 600;
+	// damage covering more than this many pixels is uploaded as one full frame instead
+	static constexpr int FullUploadThreshold = ScreenWidth * ScreenHeight / 2;
+	// coverage runs of at most this many pixels are stamped pixel by pixel instead of through memset
+	static constexpr int ShortRunLength = 16;
 };
\ No newline at end of file
@@ -0,0 +1,25 @@
+/**
+	Receives the finished frames of Graphics (the part of the framebuffer which depends on the platform)
+
+	Graphics draws every frame into its own buffer in memory, a backend only gets to see the finished frame:
+	D3DBackend uploads it to a D3D11 swap chain, MemoryBackend keeps it in memory (to run the rendering headless).
+*/
+
+#pragma once
+#include "Colors.h"
+#include "RectI.h"
+#include <vector>
+
+class GraphicsBackend
+{
+public:
+	virtual ~GraphicsBackend() = default;
+
+	/**
+		Shows (or keeps) a finished frame
+
+		@param pPixels Graphics::ScreenHeight rows of Graphics::ScreenWidth pixels, only valid during the call
+		@param damage The areas which changed since the last frame (the first frame covers the whole screen)
+	*/
+	virtual void Present( const Color* pPixels,const std::vector<RectI>& damage ) = 0;
+};
@@ -0,0 +1,331 @@
+#include "LogicSolver.h"
+#include "Bits.h"
+#include <algorithm>
+#include <assert.h>
+
+/**
+	Finds every tile the rules can decide on a board, see getSafeTiles() and getMineTiles()
+
+	@param board
+	@param trustsFlags Flagged tiles are taken as mines (otherwise they are hidden tiles like any other)
+	@return isConsistent False if the numbers (and the flags, if trusted) cannot all be satisfied
+*/
+bool LogicSolver::solve(const VisibleBoard& board, bool trustsFlags)
+{
+	width = board.getWidth();
+	height = board.getHeight();
+	paddedWidth = width + 2 * border;
+	const int paddedTileCount = paddedWidth * (height + 2 * border);
+	isConsistent = true;
+	deductions.assign(paddedTileCount, Deduction::Unknown);
+	constraintOfTile.assign(paddedTileCount, (int)noConstraint);
+	cellKinds.assign(paddedTileCount, std::uint8_t(0));
+	constraints.clear();
+	constraints.push_back({ 0u, 0, 0, 0u, true });	// The empty constraint (never queued)
+	queuedConstraints.clear();
+	safeTiles.clear();
+	mineTiles.clear();
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			const int tile = board.getTile(y * width + x);
+			const int padded = toPadded(y * width + x);
+			if (trustsFlags && tile == VisibleBoard::flagged) {
+				deductions[padded] = Deduction::Mine;
+				cellKinds[padded] = knownMine;
+			}
+			else if (tile < 0) {
+				cellKinds[padded] = undecided;
+			}
+		}
+	}
+
+	// One constraint per revealed number with hidden neighbours
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			const int tile = board.getTile(y * width + x);
+			if (tile < 0) {
+				continue;
+			}
+			const int padded = toPadded(y * width + x);
+			int mines = tile;
+			auto readRow = [this, &mines](int left) {
+				const std::uint8_t* kinds = &cellKinds[left];
+				mines -= (kinds[0] >> 1) + (kinds[1] >> 1) + (kinds[2] >> 1);
+				return std::uint64_t((kinds[0] & undecided) | (kinds[1] & undecided) << 1 | (kinds[2] & undecided) << 2);
+			};
+			const std::uint64_t cells = readRow(padded - paddedWidth - 1) << (windowCentre - windowWidth - 1) |
+				readRow(padded - 1) << (windowCentre - 1) |
+				readRow(padded + paddedWidth - 1) << (windowCentre + windowWidth - 1);
+			if (mines < 0 || mines > Bits::countSetBits(cells)) {
+				isConsistent = false;
+			}
+			if (cells != 0) {
+				constraintOfTile[padded] = (int)constraints.size();
+				constraints.push_back({ cells, mines, padded, 0u, false });
+			}
+		}
+	}
+
+	// Link the constraints which share tiles. Each one only looks at the numbers after it in the box (which link back to
+	// it), whose windows are all moved into its own with a left shift. Tiles without a number point to the empty
+	// constraint, so the loop needs no branch
+	for (int constraint = 1; constraint < (int)constraints.size(); ++constraint) {
+		const std::uint64_t cells = constraints[constraint].cells;
+		const int centre = constraints[constraint].index;
+		std::uint32_t overlaps = 0;
+		for (int box = boxCentre + 1; box < boxSize * boxSize; ++box) {
+			const int dx = box % boxSize - boxSize / 2;
+			const int dy = box / boxSize - boxSize / 2;
+			Constraint& other = constraints[constraintOfTile[centre + dy * paddedWidth + dx]];
+			const std::uint32_t overlap = (cells & other.cells << (dy * windowWidth + dx)) != 0;
+			overlaps |= overlap << box;
+			other.overlaps |= overlap << (2 * boxCentre - box);
+		}
+		constraints[constraint].overlaps |= overlaps;
+	}
+
+	for (int constraint = (int)constraints.size() - 1; constraint > noConstraint; --constraint) {
+		queue(constraint);
+	}
+	while (!queuedConstraints.empty()) {
+		const int constraint = queuedConstraints.back();
+		queuedConstraints.pop_back();
+		constraints[constraint].isQueued = false;
+		propagate(constraint);
+	}
+	return isConsistent;
+}
+
+/**
+	Applies both rules to a constraint: alone, then with every constraint which shares tiles with it
+
+	@param constraint
+*/
+void LogicSolver::propagate(int constraint)
+{
+	const int centre = constraints[constraint].index;
+	{
+		const Constraint& c = constraints[constraint];
+		if (c.cells == 0) {
+			return;
+		}
+		if (c.mines == 0) {
+			decideCells(centre, c.cells, Deduction::Safe);
+			return;
+		}
+		if (c.mines == Bits::countSetBits(c.cells)) {
+			decideCells(centre, c.cells, Deduction::Mine);
+			return;
+		}
+	}
+
+	std::uint32_t overlaps = constraints[constraint].overlaps;
+	while (overlaps != 0) {
+		const int box = Bits::lowestSetBit(overlaps);
+		overlaps &= overlaps - 1;
+		// Deciding tiles may empty this constraint (it then gets queued again, but there is nothing left to do)
+		if (applyPairRule(constraint, box) && constraints[constraint].cells == 0) {
+			return;
+		}
+	}
+}
+
+/**
+	Decides the tiles only one of two overlapping constraints has, when their mine counts leave a single possibility
+	(Unlinks the constraints once they no longer share a tile)
+
+	@param constraint
+	@param box Position of the number of the other constraint in the 5x5 box around the number of constraint
+	@return decided True if any tile was decided
+*/
+bool LogicSolver::applyPairRule(int constraint, int box)
+{
+	const int dx = box % boxSize - boxSize / 2;
+	const int dy = box / boxSize - boxSize / 2;
+	Constraint& c = constraints[constraint];
+	Constraint& other = constraints[constraintOfTile[c.index + dy * paddedWidth + dx]];
+	const std::uint64_t otherCells = shiftCells(other.cells, dx, dy);
+	if ((c.cells & otherCells) == 0) {
+		c.overlaps &= ~(1u << box);
+		other.overlaps &= ~(1u << (2 * boxCentre - box));
+		return false;
+	}
+	const std::uint64_t onlyHere = c.cells & ~otherCells;
+	const std::uint64_t onlyThere = otherCells & ~c.cells;
+	if (onlyHere == 0 && onlyThere == 0) {
+		return false;
+	}
+	const int centre = c.index;
+	const int extraMines = c.mines - other.mines;
+	if (extraMines == Bits::countSetBits(onlyHere)) {
+		decideCells(centre, onlyHere, Deduction::Mine);
+		decideCells(centre, onlyThere, Deduction::Safe);
+		return true;
+	}
+	if (-extraMines == Bits::countSetBits(onlyThere)) {
+		decideCells(centre, onlyThere, Deduction::Mine);
+		decideCells(centre, onlyHere, Deduction::Safe);
+		return true;
+	}
+	return false;
+}
+
+/**
+	Decides every tile of a window
+
+	@param centre Tile the window is centred on (in the padded grid)
+	@param cells Tiles of the window
+	@param deduction
+*/
+void LogicSolver::decideCells(int centre, std::uint64_t cells, Deduction deduction)
+{
+	while (cells != 0) {
+		const int bit = Bits::lowestSetBit(cells);
+		cells &= cells - 1;
+		decide(centre + (bit / windowWidth - 3) * paddedWidth + bit % windowWidth - 3, deduction);
+	}
+}
+
+/**
+	Decides a tile, removes it from the constraints of the numbers around it and queues them
+
+	@param padded Tile (in the padded grid)
+	@param deduction Safe or Mine
+*/
+void LogicSolver::decide(int padded, Deduction deduction)
+{
+	assert(deduction != Deduction::Unknown);
+	if (deductions[padded] != Deduction::Unknown) {
+		if (deductions[padded] != deduction) {
+			isConsistent = false;
+		}
+		return;
+	}
+	deductions[padded] = deduction;
+	(deduction == Deduction::Safe ? safeTiles : mineTiles).push_back(toIndex(padded));
+
+	for (int dy = -1; dy <= 1; ++dy) {
+		for (int dx = -1; dx <= 1; ++dx) {
+			const int constraint = constraintOfTile[padded + dy * paddedWidth + dx];
+			if (constraint == noConstraint) {
+				continue;
+			}
+			Constraint& c = constraints[constraint];
+			const std::uint64_t bit = getCellBit(-dx, -dy);
+			assert(c.cells & bit);
+			c.cells &= ~bit;
+			if (deduction == Deduction::Mine) {
+				--c.mines;
+			}
+			if (c.mines < 0 || c.mines > Bits::countSetBits(c.cells)) {
+				isConsistent = false;
+			}
+			queue(constraint);
+		}
+	}
+}
+
+/**
+	Queues a constraint to be looked at again, unless it already is
+
+	@param constraint
+*/
+void LogicSolver::queue(int constraint)
+{
+	if (!constraints[constraint].isQueued) {
+		constraints[constraint].isQueued = true;
+		queuedConstraints.push_back(constraint);
+	}
+}
+
+/**
+	Returns the bit of the tile at input offset in a window
+
+	@param dx Offset from the centre (-3 to 3)
+	@param dy
+	@return bit
+*/
+std::uint64_t LogicSolver::getCellBit(int dx, int dy)
+{
+	assert(dx >= -3 && dx <= 3 && dy >= -3 && dy <= 3);
+	return std::uint64_t(1) << (windowCentre + dy * windowWidth + dx);
+}
+
+/**
+	Moves the tiles of the window of a constraint into the window of another constraint
+
+	@param cells Tiles of the window (within 1 tile of its centre)
+	@param dx Centre of the window relative to the centre of the window it is moved into (-2 to 2)
+	@param dy
+	@return cells
+*/
+std::uint64_t LogicSolver::shiftCells(std::uint64_t cells, int dx, int dy)
+{
+	assert(dx >= -2 && dx <= 2 && dy >= -2 && dy <= 2);
+	const int shift = dy * windowWidth + dx;
+	return shift >= 0 ? cells << shift : cells >> -shift;
+}
+
+/**
+	Converts the index of a tile to its index in the padded grid
+
+	@param index
+	@return padded
+*/
+int LogicSolver::toPadded(int index) const
+{
+	return (index / width + border) * paddedWidth + index % width + border;
+}
+
+/**
+	Converts the index of a tile in the padded grid back to its index
+
+	@param padded
+	@return index
+*/
+int LogicSolver::toIndex(int padded) const
+{
+	return (padded / paddedWidth - border) * width + padded % paddedWidth - border;
+}
+
+/**
+	Returns what the last solve() found out about a tile
+
+	@param index
+	@return deduction Trusted flags count as mines
+*/
+LogicSolver::Deduction LogicSolver::getDeduction(int index) const
+{
+	assert(index >= 0 && index < width * height);
+	return deductions[toPadded(index)];
+}
+
+/**
+	Returns the tiles the last solve() proved safe (hidden or flagged)
+
+	@return safeTiles
+*/
+const std::vector<int>& LogicSolver::getSafeTiles() const
+{
+	return safeTiles;
+}
+
+/**
+	Returns the tiles the last solve() proved to be mines (trusted flags are not listed)
+
+	@return mineTiles
+*/
+const std::vector<int>& LogicSolver::getMineTiles() const
+{
+	return mineTiles;
+}
+
+/**
+	Returns the amount of revealed numbers with hidden neighbours in the last solved board
+
+	@return constraintCount
+*/
+int LogicSolver::getConstraintCount() const
+{
+	return (int)constraints.size() - 1;
+}
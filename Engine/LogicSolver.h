@@ -0,0 +1,85 @@
+/**
+	Finds the hidden tiles of a board which are certainly safe or certainly mines, from the revealed numbers alone
+
+	Every revealed number with hidden neighbours is a constraint: so many mines among these tiles. A constraint keeps
+	its tiles as bits of a 64 bit word laid out as a 7x7 window (8 bits per row) centred on its number, so the
+	constraints of two numbers up to 2 tiles apart (the only ones which can share tiles) are compared by shifting one
+	word into the window of the other. Two rules are applied until nothing changes:
+	- a constraint needing no mine makes all its tiles safe, one needing all of them makes them all mines
+	- for two overlapping constraints A and B, when A needs exactly as many more mines than B as A has tiles B does not,
+	those tiles are all mines and the tiles only B has are all safe (this covers a constraint containing another)
+	Deciding a tile removes it from the constraints around it and queues them again, so the work follows the changes.
+	The tiles are kept in a grid padded with a border of 2 tiles, so looking around a tile never needs a bounds check.
+	Flags are only taken as mines when asked to: a wrong flag could otherwise lead to a wrong deduction.
+*/
+
+#pragma once
+#include "VisibleBoard.h"
+#include <vector>
+#include <cstdint>
+
+class LogicSolver {
+public:
+	enum class Deduction : std::uint8_t {
+		Unknown,
+		Safe,
+		Mine
+	};
+
+public:
+	bool solve(const VisibleBoard& board, bool trustsFlags = false);
+
+	Deduction getDeduction(int index) const;
+	const std::vector<int>& getSafeTiles() const;
+	const std::vector<int>& getMineTiles() const;
+	int getConstraintCount() const;
+
+	static constexpr int windowWidth = 8;	// Bits per row of the window of a constraint
+	static constexpr int windowCentre = 3 * windowWidth + 3;	// Bit of the number a constraint is centred on
+	static constexpr int boxSize = 5;	// Side of the box around a number where the numbers sharing tiles with it are
+	static constexpr int boxCentre = boxSize * boxSize / 2;
+
+private:
+	/**
+		Amount of mines among the undecided hidden neighbours of a revealed number
+	*/
+	struct Constraint {
+		std::uint64_t cells;	// The neighbours, as bits of the window centred on the number
+		int mines;
+		int index;	// Tile of the number (in the padded grid)
+		// Constraints sharing tiles with this one, as bits of the 5x5 box around the number (row by row)
+		std::uint32_t overlaps;
+		bool isQueued;
+	};
+
+private:
+	void propagate(int constraint);
+	bool applyPairRule(int constraint, int box);
+	void decideCells(int centre, std::uint64_t cells, Deduction deduction);
+	void decide(int padded, Deduction deduction);
+	void queue(int constraint);
+	int toPadded(int index) const;
+	int toIndex(int padded) const;
+	static std::uint64_t getCellBit(int dx, int dy);
+	static std::uint64_t shiftCells(std::uint64_t cells, int dx, int dy);
+
+private:
+	static constexpr int noConstraint = 0;	// The first constraint is an empty one, standing for no constraint
+	static constexpr int border = 2;	// Tiles of padding around the grid (the farthest a constraint looks for another)
+	// Kinds of tile while the constraints are built: the low bit marks a tile to decide, the high bit a trusted flag
+	static constexpr std::uint8_t undecided = 1;
+	static constexpr std::uint8_t knownMine = 2;
+
+	int width = 0;
+	int height = 0;
+	int paddedWidth = 0;
+	bool isConsistent = true;	// No constraint was found impossible to satisfy
+	// Per tile of the padded grid (these vectors never shrink, so the memory is kept between solves)
+	std::vector<Deduction> deductions;
+	std::vector<int> constraintOfTile;	// Constraint of the number on the tile, or noConstraint
+	std::vector<std::uint8_t> cellKinds;
+	std::vector<Constraint> constraints;
+	std::vector<int> queuedConstraints;	// Constraints to look at again, as a stack
+	std::vector<int> safeTiles;	// In the order they were found
+	std::vector<int> mineTiles;
+};
@@ -0,0 +1,179 @@
+#include "LoopScheduler.h"
+#include <thread>
+#include <algorithm>
+#include <cmath>
+#include <assert.h>
+
+/**
+	Constructs a scheduler, the first tick and frame are due right away
+
+	@param ticksPerSecond Rate of the logic
+	@param framesPerSecondIn Highest rate of the frames (0 renders a frame after every iteration which ran a tick)
+*/
+LoopScheduler::LoopScheduler(int ticksPerSecond, int framesPerSecondIn)
+	:
+	tickDuration(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / ticksPerSecond))),
+	frameDuration(framesPerSecondIn > 0
+		? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / framesPerSecondIn))
+		: Clock::duration::zero())
+{
+	assert(ticksPerSecond > 0 && framesPerSecondIn >= 0);
+	const Clock::time_point now = Clock::now();
+	nextTick = now;
+	nextFrame = now;
+	iterationStart = now;
+	lastFrame = now;
+	statsStart = now;
+}
+
+/**
+	Returns how many ticks are due since the last call (at most maxTicksPerIteration) and schedules the next one
+
+	@return ticks
+*/
+int LoopScheduler::takeDueTicks()
+{
+	const Clock::time_point now = Clock::now();
+	if (now < nextTick) {
+		return 0;
+	}
+	int nTicks = int((now - nextTick) / tickDuration) + 1;
+	nextTick += nTicks * tickDuration;
+	if (nTicks > maxTicksPerIteration) {
+		stats.droppedTicks += nTicks - maxTicksPerIteration;
+		nTicks = maxTicksPerIteration;
+	}
+	stats.ticks += nTicks;
+	hasTickSinceFrame = true;
+	return nTicks;
+}
+
+/**
+	Returns true if a frame is to be rendered now: a frame is due and a tick ran since the last one
+	(The frames missed since the last call are skipped)
+
+	@return bool
+*/
+bool LoopScheduler::takeDueFrame()
+{
+	const Clock::time_point now = Clock::now();
+	if (frameDuration != Clock::duration::zero()) {
+		if (now < nextFrame) {
+			return false;
+		}
+		const auto nMissed = (now - nextFrame) / frameDuration;
+		stats.skippedFrames += int(nMissed);
+		nextFrame += (nMissed + 1) * frameDuration;
+	}
+	if (!hasTickSinceFrame) {
+		++stats.skippedFrames;
+		return false;
+	}
+	hasTickSinceFrame = false;
+	if (stats.frames > 0) {
+		const double seconds = toSeconds(now - lastFrame);
+		frameSeconds += seconds;
+		++frameIntervals;
+		stats.maxFrameSeconds = std::max(stats.maxFrameSeconds, seconds);
+	}
+	lastFrame = now;
+	++stats.frames;
+	return true;
+}
+
+/**
+	Sleeps until the next tick is due, or the next frame when it is due earlier and a tick ran since the last one
+*/
+void LoopScheduler::waitForNextEvent()
+{
+	const Clock::time_point now = Clock::now();
+	const double seconds = toSeconds(now - iterationStart);
+	workSeconds += seconds;
+	++iterations;
+	stats.maxWorkSeconds = std::max(stats.maxWorkSeconds, seconds);
+
+	Clock::time_point deadline = nextTick;
+	if (hasTickSinceFrame && frameDuration != Clock::duration::zero()) {
+		deadline = std::min(deadline, nextFrame);
+	}
+	if (deadline > now) {
+		sleepUntil(deadline);
+		const double oversleep = toSeconds(Clock::now() - deadline);
+		oversleepSeconds += oversleep;
+		++waits;
+		stats.maxOversleepSeconds = std::max(stats.maxOversleepSeconds, oversleep);
+	}
+	iterationStart = Clock::now();
+}
+
+/**
+	Returns the counters of the loop
+
+	@return stats
+*/
+LoopScheduler::Stats LoopScheduler::getStats() const
+{
+	Stats result = stats;
+	const double seconds = toSeconds(Clock::now() - statsStart);
+	result.averageFrameSeconds = frameIntervals > 0 ? frameSeconds / frameIntervals : 0.0;
+	result.averageWorkSeconds = iterations > 0 ? workSeconds / iterations : 0.0;
+	result.cpuUsage = seconds > 0.0 ? std::max(0.0, std::min(1.0, 1.0 - sleptSeconds / seconds)) : 0.0;
+	result.averageOversleepSeconds = waits > 0 ? oversleepSeconds / waits : 0.0;
+	return result;
+}
+
+/**
+	Starts counting from zero again
+*/
+void LoopScheduler::resetStats()
+{
+	stats = Stats();
+	statsStart = Clock::now();
+	workSeconds = 0.0;
+	sleptSeconds = 0.0;
+	frameSeconds = 0.0;
+	frameIntervals = 0;
+	oversleepSeconds = 0.0;
+	iterations = 0;
+	waits = 0;
+}
+
+/**
+	Sleeps in steps of 1 ms while a step is expected to end before the deadline (its mean duration plus a standard
+	deviation, from the recent steps), then yields until the deadline
+
+	@param deadline
+*/
+void LoopScheduler::sleepUntil(Clock::time_point deadline)
+{
+	while (true) {
+		const Clock::time_point start = Clock::now();
+		const double expected = sleepCount > 0 ? sleepMean + std::sqrt(sleepVariance) : 0.001;
+		if (toSeconds(deadline - start) <= expected) {
+			break;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		const double slept = toSeconds(Clock::now() - start);
+		sleptSeconds += slept;
+		// Running mean and variance of the first sleeps, then weighted towards the last sleepHistory ones
+		sleepCount = std::min(sleepCount + 1, sleepHistory);
+		const double weight = 1.0 / sleepCount;
+		const double difference = slept - sleepMean;
+		sleepMean += weight * difference;
+		sleepVariance = (1.0 - weight) * (sleepVariance + weight * difference * difference);
+	}
+	while (Clock::now() < deadline) {
+		std::this_thread::yield();
+	}
+}
+
+/**
+	Converts a duration of the clock to seconds
+
+	@param duration
+	@return seconds
+*/
+double LoopScheduler::toSeconds(Clock::duration duration)
+{
+	return std::chrono::duration<double>(duration).count();
+}
@@ -0,0 +1,73 @@
+/**
+	Paces the game loop: the logic runs in ticks of a fixed length however fast the loop runs, frames are rendered at
+	most at a fixed rate, and the loop sleeps until the next tick or frame is due instead of spinning
+
+	A loop which falls behind runs the ticks it missed (up to maxTicksPerIteration, the rest are dropped so it can catch
+	up) and skips the frames it missed. A frame is also skipped when no tick ran since the last one (nothing could have
+	changed). Sleeping is done in steps of 1 ms while a step is expected to end before the deadline (from how long the
+	steps took so far), and the rest of the wait yields the thread, so waking up is precise even with a coarse timer.
+*/
+
+#pragma once
+#include <chrono>
+
+class LoopScheduler {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	/**
+		Counters of the loop (since the scheduler was constructed or the last resetStats())
+	*/
+	struct Stats {
+		int ticks = 0;	// Ticks run
+		int droppedTicks = 0;	// Ticks left out because the loop was too far behind
+		int frames = 0;	// Frames rendered
+		int skippedFrames = 0;	// Frames not rendered (missed, or nothing changed)
+		double averageFrameSeconds = 0.0;	// Time from a rendered frame to the next one
+		double maxFrameSeconds = 0.0;
+		double averageWorkSeconds = 0.0;	// Time an iteration of the loop worked (not sleeping)
+		double maxWorkSeconds = 0.0;
+		double cpuUsage = 0.0;	// Part of the time the loop did not sleep (0 to 1)
+		double averageOversleepSeconds = 0.0;	// How late the loop woke up
+		double maxOversleepSeconds = 0.0;
+	};
+
+public:
+	LoopScheduler(int ticksPerSecond, int framesPerSecondIn);
+
+	int takeDueTicks();
+	bool takeDueFrame();
+	void waitForNextEvent();
+	Stats getStats() const;
+	void resetStats();
+
+	static constexpr int maxTicksPerIteration = 8;
+	static constexpr int sleepHistory = 64;	// Sleeps the estimate of a sleep mostly depends on
+
+private:
+	void sleepUntil(Clock::time_point deadline);
+	static double toSeconds(Clock::duration duration);
+
+private:
+	Clock::duration tickDuration;
+	Clock::duration frameDuration;	// Zero when the frames are not capped (rendered after every tick)
+	Clock::time_point nextTick;
+	Clock::time_point nextFrame;
+	Clock::time_point iterationStart;	// When the loop last woke up
+	Clock::time_point lastFrame;	// When the last frame was rendered
+	bool hasTickSinceFrame = true;	// A tick ran since the last rendered frame
+	// How long a sleep of 1 ms takes (mean and variance of the recent ones, see sleepUntil())
+	int sleepCount = 0;
+	double sleepMean = 0.0;
+	double sleepVariance = 0.0;
+
+	Clock::time_point statsStart;
+	double workSeconds = 0.0;
+	double sleptSeconds = 0.0;	// Time spent in sleeps (the yielding at the end of a wait counts as work)
+	double frameSeconds = 0.0;
+	int frameIntervals = 0;	// Times between rendered frames summed in frameSeconds
+	double oversleepSeconds = 0.0;
+	int iterations = 0;
+	int waits = 0;
+	Stats stats;
+};
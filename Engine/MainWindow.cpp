@@ -23,8 +23,11 @@
 #include "Graphics.h"
 #include "ChiliException.h"
 #include "Game.h"
+#include <timeapi.h>
 #include <assert.h>
 
+#pragma comment( lib,"winmm.lib" )
+
 MainWindow::MainWindow( HINSTANCE hInst,wchar_t * pArgs )
 	:
 	args( pArgs ),
@@ -61,10 +64,14 @@ MainWindow::MainWindow( HINSTANCE hInst,wchar_t * pArgs )
 	// show and update
 	ShowWindow( hWnd,SW_SHOWDEFAULT );
 	UpdateWindow( hWnd );
+
+	// 1 ms timer resolution, so the game loop can sleep until the next tick precisely (see LoopScheduler)
+	timeBeginPeriod( 1u );
 }
 
 MainWindow::~MainWindow()
 {
+	timeEndPeriod( 1u );
 	// unregister window class
 	UnregisterClass( wndClassName,hInst );
 }
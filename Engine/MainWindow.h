@@ -26,10 +26,10 @@
 #include "ChiliException.h"
 #include <string>
 
-// for granting special access to hWnd only for Graphics constructor
+// for granting special access to hWnd only for the D3D backend constructor
 class HWNDKey
 {
-	friend Graphics::Graphics( HWNDKey& );
+	friend class D3DBackend;
 public:
 	HWNDKey( const HWNDKey& ) = delete;
 	HWNDKey& operator=( HWNDKey& ) = delete;
@@ -0,0 +1,169 @@
+#include "MemoryBackend.h"
+#include "Graphics.h"
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+
+/**
+	Constructs the backend with a black frame
+*/
+MemoryBackend::MemoryBackend()
+	:
+	frame(Graphics::ScreenWidth, Graphics::ScreenHeight)
+{
+}
+
+/**
+	Copies the changed areas of the finished frame
+
+	@param pPixels The frame (Graphics::ScreenHeight rows of Graphics::ScreenWidth pixels)
+	@param damage The areas which changed since the last frame
+*/
+void MemoryBackend::Present(const Color* pPixels, const std::vector<RectI>& damage)
+{
+	for (const RectI& rect : damage) {
+		for (int y = rect.top; y < rect.bottom; ++y) {
+			memcpy(&frame.getPixels()[frame.getWidth() * y + rect.left], &pPixels[frame.getWidth() * y + rect.left],
+				sizeof(Color) * (rect.right - rect.left));
+		}
+	}
+	++frameCount;
+}
+
+/**
+	Returns the last presented frame (black before the first one)
+
+	@return The last frame
+*/
+const Surface& MemoryBackend::getFrame() const
+{
+	return frame;
+}
+
+/**
+	Returns how many frames have been presented
+
+	@return The number of frames
+*/
+int MemoryBackend::getFrameCount() const
+{
+	return frameCount;
+}
+
+/**
+	Writes the last frame as a binary PPM (P6) file
+
+	@param path Path of the file, overwritten if it exists
+	@return If the whole file could be written
+*/
+bool MemoryBackend::savePPM(const std::string& path) const
+{
+	std::vector<unsigned char> data;
+	data.reserve(std::size_t(frame.getWidth()) * frame.getHeight() * 3);
+	for (int i = 0; i < frame.getWidth() * frame.getHeight(); ++i) {
+		const Color c = frame.getPixels()[i];
+		data.push_back(c.GetR());
+		data.push_back(c.GetG());
+		data.push_back(c.GetB());
+	}
+	std::ofstream file(path, std::ios::binary);
+	file << "P6\n" << frame.getWidth() << ' ' << frame.getHeight() << "\n255\n";
+	file.write((const char*)data.data(), data.size());
+	return bool(file.flush());
+}
+
+/**
+	Writes the last frame as an 8 bit RGB PNG file
+	The image data is stored without compression (zlib stored blocks), so no library is needed
+
+	@param path Path of the file, overwritten if it exists
+	@return If the whole file could be written
+*/
+bool MemoryBackend::savePNG(const std::string& path) const
+{
+	const int width = frame.getWidth();
+	const int height = frame.getHeight();
+	auto appendBigEndian = [](std::vector<unsigned char>& bytes, std::uint32_t value) {
+		for (int shift = 24; shift >= 0; shift -= 8) {
+			bytes.push_back((unsigned char)(value >> shift));
+		}
+	};
+
+	// every row starts with its filter type (0: none)
+	std::vector<unsigned char> raw;
+	raw.reserve(std::size_t(width * 3 + 1) * height);
+	for (int y = 0; y < height; ++y) {
+		raw.push_back(0);
+		for (int x = 0; x < width; ++x) {
+			const Color c = frame.getPixels()[width * y + x];
+			raw.push_back(c.GetR());
+			raw.push_back(c.GetG());
+			raw.push_back(c.GetB());
+		}
+	}
+
+	// zlib stream: header, stored blocks of at most 65535 bytes, Adler-32 of the raw data
+	std::vector<unsigned char> zlib = { 0x78, 0x01 };
+	std::uint32_t adlerA = 1;
+	std::uint32_t adlerB = 0;
+	for (unsigned char byte : raw) {
+		adlerA = (adlerA + byte) % 65521;
+		adlerB = (adlerB + adlerA) % 65521;
+	}
+	std::size_t offset = 0;
+	do {
+		const std::size_t length = std::min<std::size_t>(raw.size() - offset, 65535);
+		zlib.push_back(offset + length == raw.size() ? 1 : 0);
+		zlib.push_back((unsigned char)length);
+		zlib.push_back((unsigned char)(length >> 8));
+		zlib.push_back((unsigned char)~length);
+		zlib.push_back((unsigned char)(~length >> 8));
+		zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+		offset += length;
+	} while (offset < raw.size());
+	appendBigEndian(zlib, (adlerB << 16) | adlerA);
+
+	std::vector<unsigned char> header;
+	appendBigEndian(header, width);
+	appendBigEndian(header, height);
+	header.insert(header.end(), { 8, 2, 0, 0, 0 }); // 8 bit, RGB, deflate, adaptive filtering, no interlace
+
+	std::vector<unsigned char> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	appendChunk(png, "IHDR", header);
+	appendChunk(png, "IDAT", zlib);
+	appendChunk(png, "IEND", {});
+
+	std::ofstream file(path, std::ios::binary);
+	file.write((const char*)png.data(), png.size());
+	return bool(file.flush());
+}
+
+/**
+	Appends a PNG chunk: length, type, data and the CRC-32 of type and data
+
+	@param png The file so far
+	@param type The four letters of the chunk type
+	@param data The chunk data
+*/
+void MemoryBackend::appendChunk(std::vector<unsigned char>& png, const char* type, const std::vector<unsigned char>& data)
+{
+	const std::size_t start = png.size();
+	const std::uint32_t length = std::uint32_t(data.size());
+	for (int shift = 24; shift >= 0; shift -= 8) {
+		png.push_back((unsigned char)(length >> shift));
+	}
+	png.insert(png.end(), type, type + 4);
+	png.insert(png.end(), data.begin(), data.end());
+
+	std::uint32_t crc = 0xFFFFFFFFu;
+	for (std::size_t i = start + 4; i < png.size(); ++i) {
+		crc ^= png[i];
+		for (int bit = 0; bit < 8; ++bit) {
+			crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+		}
+	}
+	crc = ~crc;
+	for (int shift = 24; shift >= 0; shift -= 8) {
+		png.push_back((unsigned char)(crc >> shift));
+	}
+}
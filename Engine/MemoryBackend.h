@@ -0,0 +1,29 @@
+/**
+	Backend which keeps the last presented frame in memory instead of showing it
+	Lets the rendering (Graphics, SpriteCodex, the minefields, the menu) run without a window, e.g. to compare frames to golden images
+*/
+
+#pragma once
+#include "GraphicsBackend.h"
+#include "Surface.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class MemoryBackend : public GraphicsBackend {
+public:
+	MemoryBackend();
+
+	void Present(const Color* pPixels, const std::vector<RectI>& damage) override;
+
+	const Surface& getFrame() const;
+	int getFrameCount() const;
+	bool savePPM(const std::string& path) const;
+	bool savePNG(const std::string& path) const;
+
+private:
+	static void appendChunk(std::vector<unsigned char>& png, const char* type, const std::vector<unsigned char>& data);
+
+	Surface frame;
+	int frameCount = 0;
+};
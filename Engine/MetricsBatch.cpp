@@ -0,0 +1,42 @@
+#include "MetricsBatch.h"
+#include <algorithm>
+#include <functional>
+
+/**
+	Constructs a batch
+
+	@param poolIn Threads computing the runs of boards (nullptr to compute every board on the calling thread)
+*/
+MetricsBatch::MetricsBatch(ThreadPool* poolIn)
+	:
+	pool(poolIn)
+{
+}
+
+/**
+	Computes the metrics of every board
+
+	@param grids Boards with their mines and adjacent mine counts set
+	@param metrics Set to the metrics of each board, in the same order
+*/
+void MetricsBatch::compute(const std::vector<TileGrid>& grids, std::vector<BoardMetrics::Metrics>& metrics)
+{
+	const int nGrids = (int)grids.size();
+	metrics.resize(nGrids);
+	const int nRuns = pool != nullptr ? std::min(pool->getThreadCount(), nGrids) : 1;
+	if ((int)calculators.size() < nRuns) {
+		calculators.resize(nRuns);
+	}
+	const auto computeRun = [this, &grids, &metrics, nGrids, nRuns](int run) {
+		const int end = int((long long)nGrids * (run + 1) / nRuns);
+		for (int grid = int((long long)nGrids * run / nRuns); grid < end; ++grid) {
+			metrics[grid] = calculators[run].compute(grids[grid]);
+		}
+	};
+	if (nRuns > 1) {
+		pool->parallelFor(nRuns, std::cref(computeRun));	// Wrapped in a reference, so the std::function never allocates
+	}
+	else if (nRuns == 1) {
+		computeRun(0);
+	}
+}
@@ -0,0 +1,20 @@
+/**
+	Computes the metrics of many boards at once (see BoardMetrics), split into one run of boards per thread of a pool
+*/
+
+#pragma once
+#include "BoardMetrics.h"
+#include "TileGrid.h"
+#include "ThreadPool.h"
+#include <vector>
+
+class MetricsBatch {
+public:
+	MetricsBatch(ThreadPool* poolIn = nullptr);
+
+	void compute(const std::vector<TileGrid>& grids, std::vector<BoardMetrics::Metrics>& metrics);
+
+private:
+	ThreadPool* pool = nullptr;	// nullptr to compute every board on the calling thread
+	std::vector<BoardMetrics> calculators;	// One per run of boards (never shrinks, so the memory is kept between batches)
+};
@@ -0,0 +1,86 @@
+/**
+	Mine placement shared by TileGrid and BasicMinefield, so a seed and a first click give the same mines on both
+
+	The tiles are addressed by their index y * width + x, the callers map it to their own layout.
+*/
+
+#pragma once
+#include "CounterRng.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace MinePlacement {
+	/**
+		Writes the sorted indices of the tiles which must stay free of mines: the 3x3 box around the safe tile,
+		or only the safe tile itself when the field is too full to keep the whole box free
+
+		@param width
+		@param height
+		@param nMines The amount of mines to place
+		@param safeIndex Index of the tile which was clicked
+		@param excluded Receives the indices (room for 9 of them)
+		@return The amount of excluded tiles
+	*/
+	inline int getExcludedTiles(int width, int height, int nMines, int safeIndex, int* excluded)
+	{
+		const int safeX = safeIndex % width;
+		const int safeY = safeIndex / width;
+		int nExcluded = 0;
+		for (int y = std::max(0, safeY - 1); y <= std::min(height - 1, safeY + 1); ++y) {
+			for (int x = std::max(0, safeX - 1); x <= std::min(width - 1, safeX + 1); ++x) {
+				excluded[nExcluded++] = y * width + x;
+			}
+		}
+		if (width * height - nExcluded < nMines) {
+			excluded[0] = safeIndex;
+			nExcluded = 1;
+		}
+		return nExcluded;
+	}
+
+	/**
+		Places mines with a single pass partial Fisher-Yates shuffle over the allowed tiles: only as many positions
+		are drawn as there are tiles to pick. When more than half of the allowed tiles get a mine, the safe tiles are
+		drawn instead and every other allowed tile gets a mine, so the amount of random draws never exceeds half of
+		the field.
+
+		@param tileCount
+		@param nMines The amount of mines to place
+		@param excluded Sorted indices of the tiles which must stay free of mines
+		@param nExcluded
+		@param seed Seed of the counter-based random numbers (draw i uses number i of the sequence)
+		@param candidates Scratch space for tileCount - nExcluded indices
+		@param placeMine Called as placeMine(index) once for every tile which gets a mine
+	*/
+	template<typename PlaceMine>
+	void shuffleMines(int tileCount, int nMines, const int* excluded, int nExcluded, std::uint64_t seed,
+		int* candidates, PlaceMine placeMine)
+	{
+		const int nAllowed = tileCount - nExcluded;
+
+		// Lay the allowed tiles out in a contiguous array (the excluded tiles are skipped)
+		int e = 0;
+		for (int i = 0, c = 0; i < tileCount; ++i) {
+			if (e < nExcluded && excluded[e] == i) {
+				++e;
+			}
+			else {
+				candidates[c++] = i;
+			}
+		}
+
+		const bool dense = nMines > nAllowed / 2;
+		const int nPicked = dense ? nAllowed - nMines : nMines;
+		for (int i = 0; i < nPicked; ++i) {
+			const int pick = i + (int)CounterRng::getBelow(seed, std::uint64_t(i), std::uint32_t(nAllowed - i));
+			std::swap(candidates[i], candidates[pick]);
+		}
+
+		// The picked tiles get the mines, or every tile but the picked ones when the field is dense
+		const int first = dense ? nPicked : 0;
+		const int last = dense ? nAllowed : nPicked;
+		for (int i = first; i < last; ++i) {
+			placeMine(candidates[i]);
+		}
+	}
+}
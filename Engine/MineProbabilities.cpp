@@ -0,0 +1,375 @@
+#include "MineProbabilities.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <assert.h>
+
+/**
+	Computes the probability of every tile of a board to be a mine
+
+	@param board
+	@param pool Threads counting the components with at least minParallelTiles tiles (nullptr to count every component
+		on the calling thread)
+	@param trustsFlags Flagged tiles are taken as mines (otherwise they are hidden tiles like any other)
+	@return isConsistent False if no way of placing the mines fits the board (the probabilities are then all 0)
+*/
+bool MineProbabilities::compute(const VisibleBoard& board, ThreadPool* pool, bool trustsFlags)
+{
+	width = board.getWidth();
+	height = board.getHeight();
+	isConsistent = true;
+	probabilities.assign(width * height, 0.0);
+	positionOfTile.resize(width * height);
+	otherProbability = 0.0;
+	buildComponents(board, trustsFlags);
+
+	int knownMines = 0;
+	int nOthers = 0;
+	for (int index = 0; index < width * height; ++index) {
+		if (trustsFlags && board.getTile(index) == VisibleBoard::flagged) {
+			++knownMines;
+		}
+		else if (!board.isRevealed(index) && roots[index] < 0) {
+			++nOthers;
+		}
+	}
+
+	componentIsConsistent.assign(nComponents, 1);
+	const std::function<void(int)> count = [this](int component) {
+		componentIsConsistent[component] = components[component].count(constraints, positionOfTile);
+	};
+	runOnComponents(pool, count);
+	isConsistent = isConsistent && std::find(componentIsConsistent.begin(), componentIsConsistent.end(), 0) ==
+		componentIsConsistent.end();
+	if (!isConsistent || !combine(board.getMineCount() - knownMines, nOthers)) {
+		isConsistent = false;
+		std::fill(probabilities.begin(), probabilities.end(), 0.0);
+		return false;
+	}
+
+	const std::function<void(int)> weigh = [this](int component) {
+		components[component].computeProbabilities(weights[component].data(), probabilities);
+	};
+	runOnComponents(pool, weigh);
+	for (int index = 0; index < width * height; ++index) {
+		if (trustsFlags && board.getTile(index) == VisibleBoard::flagged) {
+			probabilities[index] = 1.0;
+		}
+		else if (!board.isRevealed(index) && roots[index] < 0) {
+			probabilities[index] = otherProbability;
+		}
+	}
+	return true;
+}
+
+/**
+	Lists the numbers with hidden neighbours and joins the hidden tiles they share into components
+
+	@param board
+	@param trustsFlags
+*/
+void MineProbabilities::buildComponents(const VisibleBoard& board, bool trustsFlags)
+{
+	constraints.clear();
+	roots.assign(width * height, -1);
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			if (!board.isRevealed(y * width + x)) {
+				continue;
+			}
+			FrontierComponent::Constraint constraint;
+			constraint.mines = board.getTile(y * width + x);
+			constraint.nTiles = 0;
+			for (int ny = std::max(0, y - 1); ny <= std::min(height - 1, y + 1); ++ny) {
+				for (int nx = std::max(0, x - 1); nx <= std::min(width - 1, x + 1); ++nx) {
+					const int neighbour = ny * width + nx;
+					if (trustsFlags && board.getTile(neighbour) == VisibleBoard::flagged) {
+						--constraint.mines;
+					}
+					else if (!board.isRevealed(neighbour)) {
+						constraint.tiles[constraint.nTiles++] = neighbour;
+					}
+				}
+			}
+			if (constraint.mines < 0 || constraint.mines > constraint.nTiles) {
+				isConsistent = false;
+			}
+			if (constraint.nTiles == 0) {
+				continue;
+			}
+			constraints.push_back(constraint);
+			for (int i = 0; i < constraint.nTiles; ++i) {
+				int& root = roots[constraint.tiles[i]];
+				root = root < 0 ? constraint.tiles[i] : root;
+			}
+			// Join the tiles of the number (union by index, the smaller root wins)
+			for (int i = 1; i < constraint.nTiles; ++i) {
+				const int a = findRoot(constraint.tiles[0]);
+				const int b = findRoot(constraint.tiles[i]);
+				roots[std::max(a, b)] = std::min(a, b);
+			}
+		}
+	}
+
+	nComponents = 0;
+	componentOfRoot.assign(width * height, -1);
+	for (int index = 0; index < width * height; ++index) {
+		if (roots[index] < 0) {
+			continue;
+		}
+		const int root = findRoot(index);
+		if (componentOfRoot[root] < 0) {
+			if (nComponents == (int)components.size()) {
+				components.emplace_back();
+			}
+			components[nComponents].clear();
+			componentOfRoot[root] = nComponents++;
+		}
+		components[componentOfRoot[root]].addTile(index);
+	}
+	for (int c = 0; c < (int)constraints.size(); ++c) {
+		components[componentOfRoot[findRoot(constraints[c].tiles[0])]].addConstraint(c);
+	}
+}
+
+/**
+	Returns the root of the union-find tree of a frontier tile (halving the path on the way)
+
+	@param tile
+	@return root
+*/
+int MineProbabilities::findRoot(int tile)
+{
+	while (roots[tile] != tile) {
+		roots[tile] = roots[roots[tile]];
+		tile = roots[tile];
+	}
+	return tile;
+}
+
+/**
+	Runs a task on every component: the large ones on the pool (if there is more than one), the rest on this thread
+
+	@param pool
+	@param task Takes the index of the component
+*/
+void MineProbabilities::runOnComponents(ThreadPool* pool, const std::function<void(int)>& task)
+{
+	largeComponents.clear();
+	for (int c = 0; c < nComponents; ++c) {
+		if (pool != nullptr && components[c].getTileCount() >= minParallelTiles) {
+			largeComponents.push_back(c);
+		}
+		else {
+			task(c);
+		}
+	}
+	if (largeComponents.size() > 1) {
+		const auto runLarge = [this, &task](int i) {
+			task(largeComponents[i]);
+		};
+		pool->parallelFor((int)largeComponents.size(), std::cref(runLarge));	// Wrapped in a reference, so the std::function never allocates
+	}
+	else if (largeComponents.size() == 1) {
+		task(largeComponents[0]);
+	}
+}
+
+/**
+	Combines the mine counts of the components with the other hidden tiles into the weight of each amount of mines of
+	each component, and the probability of the other tiles
+
+	@param nMines Mines left to the hidden tiles
+	@param nOthers Hidden tiles away from the frontier
+	@return isConsistent False if the amount of mines cannot fit
+*/
+bool MineProbabilities::combine(int nMines, int nOthers)
+{
+	if (nMines < 0) {
+		return false;
+	}
+	prefixes.resize(nComponents + 1);
+	suffixes.resize(nComponents + 1);
+	prefixMins.resize(nComponents + 1);
+	suffixMins.resize(nComponents + 1);
+	weights.resize(std::max(weights.size(), std::size_t(nComponents)));
+	auto normalize = [](std::vector<double>& distribution) {
+		const double largest = *std::max_element(distribution.begin(), distribution.end());
+		if (largest > 0.0) {
+			for (double& value : distribution) {
+				value /= largest;
+			}
+		}
+	};
+
+	// The counts of every component (kept in its weights until they are computed), then the distributions of the
+	// components before each one and from each one on, without the amounts beyond nMines
+	for (int c = 0; c < nComponents; ++c) {
+		const FrontierComponent& component = components[c];
+		weights[c].resize(component.getMaxMines() - component.getMinMines() + 1);
+		for (int mines = component.getMinMines(); mines <= component.getMaxMines(); ++mines) {
+			weights[c][mines - component.getMinMines()] = component.getCount(mines);
+		}
+		normalize(weights[c]);
+	}
+	prefixes[0].assign(1, 1.0);
+	prefixMins[0] = 0;
+	for (int c = 0; c < nComponents; ++c) {
+		prefixMins[c + 1] = prefixMins[c] + components[c].getMinMines();
+		if (prefixMins[c + 1] > nMines) {
+			return false;
+		}
+		convolve(prefixes[c], weights[c], prefixes[c + 1], nMines - prefixMins[c + 1] + 1);
+		normalize(prefixes[c + 1]);
+	}
+	suffixes[nComponents].assign(1, 1.0);
+	suffixMins[nComponents] = 0;
+	for (int c = nComponents - 1; c >= 0; --c) {
+		suffixMins[c] = suffixMins[c + 1] + components[c].getMinMines();
+		convolve(weights[c], suffixes[c + 1], suffixes[c], nMines - suffixMins[c] + 1);
+		normalize(suffixes[c]);
+	}
+
+	// Weight of each amount of mines of the whole frontier: the ways to place the rest on the other tiles
+	const std::vector<double>& totals = prefixes[nComponents];
+	const int minTotal = prefixMins[nComponents];
+	const int maxTotal = minTotal + (int)totals.size() - 1;
+	const double logOthers = std::lgamma(nOthers + 1.0);
+	auto logBinomial = [nOthers, logOthers](int k) {
+		return logOthers - std::lgamma(k + 1.0) - std::lgamma(nOthers - k + 1.0);
+	};
+	double largestLog = -HUGE_VAL;
+	for (int total = std::max(minTotal, nMines - nOthers); total <= maxTotal; ++total) {
+		largestLog = std::max(largestLog, logBinomial(nMines - total));
+	}
+	binomials.resize(totals.size());
+	double sum = 0.0;
+	double otherMines = 0.0;
+	for (int total = minTotal; total <= maxTotal; ++total) {
+		const int left = nMines - total;
+		const double binomial = left <= nOthers ? std::exp(logBinomial(left) - largestLog) : 0.0;
+		binomials[total - minTotal] = binomial;
+		sum += totals[total - minTotal] * binomial;
+		otherMines += totals[total - minTotal] * binomial * left;
+	}
+	if (!(sum > 0.0)) {
+		return false;
+	}
+	otherProbability = nOthers > 0 ? otherMines / (sum * nOthers) : 0.0;
+
+	// Weight of each amount of mines of a component: the ways to place the rest on the other components and tiles
+	for (int c = 0; c < nComponents; ++c) {
+		convolve(prefixes[c], suffixes[c + 1], rest, nMines - prefixMins[c] - suffixMins[c + 1] + 1);
+		const int restMin = prefixMins[c] + suffixMins[c + 1];
+		const int minMines = components[c].getMinMines();
+		for (int k = 0; k < (int)weights[c].size(); ++k) {
+			double weight = 0.0;
+			for (int r = 0; r < (int)rest.size(); ++r) {
+				const int total = minMines + k + restMin + r;
+				if (total > maxTotal) {
+					break;
+				}
+				weight += rest[r] * binomials[total - minTotal];
+			}
+			weights[c][k] = weight;
+		}
+	}
+	return true;
+}
+
+/**
+	Convolves two distributions of amounts of mines (each starting at its fewest mines)
+
+	@param a
+	@param b
+	@param out Set to the distribution of the sum, without the amounts past maxSize
+	@param maxSize At least 1
+*/
+void MineProbabilities::convolve(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& out,
+	int maxSize)
+{
+	assert(maxSize >= 1);
+	out.assign(std::min(int(a.size() + b.size()) - 1, maxSize), 0.0);
+	for (int i = 0; i < (int)a.size() && i < (int)out.size(); ++i) {
+		for (int j = 0; j < (int)b.size() && i + j < (int)out.size(); ++j) {
+			out[i + j] += a[i] * b[j];
+		}
+	}
+}
+
+/**
+	Returns the probability of a tile to be a mine (0 for revealed tiles, 1 for trusted flags)
+
+	@param index
+	@return probability
+*/
+double MineProbabilities::getProbability(int index) const
+{
+	assert(index >= 0 && index < width * height);
+	return probabilities[index];
+}
+
+/**
+	Returns the probability of a hidden tile away from the frontier to be a mine (they are all alike)
+
+	@return probability
+*/
+double MineProbabilities::getOtherProbability() const
+{
+	return otherProbability;
+}
+
+/**
+	Returns the hidden tile least likely to be a mine, the first one of them in tile order (flagged tiles are left out)
+
+	@param board The board the probabilities were computed for
+	@return index -1 if there is no such tile
+*/
+int MineProbabilities::findSafestTile(const VisibleBoard& board) const
+{
+	int safest = -1;
+	for (int index = 0; index < width * height; ++index) {
+		if (board.getTile(index) == VisibleBoard::hidden && (safest < 0 || probabilities[index] < probabilities[safest])) {
+			safest = index;
+		}
+	}
+	return safest;
+}
+
+/**
+	Returns the amount of components of the frontier of the last board
+
+	@return componentCount
+*/
+int MineProbabilities::getComponentCount() const
+{
+	return nComponents;
+}
+
+/**
+	Returns the amount of tiles of the largest component of the last board
+
+	@return tileCount
+*/
+int MineProbabilities::getLargestComponentSize() const
+{
+	int largest = 0;
+	for (int c = 0; c < nComponents; ++c) {
+		largest = std::max(largest, components[c].getTileCount());
+	}
+	return largest;
+}
+
+/**
+	Returns the amount of states every component of the last board went through together
+
+	@return stateCount
+*/
+int MineProbabilities::getStateCount() const
+{
+	int stateCount = 0;
+	for (int c = 0; c < nComponents; ++c) {
+		stateCount += components[c].getStateCount();
+	}
+	return stateCount;
+}
@@ -0,0 +1,63 @@
+/**
+	Computes the exact probability of every hidden tile of a board to be a mine, from what a player sees
+
+	The frontier (the hidden tiles next to revealed numbers) splits into components which share no number, so the
+	ways to place the mines of each one can be counted on their own (see FrontierComponent). They only depend on each
+	other through the amount of mines of the whole board: every way to place k mines on the frontier leaves the rest of
+	the mines to the hidden tiles away from it, in C(others, nMines - k) ways. The distributions of the components are
+	combined by convolution (and the distribution of all of them but one from the components before and after it), and
+	the binomials are taken from their logarithms, relative to the largest one, so neither overflows on any board.
+	Components with many tiles are counted in parallel when a pool is given.
+*/
+
+#pragma once
+#include "VisibleBoard.h"
+#include "FrontierComponent.h"
+#include "ThreadPool.h"
+#include <vector>
+#include <functional>
+
+class MineProbabilities {
+public:
+	bool compute(const VisibleBoard& board, ThreadPool* pool = nullptr, bool trustsFlags = false);
+
+	double getProbability(int index) const;
+	double getOtherProbability() const;
+	int findSafestTile(const VisibleBoard& board) const;
+	int getComponentCount() const;
+	int getLargestComponentSize() const;
+	int getStateCount() const;
+
+	static constexpr int minParallelTiles = 24;	// Components with fewer tiles are counted on the calling thread
+
+private:
+	void buildComponents(const VisibleBoard& board, bool trustsFlags);
+	int findRoot(int tile);
+	void runOnComponents(ThreadPool* pool, const std::function<void(int)>& task);
+	bool combine(int nMines, int nOthers);
+	static void convolve(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& out,
+		int maxSize);
+
+private:
+	int width = 0;
+	int height = 0;
+	bool isConsistent = true;
+	std::vector<double> probabilities;	// Per tile (these vectors never shrink, so the memory is kept between computes)
+	double otherProbability = 0.0;	// Of the hidden tiles away from the frontier
+	std::vector<FrontierComponent::Constraint> constraints;
+	std::vector<int> roots;	// Per tile: union-find parent of a frontier tile, -1 for the other tiles
+	std::vector<int> componentOfRoot;
+	std::vector<int> positionOfTile;	// Scratch of the components
+	std::vector<FrontierComponent> components;	// The first nComponents are used
+	int nComponents = 0;
+	std::vector<int> largeComponents;
+	std::vector<char> componentIsConsistent;
+	// Combining the components: distributions of the amount of mines, each starting at the fewest mines possible
+	std::vector<std::vector<double>> prefixes;	// Of the components before each one
+	std::vector<std::vector<double>> suffixes;	// Of the components from each one on
+	std::vector<int> prefixMins;
+	std::vector<int> suffixMins;
+	std::vector<double> rest;
+	std::vector<double> binomials;	// Weight of each amount of mines left to the other tiles
+	std::vector<std::vector<double>> weights;	// Per component: weight of each of its amounts of mines
+};
@@ -1,269 +1,378 @@
 #include "Minefield.h"
 #include "RectI.h"
-#include <random>
 #include <algorithm>
 #include <assert.h>
 
 /**
-	Draws a Tile to the screen (If minefield is exploded, draws hidden mines as well)
+	Draws a Tile to the screen at the zoom of the camera (If minefield is exploded, draws hidden mines as well)
 
-	@param gfx Graphics processor
-	@param isExploded Whether or not the minefield is already exploded
+	@param target Graphics processor or Canvas drawn into (only reads the minefield, so bands can be drawn concurrently)
+	@param index Index of the tile to be drawn (the tile at the top-left of the pixel when it covers several)
+	@param position Screen position of the top-left corner of the tile
 */
-void Minefield::Tile::draw(Graphics & gfx, bool minefieldIsExploded) const
+template<typename Target>
+void Minefield::drawTile(Target& target, int index, const Vei2& position) const
 {
-	switch (state) {
+	const int zoom = camera.getZoom();
+	if (zoom > 0) {
+		tileImages.draw(target, (int)getTileLook(index), zoom, position);
+	}
+	else if (zoom == 0) {
+		target.PutPixel(position.x, position.y, tileImages.getColor((int)getTileLook(index)));
+	}
+	else {
+		// The pixel covers a block of 2^-zoom x 2^-zoom tiles, which is a cell of the pyramid (or more than the whole field)
+		const Vei2 tile = camera.toTile(position);
+		const int level = std::min(-zoom, pyramid.getLevelCount());
+		target.PutPixel(position.x, position.y, getOverviewColor(pyramid.getCell(level, tile.x >> level, tile.y >> level)));
+	}
+}
+
+/**
+	Returns how the tile at input index looks (If minefield is exploded, hidden mines show as well)
+
+	@param index
+	@return look
+*/
+Minefield::TileLook Minefield::getTileLook(int index) const
+{
+	switch (field.getState(index)) {
 	case State::Hidden:
-		if (hasMine() && minefieldIsExploded) {
-			SpriteCodex::drawTileMine(position, gfx);
+		return field.hasMine(index) && isExploded ? TileLook::ButtonOverMine : TileLook::Button;
+	case State::PartiallyRevealed:
+		return TileLook::PartiallyRevealed;
+	case State::Revealed:
+		if (!field.hasMine(index)) {
+			return TileLook(int(TileLook::Number0) + field.getAdjacentMineCount(index));
 		}
+		return isExploded ? TileLook::MineRed : TileLook::Button;
+	default: /* Flagged */
+		return isExploded && !field.hasMine(index) ? TileLook::WrongFlag : TileLook::Flag;
+	}
+}
+
+/**
+	Returns the color of a pixel covering the block of tiles of a cell of the pyramid: the colors of hidden, revealed and
+	flagged tiles mixed in the parts of the block they cover (an exploded mine stands out at any zoom)
+	The average colors of the looks hardly differ (a revealed tile is about as gray as a button), so revealed and
+	flagged tiles get colors of their own
+
+	@param cell
+	@return color
+*/
+Color Minefield::getOverviewColor(const TilePyramid::Cell& cell) const
+{
+	if (cell.hasExplodedMine) {
+		return Colors::Yellow;
+	}
+	const Color hiddenColor = tileImages.getColor((int)TileLook::Button);
+	const Color revealedColor = Colors::Gray;
+	const Color flaggedColor = Colors::Red;
+	const int hidden = std::max(TilePyramid::fullPart - cell.revealed - cell.flagged, 0);
+	auto mix = [&](int hiddenChannel, int revealedChannel, int flaggedChannel) {
+		return (unsigned char)((hiddenChannel * hidden + revealedChannel * cell.revealed + flaggedChannel * cell.flagged
+			+ TilePyramid::fullPart / 2) / TilePyramid::fullPart);
+	};
+	return Color(
+		mix(hiddenColor.GetR(), revealedColor.GetR(), flaggedColor.GetR()),
+		mix(hiddenColor.GetG(), revealedColor.GetG(), flaggedColor.GetG()),
+		mix(hiddenColor.GetB(), revealedColor.GetB(), flaggedColor.GetB()));
+}
+
+/**
+	Draws a look of a tile at the size of the sprites
+
+	@param look
+	@param position Screen position of the top-left corner of the tile
+	@param gfx Graphics processor
+*/
+void Minefield::drawTileLook(TileLook look, const Vei2& position, Graphics& gfx)
+{
+	switch (look) {
+	case TileLook::Button:
 		SpriteCodex::drawTileButton(position, gfx);
 		break;
-	case State::PartiallyRevealed:
+	case TileLook::ButtonOverMine:
+		SpriteCodex::drawTileMine(position, gfx);
+		SpriteCodex::drawTileButton(position, gfx);
+		break;
+	case TileLook::PartiallyRevealed:
 		SpriteCodex::drawTile0(position, gfx);
 		break;
-	case State::Revealed:
-		if (!hasMine()) {
-			SpriteCodex::drawTileNumber(adjacentMineCount, position, gfx);
-		}
-		else /* hasMine */ {
-			minefieldIsExploded ?
-				SpriteCodex::drawTileMineRed(position, gfx) : SpriteCodex::drawTileButton(position, gfx);
-		}
+	case TileLook::MineRed:
+		SpriteCodex::drawTileMineRed(position, gfx);
 		break;
-	case State::Flagged:
+	case TileLook::Flag:
+	case TileLook::WrongFlag:
 		SpriteCodex::drawTileButton(position, gfx);
 		SpriteCodex::drawTileFlag(position, gfx);
-		if (minefieldIsExploded && !hasMine()) {
+		if (look == TileLook::WrongFlag) {
 			SpriteCodex::drawTileCross(position, gfx);
 		}
 		break;
+	default:
+		SpriteCodex::drawTileNumber(int(look) - int(TileLook::Number0), position, gfx);
+		break;
 	}
 }
 
 /**
-	Returns the position of the Tile
+	Constructs a minefield object
 
-	@return position
+	@param widthIn Width of the field (in tiles)
+	@param heightIn Height of the field (in tiles)
+	@param nMinesIn The amount of mines for the field to contain
+	@param seedIn Seed from which the mines are generated (the same seed and first click always give the same field)
+	@param poolIn Threads used to generate the mines (nullptr to generate them on the calling thread)
 */
-Vei2 Minefield::Tile::getPosition() const
+Minefield::Minefield(int widthIn, int heightIn, int nMinesIn, std::uint64_t seedIn, ThreadPool* poolIn)
 {
-	return position;
+	reset(widthIn, heightIn, nMinesIn, seedIn, poolIn);
 }
 
 /**
-	Sets the position of the Tile
+	Constructs a minefield object based on the currently selected menu choice
 
-	@param position
+	@param menu A menu object with chosen current difficulty
+	@param seedIn Seed from which the mines are generated
+	@param poolIn Threads used to generate the mines (nullptr to generate them on the calling thread)
 */
-void Minefield::Tile::setPosition(Vei2 position)
+Minefield::Minefield(const Menu& menu, std::uint64_t seedIn, ThreadPool* poolIn)
+	:
+	Minefield(getSelectedOption(menu).setsMinefieldSize.x, getSelectedOption(menu).setsMinefieldSize.y,
+		getSelectedOption(menu).setsMines, seedIn, poolIn)
 {
-	this->position = position;
 }
 
 /**
-	Sets the number of mines which are adjacent to the tile
+	Turns the minefield into a new one in place (The tiles keep their memory, so a field which does not grow never allocates)
 
-	@param mineCount 
+	@param widthIn Width of the field (in tiles)
+	@param heightIn Height of the field (in tiles)
+	@param nMinesIn The amount of mines for the field to contain
+	@param seedIn Seed from which the mines are generated
+	@param poolIn Threads used to generate the mines (nullptr to generate them on the calling thread)
 */
-void Minefield::Tile::setAdjacentMineCount(int mineCount)
+void Minefield::reset(int widthIn, int heightIn, int nMinesIn, std::uint64_t seedIn, ThreadPool* poolIn)
 {
-	adjacentMineCount = mineCount;
+	assert(nMinesIn > 0 && nMinesIn < widthIn*heightIn);	// The field can be larger than the screen, see Camera
+	width = widthIn;
+	height = heightIn;
+	nMines = nMinesIn;
+	seed = seedIn;
+	pool = poolIn;
+	restart();
 }
 
 /**
-	Sets whether or not the tile contains a mine
+	Turns the minefield into a new one based on the currently selected menu choice, in place
 
-	@param set mine or !mine
+	@param menu A menu object with chosen current difficulty
+	@param seedIn Seed from which the mines are generated
+	@param poolIn Threads used to generate the mines (nullptr to generate them on the calling thread)
 */
-void Minefield::Tile::setMine(bool set)
+void Minefield::reset(const Menu& menu, std::uint64_t seedIn, ThreadPool* poolIn)
 {
-	if (set) {
-		assert(!mine);
-		mine = true;
-	}
-	else {
-		assert(mine);  
-		mine = false;
-	}
+	const Menu::Option& option = getSelectedOption(menu);
+	reset(option.setsMinefieldSize.x, option.setsMinefieldSize.y, option.setsMines, seedIn, poolIn);
 }
 
 /**
-	Sets the state of the tile
+	Returns the currently selected menu choice
 
-	@param stateIn
+	@param menu A menu object with chosen current difficulty
+	@return option
 */
-void Minefield::Tile::setState(State stateIn)
+const Menu::Option& Minefield::getSelectedOption(const Menu& menu)
 {
-	switch (stateIn) {
-	case State::Revealed:
-		assert(state == State::Hidden || state == State::PartiallyRevealed);
-		break;
-	case State::PartiallyRevealed:
-		assert(state == State::Hidden);
-		break;
-	case State::Hidden:
-		assert(state != State::Hidden);
-		break;
-	case State::Flagged:
-		assert(state == State::Hidden);
-		break;
-	}
-	state = stateIn;
-}
+	Menu::Option::Name difficulty = menu.getSelectedOption();
 
-/**
-	Returns the amount of mines adjacent to the tile
+	assert(difficulty != Menu::Option::Name::None);	//Ensure a difficulty is selected
 
-	@return adjacentMineCount
-*/
-int Minefield::Tile::getAdjacentMineCount() const
-{
-	return adjacentMineCount;
+	return menu.options[(int)difficulty];
 }
 
 /**
-	Returns the state of the tile
+	Generates mines accross the field from the seed after a tile was clicked
 
-	@return state
+	@param clickedIndex Index of the tile which was clicked (it and its surrounding tiles are kept free of mines)
 */
-Minefield::Tile::State Minefield::Tile::getState() const
+void Minefield::generateMines(int clickedIndex)
 {
-	return state;
+	assert(!minesAreGenerated);
+	if (noGuessGenerator) {
+		noGuessGenerator->generate(width, height, nMines, clickedIndex, seed);
+		field.clearMines();
+		for (int index = 0; index < width * height; ++index) {
+			if (noGuessGenerator->hasMine(index)) {
+				field.setMine(index, true);
+			}
+		}
+	}
+	else {
+		field.placeMines(nMines, clickedIndex, seed, pool);
+	}
+
+	// Once mines have been spawned, set the numbers of each tile stating how many mines are nearby
+	field.countAdjacentMines(pool);
+	if (usesOpeningIndex) {
+		openings.build(field);
+	}
+	
+	minesAreGenerated = true;
 }
 
 /**
-	Returns true if the tile has a mine
+	Draws the part of the minefield the camera shows (Only the tiles which changed since the last frame get redrawn,
+	see BoardLayer)
 
-	@return mine
+	@param gfx Graphics processor
+	@param renderPool Threads redrawing the tiles in bands when every tile has to be redrawn (nullptr to draw them on
+		the calling thread)
 */
-bool Minefield::Tile::hasMine() const
+void Minefield::draw(Graphics & gfx, ThreadPool* renderPool)
 {
-	return mine;
+	if (!tileImages.isBuilt()) {
+		tileImages.build(gfx, (int)TileLook::Count, [&gfx](int look, const Vei2& position) {
+			drawTileLook(TileLook(look), position, gfx);
+		});
+	}
+
+	// The pyramid reads the changed tiles before the layer clears them
+	if (pyramid.update(field, field.getDirtyTiles(), pool)) {
+		minimapIsValid = false;
+	}
+
+	// Tiles over the background rectangle
+	const auto drawShownTile = [this](auto& target, int index, const Vei2& position) {
+		drawTile(target, index, position);
+	};
+	if (renderPool) {
+		layer.draw(gfx, camera, field.getDirtyTiles(), *renderPool, drawShownTile);
+	}
+	else {
+		layer.draw(gfx, camera, field.getDirtyTiles(), drawShownTile);
+	}
+	if (showsMinimap()) {
+		drawMinimap(gfx);
+	}
+
+	// Display
+	const RectI area = camera.getVisibleArea();
+	minesLeftDisplay.draw(gfx, area.left, area.top - DigitalDisplay::getHeight() - displayOffset);
 }
 
 /**
-	Restarts the Tile to default states
+	Draws the minimap at the bottom-right of the viewport, framed, with an outline around the part of the field the
+	camera shows
+	(The image of the minimap is only redrawn when a tile changed)
+
+	@param gfx Graphics processor
 */
-void Minefield::Tile::restart()
+void Minefield::drawMinimap(Graphics& gfx)
 {
-	if (state != State::Hidden)
-		setState(State::Hidden);
-	if (hasMine()) {
-		setMine(false);
+	const int level = getMinimapLevel();
+	const Vei2 size = pyramid.getLevelSize(level);
+	if (!minimapIsValid || minimap.getWidth() != size.x || minimap.getHeight() != size.y) {
+		minimap.resize(size.x, size.y);
+		for (int y = 0; y < size.y; ++y) {
+			for (int x = 0; x < size.x; ++x) {
+				minimap.getPixels()[size.x * y + x] = getOverviewColor(pyramid.getCell(level, x, y));
+			}
+		}
+		minimapIsValid = true;
 	}
+	const RectI area = getMinimapArea();
+	gfx.DrawRect(area.left - 1, area.top - 1, area.right + 1, area.bottom + 1, Colors::Black);	// Frame
+	gfx.DrawSurface(minimap, Vei2(area.left, area.top));
+
+	const RectI tiles = camera.getVisibleTiles();
+	const int left = area.left + (tiles.left >> level);
+	const int right = area.left + ((tiles.right - 1) >> level) + 1;
+	const int top = area.top + (tiles.top >> level);
+	const int bottom = area.top + ((tiles.bottom - 1) >> level) + 1;
+	gfx.DrawRect(left, top, right, top + 1, Colors::Blue);
+	gfx.DrawRect(left, bottom - 1, right, bottom, Colors::Blue);
+	gfx.DrawRect(left, top, left + 1, bottom, Colors::Blue);
+	gfx.DrawRect(right - 1, top, right, bottom, Colors::Blue);
 }
 
 /**
-	Constructs a minefield object
+	Returns true if the minimap is drawn (the camera does not show the whole field)
 
-	@param widthIn Width of the field (in tiles)
-	@param heightIn Height of the field (in tiles)
-	@param nMinesIn The amount of mines for the field to contain
+	@return bool
 */
-Minefield::Minefield(int widthIn, int heightIn, int nMinesIn)
-	:
-	width(widthIn),
-	height(heightIn),
-	nMines(nMinesIn),
-	minesLeftDisplay(DigitalDisplay(nMines))
-{
-	assert(nMines > 0 && nMines < width*height);
-	assert(Graphics::ScreenWidth >= Tile::size * widthIn);
-	assert(Graphics::ScreenHeight >= Tile::size * heightIn);
-	restart();
+bool Minefield::showsMinimap() const
+{
+	const RectI tiles = camera.getVisibleTiles();
+	return pyramid.isBuilt() && (tiles.left > 0 || tiles.top > 0 || tiles.right < width || tiles.bottom < height);
 }
 
 /**
-	Constructs a minefield object based on the currently selected menu choice
+	Returns the level of the pyramid the minimap shows, the most detailed one which fits in minimapSize
 
-	@param menu A menu object with chosen current difficulty
+	@return level
 */
-Minefield::Minefield(const Menu& menu)
+int Minefield::getMinimapLevel() const
 {
-	Menu::Option::Name difficulty = menu.getSelectedOption();
-
-	assert(difficulty != Menu::Option::Name::None);	//Ensure a difficulty is selected
-
-	int fieldWidth = menu.options[(int)difficulty].setsMinefieldSize.x;
-	int fieldHeight = menu.options[(int)difficulty].setsMinefieldSize.y;
-	int mineCount = menu.options[(int)difficulty].setsMines;
-	 
-	*this = Minefield(fieldWidth, fieldHeight, mineCount);
+	int level = 1;
+	while (level < pyramid.getLevelCount()
+		&& (pyramid.getLevelSize(level).x > minimapSize || pyramid.getLevelSize(level).y > minimapSize)) {
+		++level;
+	}
+	return level;
 }
 
 /**
-	Generates mines randomly accross the field after a tile was clicked
+	Returns the area of the screen the minimap is drawn in
+
+	@return area
 */
-void Minefield::generateMines(Tile& clickedTile)
+RectI Minefield::getMinimapArea() const
 {
-	assert(!minesAreGenerated);
-	std::random_device rd;
-	std::mt19937 rng(rd());
-	std::uniform_int_distribution<int> xDist(0, width - 1);
-	std::uniform_int_distribution<int> yDist(0, height - 1);
-
-	do {
-		clearMines();
-
-		for (int spawnedMines = 0; spawnedMines < nMines; ++spawnedMines) {
-			Vei2 spawnPosition;
-			// Keep generating a new spawn position while current position already has a mine
-			do {
-				spawnPosition = { xDist(rng), yDist(rng) };
-			} while (tileAt(spawnPosition).hasMine());
-
-			tileAt(spawnPosition).setMine(true);
-		}
-
-		// Once mines have been spawned, set the numbers of each tile stating how many mines are nearby
-		for (int y = 0; y < height; ++y) {
-			for (int x = 0; x < width; ++x) {
-				int n = getAdjacentMineCount(field[y*width + x]);
-				field[y*width + x].setAdjacentMineCount(n);
-			}
-		}
-
-	// Keep generating a new minefield unless clicked tile generates with 0 adjacent mines 
-	} while ((getAdjacentMineCount(clickedTile) != 0) );
-	
-	minesAreGenerated = true;
+	const Vei2 size = pyramid.getLevelSize(getMinimapLevel());
+	const RectI& viewport = camera.getViewport();
+	return RectI(viewport.right - displayOffset - size.x, viewport.right - displayOffset,
+		viewport.bottom - displayOffset - size.y, viewport.bottom - displayOffset);
 }
 
-
 /**
-	Clears the field of all mines
+	Centers the view on the part of the field under a point of the minimap
+
+	@param screenPoint
+	@return bool True if the point is on the minimap (and the view moved)
 */
-void Minefield::clearMines()
+bool Minefield::moveViewToMinimapLocation(const Vei2& screenPoint)
 {
-	for (int y = 0; y < height; ++y) {
-		for (int x = 0; x < width; ++x) {
-			if (field[y*width + x].hasMine()) {
-				field[y*width + x].setMine(false);
-			}
-		}
+	if (!showsMinimap() || !getMinimapArea().ContainsPoint(screenPoint)) {
+		return false;
 	}
+	const RectI area = getMinimapArea();
+	const int level = getMinimapLevel();
+	const Vei2 cell(screenPoint.x - area.left, screenPoint.y - area.top);
+	camera.lookAt(Vei2((cell.x << level) + (1 << level) / 2, (cell.y << level) + (1 << level) / 2));
+	return true;
 }
 
 /**
-	Draws the minefield
+	Moves the view over the minefield (it stops at the edges of a field larger than the screen)
 
-	@param gfx Graphics processor
+	@param screenDelta How far to move the view (in pixels)
 */
-void Minefield::draw(Graphics & gfx) const
+void Minefield::pan(const Vei2& screenDelta)
 {
-	// Background rectangle
-	gfx.DrawRect(rectangle, SpriteCodex::baseColor);
+	camera.pan(screenDelta);
+}
 
-	// Tiles
-	for (int y = 0; y < height; ++y) {
-		for (int x = 0; x < width; ++x) {
-			field[y*width + x].draw(gfx, isExploded);
-		}
-	}
+/**
+	Zooms in or out of the minefield, keeping the tile under input point where it is
 
-	// Display
-	minesLeftDisplay.draw(gfx, field->getPosition().x, field->getPosition().y - DigitalDisplay::getHeight() - displayOffset);
+	@param steps Zoom levels to zoom in by (negative zooms out)
+	@param screenPoint The point to zoom at (e.g. the mouse position)
+*/
+void Minefield::zoomAt(int steps, const Vei2& screenPoint)
+{
+	camera.zoomAt(steps, screenPoint);
 }
 
 /**
@@ -273,25 +382,23 @@ void Minefield::draw(Graphics & gfx) const
 */
 void Minefield::partiallyRevealTileAtLocation(const Vei2 & globalLocation)
 {
-	Tile& tile = getTileAtLocation(globalLocation);
-	if (tile.getState() == Tile::State::Hidden) {
-		tile.setState(Tile::State::PartiallyRevealed);
-		partiallyRevealedTilePtr = &tile;	// Store the last partially revealed tile address in a pointer
+	const int index = getTileIndexAtLocation(globalLocation);
+	if (field.getState(index) == State::Hidden) {
+		field.setState(index, State::PartiallyRevealed);
+		partiallyRevealedIndex = index;	// Store the index of the last partially revealed tile
 	}
 }
 
 /**
-	Converts a global location input to a tile location of the grid (e.g. tile at {324, 450} could be tile[0][3], this will return {0, 3})
+	Converts a global location input to a tile location of the grid through the camera (e.g. tile at {324, 450} could
+	be tile[0][3], this will return {0, 3}; zoomed out below a pixel per tile, the tile at the top-left of the pixel)
 
 	@return tileLocation
 */
 Vei2 Minefield::getTileLocation(const Vei2& globalLocation) const
 {
-	assert(rectangle.ContainsPoint(globalLocation));
-	Vei2 tileLocation;
-	tileLocation.x = (globalLocation.x - field[0].getPosition().x) / Tile::size;
-	tileLocation.y = (globalLocation.y - field[0].getPosition().y) / Tile::size;
-	return tileLocation;
+	assert(tileExistsAtLocation(globalLocation));
+	return camera.toTile(globalLocation);
 }
 
 /**
@@ -302,7 +409,8 @@ Vei2 Minefield::getTileLocation(const Vei2& globalLocation) const
 */
 bool Minefield::tileExistsAtLocation(const Vei2& globalLocation) const
 {
-	return rectangle.ContainsPoint(globalLocation);
+	return camera.getVisibleArea().ContainsPoint(globalLocation)
+		&& !(showsMinimap() && getMinimapArea().ContainsPoint(globalLocation));	// The minimap covers the tiles under it
 }
 
 /**
@@ -313,8 +421,29 @@ bool Minefield::tileExistsAtLocation(const Vei2& globalLocation) const
 */
 bool Minefield::tileAtLocationIsPartiallyRevealed(const Vei2 & globalLocation) const
 {
-	const Tile& tile = getTileAtLocation(globalLocation);
-	return tile.getState() == Tile::State::PartiallyRevealed;
+	return field.getState(getTileIndexAtLocation(globalLocation)) == State::PartiallyRevealed;
+}
+
+/**
+	Returns true if tile at input location is revealed and has as many flags around it as its number
+
+	@param globalLocation
+	@return bool
+*/
+bool Minefield::tileAtLocationIsSatisfied(const Vei2& globalLocation) const
+{
+	return isSatisfied(getTileIndexAtLocation(globalLocation));
+}
+
+/**
+	Returns true if chording the tile at input location would reveal the tiles around it
+
+	@param globalLocation
+	@return bool
+*/
+bool Minefield::tileAtLocationCanBeChorded(const Vei2& globalLocation) const
+{
+	return canChord(getTileIndexAtLocation(globalLocation));
 }
 
 /**
@@ -325,53 +454,42 @@ bool Minefield::tileAtLocationIsPartiallyRevealed(const Vei2 & globalLocation) c
 void Minefield::revealTileAtLocation(const Vei2 & globalLocation)
 {
 	if(!isExploded) {
-		Tile& tile = getTileAtLocation(globalLocation);
-
-		if (tile.getState() == Tile::State::Hidden || tile.getState() == Tile::State::PartiallyRevealed) {
-			if (tile.hasMine()) {
-				isExploded = true;
-			}
-
-			revealRecursively(tile);	// Recursive reveal for tiles with 0 adjacent miness
-			if (partiallyRevealedTilePtr != nullptr) {
-				partiallyRevealedTilePtr = nullptr;		// Reset pointer (No partially revealed tile exists if we are revealing)
-			}
+		const int index = getTileIndexAtLocation(globalLocation);
+		if (field.isRevealable(index)) {
+			revealTile(index);	// Reveals the whole opening for tiles with 0 adjacent mines
+			partiallyRevealedIndex = noTile;	// No partially revealed tile exists if we are revealing
 		}
 	}
 }
 
 /**
-	Reveals input tile and if it has 0 adjacent mines, also reveal all surrounding tiles recursively
+	Reveals input tile and if it has 0 adjacent mines, also reveals the whole opening around it
+
+	@param index Index of the tile to be revealed
 */
-void Minefield::revealRecursively(Tile & tileIn)
+void Minefield::revealTile(int index)
 {
 	if (getRevealedCounter() == 0) {
-		generateMines(tileIn);	// Mines are generated after first click
+		generateMines(index);	// Mines are generated after first click
 	}
-	if (tileIn.getState() == Tile::State::Hidden || tileIn.getState() == Tile::State::PartiallyRevealed) {
-		tileIn.setState(Tile::State::Revealed);
-		if (tileIn.hasMine()) {
+	if (field.isRevealable(index)) {
+		if (field.hasMine(index)) {
+			field.setState(index, State::Revealed);
 			isExploded = true;
-			return;
-		}
-		else {
-			++revealedCounter;
+			field.getDirtyTiles().markAll();	// Every mine and wrong flag gets shown
 		}
-
-		if (tileIn.getAdjacentMineCount() == 0) {
-			// If adjacent mines is 0, we need to reveal all surrounding tiles
-
-			// Reveal tiles in a 3x3 box, unless the clicked tile is in a corner / near the wall edge, 
-			// then the reveal box will be smaller, capped by the edges
-			Vei2 revealStart = getTileBox3x3Start(tileIn);
-			Vei2 revealEnd = getTileBox3x3End(tileIn);
-
-			for (int y = revealStart.y; y <= revealEnd.y; ++y) {
-				for (int x = revealStart.x; x <= revealEnd.x; ++x) {
-					Tile& adjacentTile = field[y*width + x];
-					revealRecursively(adjacentTile);
-				}
+		else if (usesOpeningIndex && openings.getOpening(index) != OpeningIndex::noOpening) {
+			const int opening = openings.getOpening(index);
+			if (openings.isIntact(opening)) {
+				revealedCounter += openings.reveal(field, opening);
 			}
+			else {
+				revealedCounter += field.floodReveal(index);
+			}
+			openings.breakOpening(opening);
+		}
+		else {
+			revealedCounter += field.floodReveal(index);
 		}
 	}
 }
@@ -379,42 +497,80 @@ void Minefield::revealRecursively(Tile & tileIn)
 /**
 	Reveals all surrounding tiles (called  on Left + Right mouse click / Spacebar press on a revealed tile)
 
-	@param tileIn tile of which the surrounding tiles should be revealed
+	@param index Index of the tile of which the surrounding tiles should be revealed
 	@return bool true if successfully revealed surrounding tiles, false otherwise (E.g. false if the user left + right clicked a number 4 tiles which only had 3 flags nearby)
 */
-bool Minefield::revealSurroundingTiles(Tile & tileIn)
+bool Minefield::revealSurroundingTiles(int index)
 {
+	// It's only okay to reveal surrounding mines if the surrounding flags match the number (kept count of by the grid)
+	if (!isSatisfied(index)) {
+		return false;
+	}
+	if (field.getHiddenNeighbourCount(index) == 0) {
+		return true;
+	}
+
 	// Reveal tiles in a 3x3 box, unless the clicked tile is in a corner / near the wall edge, 
 	// then the reveal box will be smaller, capped by the edges
-	Vei2 revealStart = getTileBox3x3Start(tileIn);
-	Vei2 revealEnd = getTileBox3x3End(tileIn);
-
-	// Count surrounding flags
-	int surroundingFlagsCount = 0;
+	const Vei2 tileLocation = { index % width, index / width };
+	Vei2 revealStart = getTileBox3x3Start(tileLocation);
+	Vei2 revealEnd = getTileBox3x3End(tileLocation);
 	for (int y = revealStart.y; y <= revealEnd.y; ++y) {
 		for (int x = revealStart.x; x <= revealEnd.x; ++x) {
-			const Tile& adjacentTile = field[y*width + x];
-			if (adjacentTile.getState() == Tile::State::Flagged) {
-				++surroundingFlagsCount;
+			if(field.getState(y*width + x) == State::Hidden) {
+				revealTile(y*width + x);
 			}
 		}
 	}
+	return true;
+}
 
-	// It's okay to reveal surrounding mines
-	if (surroundingFlagsCount == tileIn.getAdjacentMineCount()) {
-		for (int y = revealStart.y; y <= revealEnd.y; ++y) {
-			for (int x = revealStart.x; x <= revealEnd.x; ++x) {
-				Tile& adjacentTile = field[y*width + x];
-				if(adjacentTile.getState() == Tile::State::Hidden) {
-					revealRecursively(adjacentTile);
-				}
+/**
+	Returns true if the tile at input index is revealed and has as many flags around it as its number
+
+	@param index
+	@return bool
+*/
+bool Minefield::isSatisfied(int index) const
+{
+	return field.getState(index) == State::Revealed && !field.hasMine(index)
+		&& field.getFlaggedNeighbourCount(index) == field.getAdjacentMineCount(index);
+}
+
+/**
+	Returns true if chording the tile at input index would reveal something (it is satisfied and has hidden tiles around it)
+
+	@param index
+	@return bool
+*/
+bool Minefield::canChord(int index) const
+{
+	return isSatisfied(index) && field.getHiddenNeighbourCount(index) > 0;
+}
+
+/**
+	Chords every tile which can be chorded, over and over until no tile can (Used by solvers and bots)
+	Stops early if a wrongly placed flag makes a chord reveal a mine
+
+	@return revealed The amount of tiles which got revealed
+*/
+int Minefield::chordAll()
+{
+	const int revealedBefore = revealedCounter;
+	const int tileCount = field.getTileCount();
+	bool chorded = true;
+	while (chorded && !isExploded) {
+		// A chord only reveals tiles, so only the tiles it reveals can become chordable: a pass over the field
+		// picks up the ones further down right away, the others get their turn in the next pass
+		chorded = false;
+		for (int i = 0; i < tileCount && !isExploded; ++i) {
+			if (canChord(i)) {
+				revealSurroundingTiles(i);
+				chorded = true;
 			}
 		}
-		return true;
-	}
-	else {
-		return false;
 	}
+	return revealedCounter - revealedBefore;
 }
 
 /**
@@ -424,11 +580,12 @@ bool Minefield::revealSurroundingTiles(Tile & tileIn)
 */
 void Minefield::revealSurroundingTilesOrFlagTileAtLocation(const Vei2 & globalLocation)
 {
-	Tile& tileIn = getTileAtLocation(globalLocation);
-	if (tileIn.getState() == Tile::State::Revealed) {
-		revealSurroundingTiles(tileIn);
+	const int index = getTileIndexAtLocation(globalLocation);
+	const State state = field.getState(index);
+	if (state == State::Revealed) {
+		revealSurroundingTiles(index);
 	}
-	else if (tileIn.getState() == Tile::State::Hidden || tileIn.getState() == Tile::State::Flagged) {
+	else if (state == State::Hidden || state == State::Flagged) {
 		toggleTileFlagAtLocation(globalLocation);		
 	}
 }
@@ -440,61 +597,41 @@ void Minefield::revealSurroundingTilesOrFlagTileAtLocation(const Vei2 & globalLo
 */
 void Minefield::toggleTileFlagAtLocation(const Vei2 & globalLocation)
 {
-	Tile& tile = getTileAtLocation(globalLocation);
-		if (tile.getState() == Tile::State::Hidden) {
-			tile.setState(Tile::State::Flagged);
+	const int index = getTileIndexAtLocation(globalLocation);
+		if (field.getState(index) == State::Hidden) {
+			field.setState(index, State::Flagged);
 			++flaggedCount;
+			if (usesOpeningIndex && minesAreGenerated) {
+				openings.setTileFlagged(index, true);
+			}
 		}
-		else if (tile.getState() == Tile::State::Flagged) {
-			tile.setState(Tile::State::Hidden);
+		else if (field.getState(index) == State::Flagged) {
+			field.setState(index, State::Hidden);
 			--flaggedCount;
+			if (usesOpeningIndex && minesAreGenerated) {
+				openings.setTileFlagged(index, false);
+			}
 		}
 	updateDisplay();	// Display shows amount of un-flagged mines left, therefore update every time you change flag count
 }
 
 /**
-	Returns a constant reference to a tile at input tile location
-
-	@param tileLocation
-	@return tile
-*/
-const Minefield::Tile & Minefield::tileAt(const Vei2 & tileLocation) const
-{
-	return field[tileLocation.y * width + tileLocation.x];
-}
-/**
-	Returns a non-constant reference to a tile at input tile location
-
-	@param tileLocation
-	@return tile
-*/
-Minefield::Tile & Minefield::tileAt(const Vei2 & tileLocation)
-{
-	return field[tileLocation.y * width + tileLocation.x];
-}
-
-/**
-	Hides the tile that was partially revealed and reset the pointer to the partially revealed tile to nullptr
+	Hides the tile that was partially revealed and reset the index of the partially revealed tile
 */
 void Minefield::hidePartiallyRevealedTile()
 {
-	if (partiallyRevealedTilePtr != nullptr) {
-		partiallyRevealedTilePtr->setState(Tile::State::Hidden);
-		partiallyRevealedTilePtr = nullptr;
+	if (partiallyRevealedIndex != noTile) {
+		field.setState(partiallyRevealedIndex, State::Hidden);
+		partiallyRevealedIndex = noTile;
 	}
 }
 
+/**
+	Flags all the remaining hidden mines (called once the game is won)
+*/
 void Minefield::flagRemainingTiles()
 {
-	for (int y = 0; y < height; ++y) {
-		for (int x = 0; x < width; ++x) {
-			Tile& tile = field[y*width + x];
-			if (tile.hasMine() && tile.getState() == Tile::State::Hidden) {
-				tile.setState(Tile::State::Flagged);
-				++flaggedCount;
-			}
-		}
-	}
+	flaggedCount += field.flagHiddenMines();
 	updateDisplay();
 }
 
@@ -521,128 +658,179 @@ int Minefield::getRevealedCounter() const
 }
 
 /**
-	Returns the width of the minefield (in pixels)
+	Copies what the player sees of the field (partially revealed tiles count as hidden)
+
+	@param board
+*/
+void Minefield::readVisibleBoard(VisibleBoard& board) const
+{
+	board.read(field, nMines);
+}
+
+/**
+	Returns the width of the minefield on the screen (in pixels, the width of the viewport if the field is larger)
 
-	@return width width in tiles * tile size
+	@return width
 */
 int Minefield::getWidth() const
 {
-	return width * Tile::size;
+	const RectI area = camera.getVisibleArea();
+	return area.right - area.left;
 }
 
 /**
-	Returns the height of the minefield (in pixels)
+	Returns the height of the minefield on the screen (in pixels, the height of the viewport if the field is larger)
 
-	@return height height in tiles * tile size
+	@return height
 */
 int Minefield::getHeight() const
 {
-	return height * Tile::size;
+	const RectI area = camera.getVisibleArea();
+	return area.bottom - area.top;
 }
 
 /**
-	Restarts the minefield back to its default values
+	Sets the seed from which the mines are generated (Only has an effect before the first tile gets revealed)
+
+	@param seedIn
 */
-void Minefield::restart()
+void Minefield::setSeed(std::uint64_t seedIn)
 {
-	minesAreGenerated = false;
+	assert(!minesAreGenerated);
+	seed = seedIn;
+}
 
-	if (field!=nullptr) {
-		delete[] field;
-		field = nullptr;
-	}
-	field = new Tile[width*height];
+/**
+	Sets whether the openings get revealed from an index built together with the mines (the index costs about
+	4 bytes per tile, but makes revealing an opening a single pass over its tiles instead of a flood fill)
+	Only has an effect before the first tile gets revealed
 
-	isExploded = false;
+	@param usesOpeningIndexIn
+*/
+void Minefield::setUsesOpeningIndex(bool usesOpeningIndexIn)
+{
+	assert(!minesAreGenerated);
+	usesOpeningIndex = usesOpeningIndexIn;
+}
 
-	Vei2 centerTopLeft = { (Graphics::ScreenWidth - width * Tile::size) / 2, (Graphics::ScreenHeight - height * Tile::size) / 2 };
+/**
+	Sets the generator placing the mines after the first click, so the field can be solved without guessing
+	(Only meant for fields small enough to be played through a few times while the mines are generated)
 
-	for (int y = 0; y < height; ++y) {
-		for (int x = 0; x < width; ++x) {
-			field[y*width + x].restart();
-			field[y*width + x].setPosition(Vei2(x*Tile::size + centerTopLeft.x, y*Tile::size + centerTopLeft.y));
-		}
-	}
+	@param noGuessGeneratorIn nullptr to place random mines
+*/
+void Minefield::setNoGuessGenerator(NoGuessGenerator* noGuessGeneratorIn)
+{
+	assert(!minesAreGenerated);
+	noGuessGenerator = noGuessGeneratorIn;
+}
 
-	rectangle = RectI(field[0].getPosition(), width*Tile::size, height*Tile::size);
-	revealedCounter = 0;
+/**
+	Returns the index of the openings of the field (sizes and count of the openings)
+
+	@return openingIndex (nullptr if the field does not use one or the mines are not generated yet)
+*/
+const OpeningIndex* Minefield::getOpeningIndex() const
+{
+	return usesOpeningIndex && minesAreGenerated ? &openings : nullptr;
 }
 
 /**
-	Returns a non-const reference to the tile at input location
-	
-	@param globalLocation
-	@return tile
+	Returns the seed from which the mines are generated
+
+	@return seed
 */
-Minefield::Tile& Minefield::getTileAtLocation(const Vei2 & globalLocation)
+std::uint64_t Minefield::getSeed() const
 {
-	assert(rectangle.ContainsPoint(globalLocation));
-	Vei2 tileLocation = getTileLocation(globalLocation);
-	return tileAt(tileLocation);
+	return seed;
 }
 
 /**
-	Returns a const reference to the tile at input location
-	
-	@param globalLocation
-	@return tile
+	Returns the image of the tiles kept between frames (to see how much the last frame redrew)
+
+	@return layer
 */
-const Minefield::Tile & Minefield::getTileAtLocation(const Vei2 & globalLocation) const
+const BoardLayer& Minefield::getBoardLayer() const
 {
-	assert(rectangle.ContainsPoint(globalLocation));
-	Vei2 tileLocation = getTileLocation(globalLocation);
-	return tileAt(tileLocation);
+	return layer;
 }
 
 /**
-	Returns the amount of mines adjacent to the input tile
+	Returns the camera showing the minefield
 
-	@param tile
-	@return adjacentMines
+	@return camera
 */
-int Minefield::getAdjacentMineCount(const Tile& tileIn) const
+const Camera& Minefield::getCamera() const
 {
-	Vei2 checkStart = getTileBox3x3Start(tileIn);
-	Vei2 checkEnd = getTileBox3x3End(tileIn);
+	return camera;
+}
 
-	Vei2 tileLocal = getTileLocation(tileIn.getPosition());
+/**
+	Returns the summary of the tiles the overview and the minimap are drawn from
 
-	int mineCounter = 0;
-	for (int y = checkStart.y; y <= checkEnd.y; ++y) {
-		for (int x = checkStart.x; x <= checkEnd.x; ++x) {
-			if (field[y*width + x].hasMine()) {
-				++mineCounter;
-			}
-		}
-	}
+	@return pyramid
+*/
+const TilePyramid& Minefield::getPyramid() const
+{
+	return pyramid;
+}
 
-	return mineCounter;
+/**
+	Restarts the minefield back to its default values (Reuses the memory of the tiles, so it never allocates)
+*/
+void Minefield::restart()
+{
+	minesAreGenerated = false;
+	field.setTracksNeighbours(true);	// Keeps chording constant time
+	field.setTracksChanges(true);	// Lets draw() redraw only the changed tiles
+	field.resize(width, height);
+	openings.clear();
+
+	isExploded = false;
+	partiallyRevealedIndex = noTile;
+
+	// The field is centered on the screen, leaving room for the displays above and below it if it does not fit
+	const int displayBand = DigitalDisplay::getHeight() + 2 * displayOffset;
+	camera = Camera(RectI(0, Graphics::ScreenWidth, displayBand, Graphics::ScreenHeight - displayBand), Vei2(width, height));
+	revealedCounter = 0;
+	flaggedCount = 0;
+	updateDisplay();
+}
+
+/**
+	Returns the index of the tile at input location
+	
+	@param globalLocation
+	@return index
+*/
+int Minefield::getTileIndexAtLocation(const Vei2 & globalLocation) const
+{
+	Vei2 tileLocation = getTileLocation(globalLocation);
+	return field.indexOf(tileLocation.x, tileLocation.y);
 }
 
 /**
 	Returns the starting position (top-left point) of (usually) a 3x3 box (This box may be 2x3, 3x2, or 2x2 if clipped near a wall),
 	which is surrounding the input tile
 
-	@param tile tile which should be in the center of the 3x3 box
+	@param tileLocation location of the tile which should be in the center of the 3x3 box
 	@return tileLocalPosition The position of the starting tile of the clipping box
 */
-Vei2 Minefield::getTileBox3x3Start(const Tile & tileIn) const
+Vei2 Minefield::getTileBox3x3Start(const Vei2 & tileLocation) const
 {
-	Vei2 tileLocalPosition = getTileLocation(tileIn.getPosition());
-	return { std::max(0, tileLocalPosition.x - 1), std::max(0, tileLocalPosition.y - 1) };
+	return { std::max(0, tileLocation.x - 1), std::max(0, tileLocation.y - 1) };
 }
 
 /**
 	Returns the ending position (top-left point) of (usually) a 3x3 box (This box may be 2x3, 3x2, or 2x2 if clipped near a wall),
 	which is surrounding the input tile
 
-	@param tile tile which should be in the center of the 3x3 box
+	@param tileLocation location of the tile which should be in the center of the 3x3 box
 	@return tileLocalPosition The position of the ending tile of the clipping box
 */
-Vei2 Minefield::getTileBox3x3End(const Tile & tileIn) const
+Vei2 Minefield::getTileBox3x3End(const Vei2 & tileLocation) const
 {
-	Vei2 tileLocalPosition = getTileLocation(tileIn.getPosition());
-	return { std::min(tileLocalPosition.x + 1, width - 1), std::min(tileLocalPosition.y + 1, height - 1) };
+	return { std::min(tileLocation.x + 1, width - 1), std::min(tileLocation.y + 1, height - 1) };
 }
 
 /**
@@ -650,5 +838,5 @@ Vei2 Minefield::getTileBox3x3End(const Tile & tileIn) const
 */
 void Minefield::updateDisplay()
 {
-	minesLeftDisplay = DigitalDisplay(nMines - flaggedCount);
+	minesLeftDisplay.setValue(nMines - flaggedCount);
 }
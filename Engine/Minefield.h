@@ -12,48 +12,27 @@
 #include "Menu.h"
 #include "DigitalDisplay.h"
 #include "SpriteCodex.h"
+#include "TileGrid.h"
+#include "ThreadPool.h"
+#include "OpeningIndex.h"
+#include "BoardLayer.h"
+#include "Camera.h"
+#include "TileImages.h"
+#include "TilePyramid.h"
+#include "Surface.h"
+#include "VisibleBoard.h"
+#include "NoGuessGenerator.h"
+#include <cstdint>
 
 class Minefield {
-private:
-	/**
-		Manages each Tile of the minefield
-	*/
-	class Tile {
-	public:
-		enum class State {
-			Hidden,
-			PartiallyRevealed,
-			Revealed,
-			Flagged,
-		};
-
-		Tile() = default;
-		void draw(Graphics& gfx, bool isExploded) const;
-		
-		void setPosition(Vei2 posIn);
-		void setAdjacentMineCount(int countIn);
-		void setMine(bool set);
-		void setState(State stateIn);
-		void restart();
-
-		State getState() const;
-		bool hasMine() const;
-		int getAdjacentMineCount() const;
-		Vei2 getPosition() const;
-
-		static constexpr int size = SpriteCodex::tileSize;
-
-	private:
-		Vei2 position;
-		int adjacentMineCount;
-		State state = State::Hidden;
-		bool mine = false;
-	};
-
 public:
 	Minefield() = default;
-	Minefield(int widthIn, int heightIn, int nMinesIn);
-	Minefield(const Menu& menu);
+	Minefield(int widthIn, int heightIn, int nMinesIn, std::uint64_t seedIn, ThreadPool* poolIn = nullptr);
+	Minefield(const Menu& menu, std::uint64_t seedIn, ThreadPool* poolIn = nullptr);
+	Minefield(const Minefield&) = delete;
+	Minefield& operator=(const Minefield&) = delete;
+	Minefield(Minefield&&) = default;
+	Minefield& operator=(Minefield&&) = default;
 
 	void partiallyRevealTileAtLocation(const Vei2& globalLocation);
 	void revealTileAtLocation(const Vei2& globalLocation);
@@ -61,47 +40,101 @@ public:
 	void toggleTileFlagAtLocation(const Vei2& globalLocation);
 	void hidePartiallyRevealedTile();
 	void flagRemainingTiles();
+	int chordAll();
 	void restart();
-
-	void draw(Graphics& gfx) const;
+	void reset(int widthIn, int heightIn, int nMinesIn, std::uint64_t seedIn, ThreadPool* poolIn = nullptr);
+	void reset(const Menu& menu, std::uint64_t seedIn, ThreadPool* poolIn = nullptr);
+	void setSeed(std::uint64_t seedIn);
+	void setUsesOpeningIndex(bool usesOpeningIndexIn);
+	void setNoGuessGenerator(NoGuessGenerator* noGuessGeneratorIn);
+	void pan(const Vei2& screenDelta);
+	void zoomAt(int steps, const Vei2& screenPoint);
+	bool moveViewToMinimapLocation(const Vei2& screenPoint);
+
+	void draw(Graphics& gfx, ThreadPool* renderPool = nullptr);
 	bool revealedAll() const;
 	bool tileExistsAtLocation(const Vei2& globalLocation) const;
 	bool tileAtLocationIsPartiallyRevealed(const Vei2& globalLocation) const;
+	bool tileAtLocationIsSatisfied(const Vei2& globalLocation) const;
+	bool tileAtLocationCanBeChorded(const Vei2& globalLocation) const;
 	int getRevealedCounter() const;
+	void readVisibleBoard(VisibleBoard& board) const;
 	int getWidth() const;
 	int getHeight() const;
+	std::uint64_t getSeed() const;
+	const OpeningIndex* getOpeningIndex() const;
+	const BoardLayer& getBoardLayer() const;
+	const Camera& getCamera() const;
+	const TilePyramid& getPyramid() const;
 
 	bool isExploded = false;
 	static constexpr int displayOffset = 5;
+	static constexpr int tileSize = SpriteCodex::tileSize;
+	static constexpr int minimapSize = 128;	// Largest side of the minimap (in pixels)
 
 private:
 	bool minesAreGenerated = false;
 
 private:
-	Vei2 getTileLocation(const Vei2& globalLocation) const;
-	Tile& getTileAtLocation(const Vei2& globalPosition);
-	const Tile& getTileAtLocation(const Vei2& globalPosition) const;
+	using State = TileGrid::State;
+	static constexpr int noTile = -1;
 
-	int getAdjacentMineCount(const Tile& tileIn) const;
-	Vei2 getTileBox3x3Start(const Tile& tileIn) const;
-	Vei2 getTileBox3x3End(const Tile& tileIn) const;
-	void updateDisplay();
-	void generateMines(Tile& clickedTile);
-	void clearMines();
-	void revealRecursively(Tile& tileIn);
-	bool revealSurroundingTiles(Tile& tileIn);
-	const Tile& tileAt(const Vei2& tileLocation) const;
-	Tile& tileAt(const Vei2& tileLocation);
+	/**
+		Every way a tile can look (a tile is drawn from the image of its look, see TileImages)
+	*/
+	enum class TileLook {
+		Button,
+		ButtonOverMine,
+		PartiallyRevealed,
+		Number0, Number1, Number2, Number3, Number4, Number5, Number6, Number7, Number8,
+		MineRed,
+		Flag,
+		WrongFlag,
+		Count
+	};
 
-	Tile* field = nullptr;
-	Tile* partiallyRevealedTilePtr = nullptr; // Keeps track of the tile that is partially revealed
-	int width;
-	int height;
-	int nMines;
+private:
+	static const Menu::Option& getSelectedOption(const Menu& menu);
+	Vei2 getTileLocation(const Vei2& globalLocation) const;
+	int getTileIndexAtLocation(const Vei2& globalLocation) const;
+	template<typename Target>
+	void drawTile(Target& target, int index, const Vei2& position) const;
+	TileLook getTileLook(int index) const;
+	static void drawTileLook(TileLook look, const Vei2& position, Graphics& gfx);
+	Color getOverviewColor(const TilePyramid::Cell& cell) const;
+	void drawMinimap(Graphics& gfx);
+	bool showsMinimap() const;
+	int getMinimapLevel() const;
+	RectI getMinimapArea() const;
+
+	Vei2 getTileBox3x3Start(const Vei2& tileLocation) const;
+	Vei2 getTileBox3x3End(const Vei2& tileLocation) const;
+	void updateDisplay();
+	void generateMines(int clickedIndex);
+	void revealTile(int index);
+	bool revealSurroundingTiles(int index);
+	bool isSatisfied(int index) const;
+	bool canChord(int index) const;
+
+	TileGrid field;
+	int partiallyRevealedIndex = noTile; // Keeps track of the tile that is partially revealed
+	int width = 0;
+	int height = 0;
+	int nMines = 0;
 	int revealedCounter = 0;
 	int flaggedCount = 0;
-	RectI rectangle; // Rectangle representing the minefield (location, dimensions)
+	std::uint64_t seed = 0; // The mines only depend on the seed and the first clicked tile
+	ThreadPool* pool = nullptr; // Threads used to generate the mines (nullptr to generate them on the calling thread)
+	bool usesOpeningIndex = false; // Openings are revealed from an index built with the mines instead of a flood fill
+	OpeningIndex openings;
+	NoGuessGenerator* noGuessGenerator = nullptr; // Places the mines so the field can be solved without guessing (nullptr for random mines)
+	Camera camera; // Part of the field shown on the screen and its zoom, every tile position is computed from its index
 	DigitalDisplay minesLeftDisplay;
+	BoardLayer layer;	// Image of the tiles kept between frames
+	TileImages tileImages;	// Every look of a tile at every zoom (drawn with the first frame)
+	TilePyramid pyramid;	// Summary of the tiles, drawn instead of them when a pixel covers several and on the minimap
+	Surface minimap;	// Image of the level of the pyramid which fits in minimapSize
+	bool minimapIsValid = false;	// The minimap shows the pyramid as it is
 
 
 };
\ No newline at end of file
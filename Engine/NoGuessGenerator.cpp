@@ -0,0 +1,320 @@
+#include "NoGuessGenerator.h"
+#include "CounterRng.h"
+#include <algorithm>
+#include <functional>
+#include <assert.h>
+
+/**
+	Constructs a generator
+
+	@param poolIn Threads running the candidates side by side (nullptr to run them one at a time)
+*/
+NoGuessGenerator::NoGuessGenerator(ThreadPool* poolIn)
+	:
+	pool(poolIn),
+	firstCleared(noCandidate)
+{
+}
+
+/**
+	Generates the mines of a field, see hasMine()
+
+	@param widthIn
+	@param heightIn
+	@param nMinesIn
+	@param clickedIndexIn Index of the tile which was clicked first (it and its surrounding tiles are kept free of mines)
+	@param seedIn Seed of the candidates (the first candidate gets the same mines as TileGrid::placeMines() with it)
+	@return isNoGuess False if no candidate got cleared (within the 3BV band), the mines are then the ones
+		TileGrid::placeMines() places
+*/
+bool NoGuessGenerator::generate(int widthIn, int heightIn, int nMinesIn, int clickedIndexIn, std::uint64_t seedIn)
+{
+	assert(nMinesIn > 0 && nMinesIn < widthIn * heightIn);
+	assert(clickedIndexIn >= 0 && clickedIndexIn < widthIn * heightIn);
+	width = widthIn;
+	height = heightIn;
+	nMines = nMinesIn;
+	clickedIndex = clickedIndexIn;
+	seed = seedIn;
+
+	const int nSlots = pool != nullptr ? pool->getThreadCount() : 1;
+	if ((int)candidates.size() < nSlots) {
+		candidates.resize(nSlots);
+	}
+	firstCleared = noCandidate;
+	nCandidates = 0;
+	const int candidateLimit = hasBand() ? int(maxBandCandidates) : int(maxCandidates);
+	while (firstCleared == noCandidate && nCandidates < candidateLimit) {
+		const int firstNumber = nCandidates;
+		const auto runSlot = [this, firstNumber](int slot) {
+			runCandidate(candidates[slot], firstNumber + slot);
+		};
+		if (nSlots > 1) {
+			pool->parallelFor(nSlots, std::cref(runSlot));	// Wrapped in a reference, so the std::function never allocates
+		}
+		else {
+			runSlot(0);
+		}
+		nCandidates += nSlots;
+	}
+
+	if (firstCleared == noCandidate) {
+		keptSlot = 0;
+		candidates[0].grid.resize(width, height);
+		candidates[0].grid.placeMines(nMines, clickedIndex, seed);
+		candidates[0].nRepairs = 0;
+		return false;
+	}
+	keptSlot = firstCleared % nSlots;
+	return true;
+}
+
+/**
+	Keeps the fields to a band of 3BV (Only the candidates within it can be kept, so a narrow band or one far from the
+	usual 3BV of the size takes more candidates, and may not be met at all)
+
+	@param minBbbvIn
+	@param maxBbbvIn
+*/
+void NoGuessGenerator::setBbbvBand(int minBbbvIn, int maxBbbvIn)
+{
+	assert(minBbbvIn <= maxBbbvIn);
+	minBbbv = minBbbvIn;
+	maxBbbv = maxBbbvIn;
+}
+
+/**
+	Places the mines of a candidate, then plays it and repairs it until it gets cleared, gets dropped or a candidate
+	with a lower number got cleared
+
+	@param candidate
+	@param number
+*/
+void NoGuessGenerator::runCandidate(Candidate& candidate, int number)
+{
+	TileGrid& grid = candidate.grid;
+	grid.resize(width, height);
+	grid.placeMines(nMines, clickedIndex, getCandidateSeed(number));
+	grid.countAdjacentMines();
+	candidate.nRepairs = 0;
+	if (!isInBand(candidate)) {
+		return;
+	}
+	const std::uint64_t repairSeed = CounterRng::mix(getCandidateSeed(number));
+	while (!play(candidate, number)) {
+		if (candidate.nRepairs == maxRepairs || firstCleared < number || !repair(candidate, repairSeed)) {
+			return;
+		}
+		++candidate.nRepairs;
+	}
+	if (candidate.nRepairs > 0 && !isInBand(candidate)) {
+		return;
+	}
+
+	int cleared = firstCleared;
+	while (number < cleared && !firstCleared.compare_exchange_weak(cleared, number)) {
+	}
+}
+
+/**
+	Plays a candidate from the first click with the logic solver alone
+
+	@param candidate
+	@param number Number of the candidate (it stops early once a candidate with a lower number got cleared)
+	@return isCleared False if the solver got stuck, a pass neither flagging nor revealing a tile (the tiles are left
+		as it left them), or the candidate stopped
+*/
+bool NoGuessGenerator::play(Candidate& candidate, int number) const
+{
+	TileGrid& grid = candidate.grid;
+	grid.hideAll();
+	int revealed = grid.floodReveal(clickedIndex);
+	const int nonMineTiles = width * height - nMines;
+	while (revealed < nonMineTiles) {
+		if (firstCleared.load(std::memory_order_relaxed) < number) {
+			return false;
+		}
+		candidate.board.read(grid, nMines);
+		candidate.solver.solve(candidate.board, true);	// The flags were all placed by the solver
+		bool isStuck = true;	// Only once a pass neither flags nor reveals anything (new flags can unlock deductions)
+		for (int index : candidate.solver.getMineTiles()) {
+			if (grid.getState(index) != TileGrid::State::Flagged) {
+				grid.setState(index, TileGrid::State::Flagged);
+				isStuck = false;
+			}
+		}
+		for (int index : candidate.solver.getSafeTiles()) {
+			if (grid.isRevealable(index)) {
+				revealed += grid.floodReveal(index);
+				isStuck = false;
+			}
+		}
+		if (isStuck) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+	Moves a mine where a candidate got stuck: a random undecided tile next to the revealed numbers gives its mine to a
+	random empty tile away from them, or takes the mine of one of them if it has none (the mine count never changes)
+
+	@param candidate Stuck, as play() left it
+	@param repairSeed Seed of the random choices of the candidate
+	@return isRepaired False if there was nothing to move (the candidate is then dropped)
+*/
+bool NoGuessGenerator::repair(Candidate& candidate, std::uint64_t repairSeed) const
+{
+	const TileGrid& grid = candidate.grid;
+	candidate.stuckTiles.clear();
+	candidate.otherMines.clear();
+	candidate.otherSafeTiles.clear();
+	for (int index = 0; index < width * height; ++index) {
+		if (grid.getState(index) != TileGrid::State::Hidden) {
+			continue;
+		}
+		if (isNextToRevealed(grid, index)) {
+			candidate.stuckTiles.push_back(index);
+		}
+		else {
+			(grid.hasMine(index) ? candidate.otherMines : candidate.otherSafeTiles).push_back(index);
+		}
+	}
+	if (candidate.stuckTiles.empty()) {
+		return false;
+	}
+
+	const std::uint64_t draw = 2 * std::uint64_t(candidate.nRepairs);
+	const int stuck = candidate.stuckTiles[CounterRng::getBelow(repairSeed, draw,
+		std::uint32_t(candidate.stuckTiles.size()))];
+	std::vector<int>& others = grid.hasMine(stuck) ? candidate.otherSafeTiles : candidate.otherMines;
+	if (others.empty()) {
+		return false;
+	}
+	const int other = others[CounterRng::getBelow(repairSeed, draw + 1, std::uint32_t(others.size()))];
+	if (grid.hasMine(stuck)) {
+		moveMine(candidate.grid, stuck, other);
+	}
+	else {
+		moveMine(candidate.grid, other, stuck);
+	}
+	return true;
+}
+
+/**
+	Returns true if the 3BV of a candidate is within the band
+
+	@param candidate
+	@return bool
+*/
+bool NoGuessGenerator::isInBand(Candidate& candidate) const
+{
+	if (!hasBand()) {
+		return true;
+	}
+	const int bbbv = candidate.metrics.compute(candidate.grid).bbbv;
+	return bbbv >= minBbbv && bbbv <= maxBbbv;
+}
+
+/**
+	Returns true if the fields are kept to a band of 3BV narrower than every field
+
+	@return bool
+*/
+bool NoGuessGenerator::hasBand() const
+{
+	return minBbbv > 0 || maxBbbv < std::numeric_limits<int>::max();
+}
+
+/**
+	Moves a mine to an empty tile, updating the adjacent mine counts around both
+
+	@param grid
+	@param from Tile with a mine
+	@param to Tile without a mine
+*/
+void NoGuessGenerator::moveMine(TileGrid& grid, int from, int to) const
+{
+	assert(grid.hasMine(from) && !grid.hasMine(to));
+	auto addToNeighbours = [this, &grid](int index, int delta) {
+		const int x = index % width;
+		const int y = index / width;
+		for (int ny = std::max(0, y - 1); ny <= std::min(height - 1, y + 1); ++ny) {
+			for (int nx = std::max(0, x - 1); nx <= std::min(width - 1, x + 1); ++nx) {
+				const int neighbour = ny * width + nx;
+				if (neighbour != index) {
+					grid.setAdjacentMineCount(neighbour, grid.getAdjacentMineCount(neighbour) + delta);
+				}
+			}
+		}
+	};
+	grid.setMine(from, false);
+	addToNeighbours(from, -1);
+	grid.setMine(to, true);
+	addToNeighbours(to, 1);
+}
+
+/**
+	Returns true if a tile touches a revealed tile
+
+	@param grid
+	@param index
+	@return bool
+*/
+bool NoGuessGenerator::isNextToRevealed(const TileGrid& grid, int index) const
+{
+	const int x = index % width;
+	const int y = index / width;
+	for (int ny = std::max(0, y - 1); ny <= std::min(height - 1, y + 1); ++ny) {
+		for (int nx = std::max(0, x - 1); nx <= std::min(width - 1, x + 1); ++nx) {
+			if (grid.getState(ny * width + nx) == TileGrid::State::Revealed) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+	Returns the seed a candidate places its mines from
+
+	@param number
+	@return seed The seed of the field for the first candidate
+*/
+std::uint64_t NoGuessGenerator::getCandidateSeed(int number) const
+{
+	return number == 0 ? seed : CounterRng::get(seed, std::uint64_t(number));
+}
+
+/**
+	Returns true if the last generated field has a mine on a tile
+
+	@param index
+	@return bool
+*/
+bool NoGuessGenerator::hasMine(int index) const
+{
+	assert(index >= 0 && index < width * height);
+	return candidates[keptSlot].grid.hasMine(index);
+}
+
+/**
+	Returns how many candidates the last generate() started (the candidates of a round all start together)
+
+	@return candidateCount
+*/
+int NoGuessGenerator::getCandidateCount() const
+{
+	return nCandidates;
+}
+
+/**
+	Returns how many times the last generated field was repaired
+
+	@return repairCount
+*/
+int NoGuessGenerator::getRepairCount() const
+{
+	return candidates[keptSlot].nRepairs;
+}
@@ -0,0 +1,84 @@
+/**
+	Generates mines so that a field can be solved from the first click by logic alone, without ever guessing
+
+	A candidate is a field of mines placed like TileGrid::placeMines() does, played by LogicSolver from the first
+	click: every tile it proves safe is revealed and every tile it proves to be a mine is flagged, until the field is
+	cleared or the solver is stuck. A stuck field is repaired where it got stuck instead of being thrown away: one of
+	the undecided tiles next to the revealed numbers trades its mine (or its lack of one) with a tile away from them,
+	then the field is played again from the first click. Candidates run side by side on the pool, each from its own
+	seed, and the one with the lowest number which gets cleared is kept, so the mines only depend on the seed and the
+	first click, never on the threads. The candidates numbered after a cleared one stop early.
+	A band of 3BV can be asked for as well (see BoardMetrics): candidates outside of it are dropped before they are
+	played, and once they are cleared, since the repairs move mines. More candidates are tried then, see
+	maxBandCandidates.
+*/
+
+#pragma once
+#include "TileGrid.h"
+#include "VisibleBoard.h"
+#include "LogicSolver.h"
+#include "ThreadPool.h"
+#include "BoardMetrics.h"
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+class NoGuessGenerator {
+public:
+	NoGuessGenerator(ThreadPool* poolIn = nullptr);
+	NoGuessGenerator(const NoGuessGenerator&) = delete;
+	NoGuessGenerator& operator=(const NoGuessGenerator&) = delete;
+
+	bool generate(int widthIn, int heightIn, int nMinesIn, int clickedIndexIn, std::uint64_t seedIn);
+	void setBbbvBand(int minBbbvIn, int maxBbbvIn);
+
+	bool hasMine(int index) const;
+	int getCandidateCount() const;
+	int getRepairCount() const;
+
+	static constexpr int maxCandidates = 64;	// Candidates tried before giving up on a field without guesses
+	static constexpr int maxBandCandidates = 1024;	// The same with a band of 3BV (most candidates are dropped unplayed)
+	static constexpr int maxRepairs = 24;	// Repairs of a candidate before it is dropped
+
+private:
+	/**
+		Field being tried, with what playing it needs
+	*/
+	struct Candidate {
+		TileGrid grid;
+		VisibleBoard board;
+		LogicSolver solver;
+		std::vector<int> stuckTiles;	// Undecided hidden tiles next to a revealed number (used by repair())
+		std::vector<int> otherMines;	// Hidden tiles away from the revealed numbers, with and without a mine
+		std::vector<int> otherSafeTiles;
+		BoardMetrics metrics;	// Checks the 3BV band
+		int nRepairs = 0;
+	};
+
+	static constexpr int noCandidate = 1 << 30;
+
+private:
+	void runCandidate(Candidate& candidate, int number);
+	bool play(Candidate& candidate, int number) const;
+	bool repair(Candidate& candidate, std::uint64_t repairSeed) const;
+	bool isInBand(Candidate& candidate) const;
+	bool hasBand() const;
+	void moveMine(TileGrid& grid, int from, int to) const;
+	bool isNextToRevealed(const TileGrid& grid, int index) const;
+	std::uint64_t getCandidateSeed(int number) const;
+
+private:
+	ThreadPool* pool = nullptr;	// Threads running the candidates side by side (nullptr to run them one at a time)
+	int width = 0;
+	int height = 0;
+	int nMines = 0;
+	int clickedIndex = 0;
+	std::uint64_t seed = 0;
+	int minBbbv = 0;	// Band of 3BV of the fields (every field by default)
+	int maxBbbv = std::numeric_limits<int>::max();
+	std::vector<Candidate> candidates;	// One per thread (never shrinks, so the memory is kept between fields)
+	std::atomic<int> firstCleared;	// Lowest number of a candidate which got cleared (noCandidate until one is)
+	int nCandidates = 0;	// Candidates started by the last generate()
+	int keptSlot = 0;	// Candidate holding the generated mines
+};
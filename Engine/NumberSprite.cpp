@@ -1,5 +1,10 @@
 #include "NumberSprite.h"
 #include <algorithm>
+#include <array>
+
+// Definitions of the colors of the portions (bound to a reference when picked with ?:)
+constexpr Color NumberSprite::Digit::on;
+constexpr Color NumberSprite::Digit::off;
 
 /**
 	Constructs a number sprite
@@ -11,29 +16,27 @@ NumberSprite::NumberSprite(int value, int size)
 	:
 	value(value)
 {	
-	int digitCounter = 0;
+	assert(size <= maxDigits);
 
-	// Push each digit into digits vector
+	// Push each digit into digits array
 	do {
 		int digitValue = abs(value % 10);
-		digits.push_back(Digit(digitValue));
+		digits[nDigits++] = Digit(digitValue);
 		value = value / 10;
-		++digitCounter;
 	} while (value != 0);
 	
 	// Fill the rest of the display with 0s if all digits have been pushed
 	// "- (int)(this->value < 0)" means "push one 0 less if the number is negative" to reserve a slot for '-' symbol
-	while (digitCounter < size - (int)(this->value < 0)) { 
-		digits.push_back(Digit(0));
-		++digitCounter;
+	while (nDigits < size - (int)(this->value < 0)) { 
+		digits[nDigits++] = Digit(0);
 	}
 
 	if (this->value < 0) {
-		digits.push_back(Digit(-1));	// Digit class takes (-1) as negation symbol
+		digits[nDigits++] = Digit(-1);	// Digit class takes (-1) as negation symbol
 	}
 
-	// Digits were pushed in reverse order, now just reverse the vector to get this in the correct order
-	std::reverse(digits.begin(), digits.end());
+	// Digits were pushed in reverse order, now just reverse the array to get this in the correct order
+	std::reverse(digits, digits + nDigits);
 }
 
 /**
@@ -45,11 +48,65 @@ NumberSprite::NumberSprite(int value, int size)
 */
 void NumberSprite::draw(Graphics & gfx, int x, int y) const
 {
-	for (int i = 0; i < (int)digits.size(); ++i) {
-		digits[i].draw(gfx, x+i*(Digit::spacing + Digit::width), y);
+	for (int i = 0; i < nDigits; ++i) {
+		const Glyph& glyph = getGlyph(digits[i].getValue());
+		const int digitX = x + i * (Digit::spacing + Digit::width);
+		for (int r = 0; r < glyph.nRuns; ++r) {
+			const Glyph::Run& run = glyph.runs[r];
+			gfx.PutPixels(digitX + run.x, y + run.y, &glyph.pixels[run.y][run.x], run.length);
+		}
 	}
 }
 
+/**
+	Returns the glyph of a digit, the glyphs of all digits are drawn the first time one is needed
+
+	@param digitValue Value of the digit (-1 being the negation symbol)
+	@return glyph
+*/
+const NumberSprite::Glyph& NumberSprite::getGlyph(int digitValue)
+{
+	assert(digitValue >= -1 && digitValue <= 9);
+	static const std::array<Glyph, 11> glyphs = [] {
+		std::array<Glyph, 11> result;
+		for (int v = -1; v <= 9; ++v) {
+			Glyph& glyph = result[v + 1];
+			Digit(v).draw(glyph, 0, 0);
+			// Join the drawn pixels of each row into runs
+			for (int y = 0; y < Digit::height; ++y) {
+				for (int x = 0; x < Digit::width; ++x) {
+					if (!glyph.isDrawn[y][x]) {
+						continue;
+					}
+					int end = x;
+					while (end < Digit::width && glyph.isDrawn[y][end]) {
+						++end;
+					}
+					assert(glyph.nRuns < Glyph::maxRuns);
+					glyph.runs[glyph.nRuns++] = { x, y, end - x };
+					x = end;
+				}
+			}
+		}
+		return result;
+	}();
+	return glyphs[digitValue + 1];
+}
+
+/**
+	Stores a pixel of the digit being drawn into the glyph
+
+	@param x x-value of the pixel (within the digit)
+	@param y y-value of the pixel (within the digit)
+	@param c Color of the pixel
+*/
+void NumberSprite::Glyph::PutPixel(int x, int y, Color c)
+{
+	assert(x >= 0 && x < Digit::width && y >= 0 && y < Digit::height);
+	pixels[y][x] = c;
+	isDrawn[y][x] = true;
+}
+
 /**
 	Returns the number to be drawn onto the screen
 
@@ -67,7 +124,7 @@ int NumberSprite::getValue() const
 */
 int NumberSprite::getWidth() const
 {
-	return (Digit::width + Digit::spacing) * (int) digits.size() - Digit::spacing ;
+	return (Digit::width + Digit::spacing) * nDigits - Digit::spacing ;
 }
 
 /**
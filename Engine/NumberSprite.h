@@ -8,7 +8,6 @@
 #pragma once
 #include "Graphics.h"
 #include <assert.h>
-#include <vector>
 
 class NumberSprite {
 private:
@@ -31,6 +30,7 @@ private:
 		};
 
 	public:
+		Digit() = default;
 		/**
 			Constructs the Digit object assigning its portions
 		*/
@@ -55,13 +55,14 @@ private:
 			assert(portions < 0b10000000);
 		}	
 		/**
-			Draws a digit at input position
+			Draws a digit at input position (only done once per value, into its glyph; see NumberSprite::getGlyph())
 
-			@param gfx Graphics processor
+			@param gfx Anything with a PutPixel(x, y, color) method
 			@param x x-value of the position where the digit is to be drawn
 			@param y y-value of the position where the digit is to be drawn
 		*/
-		void draw(Graphics& gfx, int x, int y) const {
+		template<typename Target>
+		void draw(Target& gfx, int x, int y) const {
 			unsigned char currentPortionOn = 0b01000000;
 			for (int p = 0; p < (int)Portion::SIZE; ++p) {
 				drawPortion(gfx, Portion(p), bool(portions & currentPortionOn), x, y); // Check if current portion is on and draw accordingly
@@ -69,6 +70,15 @@ private:
 			}
 		}
 
+		/**
+			Returns the value of the digit (-1 being the negation symbol)
+
+			@return value
+		*/
+		int getValue() const {
+			return value;
+		}
+
 	public:
 		static constexpr int spacing = 2;
 		static constexpr int width = 11;
@@ -78,13 +88,14 @@ private:
 		/**
 			Draws a single portion of a digit
 
-			@param gfx Graphics processor
+			@param gfx Anything with a PutPixel(x, y, color) method
 			@param portion The portion which is to be drawn
 			@param isOn Whether or not the portion should be glowing or not
 			@param x x-value of the position where the portion is to be drawn
 			@param y y-value of the position where the portion is to be drawn
 		*/
-		void drawPortion(Graphics& gfx, Portion portion, bool isOn, int x, int y) const {	
+		template<typename Target>
+		void drawPortion(Target& gfx, Portion portion, bool isOn, int x, int y) const {	
 			// "on" color draws bright red, "off" draws dark red every other pixel
 			const Color c = isOn ? on : off;
 			switch (portion) {
@@ -269,13 +280,33 @@ private:
 		}
 
 	private:
-		unsigned char portions;
-		int value;
+		unsigned char portions = 0;
+		int value = 0;
 
 		static constexpr Color on = Colors::Red;
 		static constexpr Color off = Color(123, 0, 0);
 	};
 
+	/**
+		A digit drawn once, so drawing it again is a few row copies instead of a PutPixel call per pixel
+	*/
+	struct Glyph {
+		// pixels [x, x + length) of the row y are drawn, everything else is transparent
+		struct Run {
+			int x;
+			int y;
+			int length;
+		};
+		static constexpr int maxRuns = Digit::height * (Digit::width + 1) / 2;
+
+		void PutPixel(int x, int y, Color c);
+
+		Color pixels[Digit::height][Digit::width];
+		bool isDrawn[Digit::height][Digit::width] = {};
+		Run runs[maxRuns];
+		int nRuns = 0;
+	};
+
 public:
 	NumberSprite() = default;
 	NumberSprite(int value, int size);
@@ -285,7 +316,13 @@ public:
 	int getWidth() const;
 	static int getHeight();
 
+	static constexpr int maxDigits = 11;	// Enough for any int, including its '-' symbol
+
+private:
+	static const Glyph& getGlyph(int digitValue);
+
 private:
 	int value;
-	std::vector<Digit> digits;
+	int nDigits = 0;
+	Digit digits[maxDigits];	// Kept inline, so replacing the number never allocates
 };
\ No newline at end of file
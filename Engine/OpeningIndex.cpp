@@ -0,0 +1,292 @@
+#include "OpeningIndex.h"
+#include "Bits.h"
+#include <algorithm>
+#include <assert.h>
+
+/**
+	Builds the index from a grid whose mines and adjacent mine counts are set
+
+	Works on runs of empty tiles instead of single tiles: the runs of every row are joined with union-find to the runs
+	of the row above which they touch (including diagonally), then every set of runs gets numbered in tile order
+	and its runs become the spans of an opening.
+	Empty tiles which are already flagged or revealed count as blocked (See isIntact()).
+
+	@param grid
+*/
+void OpeningIndex::build(const TileGrid& grid)
+{
+	width = grid.getWidth();
+	height = grid.getHeight();
+
+	// Runs of every row, each joined to the runs above reaching [begin - 1, end + 1)
+	runs.clear();
+	runParents.clear();
+	int aboveBegin = 0;
+	for (int y = 0; y < height; ++y) {
+		const int rowStart = y * width;
+		const int aboveEnd = (int)runs.size();
+		int above = aboveBegin;
+		auto addRun = [&](int x, int end) {
+			const int run = (int)runs.size();
+			runs.push_back({ rowStart + x, rowStart + end });
+			runParents.push_back(run);
+			// Skip the runs above which end left of this one, join the ones which touch it
+			while (above < aboveEnd && runs[above].end - (rowStart - width) < x) {
+				++above;
+			}
+			for (int touching = above; touching < aboveEnd && runs[touching].begin - (rowStart - width) <= end; ++touching) {
+				join(run, touching);
+			}
+		};
+
+		// Find the runs a chunk of tiles at a time, jumping from one change between empty and not empty to the next
+		int runBegin = -1;
+		for (int x = 0; x < width; x += emptyBitsPerChunk) {
+			const int count = std::min(int(emptyBitsPerChunk), width - x);
+			const std::uint64_t empty = grid.getEmptyBits(rowStart + x, count);
+			const std::uint64_t notEmpty = ~empty & ((std::uint64_t(1) << count) - 1);
+			int bit = 0;
+			while (bit < count) {
+				const std::uint64_t rest = (runBegin < 0 ? empty : notEmpty) >> bit;
+				if (rest == 0) {
+					break;
+				}
+				bit += Bits::lowestSetBit(rest);
+				if (runBegin < 0) {
+					runBegin = x + bit;
+				}
+				else {
+					addRun(runBegin, x + bit);
+					runBegin = -1;
+				}
+			}
+		}
+		if (runBegin >= 0) {
+			addRun(runBegin, width);
+		}
+		aboveBegin = aboveEnd;
+	}
+
+	// Number the sets in tile order: the parent of a run comes before it, so it was already numbered
+	int nOpenings = 0;
+	for (int run = 0; run < (int)runs.size(); ++run) {
+		const int parent = runParents[run];
+		runParents[run] = parent == run ? nOpenings++ : runParents[parent];
+	}
+
+	// Group the runs by opening (keeping them in tile order) and label the empty tiles
+	openingStart.assign(nOpenings + 1, 0);
+	emptyTileCounts.assign(nOpenings, 0);
+	blockedTileCounts.assign(nOpenings, 0);
+	openingOfTile.assign(grid.getTileCount(), int(noOpening));
+	for (int run = 0; run < (int)runs.size(); ++run) {
+		const int opening = runParents[run];
+		++openingStart[opening + 1];
+		const int length = runs[run].end - runs[run].begin;
+		emptyTileCounts[opening] += length;
+		blockedTileCounts[opening] += length - grid.countRevealable(runs[run].begin, runs[run].end);
+		std::fill(openingOfTile.begin() + runs[run].begin, openingOfTile.begin() + runs[run].end, opening);
+	}
+	for (int opening = 0; opening < nOpenings; ++opening) {
+		openingStart[opening + 1] += openingStart[opening];
+	}
+
+	spans.resize(runs.size());
+	nextSpans.assign(openingStart.begin(), openingStart.end() - 1);
+	for (int run = 0; run < (int)runs.size(); ++run) {
+		spans[nextSpans[runParents[run]]++] = runs[run];
+	}
+}
+
+/**
+	Empties the index (keeps its memory for the next build())
+*/
+void OpeningIndex::clear()
+{
+	openingOfTile.clear();
+	openingStart.clear();
+	spans.clear();
+	emptyTileCounts.clear();
+	blockedTileCounts.clear();
+	runs.clear();
+	runParents.clear();
+	nextSpans.clear();
+}
+
+/**
+	Returns the opening of the tile at input index if the tile is empty (has 0 adjacent mines and no mine)
+
+	@param index
+	@return opening (noOpening if the tile is not empty)
+*/
+int OpeningIndex::getOpening(int index) const
+{
+	assert(index >= 0 && index < (int)openingOfTile.size());
+	return openingOfTile[index];
+}
+
+/**
+	Returns true if revealing the opening reveals all of its tiles, which is the case as long as none of its
+	empty tiles is flagged (a flag stops a flood fill) or was revealed on its own (a revealed tile stops it too)
+
+	@param opening
+	@return bool
+*/
+bool OpeningIndex::isIntact(int opening) const
+{
+	return blockedTileCounts[opening] == 0;
+}
+
+/**
+	Reveals every revealable tile of an intact opening
+
+	@param grid The grid the index was built from
+	@param opening
+	@return revealed The amount of tiles which got revealed
+*/
+int OpeningIndex::reveal(TileGrid& grid, int opening)
+{
+	assert(isIntact(opening));
+	int revealed = 0;
+	for (int span = openingStart[opening]; span < openingStart[opening + 1]; ++span) {
+		const int y = spans[span].begin / width;
+		const int left = std::max(spans[span].begin - y * width - 1, 0);
+		const int right = std::min(spans[span].end - y * width + 1, width);
+		for (int row = std::max(y - 1, 0); row <= std::min(y + 1, height - 1); ++row) {
+			revealed += grid.revealRange(row * width + left, row * width + right);
+		}
+	}
+	breakOpening(opening);
+	return revealed;
+}
+
+/**
+	Marks an opening as no longer intact (Called once some of its empty tiles were revealed by a flood fill)
+
+	@param opening
+*/
+void OpeningIndex::breakOpening(int opening)
+{
+	blockedTileCounts[opening] = emptyTileCounts[opening] + 1;	// Never drops back to 0, even if every flag gets removed
+}
+
+/**
+	Updates the opening of the tile at input index after the tile got flagged or unflagged
+
+	@param index
+	@param flagged
+*/
+void OpeningIndex::setTileFlagged(int index, bool flagged)
+{
+	const int opening = getOpening(index);
+	if (opening != noOpening) {
+		blockedTileCounts[opening] += flagged ? 1 : -1;
+		assert(blockedTileCounts[opening] >= 0);
+	}
+}
+
+/**
+	Returns the amount of openings on the field
+
+	@return nOpenings
+*/
+int OpeningIndex::getOpeningCount() const
+{
+	return (int)emptyTileCounts.size();
+}
+
+/**
+	Returns the amount of tiles with 0 adjacent mines in an opening
+
+	@param opening
+	@return nEmptyTiles
+*/
+int OpeningIndex::getEmptyTileCount(int opening) const
+{
+	return emptyTileCounts[opening];
+}
+
+/**
+	Returns the amount of memory held by the index (in bytes)
+
+	@return bytes
+*/
+std::size_t OpeningIndex::getMemoryUsage() const
+{
+	return (openingOfTile.size() + openingStart.size() + emptyTileCounts.size() + blockedTileCounts.size() + runParents.size() + nextSpans.size()) * sizeof(int)
+		+ (spans.size() + runs.size()) * sizeof(Span);
+}
+
+/**
+	Returns the amount of tiles an opening reveals (its empty tiles and the numbered tiles bordering them)
+	Counted by merging the rows its spans reveal (See reveal()), so it takes as long as revealing the opening
+
+	@param opening
+	@return size
+*/
+int OpeningIndex::getOpeningSize(int opening) const
+{
+	// Revealed columns [left, right) of a row
+	struct Range {
+		int row;
+		int left;
+		int right;
+		bool operator<(const Range& rhs) const { return row < rhs.row || (row == rhs.row && left < rhs.left); }
+	};
+	std::vector<Range> ranges;
+
+	// The rows above, at and below the spans are each already sorted (the spans are in tile order),
+	// merged they put the overlapping ranges of a row next to each other
+	std::size_t blockEnds[3];
+	for (int offset = -1; offset <= 1; ++offset) {
+		for (int span = openingStart[opening]; span < openingStart[opening + 1]; ++span) {
+			const int y = spans[span].begin / width;
+			if (y + offset >= 0 && y + offset < height) {
+				const int left = std::max(spans[span].begin - y * width - 1, 0);
+				const int right = std::min(spans[span].end - y * width + 1, width);
+				ranges.push_back({ y + offset, left, right });
+			}
+		}
+		blockEnds[offset + 1] = ranges.size();
+	}
+	std::inplace_merge(ranges.begin(), ranges.begin() + blockEnds[0], ranges.begin() + blockEnds[1]);
+	std::inplace_merge(ranges.begin(), ranges.begin() + blockEnds[1], ranges.end());
+
+	int tileCount = 0;
+	for (std::size_t i = 0; i < ranges.size();) {
+		Range merged = ranges[i++];
+		while (i < ranges.size() && ranges[i].row == merged.row && ranges[i].left <= merged.right) {
+			merged.right = std::max(merged.right, ranges[i++].right);
+		}
+		tileCount += merged.right - merged.left;
+	}
+	return tileCount;
+}
+
+/**
+	Joins the sets of two runs (the root which comes later gets attached to the other root)
+
+	@param run
+	@param otherRun
+*/
+void OpeningIndex::join(int run, int otherRun)
+{
+	const int root = findRoot(run);
+	const int otherRoot = findRoot(otherRun);
+	runParents[std::max(root, otherRoot)] = std::min(root, otherRoot);
+}
+
+/**
+	Returns the root of the set of a run (Halves the path on the way up)
+
+	@param run
+	@return root
+*/
+int OpeningIndex::findRoot(int run)
+{
+	while (runParents[run] != run) {
+		runParents[run] = runParents[runParents[run]];
+		run = runParents[run];
+	}
+	return run;
+}
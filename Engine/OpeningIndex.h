@@ -0,0 +1,59 @@
+/**
+	Index of the openings of a minefield, built once after the mines were placed
+
+	An opening is a connected area of tiles with 0 adjacent mines (connected through all 8 neighbours) together with
+	the numbered tiles bordering it, which is exactly what a flood fill from any of its empty tiles reveals.
+	The empty tiles of every opening are kept as one contiguous list of spans (runs of empty tiles in a row), so revealing
+	an opening is a single pass over its spans instead of a flood fill: each span reveals the rows above, at and below it,
+	one tile wider on both ends, which covers the numbered border as well.
+*/
+
+#pragma once
+#include "TileGrid.h"
+#include <vector>
+#include <cstddef>
+
+class OpeningIndex {
+public:
+	/**
+		Run of consecutive empty tiles [begin, end) of an opening, inside of a single row
+	*/
+	struct Span {
+		int begin;
+		int end;
+	};
+
+public:
+	void build(const TileGrid& grid);
+	void clear();
+
+	int getOpening(int index) const;
+	bool isIntact(int opening) const;
+	int reveal(TileGrid& grid, int opening);
+	void breakOpening(int opening);
+	void setTileFlagged(int index, bool flagged);
+
+	int getOpeningCount() const;
+	int getOpeningSize(int opening) const;
+	int getEmptyTileCount(int opening) const;
+	std::size_t getMemoryUsage() const;
+
+	static constexpr int noOpening = -1;
+	static constexpr int emptyBitsPerChunk = 32;	// Tiles looked at together while searching for runs of empty tiles
+
+private:
+	int findRoot(int run);
+	void join(int run, int otherRun);
+
+private:
+	int width = 0;
+	int height = 0;
+	std::vector<int> openingOfTile;	// Opening of each empty tile (noOpening for every other tile)
+	std::vector<int> openingStart;	// Start of the spans of each opening in spans (one extra entry marks the end)
+	std::vector<Span> spans;	// Spans of every opening, sorted by tile index inside of each opening
+	std::vector<int> emptyTileCounts;	// Amount of tiles with 0 adjacent mines in each opening
+	std::vector<int> blockedTileCounts;	// Amount of empty tiles of each opening which are flagged or were revealed separately
+	std::vector<Span> runs;	// Runs of empty tiles of the whole grid in tile order, used by build()
+	std::vector<int> runParents;	// Union-find parents of the runs (the opening of each run once they are numbered)
+	std::vector<int> nextSpans;	// Next free span of each opening, used by build()
+};
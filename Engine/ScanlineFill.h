@@ -0,0 +1,112 @@
+/**
+	Scanline flood fill used to reveal openings (areas of tiles with 0 adjacent mines)
+
+	Works on any grid type which provides:
+		bool contains(int x, int y) const			- the tile exists
+		bool isRevealable(int x, int y) const		- the tile is hidden or partially revealed
+		bool isEmpty(int x, int y) const			- the tile has 0 adjacent mines
+		void reveal(int x, int y)					- reveals the tile
+*/
+
+#pragma once
+#include "Vei2.h"
+#include <vector>
+
+namespace ScanlineFill {
+	/**
+		Scans the tiles [left, right] of a row bordering a filled span: numbered tiles get revealed,
+		the first tile of each run of empty tiles gets pushed as a new seed
+
+		@param grid
+		@param y Row to scan
+		@param left First column to scan
+		@param right Last column to scan
+		@param stack Seeds still to be filled
+		@return revealed The amount of tiles which got revealed
+	*/
+	template<typename Grid>
+	int scanNeighbourRow(Grid& grid, int y, int left, int right, std::vector<Vei2>& stack)
+	{
+		int revealed = 0;
+		bool inRun = false;
+		for (int x = left; x <= right; ++x) {
+			if (!grid.contains(x, y) || !grid.isRevealable(x, y)) {
+				inRun = false;
+			}
+			else if (grid.isEmpty(x, y)) {
+				if (!inRun) {
+					stack.push_back({ x, y });
+					inRun = true;
+				}
+			}
+			else {
+				grid.reveal(x, y);
+				++revealed;
+				inRun = false;
+			}
+		}
+		return revealed;
+	}
+
+	/**
+		Reveals the tile at input location and, if it is empty, the whole opening around it
+
+		Every popped seed is grown into the widest horizontal span of revealable empty tiles, which is revealed at once
+		together with its numbered ends. The rows above and below the span are then scanned once, numbered tiles are
+		revealed directly and only the first tile of each run of empty tiles is pushed as a new seed.
+		Tiles which are not revealable (flagged) are never revealed and stop the fill.
+
+		@param grid
+		@param x
+		@param y Location of a revealable tile without a mine
+		@param stack Buffer for the seeds (reused between calls to avoid allocations)
+		@return revealed The amount of tiles which got revealed
+	*/
+	template<typename Grid>
+	int reveal(Grid& grid, int x, int y, std::vector<Vei2>& stack)
+	{
+		if (!grid.isEmpty(x, y)) {
+			grid.reveal(x, y);
+			return 1;
+		}
+
+		int revealed = 0;
+		stack.clear();
+		stack.push_back({ x, y });
+		while (!stack.empty()) {
+			const Vei2 seed = stack.back();
+			stack.pop_back();
+			if (!grid.isRevealable(seed.x, seed.y)) {
+				continue;	// Already covered by a span which was filled after this seed was pushed
+			}
+
+			int left = seed.x;
+			int right = seed.x;
+			while (grid.contains(left - 1, seed.y) && grid.isRevealable(left - 1, seed.y) && grid.isEmpty(left - 1, seed.y)) {
+				--left;
+			}
+			while (grid.contains(right + 1, seed.y) && grid.isRevealable(right + 1, seed.y) && grid.isEmpty(right + 1, seed.y)) {
+				++right;
+			}
+
+			for (int spanX = left; spanX <= right; ++spanX) {
+				grid.reveal(spanX, seed.y);
+			}
+			revealed += right - left + 1;
+
+			// The tiles right next to the span are numbers (or not revealable), they are revealed but not expanded
+			if (grid.contains(left - 1, seed.y) && grid.isRevealable(left - 1, seed.y)) {
+				grid.reveal(left - 1, seed.y);
+				++revealed;
+			}
+			if (grid.contains(right + 1, seed.y) && grid.isRevealable(right + 1, seed.y)) {
+				grid.reveal(right + 1, seed.y);
+				++revealed;
+			}
+
+			revealed += scanNeighbourRow(grid, seed.y - 1, left - 1, right + 1, stack);
+			revealed += scanNeighbourRow(grid, seed.y + 1, left - 1, right + 1, stack);
+		}
+		return revealed;
+	}
+}
@@ -0,0 +1,3847 @@
+#include "SpriteAtlas.h"
+
+// Generated from the former Graphics::PutPixel listings of SpriteCodex.cpp, do not edit by hand
+// (Every opaque pixel of every sprite kept once, in rows of opaque spans)
+
+namespace SpriteAtlas {
+	namespace {
+		const Sprite sprites[] = {
+			{ 16, 16, 0, 16 },	// Tile0
+			{ 16, 16, 16, 26 },	// Tile1
+			{ 16, 16, 42, 27 },	// Tile2
+			{ 16, 16, 69, 26 },	// Tile3
+			{ 16, 16, 95, 30 },	// Tile4
+			{ 16, 16, 125, 26 },	// Tile5
+			{ 16, 16, 151, 28 },	// Tile6
+			{ 16, 16, 179, 26 },	// Tile7
+			{ 16, 16, 205, 30 },	// Tile8
+			{ 16, 16, 235, 30 },	// TileButton
+			{ 15, 14, 265, 22 },	// TileCross
+			{ 12, 13, 287, 10 },	// TileFlag
+			{ 16, 16, 297, 16 },	// TileMine
+			{ 16, 16, 313, 16 },	// TileMineRed
+			{ 111, 27, 329, 203 },	// Beginner
+			{ 159, 21, 532, 289 },	// Intermediate
+			{ 82, 27, 821, 147 },	// Expert
+			{ 116, 32, 968, 56 },	// BeginnerGlow
+			{ 164, 27, 1024, 70 },	// IntermediateGlow
+			{ 86, 32, 1094, 57 },	// ExpertGlow
+			{ 244, 37, 1151, 322 },	// GameLoss
+			{ 352, 48, 1473, 48 },	// GameWin
+		};
+		static_assert(sizeof(sprites) / sizeof(sprites[0]) == int(Id::Count), "Every sprite needs an entry");
+
+		const Span spans[] = {
+			{ 0, 0, 16, 0 }, { 0, 1, 1, 16 }, { 0, 2, 1, 17 }, { 0, 3, 1, 18 }, { 0, 4, 1, 19 }, { 0, 5, 1, 20 },
+			{ 0, 6, 1, 21 }, { 0, 7, 1, 22 }, { 0, 8, 1, 23 }, { 0, 9, 1, 24 }, { 0, 10, 1, 25 }, { 0, 11, 1, 26 },
+			{ 0, 12, 1, 27 }, { 0, 13, 1, 28 }, { 0, 14, 1, 29 }, { 0, 15, 1, 30 }, { 0, 0, 16, 31 }, { 0, 1, 1, 47 },
+			{ 0, 2, 1, 48 }, { 0, 3, 1, 49 }, { 8, 3, 2, 50 }, { 0, 4, 1, 52 }, { 7, 4, 3, 53 }, { 0, 5, 1, 56 },
+			{ 6, 5, 4, 57 }, { 0, 6, 1, 61 }, { 5, 6, 5, 62 }, { 0, 7, 1, 67 }, { 7, 7, 3, 68 }, { 0, 8, 1, 71 },
+			{ 7, 8, 3, 72 }, { 0, 9, 1, 75 }, { 7, 9, 3, 76 }, { 0, 10, 1, 79 }, { 7, 10, 3, 80 }, { 0, 11, 1, 83 },
+			{ 5, 11, 7, 84 }, { 0, 12, 1, 91 }, { 5, 12, 7, 92 }, { 0, 13, 1, 99 }, { 0, 14, 1, 100 }, { 0, 15, 1, 101 },
+			{ 0, 0, 16, 102 }, { 0, 1, 1, 118 }, { 0, 2, 1, 119 }, { 0, 3, 1, 120 }, { 4, 3, 8, 121 }, { 0, 4, 1, 129 },
+			{ 3, 4, 10, 130 }, { 0, 5, 1, 140 }, { 3, 5, 3, 141 }, { 10, 5, 3, 144 }, { 0, 6, 1, 147 }, { 10, 6, 3, 148 },
+			{ 0, 7, 1, 151 }, { 8, 7, 4, 152 }, { 0, 8, 1, 156 }, { 6, 8, 5, 157 }, { 0, 9, 1, 162 }, { 4, 9, 5, 163 },
+			{ 0, 10, 1, 168 }, { 3, 10, 4, 169 }, { 0, 11, 1, 173 }, { 3, 11, 10, 174 }, { 0, 12, 1, 184 }, { 3, 12, 10, 185 },
+			{ 0, 13, 1, 195 }, { 0, 14, 1, 196 }, { 0, 15, 1, 197 }, { 0, 0, 16, 198 }, { 0, 1, 1, 214 }, { 0, 2, 1, 215 },
+			{ 0, 3, 1, 216 }, { 3, 3, 9, 217 }, { 0, 4, 1, 226 }, { 3, 4, 10, 227 }, { 0, 5, 1, 237 }, { 10, 5, 3, 238 },
+			{ 0, 6, 1, 241 }, { 10, 6, 3, 242 }, { 0, 7, 1, 245 }, { 6, 7, 6, 246 }, { 0, 8, 1, 252 }, { 6, 8, 6, 253 },
+			{ 0, 9, 1, 259 }, { 10, 9, 3, 260 }, { 0, 10, 1, 263 }, { 10, 10, 3, 264 }, { 0, 11, 1, 267 }, { 3, 11, 10, 268 },
+			{ 0, 12, 1, 278 }, { 3, 12, 9, 279 }, { 0, 13, 1, 288 }, { 0, 14, 1, 289 }, { 0, 15, 1, 290 }, { 0, 0, 16, 291 },
+			{ 0, 1, 1, 307 }, { 0, 2, 1, 308 }, { 0, 3, 1, 309 }, { 5, 3, 3, 310 }, { 9, 3, 3, 313 }, { 0, 4, 1, 316 },
+			{ 5, 4, 3, 317 }, { 9, 4, 3, 320 }, { 0, 5, 1, 323 }, { 4, 5, 3, 324 }, { 9, 5, 3, 327 }, { 0, 6, 1, 330 },
+			{ 4, 6, 3, 331 }, { 9, 6, 3, 334 }, { 0, 7, 1, 337 }, { 3, 7, 10, 338 }, { 0, 8, 1, 348 }, { 3, 8, 10, 349 },
+			{ 0, 9, 1, 359 }, { 9, 9, 3, 360 }, { 0, 10, 1, 363 }, { 9, 10, 3, 364 }, { 0, 11, 1, 367 }, { 9, 11, 3, 368 },
+			{ 0, 12, 1, 371 }, { 9, 12, 3, 372 }, { 0, 13, 1, 375 }, { 0, 14, 1, 376 }, { 0, 15, 1, 377 }, { 0, 0, 16, 378 },
+			{ 0, 1, 1, 394 }, { 0, 2, 1, 395 }, { 0, 3, 1, 396 }, { 3, 3, 10, 397 }, { 0, 4, 1, 407 }, { 3, 4, 10, 408 },
+			{ 0, 5, 1, 418 }, { 3, 5, 3, 419 }, { 0, 6, 1, 422 }, { 3, 6, 3, 423 }, { 0, 7, 1, 426 }, { 3, 7, 9, 427 },
+			{ 0, 8, 1, 436 }, { 3, 8, 10, 437 }, { 0, 9, 1, 447 }, { 10, 9, 3, 448 }, { 0, 10, 1, 451 }, { 10, 10, 3, 452 },
+			{ 0, 11, 1, 455 }, { 3, 11, 10, 456 }, { 0, 12, 1, 466 }, { 3, 12, 9, 467 }, { 0, 13, 1, 476 }, { 0, 14, 1, 477 },
+			{ 0, 15, 1, 478 }, { 0, 0, 16, 479 }, { 0, 1, 1, 495 }, { 0, 2, 1, 496 }, { 0, 3, 1, 497 }, { 4, 3, 8, 498 },
+			{ 0, 4, 1, 506 }, { 3, 4, 9, 507 }, { 0, 5, 1, 516 }, { 3, 5, 3, 517 }, { 0, 6, 1, 520 }, { 3, 6, 3, 521 },
+			{ 0, 7, 1, 524 }, { 3, 7, 9, 525 }, { 0, 8, 1, 534 }, { 3, 8, 10, 535 }, { 0, 9, 1, 545 }, { 3, 9, 3, 546 },
+			{ 10, 9, 3, 549 }, { 0, 10, 1, 552 }, { 3, 10, 3, 553 }, { 10, 10, 3, 556 }, { 0, 11, 1, 559 }, { 3, 11, 10, 560 },
+			{ 0, 12, 1, 570 }, { 4, 12, 8, 571 }, { 0, 13, 1, 579 }, { 0, 14, 1, 580 }, { 0, 15, 1, 581 }, { 0, 0, 16, 582 },
+			{ 0, 1, 1, 598 }, { 0, 2, 1, 599 }, { 0, 3, 1, 600 }, { 3, 3, 10, 601 }, { 0, 4, 1, 611 }, { 3, 4, 10, 612 },
+			{ 0, 5, 1, 622 }, { 10, 5, 3, 623 }, { 0, 6, 1, 626 }, { 10, 6, 3, 627 }, { 0, 7, 1, 630 }, { 9, 7, 3, 631 },
+			{ 0, 8, 1, 634 }, { 9, 8, 3, 635 }, { 0, 9, 1, 638 }, { 8, 9, 3, 639 }, { 0, 10, 1, 642 }, { 8, 10, 3, 643 },
+			{ 0, 11, 1, 646 }, { 7, 11, 3, 647 }, { 0, 12, 1, 650 }, { 7, 12, 3, 651 }, { 0, 13, 1, 654 }, { 0, 14, 1, 655 },
+			{ 0, 15, 1, 656 }, { 0, 0, 16, 657 }, { 0, 1, 1, 673 }, { 0, 2, 1, 674 }, { 0, 3, 1, 675 }, { 4, 3, 8, 676 },
+			{ 0, 4, 1, 684 }, { 3, 4, 10, 685 }, { 0, 5, 1, 695 }, { 3, 5, 3, 696 }, { 10, 5, 3, 699 }, { 0, 6, 1, 702 },
+			{ 3, 6, 3, 703 }, { 10, 6, 3, 706 }, { 0, 7, 1, 709 }, { 4, 7, 8, 710 }, { 0, 8, 1, 718 }, { 4, 8, 8, 719 },
+			{ 0, 9, 1, 727 }, { 3, 9, 3, 728 }, { 10, 9, 3, 731 }, { 0, 10, 1, 734 }, { 3, 10, 3, 735 }, { 10, 10, 3, 738 },
+			{ 0, 11, 1, 741 }, { 3, 11, 10, 742 }, { 0, 12, 1, 752 }, { 4, 12, 8, 753 }, { 0, 13, 1, 761 }, { 0, 14, 1, 762 },
+			{ 0, 15, 1, 763 }, { 0, 0, 15, 764 }, { 0, 1, 14, 779 }, { 15, 1, 1, 793 }, { 0, 2, 2, 794 }, { 14, 2, 2, 796 },
+			{ 0, 3, 2, 798 }, { 14, 3, 2, 800 }, { 0, 4, 2, 802 }, { 14, 4, 2, 804 }, { 0, 5, 2, 806 }, { 14, 5, 2, 808 },
+			{ 0, 6, 2, 810 }, { 14, 6, 2, 812 }, { 0, 7, 2, 814 }, { 14, 7, 2, 816 }, { 0, 8, 2, 818 }, { 14, 8, 2, 820 },
+			{ 0, 9, 2, 822 }, { 14, 9, 2, 824 }, { 0, 10, 2, 826 }, { 14, 10, 2, 828 }, { 0, 11, 2, 830 }, { 14, 11, 2, 832 },
+			{ 0, 12, 2, 834 }, { 14, 12, 2, 836 }, { 0, 13, 2, 838 }, { 14, 13, 2, 840 }, { 0, 14, 1, 842 }, { 2, 14, 14, 843 },
+			{ 1, 15, 15, 857 }, { 2, 2, 2, 872 }, { 13, 2, 2, 874 }, { 3, 3, 2, 876 }, { 12, 3, 2, 878 }, { 4, 4, 2, 880 },
+			{ 11, 4, 2, 882 }, { 5, 5, 2, 884 }, { 10, 5, 2, 886 }, { 6, 6, 2, 888 }, { 9, 6, 2, 890 }, { 7, 7, 3, 892 },
+			{ 7, 8, 3, 895 }, { 6, 9, 2, 898 }, { 9, 9, 2, 900 }, { 5, 10, 2, 902 }, { 10, 10, 2, 904 }, { 4, 11, 2, 906 },
+			{ 11, 11, 2, 908 }, { 3, 12, 2, 910 }, { 12, 12, 2, 912 }, { 2, 13, 2, 914 }, { 13, 13, 2, 916 }, { 7, 3, 2, 918 },
+			{ 5, 4, 4, 920 }, { 4, 5, 5, 924 }, { 5, 6, 4, 929 }, { 7, 7, 2, 933 }, { 8, 8, 1, 935 }, { 8, 9, 1, 936 },
+			{ 6, 10, 4, 937 }, { 4, 11, 8, 941 }, { 4, 12, 8, 949 }, { 0, 0, 16, 957 }, { 0, 1, 16, 973 }, { 0, 2, 16, 989 },
+			{ 0, 3, 16, 1005 }, { 0, 4, 16, 1021 }, { 0, 5, 16, 1037 }, { 0, 6, 16, 1053 }, { 0, 7, 16, 1069 }, { 0, 8, 16, 1085 },
+			{ 0, 9, 16, 1101 }, { 0, 10, 16, 1117 }, { 0, 11, 16, 1133 }, { 0, 12, 16, 1149 }, { 0, 13, 16, 1165 }, { 0, 14, 16, 1181 },
+			{ 0, 15, 16, 1197 }, { 0, 0, 16, 1213 }, { 0, 1, 16, 1229 }, { 0, 2, 16, 1245 }, { 0, 3, 16, 1261 }, { 0, 4, 16, 1277 },
+			{ 0, 5, 16, 1293 }, { 0, 6, 16, 1309 }, { 0, 7, 16, 1325 }, { 0, 8, 16, 1341 }, { 0, 9, 16, 1357 }, { 0, 10, 16, 1373 },
+			{ 0, 11, 16, 1389 }, { 0, 12, 16, 1405 }, { 0, 13, 16, 1421 }, { 0, 14, 16, 1437 }, { 0, 15, 16, 1453 }, { 0, 0, 13, 1469 },
+			{ 47, 0, 4, 1482 }, { 1, 1, 13, 1486 }, { 47, 1, 4, 1499 }, { 1, 2, 4, 1503 }, { 10, 2, 4, 1507 }, { 47, 2, 4, 1511 },
+			{ 1, 3, 4, 1515 }, { 11, 3, 4, 1519 }, { 47, 3, 4, 1523 }, { 1, 4, 4, 1527 }, { 11, 4, 4, 1531 }, { 1, 5, 4, 1535 },
+			{ 11, 5, 4, 1539 }, { 1, 6, 4, 1543 }, { 10, 6, 4, 1547 }, { 20, 6, 7, 1551 }, { 33, 6, 12, 1558 }, { 46, 6, 5, 1570 },
+			{ 54, 6, 5, 1575 }, { 60, 6, 6, 1580 }, { 69, 6, 6, 1586 }, { 76, 6, 5, 1592 }, { 89, 6, 7, 1597 }, { 100, 6, 5, 1604 },
+			{ 106, 6, 5, 1609 }, { 1, 7, 4, 1614 }, { 10, 7, 4, 1618 }, { 19, 7, 9, 1622 }, { 32, 7, 13, 1631 }, { 47, 7, 4, 1644 },
+			{ 55, 7, 11, 1648 }, { 71, 7, 11, 1659 }, { 88, 7, 9, 1670 }, { 101, 7, 10, 1679 }, { 1, 8, 4, 1689 }, { 8, 8, 5, 1693 },
+			{ 18, 8, 4, 1698 }, { 25, 8, 4, 1702 }, { 32, 8, 3, 1706 }, { 39, 8, 4, 1709 }, { 47, 8, 4, 1713 }, { 55, 8, 6, 1717 },
+			{ 62, 8, 5, 1723 }, { 71, 8, 6, 1728 }, { 78, 8, 4, 1734 }, { 87, 8, 4, 1738 }, { 94, 8, 3, 1742 }, { 102, 8, 5, 1745 },
+			{ 108, 8, 3, 1750 }, { 1, 9, 10, 1753 }, { 18, 9, 3, 1763 }, { 26, 9, 3, 1766 }, { 32, 9, 3, 1769 }, { 39, 9, 4, 1772 },
+			{ 47, 9, 4, 1776 }, { 55, 9, 4, 1780 }, { 63, 9, 4, 1784 }, { 71, 9, 4, 1788 }, { 79, 9, 4, 1792 }, { 86, 9, 4, 1796 },
+			{ 94, 9, 4, 1800 }, { 102, 9, 4, 1804 }, { 109, 9, 2, 1808 }, { 1, 10, 12, 1810 }, { 18, 10, 3, 1822 }, { 26, 10, 3, 1825 },
+			{ 31, 10, 4, 1828 }, { 39, 10, 4, 1832 }, { 47, 10, 4, 1836 }, { 55, 10, 4, 1840 }, { 64, 10, 3, 1844 }, { 71, 10, 4, 1847 },
+			{ 79, 10, 4, 1851 }, { 86, 10, 4, 1855 }, { 94, 10, 4, 1859 }, { 102, 10, 3, 1863 }, { 1, 11, 4, 1866 }, { 10, 11, 4, 1870 },
+			{ 17, 11, 4, 1874 }, { 26, 11, 4, 1878 }, { 32, 11, 3, 1882 }, { 39, 11, 4, 1885 }, { 47, 11, 4, 1889 }, { 55, 11, 4, 1893 },
+			{ 64, 11, 3, 1897 }, { 71, 11, 4, 1900 }, { 79, 11, 4, 1904 }, { 86, 11, 3, 1908 }, { 95, 11, 4, 1911 }, { 102, 11, 3, 1915 },
+			{ 1, 12, 4, 1918 }, { 11, 12, 3, 1922 }, { 17, 12, 13, 1925 }, { 32, 12, 3, 1938 }, { 39, 12, 4, 1941 }, { 47, 12, 4, 1945 },
+			{ 55, 12, 4, 1949 }, { 64, 12, 3, 1953 }, { 71, 12, 4, 1956 }, { 79, 12, 4, 1960 }, { 86, 12, 13, 1964 }, { 102, 12, 3, 1977 },
+			{ 1, 13, 4, 1980 }, { 11, 13, 4, 1984 }, { 17, 13, 13, 1988 }, { 32, 13, 4, 2001 }, { 38, 13, 4, 2005 }, { 47, 13, 4, 2009 },
+			{ 55, 13, 4, 2013 }, { 64, 13, 3, 2017 }, { 71, 13, 4, 2020 }, { 79, 13, 4, 2024 }, { 86, 13, 12, 2028 }, { 102, 13, 3, 2040 },
+			{ 1, 14, 4, 2043 }, { 11, 14, 4, 2047 }, { 17, 14, 4, 2051 }, { 33, 14, 9, 2055 }, { 47, 14, 4, 2064 }, { 55, 14, 4, 2068 },
+			{ 64, 14, 3, 2072 }, { 71, 14, 4, 2075 }, { 79, 14, 4, 2079 }, { 86, 14, 3, 2083 }, { 102, 14, 3, 2086 }, { 1, 15, 4, 2089 },
+			{ 11, 15, 4, 2093 }, { 17, 15, 4, 2097 }, { 33, 15, 7, 2101 }, { 47, 15, 4, 2108 }, { 55, 15, 4, 2112 }, { 64, 15, 3, 2116 },
+			{ 71, 15, 4, 2119 }, { 79, 15, 4, 2123 }, { 86, 15, 4, 2127 }, { 102, 15, 3, 2131 }, { 1, 16, 4, 2134 }, { 11, 16, 4, 2138 },
+			{ 18, 16, 3, 2142 }, { 28, 16, 1, 2145 }, { 32, 16, 3, 2146 }, { 47, 16, 4, 2149 }, { 55, 16, 4, 2153 }, { 64, 16, 3, 2157 },
+			{ 71, 16, 4, 2160 }, { 79, 16, 4, 2164 }, { 86, 16, 4, 2168 }, { 96, 16, 1, 2172 }, { 102, 16, 3, 2173 }, { 1, 17, 4, 2176 },
+			{ 10, 17, 4, 2180 }, { 18, 17, 4, 2184 }, { 27, 17, 2, 2188 }, { 32, 17, 3, 2190 }, { 47, 17, 4, 2193 }, { 55, 17, 4, 2197 },
+			{ 64, 17, 3, 2201 }, { 71, 17, 4, 2204 }, { 79, 17, 4, 2208 }, { 86, 17, 5, 2212 }, { 95, 17, 3, 2217 }, { 102, 17, 3, 2220 },
+			{ 1, 18, 4, 2223 }, { 8, 18, 6, 2227 }, { 18, 18, 11, 2233 }, { 32, 18, 11, 2244 }, { 47, 18, 4, 2255 }, { 55, 18, 4, 2259 },
+			{ 63, 18, 4, 2263 }, { 71, 18, 4, 2267 }, { 79, 18, 4, 2271 }, { 87, 18, 10, 2275 }, { 101, 18, 4, 2285 }, { 0, 19, 13, 2289 },
+			{ 19, 19, 9, 2302 }, { 32, 19, 12, 2311 }, { 46, 19, 6, 2323 }, { 54, 19, 6, 2329 }, { 62, 19, 6, 2335 }, { 70, 19, 6, 2341 },
+			{ 78, 19, 6, 2347 }, { 88, 19, 8, 2353 }, { 100, 19, 7, 2361 }, { 0, 20, 11, 2368 }, { 21, 20, 5, 2379 }, { 32, 20, 12, 2384 },
+			{ 46, 20, 6, 2396 }, { 54, 20, 6, 2402 }, { 62, 20, 14, 2408 }, { 78, 20, 6, 2422 }, { 89, 20, 6, 2428 }, { 100, 20, 7, 2434 },
+			{ 31, 21, 3, 2441 }, { 41, 21, 4, 2444 }, { 30, 22, 4, 2448 }, { 41, 22, 4, 2452 }, { 30, 23, 4, 2456 }, { 41, 23, 3, 2460 },
+			{ 31, 24, 3, 2463 }, { 40, 24, 4, 2466 }, { 31, 25, 12, 2470 }, { 32, 26, 10, 2482 }, { 0, 0, 7, 2492 }, { 106, 0, 6, 2499 },
+			{ 0, 1, 6, 2505 }, { 108, 1, 4, 2511 }, { 116, 1, 4, 2515 }, { 1, 2, 4, 2519 }, { 108, 2, 4, 2523 }, { 116, 2, 4, 2527 },
+			{ 1, 3, 4, 2531 }, { 26, 3, 3, 2535 }, { 108, 3, 4, 2538 }, { 116, 3, 4, 2542 }, { 139, 3, 3, 2546 }, { 1, 4, 4, 2549 },
+			{ 26, 4, 3, 2553 }, { 108, 4, 4, 2556 }, { 116, 4, 4, 2560 }, { 139, 4, 3, 2564 }, { 1, 5, 4, 2567 }, { 26, 5, 3, 2571 },
+			{ 108, 5, 4, 2574 }, { 138, 5, 4, 2578 }, { 1, 6, 4, 2582 }, { 8, 6, 6, 2586 }, { 15, 6, 5, 2592 }, { 25, 6, 9, 2597 },
+			{ 39, 6, 5, 2606 }, { 48, 6, 6, 2611 }, { 55, 6, 5, 2617 }, { 61, 6, 5, 2622 }, { 68, 6, 4, 2627 }, { 76, 6, 4, 2631 },
+			{ 89, 6, 5, 2635 }, { 103, 6, 9, 2640 }, { 114, 6, 6, 2649 }, { 126, 6, 6, 2655 }, { 137, 6, 10, 2661 }, { 151, 6, 5, 2671 },
+			{ 1, 7, 4, 2676 }, { 8, 7, 5, 2680 }, { 14, 7, 7, 2685 }, { 24, 7, 10, 2692 }, { 37, 7, 8, 2702 }, { 49, 7, 4, 2710 },
+			{ 54, 7, 6, 2714 }, { 61, 7, 12, 2720 }, { 74, 7, 7, 2732 }, { 87, 7, 8, 2739 }, { 102, 7, 10, 2747 }, { 115, 7, 5, 2757 },
+			{ 124, 7, 9, 2762 }, { 136, 7, 11, 2771 }, { 149, 7, 8, 2782 }, { 1, 8, 4, 2790 }, { 10, 8, 11, 2794 }, { 26, 8, 3, 2805 },
+			{ 36, 8, 4, 2808 }, { 42, 8, 4, 2812 }, { 50, 8, 10, 2816 }, { 62, 8, 19, 2826 }, { 86, 8, 4, 2845 }, { 92, 8, 4, 2849 },
+			{ 101, 8, 4, 2853 }, { 107, 8, 5, 2857 }, { 116, 8, 4, 2862 }, { 123, 8, 5, 2866 }, { 129, 8, 5, 2871 }, { 138, 8, 4, 2876 },
+			{ 148, 8, 4, 2880 }, { 154, 8, 4, 2884 }, { 1, 9, 4, 2888 }, { 10, 9, 5, 2892 }, { 18, 9, 3, 2897 }, { 26, 9, 3, 2900 },
+			{ 36, 9, 3, 2903 }, { 43, 9, 4, 2906 }, { 50, 9, 4, 2910 }, { 57, 9, 3, 2914 }, { 62, 9, 5, 2917 }, { 70, 9, 5, 2922 },
+			{ 78, 9, 4, 2927 }, { 85, 9, 4, 2931 }, { 93, 9, 4, 2935 }, { 100, 9, 4, 2939 }, { 108, 9, 4, 2943 }, { 116, 9, 4, 2947 },
+			{ 123, 9, 3, 2951 }, { 130, 9, 4, 2954 }, { 138, 9, 4, 2958 }, { 148, 9, 3, 2962 }, { 155, 9, 4, 2965 }, { 1, 10, 4, 2969 },
+			{ 10, 10, 4, 2973 }, { 18, 10, 4, 2977 }, { 26, 10, 3, 2981 }, { 35, 10, 4, 2984 }, { 43, 10, 4, 2988 }, { 50, 10, 4, 2992 },
+			{ 57, 10, 3, 2996 }, { 62, 10, 4, 2999 }, { 70, 10, 4, 3003 }, { 78, 10, 4, 3007 }, { 85, 10, 4, 3011 }, { 93, 10, 4, 3015 },
+			{ 99, 10, 4, 3019 }, { 108, 10, 4, 3023 }, { 116, 10, 4, 3027 }, { 123, 10, 3, 3031 }, { 131, 10, 3, 3034 }, { 138, 10, 4, 3037 },
+			{ 147, 10, 4, 3041 }, { 155, 10, 4, 3045 }, { 1, 11, 4, 3049 }, { 10, 11, 4, 3053 }, { 18, 11, 4, 3057 }, { 26, 11, 3, 3061 },
+			{ 35, 11, 4, 3064 }, { 43, 11, 4, 3068 }, { 50, 11, 4, 3072 }, { 62, 11, 4, 3076 }, { 70, 11, 4, 3080 }, { 78, 11, 4, 3084 },
+			{ 85, 11, 3, 3088 }, { 93, 11, 4, 3091 }, { 99, 11, 4, 3095 }, { 108, 11, 4, 3099 }, { 116, 11, 4, 3103 }, { 131, 11, 3, 3107 },
+			{ 138, 11, 4, 3110 }, { 147, 11, 4, 3114 }, { 155, 11, 4, 3118 }, { 1, 12, 4, 3122 }, { 10, 12, 4, 3126 }, { 18, 12, 4, 3130 },
+			{ 26, 12, 3, 3134 }, { 34, 12, 13, 3137 }, { 50, 12, 4, 3150 }, { 62, 12, 4, 3154 }, { 70, 12, 4, 3158 }, { 78, 12, 4, 3162 },
+			{ 84, 12, 13, 3166 }, { 99, 12, 4, 3179 }, { 108, 12, 4, 3183 }, { 116, 12, 4, 3187 }, { 127, 12, 7, 3191 }, { 138, 12, 4, 3198 },
+			{ 146, 12, 13, 3202 }, { 1, 13, 4, 3215 }, { 10, 13, 4, 3219 }, { 18, 13, 4, 3223 }, { 26, 13, 3, 3227 }, { 34, 13, 13, 3230 },
+			{ 50, 13, 4, 3243 }, { 62, 13, 4, 3247 }, { 70, 13, 4, 3251 }, { 78, 13, 4, 3255 }, { 84, 13, 13, 3259 }, { 99, 13, 4, 3272 },
+			{ 108, 13, 4, 3276 }, { 116, 13, 4, 3280 }, { 125, 13, 9, 3284 }, { 138, 13, 4, 3293 }, { 146, 13, 13, 3297 }, { 1, 14, 4, 3310 },
+			{ 10, 14, 4, 3314 }, { 18, 14, 4, 3318 }, { 26, 14, 3, 3322 }, { 34, 14, 4, 3325 }, { 50, 14, 4, 3329 }, { 62, 14, 4, 3333 },
+			{ 70, 14, 4, 3337 }, { 78, 14, 4, 3341 }, { 84, 14, 4, 3345 }, { 99, 14, 4, 3349 }, { 108, 14, 4, 3353 }, { 116, 14, 4, 3357 },
+			{ 124, 14, 5, 3361 }, { 131, 14, 3, 3366 }, { 138, 14, 4, 3369 }, { 146, 14, 4, 3373 }, { 1, 15, 4, 3377 }, { 10, 15, 4, 3381 },
+			{ 18, 15, 4, 3385 }, { 26, 15, 3, 3389 }, { 34, 15, 5, 3392 }, { 50, 15, 4, 3397 }, { 62, 15, 4, 3401 }, { 70, 15, 4, 3405 },
+			{ 78, 15, 4, 3409 }, { 84, 15, 4, 3413 }, { 99, 15, 4, 3417 }, { 108, 15, 4, 3421 }, { 116, 15, 4, 3425 }, { 123, 15, 3, 3429 },
+			{ 131, 15, 3, 3432 }, { 138, 15, 4, 3435 }, { 146, 15, 5, 3439 }, { 1, 16, 4, 3444 }, { 10, 16, 4, 3448 }, { 18, 16, 4, 3452 },
+			{ 26, 16, 3, 3456 }, { 35, 16, 4, 3459 }, { 50, 16, 4, 3463 }, { 62, 16, 4, 3467 }, { 70, 16, 4, 3471 }, { 78, 16, 4, 3475 },
+			{ 85, 16, 4, 3479 }, { 99, 16, 4, 3483 }, { 108, 16, 4, 3487 }, { 116, 16, 4, 3491 }, { 123, 16, 3, 3495 }, { 131, 16, 3, 3498 },
+			{ 138, 16, 4, 3501 }, { 147, 16, 4, 3505 }, { 1, 17, 4, 3509 }, { 10, 17, 4, 3513 }, { 18, 17, 4, 3517 }, { 26, 17, 3, 3521 },
+			{ 35, 17, 4, 3524 }, { 45, 17, 1, 3528 }, { 50, 17, 4, 3529 }, { 62, 17, 4, 3533 }, { 70, 17, 4, 3537 }, { 78, 17, 4, 3541 },
+			{ 85, 17, 4, 3545 }, { 95, 17, 1, 3549 }, { 99, 17, 4, 3550 }, { 108, 17, 4, 3554 }, { 116, 17, 4, 3558 }, { 123, 17, 3, 3562 },
+			{ 130, 17, 4, 3565 }, { 138, 17, 4, 3569 }, { 147, 17, 4, 3573 }, { 157, 17, 1, 3577 }, { 1, 18, 4, 3578 }, { 10, 18, 4, 3582 },
+			{ 18, 18, 4, 3586 }, { 26, 18, 4, 3590 }, { 32, 18, 2, 3594 }, { 36, 18, 4, 3596 }, { 43, 18, 4, 3600 }, { 50, 18, 4, 3604 },
+			{ 62, 18, 4, 3608 }, { 70, 18, 4, 3612 }, { 78, 18, 4, 3616 }, { 85, 18, 5, 3620 }, { 93, 18, 4, 3625 }, { 100, 18, 4, 3629 },
+			{ 106, 18, 6, 3633 }, { 116, 18, 4, 3639 }, { 123, 18, 4, 3643 }, { 129, 18, 5, 3647 }, { 139, 18, 4, 3652 }, { 144, 18, 3, 3656 },
+			{ 148, 18, 4, 3659 }, { 155, 18, 4, 3663 }, { 1, 19, 4, 3667 }, { 9, 19, 5, 3671 }, { 18, 19, 4, 3676 }, { 26, 19, 8, 3680 },
+			{ 36, 19, 10, 3688 }, { 50, 19, 4, 3698 }, { 62, 19, 4, 3702 }, { 70, 19, 4, 3706 }, { 78, 19, 4, 3710 }, { 86, 19, 10, 3714 },
+			{ 101, 19, 7, 3724 }, { 109, 19, 3, 3731 }, { 116, 19, 4, 3734 }, { 123, 19, 11, 3738 }, { 139, 19, 8, 3749 }, { 148, 19, 10, 3757 },
+			{ 0, 20, 7, 3767 }, { 8, 20, 7, 3774 }, { 16, 20, 7, 3781 }, { 27, 20, 6, 3788 }, { 37, 20, 8, 3794 }, { 48, 20, 7, 3802 },
+			{ 61, 20, 6, 3809 }, { 69, 20, 6, 3815 }, { 77, 20, 6, 3821 }, { 87, 20, 7, 3827 }, { 101, 20, 6, 3834 }, { 109, 20, 5, 3840 },
+			{ 115, 20, 6, 3845 }, { 124, 20, 6, 3851 }, { 131, 20, 5, 3857 }, { 140, 20, 5, 3862 }, { 149, 20, 8, 3867 }, { 0, 0, 14, 3875 },
+			{ 1, 1, 13, 3889 }, { 1, 2, 4, 3902 }, { 11, 2, 3, 3906 }, { 75, 2, 3, 3909 }, { 1, 3, 4, 3912 }, { 11, 3, 3, 3916 },
+			{ 75, 3, 3, 3919 }, { 1, 4, 4, 3922 }, { 11, 4, 3, 3926 }, { 74, 4, 4, 3929 }, { 1, 5, 4, 3933 }, { 74, 5, 4, 3937 },
+			{ 1, 6, 4, 3941 }, { 9, 6, 2, 3945 }, { 15, 6, 7, 3947 }, { 24, 6, 11, 3954 }, { 36, 6, 6, 3965 }, { 50, 6, 7, 3971 },
+			{ 61, 6, 5, 3978 }, { 67, 6, 15, 3983 }, { 1, 7, 4, 3998 }, { 9, 7, 2, 4002 }, { 17, 7, 4, 4004 }, { 25, 7, 3, 4008 },
+			{ 31, 7, 12, 4011 }, { 49, 7, 9, 4023 }, { 62, 7, 20, 4032 }, { 1, 8, 4, 4052 }, { 8, 8, 3, 4056 }, { 17, 8, 4, 4059 },
+			{ 24, 8, 3, 4063 }, { 31, 8, 6, 4066 }, { 39, 8, 5, 4072 }, { 48, 8, 3, 4077 }, { 55, 8, 3, 4080 }, { 62, 8, 5, 4083 },
+			{ 69, 8, 3, 4088 }, { 74, 8, 4, 4091 }, { 1, 9, 10, 4095 }, { 18, 9, 4, 4105 }, { 24, 9, 3, 4109 }, { 31, 9, 5, 4112 },
+			{ 40, 9, 4, 4117 }, { 47, 9, 4, 4121 }, { 55, 9, 4, 4125 }, { 62, 9, 4, 4129 }, { 69, 9, 3, 4133 }, { 74, 9, 4, 4136 },
+			{ 1, 10, 10, 4140 }, { 19, 10, 3, 4150 }, { 23, 10, 3, 4153 }, { 31, 10, 4, 4156 }, { 41, 10, 3, 4160 }, { 47, 10, 4, 4163 },
+			{ 55, 10, 4, 4167 }, { 62, 10, 4, 4171 }, { 74, 10, 4, 4175 }, { 1, 11, 4, 4179 }, { 8, 11, 3, 4183 }, { 19, 11, 6, 4186 },
+			{ 31, 11, 4, 4192 }, { 41, 11, 4, 4196 }, { 47, 11, 3, 4200 }, { 56, 11, 3, 4203 }, { 62, 11, 4, 4206 }, { 74, 11, 4, 4210 },
+			{ 1, 12, 4, 4214 }, { 9, 12, 2, 4218 }, { 20, 12, 4, 4220 }, { 31, 12, 4, 4224 }, { 41, 12, 4, 4228 }, { 46, 12, 14, 4232 },
+			{ 62, 12, 4, 4246 }, { 74, 12, 4, 4250 }, { 1, 13, 4, 4254 }, { 20, 13, 4, 4258 }, { 31, 13, 4, 4262 }, { 41, 13, 4, 4266 },
+			{ 46, 13, 13, 4270 }, { 62, 13, 4, 4283 }, { 74, 13, 4, 4287 }, { 1, 14, 4, 4291 }, { 20, 14, 5, 4295 }, { 31, 14, 4, 4300 },
+			{ 41, 14, 4, 4304 }, { 46, 14, 4, 4308 }, { 62, 14, 4, 4312 }, { 74, 14, 4, 4316 }, { 1, 15, 4, 4320 }, { 11, 15, 3, 4324 },
+			{ 19, 15, 7, 4327 }, { 31, 15, 4, 4334 }, { 41, 15, 3, 4338 }, { 47, 15, 4, 4341 }, { 62, 15, 4, 4345 }, { 74, 15, 4, 4349 },
+			{ 1, 16, 4, 4353 }, { 11, 16, 3, 4357 }, { 18, 16, 3, 4360 }, { 23, 16, 4, 4363 }, { 31, 16, 4, 4367 }, { 41, 16, 3, 4371 },
+			{ 47, 16, 4, 4374 }, { 57, 16, 1, 4378 }, { 62, 16, 4, 4379 }, { 74, 16, 4, 4383 }, { 1, 17, 4, 4387 }, { 11, 17, 3, 4391 },
+			{ 17, 17, 3, 4394 }, { 23, 17, 4, 4397 }, { 31, 17, 4, 4401 }, { 40, 17, 4, 4405 }, { 47, 17, 4, 4409 }, { 56, 17, 3, 4413 },
+			{ 62, 17, 4, 4416 }, { 74, 17, 4, 4420 }, { 81, 17, 1, 4424 }, { 1, 18, 4, 4425 }, { 10, 18, 4, 4429 }, { 17, 18, 3, 4433 },
+			{ 24, 18, 4, 4436 }, { 31, 18, 6, 4440 }, { 39, 18, 4, 4446 }, { 48, 18, 10, 4450 }, { 62, 18, 4, 4460 }, { 75, 18, 7, 4464 },
+			{ 0, 19, 14, 4471 }, { 15, 19, 6, 4485 }, { 23, 19, 7, 4491 }, { 31, 19, 11, 4498 }, { 49, 19, 8, 4509 }, { 61, 19, 6, 4517 },
+			{ 75, 19, 7, 4523 }, { 0, 20, 14, 4530 }, { 15, 20, 6, 4544 }, { 23, 20, 7, 4550 }, { 31, 20, 10, 4557 }, { 50, 20, 6, 4567 },
+			{ 61, 20, 7, 4573 }, { 76, 20, 4, 4580 }, { 31, 21, 4, 4584 }, { 31, 22, 4, 4588 }, { 31, 23, 4, 4592 }, { 31, 24, 4, 4596 },
+			{ 31, 25, 5, 4600 }, { 30, 26, 7, 4605 }, { 1, 0, 15, 4612 }, { 49, 0, 6, 4627 }, { 0, 1, 18, 4633 }, { 47, 1, 8, 4651 },
+			{ 0, 2, 19, 4659 }, { 47, 2, 9, 4678 }, { 0, 3, 19, 4687 }, { 47, 3, 9, 4706 }, { 0, 4, 19, 4715 }, { 47, 4, 9, 4734 },
+			{ 0, 5, 20, 4743 }, { 24, 5, 4, 4763 }, { 37, 5, 24, 4767 }, { 63, 5, 4, 4791 }, { 72, 5, 5, 4795 }, { 78, 5, 4, 4800 },
+			{ 92, 5, 5, 4804 }, { 101, 5, 1, 4809 }, { 103, 5, 5, 4810 }, { 109, 5, 4, 4815 }, { 0, 6, 20, 4819 }, { 21, 6, 10, 4839 },
+			{ 34, 6, 51, 4849 }, { 89, 6, 26, 4900 }, { 0, 7, 86, 4926 }, { 88, 7, 28, 5012 }, { 0, 8, 116, 5040 }, { 0, 9, 116, 5156 },
+			{ 0, 10, 116, 5272 }, { 0, 11, 116, 5388 }, { 0, 12, 116, 5504 }, { 0, 13, 116, 5620 }, { 0, 14, 115, 5736 }, { 0, 15, 111, 5851 },
+			{ 0, 16, 110, 5962 }, { 0, 17, 111, 6072 }, { 0, 18, 111, 6183 }, { 0, 19, 111, 6294 }, { 0, 20, 111, 6405 }, { 0, 21, 111, 6516 },
+			{ 0, 22, 111, 6627 }, { 0, 23, 18, 6738 }, { 19, 23, 92, 6756 }, { 0, 24, 17, 6848 }, { 20, 24, 91, 6865 }, { 1, 25, 14, 6956 },
+			{ 22, 25, 7, 6970 }, { 30, 25, 58, 6977 }, { 90, 25, 8, 7035 }, { 101, 25, 9, 7043 }, { 30, 26, 19, 7052 }, { 30, 27, 19, 7071 },
+			{ 31, 28, 17, 7090 }, { 31, 29, 17, 7107 }, { 32, 30, 15, 7124 }, { 33, 31, 12, 7139 }, { 1, 0, 8, 7151 }, { 108, 0, 8, 7159 },
+			{ 0, 1, 10, 7167 }, { 107, 1, 17, 7177 }, { 0, 2, 11, 7194 }, { 106, 2, 19, 7205 }, { 0, 3, 11, 7224 }, { 27, 3, 7, 7235 },
+			{ 107, 3, 18, 7242 }, { 140, 3, 7, 7260 }, { 0, 4, 11, 7267 }, { 26, 4, 8, 7278 }, { 107, 4, 18, 7286 }, { 139, 4, 8, 7304 },
+			{ 0, 5, 11, 7312 }, { 26, 5, 9, 7323 }, { 108, 5, 17, 7332 }, { 139, 5, 8, 7349 }, { 0, 6, 23, 7357 }, { 25, 6, 13, 7380 },
+			{ 40, 6, 7, 7393 }, { 49, 6, 27, 7400 }, { 77, 6, 7, 7427 }, { 90, 6, 7, 7434 }, { 105, 6, 20, 7441 }, { 128, 6, 8, 7461 },
+			{ 138, 6, 13, 7469 }, { 152, 6, 7, 7482 }, { 0, 7, 85, 7489 }, { 88, 7, 11, 7574 }, { 103, 7, 58, 7585 }, { 0, 8, 86, 7643 },
+			{ 87, 8, 14, 7729 }, { 102, 8, 61, 7743 }, { 0, 9, 163, 7804 }, { 0, 10, 164, 7967 }, { 0, 11, 164, 8131 }, { 0, 12, 164, 8295 },
+			{ 0, 13, 164, 8459 }, { 0, 14, 164, 8623 }, { 0, 15, 164, 8787 }, { 0, 16, 59, 8951 }, { 62, 16, 102, 9010 }, { 0, 17, 59, 9112 },
+			{ 62, 17, 102, 9171 }, { 0, 18, 59, 9273 }, { 62, 18, 102, 9332 }, { 0, 19, 59, 9434 }, { 62, 19, 102, 9493 }, { 0, 20, 59, 9595 },
+			{ 61, 20, 103, 9654 }, { 0, 21, 60, 9757 }, { 61, 21, 103, 9817 }, { 0, 22, 60, 9920 }, { 61, 22, 103, 9980 }, { 0, 23, 60, 10083 },
+			{ 61, 23, 102, 10143 }, { 0, 24, 60, 10245 }, { 61, 24, 102, 10305 }, { 0, 25, 60, 10407 }, { 61, 25, 39, 10467 }, { 101, 25, 61, 10506 },
+			{ 1, 26, 26, 10567 }, { 28, 26, 8, 10593 }, { 39, 26, 9, 10601 }, { 49, 26, 10, 10610 }, { 61, 26, 37, 10620 }, { 102, 26, 38, 10657 },
+			{ 141, 26, 8, 10695 }, { 151, 26, 10, 10703 }, { 1, 0, 17, 10713 }, { 0, 1, 19, 10730 }, { 0, 2, 19, 10749 }, { 75, 2, 6, 10768 },
+			{ 0, 3, 19, 10774 }, { 74, 3, 8, 10793 }, { 0, 4, 19, 10801 }, { 74, 4, 8, 10820 }, { 0, 5, 37, 10828 }, { 39, 5, 4, 10865 },
+			{ 53, 5, 5, 10869 }, { 63, 5, 5, 10874 }, { 69, 5, 15, 10879 }, { 0, 6, 46, 10894 }, { 50, 6, 36, 10940 }, { 0, 7, 47, 10976 },
+			{ 49, 7, 37, 11023 }, { 0, 8, 86, 11060 }, { 0, 9, 86, 11146 }, { 0, 10, 86, 11232 }, { 0, 11, 86, 11318 }, { 0, 12, 85, 11404 },
+			{ 0, 13, 16, 11489 }, { 17, 13, 66, 11505 }, { 0, 14, 82, 11571 }, { 0, 15, 71, 11653 }, { 73, 15, 9, 11724 }, { 0, 16, 70, 11733 },
+			{ 73, 16, 9, 11803 }, { 0, 17, 70, 11812 }, { 73, 17, 13, 11882 }, { 0, 18, 71, 11895 }, { 73, 18, 13, 11966 }, { 0, 19, 71, 11979 },
+			{ 73, 19, 13, 12050 }, { 0, 20, 71, 12063 }, { 73, 20, 13, 12134 }, { 0, 21, 71, 12147 }, { 73, 21, 13, 12218 }, { 0, 22, 71, 12231 },
+			{ 74, 22, 12, 12302 }, { 0, 23, 47, 12314 }, { 48, 23, 23, 12361 }, { 74, 23, 12, 12384 }, { 0, 24, 46, 12396 }, { 49, 24, 22, 12442 },
+			{ 75, 24, 10, 12464 }, { 1, 25, 43, 12474 }, { 51, 25, 8, 12517 }, { 61, 25, 9, 12525 }, { 77, 25, 6, 12534 }, { 30, 26, 11, 12540 },
+			{ 30, 27, 11, 12551 }, { 30, 28, 11, 12562 }, { 30, 29, 11, 12573 }, { 30, 30, 11, 12584 }, { 30, 31, 11, 12595 }, { 7, 0, 20, 12606 },
+			{ 139, 0, 18, 12626 }, { 236, 0, 8, 12644 }, { 6, 1, 22, 12652 }, { 138, 1, 19, 12674 }, { 158, 1, 1, 12693 }, { 235, 1, 9, 12694 },
+			{ 4, 2, 24, 12703 }, { 137, 2, 22, 12727 }, { 234, 2, 10, 12749 }, { 4, 3, 24, 12759 }, { 136, 3, 23, 12783 }, { 234, 3, 10, 12806 },
+			{ 2, 4, 26, 12816 }, { 135, 4, 26, 12842 }, { 234, 4, 10, 12868 }, { 2, 5, 26, 12878 }, { 134, 5, 26, 12904 }, { 236, 5, 8, 12930 },
+			{ 1, 6, 13, 12938 }, { 19, 6, 9, 12951 }, { 133, 6, 28, 12960 }, { 235, 6, 9, 12988 }, { 1, 7, 11, 12997 }, { 19, 7, 9, 13008 },
+			{ 133, 7, 29, 13017 }, { 235, 7, 9, 13046 }, { 0, 8, 12, 13055 }, { 20, 8, 8, 13067 }, { 40, 8, 1, 13075 }, { 43, 8, 1, 13076 },
+			{ 45, 8, 1, 13077 }, { 60, 8, 1, 13078 }, { 62, 8, 1, 13079 }, { 70, 8, 1, 13080 }, { 72, 8, 1, 13081 }, { 85, 8, 1, 13082 },
+			{ 105, 8, 1, 13083 }, { 108, 8, 1, 13084 }, { 113, 8, 1, 13085 }, { 133, 8, 29, 13086 }, { 165, 8, 2, 13115 }, { 170, 8, 1, 13117 },
+			{ 175, 8, 1, 13118 }, { 180, 8, 5, 13119 }, { 186, 8, 3, 13124 }, { 199, 8, 1, 13127 }, { 201, 8, 1, 13128 }, { 203, 8, 1, 13129 },
+			{ 205, 8, 1, 13130 }, { 215, 8, 1, 13131 }, { 218, 8, 3, 13132 }, { 228, 8, 2, 13135 }, { 231, 8, 2, 13137 }, { 235, 8, 9, 13139 },
+			{ 0, 9, 11, 13148 }, { 20, 9, 8, 13159 }, { 36, 9, 12, 13167 }, { 49, 9, 1, 13179 }, { 55, 9, 9, 13180 }, { 66, 9, 9, 13189 },
+			{ 80, 9, 9, 13198 }, { 104, 9, 10, 13207 }, { 132, 9, 45, 13217 }, { 179, 9, 13, 13262 }, { 196, 9, 10, 13275 }, { 212, 9, 11, 13285 },
+			{ 225, 9, 8, 13296 }, { 236, 9, 8, 13304 }, { 0, 10, 11, 13312 }, { 21, 10, 5, 13323 }, { 34, 10, 17, 13328 }, { 54, 10, 23, 13345 },
+			{ 78, 10, 12, 13368 }, { 101, 10, 16, 13380 }, { 132, 10, 45, 13396 }, { 178, 10, 14, 13441 }, { 194, 10, 14, 13455 }, { 212, 10, 22, 13469 },
+			{ 236, 10, 8, 13491 }, { 0, 11, 11, 13499 }, { 23, 11, 1, 13510 }, { 32, 11, 19, 13511 }, { 54, 11, 37, 13530 }, { 101, 11, 16, 13567 },
+			{ 132, 11, 45, 13583 }, { 178, 11, 32, 13628 }, { 211, 11, 23, 13660 }, { 236, 11, 8, 13683 }, { 0, 12, 10, 13691 }, { 31, 12, 21, 13701 },
+			{ 54, 12, 39, 13722 }, { 99, 12, 19, 13761 }, { 132, 12, 103, 13780 }, { 236, 12, 8, 13883 }, { 0, 13, 10, 13891 }, { 31, 13, 21, 13901 },
+			{ 55, 13, 38, 13922 }, { 99, 13, 20, 13960 }, { 132, 13, 103, 13980 }, { 236, 13, 8, 14083 }, { 0, 14, 10, 14091 }, { 30, 14, 22, 14101 },
+			{ 56, 14, 37, 14123 }, { 98, 14, 22, 14160 }, { 132, 14, 80, 14182 }, { 214, 14, 20, 14262 }, { 236, 14, 8, 14282 }, { 0, 15, 10, 14290 },
+			{ 31, 15, 22, 14300 }, { 57, 15, 37, 14322 }, { 98, 15, 22, 14359 }, { 131, 15, 81, 14381 }, { 214, 15, 20, 14462 }, { 236, 15, 8, 14482 },
+			{ 0, 16, 10, 14490 }, { 31, 16, 22, 14500 }, { 57, 16, 36, 14522 }, { 97, 16, 23, 14558 }, { 132, 16, 31, 14581 }, { 165, 16, 47, 14612 },
+			{ 215, 16, 19, 14659 }, { 236, 16, 8, 14678 }, { 0, 17, 9, 14686 }, { 18, 17, 3, 14695 }, { 22, 17, 1, 14698 }, { 24, 17, 1, 14699 },
+			{ 27, 17, 1, 14700 }, { 31, 17, 22, 14701 }, { 57, 17, 36, 14723 }, { 97, 17, 24, 14759 }, { 131, 17, 32, 14783 }, { 166, 17, 46, 14815 },
+			{ 215, 17, 19, 14861 }, { 236, 17, 8, 14880 }, { 0, 18, 9, 14888 }, { 16, 18, 13, 14897 }, { 33, 18, 20, 14910 }, { 57, 18, 36, 14930 },
+			{ 96, 18, 25, 14966 }, { 131, 18, 33, 14991 }, { 165, 18, 48, 15024 }, { 215, 18, 10, 15072 }, { 227, 18, 6, 15082 }, { 236, 18, 8, 15088 },
+			{ 0, 19, 9, 15096 }, { 16, 19, 14, 15105 }, { 38, 19, 15, 15119 }, { 57, 19, 37, 15134 }, { 96, 19, 25, 15171 }, { 131, 19, 32, 15196 },
+			{ 167, 19, 20, 15228 }, { 188, 19, 25, 15248 }, { 214, 19, 10, 15273 }, { 235, 19, 9, 15283 }, { 0, 20, 10, 15292 }, { 16, 20, 14, 15302 },
+			{ 36, 20, 17, 15316 }, { 57, 20, 37, 15333 }, { 96, 20, 25, 15370 }, { 132, 20, 31, 15395 }, { 166, 20, 21, 15426 }, { 188, 20, 25, 15447 },
+			{ 215, 20, 9, 15472 }, { 236, 20, 8, 15481 }, { 0, 21, 10, 15489 }, { 15, 21, 15, 15499 }, { 33, 21, 20, 15514 }, { 56, 21, 38, 15534 },
+			{ 96, 21, 25, 15572 }, { 132, 21, 31, 15597 }, { 167, 21, 19, 15628 }, { 188, 21, 25, 15647 }, { 214, 21, 10, 15672 }, { 236, 21, 8, 15682 },
+			{ 0, 22, 11, 15690 }, { 16, 22, 13, 15701 }, { 32, 22, 21, 15714 }, { 57, 22, 36, 15735 }, { 96, 22, 25, 15771 }, { 132, 22, 31, 15796 },
+			{ 167, 22, 18, 15827 }, { 188, 22, 25, 15845 }, { 214, 22, 10, 15870 }, { 236, 22, 8, 15880 }, { 0, 23, 10, 15888 }, { 17, 23, 12, 15898 },
+			{ 31, 23, 22, 15910 }, { 56, 23, 38, 15932 }, { 96, 23, 24, 15970 }, { 131, 23, 32, 15994 }, { 168, 23, 17, 16026 }, { 188, 23, 25, 16043 },
+			{ 215, 23, 9, 16068 }, { 236, 23, 8, 16077 }, { 0, 24, 11, 16085 }, { 18, 24, 10, 16096 }, { 30, 24, 23, 16106 }, { 57, 24, 37, 16129 },
+			{ 96, 24, 24, 16166 }, { 132, 24, 30, 16190 }, { 168, 24, 17, 16220 }, { 187, 24, 25, 16237 }, { 215, 24, 9, 16262 }, { 237, 24, 7, 16271 },
+			{ 0, 25, 10, 16278 }, { 18, 25, 10, 16288 }, { 30, 25, 23, 16298 }, { 57, 25, 36, 16321 }, { 96, 25, 10, 16357 }, { 132, 25, 31, 16367 },
+			{ 168, 25, 17, 16398 }, { 188, 25, 11, 16415 }, { 200, 25, 1, 16426 }, { 215, 25, 9, 16427 }, { 238, 25, 6, 16436 }, { 0, 26, 11, 16442 },
+			{ 18, 26, 10, 16453 }, { 30, 26, 23, 16463 }, { 57, 26, 36, 16486 }, { 97, 26, 9, 16522 }, { 132, 26, 30, 16531 }, { 169, 26, 15, 16561 },
+			{ 188, 26, 10, 16576 }, { 207, 26, 1, 16586 }, { 209, 26, 1, 16587 }, { 215, 26, 9, 16588 }, { 236, 26, 1, 16597 }, { 238, 26, 6, 16598 },
+			{ 1, 27, 10, 16604 }, { 18, 27, 10, 16614 }, { 30, 27, 23, 16624 }, { 57, 27, 36, 16647 }, { 96, 27, 11, 16683 }, { 114, 27, 4, 16694 },
+			{ 133, 27, 28, 16698 }, { 169, 27, 14, 16726 }, { 188, 27, 11, 16740 }, { 206, 27, 4, 16751 }, { 215, 27, 9, 16755 }, { 236, 27, 8, 16764 },
+			{ 1, 28, 11, 16772 }, { 18, 28, 10, 16783 }, { 29, 28, 24, 16793 }, { 57, 28, 36, 16817 }, { 97, 28, 11, 16853 }, { 113, 28, 6, 16864 },
+			{ 133, 28, 28, 16870 }, { 170, 28, 13, 16898 }, { 189, 28, 11, 16911 }, { 204, 28, 7, 16922 }, { 215, 28, 9, 16929 }, { 235, 28, 9, 16938 },
+			{ 2, 29, 11, 16947 }, { 18, 29, 10, 16958 }, { 29, 29, 24, 16968 }, { 57, 29, 37, 16992 }, { 97, 29, 22, 17029 }, { 133, 29, 28, 17051 },
+			{ 170, 29, 13, 17079 }, { 189, 29, 23, 17092 }, { 214, 29, 10, 17115 }, { 235, 29, 9, 17125 }, { 2, 30, 26, 17134 }, { 30, 30, 23, 17160 },
+			{ 57, 30, 37, 17183 }, { 98, 30, 22, 17220 }, { 134, 30, 26, 17242 }, { 170, 30, 12, 17268 }, { 189, 30, 23, 17280 }, { 214, 30, 10, 17303 },
+			{ 235, 30, 9, 17313 }, { 2, 31, 26, 17322 }, { 30, 31, 23, 17348 }, { 56, 31, 39, 17371 }, { 98, 31, 21, 17410 }, { 135, 31, 24, 17431 },
+			{ 171, 31, 10, 17455 }, { 190, 31, 22, 17465 }, { 214, 31, 10, 17487 }, { 235, 31, 9, 17497 }, { 3, 32, 25, 17506 }, { 30, 32, 24, 17531 },
+			{ 55, 32, 40, 17555 }, { 99, 32, 20, 17595 }, { 135, 32, 24, 17615 }, { 171, 32, 10, 17639 }, { 191, 32, 21, 17649 }, { 213, 32, 13, 17670 },
+			{ 235, 32, 9, 17683 }, { 4, 33, 24, 17692 }, { 31, 33, 65, 17716 }, { 99, 33, 19, 17781 }, { 137, 33, 20, 17800 }, { 171, 33, 9, 17820 },
+			{ 191, 33, 19, 17829 }, { 213, 33, 14, 17848 }, { 235, 33, 9, 17862 }, { 6, 34, 22, 17871 }, { 31, 34, 65, 17893 }, { 101, 34, 16, 17958 },
+			{ 138, 34, 18, 17974 }, { 172, 34, 8, 17992 }, { 192, 34, 17, 18000 }, { 212, 34, 15, 18017 }, { 235, 34, 9, 18032 }, { 7, 35, 20, 18041 },
+			{ 33, 35, 62, 18061 }, { 102, 35, 13, 18123 }, { 140, 35, 15, 18136 }, { 172, 35, 8, 18151 }, { 194, 35, 13, 18159 }, { 213, 35, 13, 18172 },
+			{ 236, 35, 8, 18185 }, { 9, 36, 17, 18193 }, { 34, 36, 61, 18210 }, { 104, 36, 9, 18271 }, { 142, 36, 11, 18280 }, { 174, 36, 4, 18291 },
+			{ 196, 36, 10, 18295 }, { 213, 36, 12, 18305 }, { 237, 36, 7, 18317 }, { 0, 0, 352, 18324 }, { 0, 1, 352, 18676 }, { 0, 2, 352, 19028 },
+			{ 0, 3, 352, 19380 }, { 0, 4, 352, 19732 }, { 0, 5, 352, 20084 }, { 0, 6, 352, 20436 }, { 0, 7, 352, 20788 }, { 0, 8, 352, 21140 },
+			{ 0, 9, 352, 21492 }, { 0, 10, 352, 21844 }, { 0, 11, 352, 22196 }, { 0, 12, 352, 22548 }, { 0, 13, 352, 22900 }, { 0, 14, 352, 23252 },
+			{ 0, 15, 352, 23604 }, { 0, 16, 352, 23956 }, { 0, 17, 352, 24308 }, { 0, 18, 352, 24660 }, { 0, 19, 352, 25012 }, { 0, 20, 352, 25364 },
+			{ 0, 21, 352, 25716 }, { 0, 22, 352, 26068 }, { 0, 23, 352, 26420 }, { 0, 24, 352, 26772 }, { 0, 25, 352, 27124 }, { 0, 26, 352, 27476 },
+			{ 0, 27, 352, 27828 }, { 0, 28, 352, 28180 }, { 0, 29, 352, 28532 }, { 0, 30, 352, 28884 }, { 0, 31, 352, 29236 }, { 0, 32, 352, 29588 },
+			{ 0, 33, 352, 29940 }, { 0, 34, 352, 30292 }, { 0, 35, 352, 30644 }, { 0, 36, 352, 30996 }, { 0, 37, 352, 31348 }, { 0, 38, 352, 31700 },
+			{ 0, 39, 352, 32052 }, { 0, 40, 352, 32404 }, { 0, 41, 352, 32756 }, { 0, 42, 352, 33108 }, { 0, 43, 352, 33460 }, { 0, 44, 352, 33812 },
+			{ 0, 45, 352, 34164 }, { 0, 46, 352, 34516 }, { 0, 47, 352, 34868 },
+		};
+
+		const Color pixels[] = {
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x0000FF, 0x0000FF, 0x808080, 0x0000FF, 0x0000FF, 0x0000FF, 0x808080, 0x0000FF, 0x0000FF, 0x0000FF,
+			0x0000FF, 0x808080, 0x0000FF, 0x0000FF, 0x0000FF, 0x0000FF, 0x0000FF, 0x808080, 0x0000FF, 0x0000FF,
+			0x0000FF, 0x808080, 0x0000FF, 0x0000FF, 0x0000FF, 0x808080, 0x0000FF, 0x0000FF, 0x0000FF, 0x808080,
+			0x0000FF, 0x0000FF, 0x0000FF, 0x808080, 0x0000FF, 0x0000FF, 0x0000FF, 0x0000FF, 0x0000FF, 0x0000FF,
+			0x0000FF, 0x808080, 0x0000FF, 0x0000FF, 0x0000FF, 0x0000FF, 0x0000FF, 0x0000FF, 0x0000FF, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x808080,
+			0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000,
+			0x808080, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x808080, 0x008000, 0x008000,
+			0x008000, 0x808080, 0x008000, 0x008000, 0x008000, 0x008000, 0x808080, 0x008000, 0x008000, 0x008000,
+			0x008000, 0x008000, 0x808080, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x808080, 0x008000,
+			0x008000, 0x008000, 0x008000, 0x808080, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000,
+			0x008000, 0x008000, 0x008000, 0x008000, 0x808080, 0x008000, 0x008000, 0x008000, 0x008000, 0x008000,
+			0x008000, 0x008000, 0x008000, 0x008000, 0x008000, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0xFF0000, 0xFF0000, 0xFF0000,
+			0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0x808080, 0xFF0000, 0xFF0000, 0xFF0000,
+			0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0x808080, 0xFF0000, 0xFF0000,
+			0xFF0000, 0x808080, 0xFF0000, 0xFF0000, 0xFF0000, 0x808080, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+			0xFF0000, 0xFF0000, 0x808080, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0x808080,
+			0xFF0000, 0xFF0000, 0xFF0000, 0x808080, 0xFF0000, 0xFF0000, 0xFF0000, 0x808080, 0xFF0000, 0xFF0000,
+			0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0x808080, 0xFF0000,
+			0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x808080, 0x000080, 0x000080, 0x000080,
+			0x000080, 0x000080, 0x000080, 0x808080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080,
+			0x808080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x808080, 0x000080, 0x000080,
+			0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x808080, 0x000080,
+			0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x000080, 0x808080,
+			0x000080, 0x000080, 0x000080, 0x808080, 0x000080, 0x000080, 0x000080, 0x808080, 0x000080, 0x000080,
+			0x000080, 0x808080, 0x000080, 0x000080, 0x000080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x800000, 0x800000, 0x800000,
+			0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x808080, 0x800000, 0x800000,
+			0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x808080, 0x800000,
+			0x800000, 0x800000, 0x808080, 0x800000, 0x800000, 0x800000, 0x808080, 0x800000, 0x800000, 0x800000,
+			0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x808080, 0x800000, 0x800000, 0x800000,
+			0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x808080, 0x800000, 0x800000,
+			0x800000, 0x808080, 0x800000, 0x800000, 0x800000, 0x808080, 0x800000, 0x800000, 0x800000, 0x800000,
+			0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x808080, 0x800000, 0x800000, 0x800000,
+			0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x800000, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x008080, 0x008080,
+			0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x808080, 0x008080, 0x008080, 0x008080,
+			0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x808080, 0x008080, 0x008080, 0x008080,
+			0x808080, 0x008080, 0x008080, 0x008080, 0x808080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080,
+			0x008080, 0x008080, 0x008080, 0x008080, 0x808080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080,
+			0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x808080, 0x008080, 0x008080, 0x008080, 0x008080,
+			0x008080, 0x008080, 0x808080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x808080,
+			0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080,
+			0x808080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x008080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+			0x000000, 0x808080, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+			0x000000, 0x000000, 0x808080, 0x000000, 0x000000, 0x000000, 0x808080, 0x000000, 0x000000, 0x000000,
+			0x808080, 0x000000, 0x000000, 0x000000, 0x808080, 0x000000, 0x000000, 0x000000, 0x808080, 0x000000,
+			0x000000, 0x000000, 0x808080, 0x000000, 0x000000, 0x000000, 0x808080, 0x000000, 0x000000, 0x000000,
+			0x808080, 0x000000, 0x000000, 0x000000, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x808080, 0x808080, 0xFFFFFF, 0xFFFFFF,
+			0x808080, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x808080, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x808080, 0x808080,
+			0xFFFFFF, 0xFFFFFF, 0x808080, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x808080, 0x808080, 0xFFFFFF, 0xFFFFFF,
+			0x808080, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x808080, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x808080, 0x808080,
+			0xFFFFFF, 0xFFFFFF, 0x808080, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x808080, 0x808080, 0xFFFFFF, 0xFFFFFF,
+			0x808080, 0x808080, 0xFFFFFF, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080, 0x808080,
+			0x808080, 0x808080, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+			0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+			0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+			0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+			0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+			0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+			0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+			0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+			0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0xC1C2C4, 0xC0BCBB, 0xE6D6D6,
+			0xE2CFCB, 0xFBEEE8, 0xF5F1E8, 0xBFC2B9, 0xBFC7BC, 0xBEC3BD, 0xBEC0BD, 0xBBBFC0, 0xBEC3C7, 0xBAC1C7,
+			0xBCC1C5, 0xBFBDBE, 0xC5C0BD, 0xBCBDBF, 0xCFCDCE, 0xD0C4C4, 0xF9EAE7, 0xF6EBE7, 0xF8F3ED, 0xF9FAF2,
+			0xBCBFB6, 0xBFC0BA, 0xC3C2BE, 0xC1C1C1, 0xBCC0C3, 0xB9C1C4, 0xBCC1C4, 0xC2C1BF, 0xC2BDBA, 0xBEC2C1,
+			0x909291, 0xC2BCBE, 0xDFD5D6, 0xEAE2DF, 0xE7E2DC, 0xE3E0D9, 0xF4F0E7, 0xC6BDB6, 0xCAC1BC, 0xBBB7B6,
+			0xBFBFC1, 0xC0C4C5, 0xBEC2C1, 0xBDBCBA, 0xC5C0BD, 0x777D7B, 0x787C7B, 0x979598, 0xABA7A8, 0xC8C4C1,
+			0xB4AFAB, 0xCCC7C3, 0xE4DBD6, 0xF8EBE3, 0xCABDB7, 0xCEC6C4, 0xC2C0C1, 0xBEC0BD, 0xBBBDBA, 0xCAC6C3,
+			0xC1BCB9, 0x4D5351, 0x515554, 0x707072, 0x9A9899, 0x868581, 0x9D9C97, 0x534D4D, 0xE4DCDA, 0xEDE0DA,
+			0xFAEDE7, 0xC4BAB9, 0xC3BFBE, 0xBFC0BB, 0xC3C4BE, 0xBFBBB8, 0xC7C1C1, 0x767A7B, 0x3A3E3F, 0x545559,
+			0x464749, 0x5C5E59, 0xA2A39D, 0x4D4747, 0xE5DBD9, 0xEBDAD0, 0xF2E2D5, 0xF7ECE6, 0xC4BFBB, 0xC1C2BC,
+			0xBEC1BA, 0xC2BEBD, 0xC5C1C2, 0x3F4044, 0x2F3035, 0x33363D, 0x4B5054, 0x191F1B, 0x3B403A, 0xB9B4B1,
+			0xCDBEB7, 0xF0DAC3, 0xEFD9C1, 0xF1E3D6, 0xF9F5EC, 0xB9BEB7, 0xBFC5C1, 0xBFBFC1, 0xC2C0C3, 0xC1BEC5,
+			0x44444C, 0x232730, 0x3C454A, 0x3D4947, 0x636965, 0x867F79, 0xC1AB9D, 0xCCAA85, 0xCBAA81, 0xC8B096,
+			0xFFF5E5, 0xF1F4E9, 0xB9C2BD, 0xBEC0BF, 0xC2C0C3, 0xC2BDC4, 0xC0BFC7, 0x626874, 0x25323B, 0x37494B,
+			0x58635F, 0x796F66, 0x806047, 0xB4824D, 0xCE9A60, 0xBA9368, 0xFFF2D6, 0xF8F7E5, 0xF3FBF0, 0xC2C4C1,
+			0xBFBFBF, 0xC5C0C6, 0xBFBEC4, 0xB8BFC9, 0x3C4952, 0x283B41, 0x3A4646, 0x554A46, 0x502E15, 0xB77F46,
+			0xF5B673, 0xC38C56, 0xFFE6BC, 0xFFF5D8, 0xF8F7E5, 0xF4F4EA, 0xC0C1BB, 0xC2BEBD, 0xC2C0C1, 0xBFC3C6,
+			0xBBC4C9, 0x27383F, 0x323F45, 0x353034, 0x311708, 0x774311, 0xE4A361, 0xF2B073, 0xCC955D, 0xF4D3A8,
+			0xFFF7D8, 0xFBF4E1, 0xF6F7E7, 0xC1BDBA, 0xC3C2BE, 0xBEBEBC, 0xBEC4C4, 0xB4C1C7, 0x212B34, 0x31313B,
+			0x271811, 0x502804, 0x854C15, 0xE5A367, 0xF7B980, 0xC69867, 0xFFE8C1, 0xFFF7DD, 0xF2F0DB, 0xC5C4C0,
+			0xBFBEBA, 0xC3C0BB, 0xC1C2BD, 0xB9BEC1, 0xB8BFC7, 0x222834, 0x333134, 0x3F2D19, 0x4D2905, 0x804A1B,
+			0xCB8F5D, 0xD8A475, 0xDFB992, 0xFFF7DB, 0xFEF8E2, 0xBFBFBD, 0xC0C1BC, 0xC0BFBB, 0xBEBDB9, 0xC4C4C6,
+			0xBFC2C7, 0xBAC1CB, 0x1B2024, 0x2A2720, 0x382713, 0x442000, 0x6D3D17, 0xA47450, 0xBD9677, 0xFFF9E1,
+			0xF8F0DB, 0xBFC0C2, 0xBABEBF, 0xC0C4C5, 0xBDBEC0, 0xC3C1C2, 0xC0BCBB, 0xBDBDBD, 0xC2C6C5, 0x2C3532,
+			0x25261E, 0x403225, 0x3D2312, 0x53301D, 0x8B6C5A, 0xFFF1E1, 0xFEF2E4, 0xBFC3C6, 0xBABFC2, 0xBCC1C5,
+			0xBEC2C5, 0xC4C0BF, 0xC4BFBC, 0xC5C2BD, 0xBABFB9, 0xB7C3C3, 0x283432, 0x383530, 0x5D4F46, 0x7F625A,
+			0xB09489, 0xF1DFD3, 0xEBDFD3, 0xCA2938, 0xAB323B, 0xFBD2D0, 0xD8D4C9, 0xF5EFDF, 0xFFE9D9, 0xAC3A30,
+			0xCF2929, 0xE61E2B, 0xEE1A28, 0xEB1C24, 0xEC1D23, 0xF11924, 0xF21A27, 0xE81A26, 0xE9202A, 0xB5313C,
+			0xFFB3B9, 0xE5BFBE, 0xF0E9DF, 0xFAF4E4, 0xFFEADB, 0xFFDFD6, 0xB83030, 0xD8242F, 0xE61C28, 0xE71C20,
+			0xEC1E22, 0xF01A24, 0xF21C28, 0xE81826, 0xE81A27, 0x914748, 0xB87E7D, 0xCEB2AF, 0xE5DCD3, 0xDCD9C8,
+			0xEEE5D4, 0xFBDAD5, 0xFFDBDD, 0xBF323A, 0xD9242B, 0xE82627, 0xE41819, 0xEE1D23, 0xF01C2A, 0xED182A,
+			0xEF1A30, 0x957372, 0x8D7170, 0xA59393, 0xB1A8A3, 0xCACBBD, 0xB0B0A4, 0xCBC3C1, 0xF9D2D5, 0xFFD1D5,
+			0xBA2E2F, 0xD42627, 0xE62424, 0xE91D20, 0xF01D26, 0xEC1827, 0xF0182D, 0x544B4E, 0x5C5356, 0x726C70,
+			0x9A9697, 0x83847E, 0xA09F9A, 0x584D51, 0xF0D5DC, 0xFFD6D9, 0xFFDFDF, 0xB72D2B, 0xD72523, 0xEA2020,
+			0xED181C, 0xEE1D23, 0xED1E26, 0x81787B, 0x464044, 0x56535C, 0x45464B, 0x626463, 0x9D9C98, 0x4E4347,
+			0xEBDBDC, 0xEDDAD4, 0xFFD1C9, 0xFFD9D1, 0xBE332E, 0xD92320, 0xE91F1F, 0xEB1F20, 0xEA1C20, 0x573533,
+			0x3D2427, 0x3C3642, 0x4B4D5A, 0x1B1C20, 0x41423D, 0xBAB7B0, 0xC6BEB1, 0xEEDEC5, 0xF5DABF, 0xFFD9C8,
+			0xFFDACF, 0xBD322B, 0xDB2927, 0xE61E20, 0xED1B1E, 0x9B433F, 0x732E31, 0x3B1F2E, 0x433F4E, 0x434449,
+			0x666664, 0x847B74, 0xC1B09C, 0xC7AB83, 0xC8AB7F, 0xC9B292, 0xFFECD7, 0xFFD7CE, 0xB9322F, 0xD72729,
+			0xE42024, 0xD32628, 0xBA3138, 0x934F5E, 0x3D2935, 0x424649, 0x5E605F, 0x7C6464, 0x895E4D, 0xB7834A,
+			0xCC9957, 0xBB9564, 0xFFF2D1, 0xFFE9DE, 0xFFE3E4, 0xB93135, 0xCE272E, 0xF11A21, 0xDA252C, 0xAE3844,
+			0x6D2F3A, 0x3E2F34, 0x444243, 0x64474B, 0x5A291A, 0xB77B3F, 0xF4B86F, 0xC19055, 0xFFE6BC, 0xFFF5E1,
+			0xFFEEE6, 0xFFD9D7, 0xAD3D3B, 0xF01A22, 0xE41B23, 0xD5242C, 0xB5363D, 0x562129, 0x48373F, 0x422B31,
+			0x2F0D01, 0x774512, 0xDFA661, 0xE6AF6F, 0xC69461, 0xF4D2AF, 0xFFF0DA, 0xFFEDD8, 0xFFEDD9, 0xEF1C25,
+			0xED1B24, 0xE91A22, 0xD32830, 0xA63C46, 0x4D111B, 0x4D2830, 0x391C16, 0x4D2A04, 0x80531C, 0xDFA46A,
+			0xF7BB85, 0xC8996F, 0xFFE3C1, 0xFFFDE1, 0xF3F7DC, 0xE81B22, 0xEB1D27, 0xEB1D29, 0xE11D29, 0xD2252B,
+			0xB8353B, 0x510B16, 0x46262B, 0x412C1B, 0x452808, 0x854F21, 0xC68656, 0xE0A57B, 0xE6BA95, 0xFFEFD4,
+			0xFEF8DE, 0xEB1C22, 0xE71923, 0xEB1C2C, 0xEA1C29, 0xED1F23, 0xD62628, 0xB03A46, 0x540E18, 0x442223,
+			0x3A2315, 0x4B1F02, 0x753F19, 0xA56D48, 0xC59976, 0xFFF4DC, 0xF9EEDA, 0xF01B21, 0xF32029, 0xE81826,
+			0xEC1C29, 0xEC1B1E, 0xE21F1D, 0xD5242A, 0xB52D37, 0x5E1823, 0x3F1C20, 0x42271C, 0x3B210A, 0x553317,
+			0x8B7053, 0xFFF2DF, 0xFEF6E9, 0xF0191E, 0xEF1921, 0xEF1C2B, 0xEA1A27, 0xEE1D20, 0xEC1C1A, 0xEA1C1E,
+			0xD12A32, 0x994151, 0x47212E, 0x463231, 0x5D5143, 0x7B654D, 0xAC987F, 0xEFE3D5, 0xE6DFD5, 0xD6D6D6,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xC3C3C3,
+			0x777777, 0x101010, 0x282828, 0x595959, 0x5A5A5A, 0x141414, 0xBABABA, 0xFFFFFF, 0xFFFFFF, 0x707070,
+			0x151515, 0x1F1F1F, 0x191919, 0x595959, 0xC0C0C0, 0xFFFFFF, 0xFFFFFF, 0xEFEFEF, 0x2B2B2B, 0x878787,
+			0xFFFFFF, 0xFFFFFF, 0x494949, 0x7F7F7F, 0xFFFFFF, 0xFFFFFF, 0x575757, 0x8F8F8F, 0xFFFFFF, 0xFFFFFF,
+			0xD8D8D8, 0x838383, 0xFFFFFF, 0xFFFFFF, 0x474747, 0x7F7F7F, 0xFFFFFF, 0xFFFFFF, 0x5B5B5B, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0x080808, 0x4E4E4E, 0xA9A9A9, 0xABABAB, 0x2A2A2A, 0x808080, 0xFFFFFF, 0xFFFFFF,
+			0x5B5B5B, 0xEFEFEF, 0xFFFFFF, 0xFFFFFF, 0x282828, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x5B5B5B, 0xF9F9F9,
+			0xFFFFFF, 0xFFFFFF, 0x080808, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x5B5B5B, 0x111111, 0xFFFFFF, 0xFFFFFF,
+			0xD1D1D1, 0x141414, 0x9E9E9E, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFBFBFB, 0x848484, 0x070707, 0x868686,
+			0xF6F6F6, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x797979,
+			0xF2F2F2, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x333333, 0xDDDDDD, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x464646,
+			0x676767, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xB9B9B9, 0x0C0C0C, 0x232323, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0x070707, 0x9F9F9F, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x858585, 0x434343, 0xE4E4E4, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xD0D0D0, 0x424242, 0x4E4E4E, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xDEDEDE, 0x292929,
+			0xC5C5C5, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x5B5B5B, 0xADADAD, 0xFFFFFF,
+			0xFDFDFD, 0x333333, 0x2C2C2C, 0xF9F9F9, 0xFFFFFF, 0x939393, 0x1D1D1D, 0x444444, 0xF6F6F6, 0xFFFFFF,
+			0xC4C4C4, 0x0D0D0D, 0xDFDFDF, 0xFFFFFF, 0xE2E2E2, 0x3F3F3F, 0x212121, 0x9A9A9A, 0xFFFFFF, 0xFFFFFF,
+			0xDCDCDC, 0x131313, 0x222222, 0x0B0B0B, 0xB9B9B9, 0xFFFFFF, 0xFFFFFF, 0x2B2B2B, 0x919191, 0xFFFFFF,
+			0xFFFFFF, 0x1C1C1C, 0xA7A7A7, 0xFFFFFF, 0xDFDFDF, 0xF4F4F4, 0xFFFFFF, 0xFFFFFF, 0xC7C7C7, 0xDADADA,
+			0xFFFFFF, 0xE0E0E0, 0x0A0A0A, 0xF1F1F1, 0xFCFCFC, 0xDEDEDE, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x7F7F7F,
+			0x8B8B8B, 0xFFFFFF, 0xEEEEEE, 0x575757, 0x0F0F0F, 0x9A9A9A, 0xFFFFFF, 0xFFFFFF, 0x565656, 0x242424,
+			0xF1F1F1, 0xFFFFFF, 0xA5A5A5, 0x505050, 0xFFFFFF, 0xE3E3E3, 0xFFFFFF, 0xFFFFFF, 0xF0F0F0, 0x808080,
+			0xFFFFFF, 0xFFFFFF, 0x484848, 0x4D4D4D, 0xB8B8B8, 0xFFFFFF, 0xF8F8F8, 0x3A3A3A, 0x0B0B0B, 0xF2F2F2,
+			0xFFFFFF, 0x7E7E7E, 0x393939, 0xFFFFFF, 0xFFFFFF, 0x6B6B6B, 0xA7A7A7, 0xFFFFFF, 0xF6F6F6, 0xB1B1B1,
+			0xFFFFFF, 0xFFFFFF, 0x424242, 0x595959, 0xFFFFFF, 0xFFFFFF, 0x2B2B2B, 0x2E2E2E, 0xFFFFFF, 0xFFFFFF,
+			0xC9C9C9, 0xE3E3E3, 0x1E1E1E, 0x171717, 0xD6D6D6, 0xFFFFFF, 0xFFFFFF, 0x222222, 0x8F8F8F, 0xFFFFFF,
+			0xEEEEEE, 0xEEEEEE, 0x999999, 0x010101, 0x3B3B3B, 0xFFFFFF, 0xFFFFFF, 0xFBFBFB, 0x6A6A6A, 0xFFFFFF,
+			0xFFFFFF, 0x0C0C0C, 0xAEAEAE, 0xFFFFFF, 0xFFFFFF, 0xCACACA, 0xFFFFFF, 0xDCDCDC, 0xF6F6F6, 0x4C4C4C,
+			0x5F5F5F, 0xFFFFFF, 0xFDFDFD, 0x808080, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xDEDEDE, 0x9E9E9E, 0xFFFFFF, 0xF2F2F2, 0xD8D8D8, 0xFFFFFF, 0xF0F0F0, 0xFFFFFF,
+			0xFFFFFF, 0xAAAAAA, 0x383838, 0xFFFFFF, 0xFFFFFF, 0x7C7C7C, 0x4C4C4C, 0xFFFFFF, 0xFFFFFF, 0x2B2B2B,
+			0x202020, 0xFFFFFF, 0xFFFFFF, 0xCCCCCC, 0x4F4F4F, 0xFFFFFF, 0xFFFFFF, 0x808080, 0x838383, 0xFFFFFF,
+			0xFFFFFF, 0x858585, 0xB7B7B7, 0xFFFFFF, 0xFFFFFF, 0x282828, 0x0D0D0D, 0xFBFBFB, 0xFFFFFF, 0x727272,
+			0x232323, 0xFFFFFF, 0xFFFFFF, 0x747474, 0xC3C3C3, 0xFFFFFF, 0xFFFFFF, 0x3C3C3C, 0x888888, 0x999999,
+			0x808080, 0xFFFFFF, 0xFFFFFF, 0x707070, 0x151515, 0x1F1F1F, 0x161616, 0x7F7F7F, 0xCECECE, 0xFFFFFF,
+			0xFAFAFA, 0x6E6E6E, 0xFFFFFF, 0xFFFFFF, 0xBCBCBC, 0xA8A8A8, 0xFFFFFF, 0xFFFFFF, 0x090909, 0xFFFFFF,
+			0xFFFFFF, 0x8C8C8C, 0x242424, 0xFFFFFF, 0xFFFFFF, 0x9C9C9C, 0x4E4E4E, 0xFFFFFF, 0xFFFFFF, 0x2B2B2B,
+			0x222222, 0xFFFFFF, 0xFFFFFF, 0x5D5D5D, 0xFFFFFF, 0xFFFFFF, 0x969696, 0x858585, 0xFFFFFF, 0xF9F9F9,
+			0x1A1A1A, 0x5E5E5E, 0xFFFFFF, 0xFFFFFF, 0x3D3D3D, 0x535353, 0xFFFFFF, 0xFFFFFF, 0x404040, 0x191919,
+			0xF3F3F3, 0xFFFFFF, 0xA2A2A2, 0xC4C4C4, 0xFFFFFF, 0xDCDCDC, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x575757,
+			0xA5A5A5, 0xFFFFFF, 0xFFFFFF, 0x656565, 0x191919, 0xFFFFFF, 0xFFFFFF, 0x747474, 0x7A7A7A, 0xFFFFFF,
+			0xFFFFFF, 0x373737, 0xFFFFFF, 0xFFFFFF, 0xA1A1A1, 0x242424, 0xFFFFFF, 0xFFFFFF, 0x797979, 0x4E4E4E,
+			0xFFFFFF, 0xFFFFFF, 0x2B2B2B, 0x222222, 0xFFFFFF, 0xFFFFFF, 0x515151, 0xFFFFFF, 0xFFFFFF, 0x969696,
+			0x858585, 0xFFFFFF, 0xF4F4F4, 0x151515, 0x4D4D4D, 0xFFFFFF, 0xFFFFFF, 0x3D3D3D, 0x9D9D9D, 0xFFFFFF,
+			0xFFFFFF, 0xE0E0E0, 0xFFFFFF, 0xD5D5D5, 0x010101, 0xC4C4C4, 0xFFFFFF, 0xD2D2D2, 0x808080, 0xFFFFFF,
+			0xFFFFFF, 0x5B5B5B, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x4C4C4C, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x545454, 0xFCFCFC, 0xFFFFFF,
+			0xCCCCCC, 0x4E4E4E, 0xFFFFFF, 0xFFFFFF, 0x3C3C3C, 0x4E4E4E, 0xFFFFFF, 0xFFFFFF, 0x2B2B2B, 0x222222,
+			0xFFFFFF, 0xFFFFFF, 0x535353, 0xFFFFFF, 0xFFFFFF, 0x969696, 0x858585, 0xFFFFFF, 0xF5F5F5, 0x171717,
+			0x4F4F4F, 0xFFFFFF, 0xFFFFFF, 0x3D3D3D, 0xD1D1D1, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xF3F3F3, 0x090909, 0xC4C4C4, 0xFFFFFF, 0xD3D3D3,
+			0x808080, 0xFFFFFF, 0xFFFFFF, 0x5B5B5B, 0xC9C9C9, 0xFFFFFF, 0xFFFFFF, 0x454545, 0x4F4F4F, 0xFFFFFF,
+			0xFFFFFF, 0x616161, 0x171717, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x232323,
+			0x0C0C0C, 0x7D7D7D, 0xFFFFFF, 0xFFFFFF, 0x535353, 0x010101, 0xD6D6D6, 0xFFFFFF, 0xC3C3C3, 0x4E4E4E,
+			0xFFFFFF, 0xFFFFFF, 0x2B2B2B, 0x222222, 0xFFFFFF, 0xFFFFFF, 0x535353, 0xFFFFFF, 0xFFFFFF, 0x969696,
+			0x858585, 0xFFFFFF, 0xF5F5F5, 0x171717, 0x4F4F4F, 0xFFFFFF, 0xFFFFFF, 0x3D3D3D, 0xD5D5D5, 0xFFFFFF,
+			0xFFFFFF, 0x050505, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x202020, 0x1F1F1F,
+			0xC4C4C4, 0xFFFFFF, 0xD3D3D3, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x5B5B5B, 0xBCBCBC, 0xFFFFFF, 0xFFFFFF,
+			0x595959, 0x4D4D4D, 0xFFFFFF, 0xFFFFFF, 0x606060, 0x9E9E9E, 0xFFFFFF, 0xFFFFFF, 0xC7C7C7, 0xAAAAAA,
+			0xF4F4F4, 0xFFFFFF, 0xCFCFCF, 0x0C0C0C, 0x4E4E4E, 0xFFFFFF, 0xFFFFFF, 0x2B2B2B, 0x222222, 0xFFFFFF,
+			0xFFFFFF, 0x535353, 0xFFFFFF, 0xFFFFFF, 0x969696, 0x858585, 0xFFFFFF, 0xF5F5F5, 0x171717, 0x4F4F4F,
+			0xFFFFFF, 0xFFFFFF, 0x3D3D3D, 0xD2D2D2, 0xFFFFFF, 0xFFFFFF, 0xC4C4C4, 0xFFFFFF, 0xD3D3D3, 0x808080,
+			0xFFFFFF, 0xFFFFFF, 0x5B5B5B, 0xBFBFBF, 0xFFFFFF, 0xFFFFFF, 0x515151, 0x0F0F0F, 0xFFFFFF, 0xFFFFFF,
+			0xB5B5B5, 0xBDBDBD, 0xD0D0D0, 0x6E6E6E, 0xACACAC, 0xADADAD, 0x919191, 0x343434, 0x4E4E4E, 0xFFFFFF,
+			0xFFFFFF, 0x2B2B2B, 0x222222, 0xFFFFFF, 0xFFFFFF, 0x535353, 0xFFFFFF, 0xFFFFFF, 0x969696, 0x858585,
+			0xFFFFFF, 0xF5F5F5, 0x171717, 0x4F4F4F, 0xFFFFFF, 0xFFFFFF, 0x3D3D3D, 0x949494, 0xFFFFFF, 0xFFFFFF,
+			0x393939, 0xC4C4C4, 0xFFFFFF, 0xD3D3D3, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x5B5B5B, 0xEFEFEF, 0xFFFFFF,
+			0xFFFFFF, 0x191919, 0xFAFAFA, 0xFFFFFF, 0xF3F3F3, 0x0B0B0B, 0xABABAB, 0xFFFFFF, 0x191919, 0x4C4C4C,
+			0xFFFFFF, 0xFFFFFF, 0x2B2B2B, 0x222222, 0xFFFFFF, 0xFFFFFF, 0x535353, 0xFFFFFF, 0xFFFFFF, 0x969696,
+			0x858585, 0xFFFFFF, 0xF5F5F5, 0x171717, 0x4F4F4F, 0xFFFFFF, 0xFFFFFF, 0x3D3D3D, 0x4E4E4E, 0xFFFFFF,
+			0xFFFFFF, 0x797979, 0x111111, 0xC4C4C4, 0xFFFFFF, 0xD3D3D3, 0x7D7D7D, 0xFFFFFF, 0xFFFFFF, 0x5B5B5B,
+			0x363636, 0xFFFFFF, 0xFFFFFF, 0xE3E3E3, 0x989898, 0xFFFFFF, 0xFFFFFF, 0x8F8F8F, 0xB8B8B8, 0xF0F0F0,
+			0xFFFFFF, 0xFFFFFF, 0x535353, 0x595959, 0xFFFFFF, 0xFFFFFF, 0x282828, 0x191919, 0xFFFFFF, 0xFFFFFF,
+			0x505050, 0xFFFFFF, 0xFFFFFF, 0x939393, 0x7E7E7E, 0xFFFFFF, 0xF4F4F4, 0x141414, 0x4C4C4C, 0xFFFFFF,
+			0xFFFFFF, 0x3B3B3B, 0x0B0B0B, 0xF6F6F6, 0xFFFFFF, 0xFFFFFF, 0x151515, 0x2E2E2E, 0xFFFFFF, 0x686868,
+			0xC9C9C9, 0xFFFFFF, 0xD1D1D1, 0x969696, 0xFFFFFF, 0xFFFFFF, 0x4C4C4C, 0x1C1C1C, 0x5B5B5B, 0xFFFFFF,
+			0xFFFFFF, 0xF1F1F1, 0x090909, 0x020202, 0xDDDDDD, 0xFFFFFF, 0xFFFFFF, 0xDDDDDD, 0x6A6A6A, 0x575757,
+			0xA1A1A1, 0xFFFFFF, 0xFFFFFF, 0x3C3C3C, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xDFDFDF, 0x585858, 0x9E9E9E, 0xFFFFFF, 0xFFFFFF, 0x3C3C3C, 0x727272,
+			0xFFFFFF, 0xFFFFFF, 0x676767, 0x070707, 0xFFFFFF, 0xFFFFFF, 0xABABAB, 0xC9C9C9, 0xFFFFFF, 0xFCFCFC,
+			0x1C1C1C, 0x6C6C6C, 0xFFFFFF, 0xFFFFFF, 0x484848, 0x545454, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xADADAD,
+			0x565656, 0x636363, 0xDFDFDF, 0xFFFFFF, 0xCECECE, 0x030303, 0xE8E8E8, 0xFFFFFF, 0xE4E4E4, 0x777777,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFDFDFD, 0xEFEFEF, 0xF2F2F2, 0xEFEFEF, 0xFFFFFF, 0xFFFFFF, 0xFCFCFC,
+			0xB2B2B2, 0x1A1A1A, 0x141414, 0xB9B9B9, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xCFCFCF,
+			0x2A2A2A, 0x686868, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0x4D4D4D, 0x606060, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xF0F0F0, 0x3A3A3A, 0x4B4B4B,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFEFEFE, 0x565656, 0x2B2B2B, 0xE3E3E3, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0x989898, 0x858585, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xDCDCDC, 0x1B1B1B, 0x5D5D5D, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xF7F7F7, 0x575757, 0x515151, 0xF0F0F0, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0x929292, 0x010101, 0xBCBCBC, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xBBBBBB, 0x262626, 0x707070, 0x626262,
+			0x5F5F5F, 0x5F5F5F, 0x636363, 0x656565, 0x656565, 0x656565, 0x666666, 0x444444, 0x1A1A1A, 0x2E2E2E,
+			0x606060, 0x606060, 0x636363, 0x333333, 0x555555, 0xFFFFFF, 0xC5C5C5, 0x555555, 0x5F5F5F, 0x5F5F5F,
+			0x5F5F5F, 0x535353, 0xDFDFDF, 0xFFFFFF, 0xFFFFFF, 0xCCCCCC, 0x6A6A6A, 0x636363, 0x5F5F5F, 0x5F5F5F,
+			0x6A6A6A, 0x525252, 0x636363, 0x666666, 0x5F5F5F, 0x5F5F5F, 0x666666, 0x646464, 0x474747, 0x6D6D6D,
+			0x5F5F5F, 0x5F5F5F, 0x626262, 0x797979, 0x060606, 0x0E0E0E, 0x6D6D6D, 0x616161, 0x5F5F5F, 0x5F5F5F,
+			0x6E6E6E, 0x3B3B3B, 0x656565, 0x656565, 0x5F5F5F, 0x5F5F5F, 0x686868, 0x5D5D5D, 0x060606, 0x424242,
+			0x626262, 0x616161, 0x515151, 0x191919, 0x242424, 0x6E6E6E, 0x606060, 0x5F5F5F, 0x606060, 0x707070,
+			0x484848, 0x5F5F5F, 0xFFFFFF, 0xD5D5D5, 0xBEBEBE, 0xFFFFFF, 0xECECEC, 0x070707, 0x030303, 0xDADADA,
+			0xFFFFFF, 0x828282, 0x828282, 0xFFFFFF, 0xE9E9E9, 0x060606, 0x0F0F0F, 0xF4F4F4, 0xFFFFFF, 0x767676,
+			0x929292, 0xFFFFFF, 0xC4C4C4, 0xBBBBBB, 0xFFFFFF, 0xD3D3D3, 0x393939, 0xFFFFFF, 0xFFFFFF, 0x1E1E1E,
+			0x232323, 0xFBFBFB, 0xFFFFFF, 0xE6E6E6, 0x828282, 0x181818, 0x1E1E1E, 0x1B1B1B, 0xACACAC, 0xFFFFFF,
+			0xFFFFFF, 0x6F6F6F, 0x0E0E0E, 0x6F6F6F, 0xCBCBCB, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xE3E3E3,
+			0x8A8A8A, 0x1F1F1F, 0x636363, 0x555555, 0x525252, 0x525252, 0x585858, 0x606060, 0x0A0A0A, 0x020202,
+			0xA1A1A1, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x646464, 0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0x717171, 0x5D5D5D, 0xFFFFFF, 0xFFFFFF, 0x646464, 0x727272, 0xECECEC, 0xEBEBEB, 0x383838, 0x989898,
+			0xFFFFFF, 0xFFFFFF, 0x787878, 0x1B1B1B, 0xFFFFFF, 0xFFFFFF, 0x646464, 0x858585, 0xFFFFFF, 0xFFFFFF,
+			0x414141, 0x7D7D7D, 0xFFFFFF, 0xFFFFFF, 0x5D5D5D, 0x3C3C3C, 0xFFFFFF, 0xFFFFFF, 0x080808, 0xFFFFFF,
+			0xFFFFFF, 0x646464, 0x8F8F8F, 0xFFFFFF, 0xFFFFFF, 0x474747, 0xC8C8C8, 0xFFFFFF, 0x8A8A8A, 0x808080,
+			0xFFFFFF, 0xFFFFFF, 0x5A5A5A, 0x6D6D6D, 0xFFFFFF, 0xFEFEFE, 0x0A0A0A, 0xFFFFFF, 0xFFFFFF, 0x646464,
+			0x101010, 0x232323, 0x232323, 0x070707, 0xDADADA, 0xFFFFFF, 0x7B7B7B, 0x808080, 0xFFFFFF, 0xFFFFFF,
+			0x5A5A5A, 0xBBBBBB, 0xFFFFFF, 0xFCFCFC, 0x060606, 0xFFFFFF, 0xFFFFFF, 0x646464, 0x171717, 0xFBFBFB,
+			0xFFFFFF, 0x747474, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x5A5A5A, 0x1E1E1E, 0x787878, 0x616161, 0x616161,
+			0x585858, 0x040404, 0x0F0F0F, 0x595959, 0x636363, 0x505050, 0x020202, 0x797979, 0xFFFFFF, 0xFFFFFF,
+			0xFEFEFE, 0x575757, 0x656565, 0x666666, 0x6C6C6C, 0x323232, 0x404040, 0x676767, 0x666666, 0x595959,
+			0x1B1B1B, 0x181818, 0x797979, 0x616161, 0x616161, 0x5C5C5C, 0x040404, 0x131313, 0x565656, 0x616161,
+			0x656565, 0x070707, 0x7F7F7F, 0x626262, 0x5F5F5F, 0x696969, 0x0C0C0C, 0x4E4E4E, 0x636363, 0x585858,
+			0x0A0A0A, 0x4B4B4B, 0x636363, 0x5C5C5C, 0x080808, 0x434343, 0x686868, 0x666666, 0x545454, 0x171717,
+			0x1D1D1D, 0x565656, 0x676767, 0x686868, 0x414141, 0x181818, 0xFEFEFE, 0xFFFFFF, 0x646464, 0x020202,
+			0x7E7E7E, 0x626262, 0x5F5F5F, 0x666666, 0x0F0F0F, 0x020202, 0x3D3D3D, 0x636363, 0x646464, 0x626262,
+			0x2B2B2B, 0x0E0E0E, 0xD6D6D6, 0xFFFFFF, 0xFFFFFF, 0xAFAFAF, 0x5C5C5C, 0x666666, 0x676767, 0x646464,
+			0x0A0A0A, 0x404040, 0x676767, 0x666666, 0x595959, 0x1B1B1B, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x5A5A5A,
+			0x020202, 0x929292, 0xFFFFFF, 0xFFFFFF, 0xF3F3F3, 0x4F4F4F, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xD9D9D9, 0x141414, 0x949494, 0xE9E9E9, 0xF8F8F8, 0xFFFFFF, 0xFFFFFF, 0xECECEC, 0xF2F2F2, 0xF2F2F2,
+			0xFFFFFF, 0x777777, 0x2D2D2D, 0xD7D7D7, 0xFFFFFF, 0xF9F9F9, 0xF2F2F2, 0xFFFFFF, 0xFFFFFF, 0x757575,
+			0x898989, 0xFFFFFF, 0xFFFFFF, 0xFCFCFC, 0x717171, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x1B1B1B,
+			0x676767, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x070707, 0x272727, 0xE8E8E8, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xF3F3F3, 0x232323, 0x1B1B1B, 0xF0F0F0, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xF4F4F4, 0x2F2F2F, 0x3F3F3F,
+			0xE4E4E4, 0xFFFFFF, 0xF6F6F6, 0xF5F5F5, 0xFFFFFF, 0xFFFFFF, 0x5C5C5C, 0xA0A0A0, 0xFFFFFF, 0xFFFFFF,
+			0xEFEFEF, 0xF5F5F5, 0xFFFFFF, 0xF4F4F4, 0xFFFFFF, 0xFFFFFF, 0x646464, 0x6B6B6B, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0x2D2D2D, 0x252525, 0x969696, 0xFCFCFC, 0xF0F0F0, 0xEDEDED, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0x8D8D8D, 0x181818, 0xE0E0E0, 0xEBEBEB, 0xFFFFFF, 0xFFFFFF, 0xF8F8F8, 0xEFEFEF, 0xF2F2F2, 0xF4F4F4,
+			0xEAEAEA, 0x1A1A1A, 0x2D2D2D, 0xD8D8D8, 0xFFFFFF, 0xF8F8F8, 0xF3F3F3, 0xFFFFFF, 0xFFFFFF, 0x747474,
+			0x808080, 0xFFFFFF, 0xFFFFFF, 0x5A5A5A, 0xC2C2C2, 0xFFFFFF, 0xC9C9C9, 0x5A5A5A, 0xFFFFFF, 0x909090,
+			0x5E5E5E, 0xE6E6E6, 0xFFFFFF, 0xFFFFFF, 0xABABAB, 0xAAAAAA, 0xFFFFFF, 0xFBFBFB, 0x161616, 0xFFFFFF,
+			0xFFFFFF, 0x777777, 0x4F4F4F, 0xFFFFFF, 0xFFFFFF, 0x717171, 0xBBBBBB, 0xFFFFFF, 0xD9D9D9, 0x686868,
+			0xFFFFFF, 0x5C5C5C, 0xB9B9B9, 0xFFFFFF, 0xFFFFFF, 0x181818, 0x8A8A8A, 0xFFFFFF, 0xFFFFFF, 0x232323,
+			0xFFFFFF, 0xB2B2B2, 0x4D4D4D, 0xD9D9D9, 0xFFFFFF, 0xFFFFFF, 0xC1C1C1, 0x313131, 0xFFFFFF, 0xB3B3B3,
+			0x4F4F4F, 0xCACACA, 0xFFFFFF, 0xFFFFFF, 0xD7D7D7, 0x252525, 0xFFFFFF, 0xFFFFFF, 0x666666, 0x6A6A6A,
+			0xFFFFFF, 0xFFFFFF, 0x515151, 0xBEBEBE, 0xFFFFFF, 0xEDEDED, 0x2F2F2F, 0x353535, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0x646464, 0x959595, 0xFFFFFF, 0xFFFFFF, 0x292929, 0x3F3F3F, 0xFFFFFF, 0xFFFFFF, 0xA4A4A4,
+			0x030303, 0x060606, 0xCACACA, 0xFFFFFF, 0xFFFFFF, 0x313131, 0x0B0B0B, 0xF4F4F4, 0xFFFFFF, 0x6E6E6E,
+			0x171717, 0xFFFFFF, 0xFFFFFF, 0x767676, 0x505050, 0xFFFFFF, 0xFFFFFF, 0x6F6F6F, 0x808080, 0xFFFFFF,
+			0xFFFFFF, 0x5A5A5A, 0x8A8A8A, 0xFFFFFF, 0xFFFFFF, 0xFAFAFA, 0x0A0A0A, 0xFBFBFB, 0xFFFFFF, 0xFFFFFF,
+			0xB3B3B3, 0xFFFFFF, 0xFEFEFE, 0xFFFFFF, 0xFFFFFF, 0x909090, 0x9B9B9B, 0xFFFFFF, 0xFFFFFF, 0x0F0F0F,
+			0x7E7E7E, 0xFFFFFF, 0xFFFFFF, 0xF6F6F6, 0xE9E9E9, 0xFFFFFF, 0x1C1C1C, 0x424242, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0x383838, 0xCECECE, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x535353, 0xB4B4B4, 0xFFFFFF, 0xFFFFFF,
+			0x232323, 0x040404, 0xFFFFFF, 0xFFFFFF, 0x707070, 0xB2B2B2, 0xFFFFFF, 0xEBEBEB, 0x070707, 0x7F7F7F,
+			0xFFFFFF, 0xFEFEFE, 0x111111, 0x4A4A4A, 0xFFFFFF, 0xFFFFFF, 0x646464, 0x4C4C4C, 0xFFFFFF, 0xFFFFFF,
+			0x292929, 0x525252, 0xFFFFFF, 0xFBFBFB, 0x1C1C1C, 0xFFFFFF, 0xFFFFFF, 0x7D7D7D, 0x1F1F1F, 0xF7F7F7,
+			0xFFFFFF, 0x7B7B7B, 0xFFFFFF, 0xFFFFFF, 0x8E8E8E, 0x9B9B9B, 0xFFFFFF, 0xFEFEFE, 0x0A0A0A, 0x808080,
+			0xFFFFFF, 0xFFFFFF, 0x5A5A5A, 0x909090, 0xFFFFFF, 0xFFFFFF, 0x3A3A3A, 0xA3A3A3, 0xFFFFFF, 0xFFFFFF,
+			0x2C2C2C, 0xB3B3B3, 0xFFFFFF, 0xFEFEFE, 0x525252, 0xFFFFFF, 0xFFFFFF, 0x2B2B2B, 0x535353, 0xFFFFFF,
+			0xFFFFFF, 0x4A4A4A, 0x838383, 0xFFFFFF, 0xFFFFFF, 0x414141, 0x131313, 0x252525, 0x010101, 0x494949,
+			0xFFFFFF, 0xFFFFFF, 0x787878, 0x7B7B7B, 0xFFFFFF, 0xFFFFFF, 0x929292, 0x676767, 0xFFFFFF, 0xFFFFFF,
+			0x2A2A2A, 0x707070, 0xFFFFFF, 0xFFFFFF, 0x131313, 0x6A6A6A, 0xFFFFFF, 0xFFFFFF, 0x333333, 0x070707,
+			0xEAEAEA, 0xFFFFFF, 0xACACAC, 0x2E2E2E, 0xFFFFFF, 0xFFFFFF, 0x646464, 0x535353, 0xFFFFFF, 0xFFFFFF,
+			0x292929, 0x080808, 0x242424, 0x161616, 0xF4F4F4, 0xFFFFFF, 0xAEAEAE, 0x1F1F1F, 0xF7F7F7, 0xFFFFFF,
+			0x7B7B7B, 0x535353, 0xFFFFFF, 0xFFFFFF, 0x292929, 0x545454, 0xFFFFFF, 0xFFFFFF, 0x3F3F3F, 0x808080,
+			0xFFFFFF, 0xFFFFFF, 0x5A5A5A, 0x909090, 0xFFFFFF, 0xEEEEEE, 0x101010, 0x5C5C5C, 0xFFFFFF, 0xFFFFFF,
+			0x353535, 0xB3B3B3, 0xFFFFFF, 0xFEFEFE, 0xA3A3A3, 0xFFFFFF, 0xE9E9E9, 0x070707, 0x2E2E2E, 0xFFFFFF,
+			0xFFFFFF, 0x818181, 0x838383, 0xFFFFFF, 0xF5F5F5, 0x151515, 0x494949, 0xFFFFFF, 0xFFFFFF, 0x2A2A2A,
+			0x565656, 0xFFFFFF, 0xFFFFFF, 0x3F3F3F, 0x4D4D4D, 0xFFFFFF, 0xFFFFFF, 0x3B3B3B, 0xBFBFBF, 0xFFFFFF,
+			0xDBDBDB, 0x3F3F3F, 0xFFFFFF, 0xFFFFFF, 0x636363, 0x262626, 0xFFFFFF, 0xFFFFFF, 0x777777, 0x121212,
+			0xFFFFFF, 0xFFFFFF, 0x646464, 0x535353, 0xFFFFFF, 0xFFFFFF, 0x292929, 0xEEEEEE, 0xFFFFFF, 0xBDBDBD,
+			0x1F1F1F, 0xF7F7F7, 0xFFFFFF, 0x7B7B7B, 0xA4A4A4, 0xFFFFFF, 0xE9E9E9, 0x060606, 0x2F2F2F, 0xFFFFFF,
+			0xFFFFFF, 0x707070, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x5A5A5A, 0x909090, 0xFFFFFF, 0xEEEEEE, 0x121212,
+			0x5D5D5D, 0xFFFFFF, 0xFFFFFF, 0x343434, 0xB3B3B3, 0xFFFFFF, 0xFEFEFE, 0x040404, 0xDDDDDD, 0xFFFFFF,
+			0xE7E7E7, 0x646464, 0x646464, 0x666666, 0x666666, 0x626262, 0x797979, 0xFFFFFF, 0xFFFFFF, 0xBCBCBC,
+			0x838383, 0xFFFFFF, 0xF5F5F5, 0x161616, 0x494949, 0xFFFFFF, 0xFFFFFF, 0x2B2B2B, 0x2F2F2F, 0xFFFFFF,
+			0xFFFFFF, 0x333333, 0x262626, 0xFFFFFF, 0xFFFFFF, 0x606060, 0x111111, 0xEAEAEA, 0xFFFFFF, 0xD9D9D9,
+			0x606060, 0x656565, 0x666666, 0x666666, 0x616161, 0x7F7F7F, 0xFFFFFF, 0xFFFFFF, 0x9D9D9D, 0x787878,
+			0xFFFFFF, 0xFFFFFF, 0x494949, 0x090909, 0xFFFFFF, 0xFFFFFF, 0x646464, 0x535353, 0xFFFFFF, 0xFFFFFF,
+			0x292929, 0x090909, 0x353535, 0x565656, 0x575757, 0xF6F6F6, 0xFFFFFF, 0xBBBBBB, 0x1F1F1F, 0xF7F7F7,
+			0xFFFFFF, 0x7B7B7B, 0x040404, 0xDEDEDE, 0xFFFFFF, 0xE6E6E6, 0x646464, 0x646464, 0x666666, 0x666666,
+			0x626262, 0x797979, 0xFFFFFF, 0xFFFFFF, 0xA6A6A6, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x5A5A5A, 0x909090,
+			0xFFFFFF, 0xEEEEEE, 0x121212, 0x5D5D5D, 0xFFFFFF, 0xFFFFFF, 0x343434, 0xB3B3B3, 0xFFFFFF, 0xFEFEFE,
+			0x080808, 0xEAEAEA, 0xFFFFFF, 0xFCFCFC, 0xECECEC, 0xF2F2F2, 0xF2F2F2, 0xF2F2F2, 0xF2F2F2, 0xEEEEEE,
+			0xE0E0E0, 0xE6E6E6, 0xAEAEAE, 0x838383, 0xFFFFFF, 0xF5F5F5, 0x171717, 0x494949, 0xFFFFFF, 0xFFFFFF,
+			0x2C2C2C, 0x1F1F1F, 0xFFFFFF, 0xFFFFFF, 0x353535, 0x292929, 0xFFFFFF, 0xFFFFFF, 0x5D5D5D, 0x191919,
+			0xF3F3F3, 0xFFFFFF, 0xF9F9F9, 0xEDEDED, 0xF2F2F2, 0xF2F2F2, 0xF2F2F2, 0xF2F2F2, 0xEDEDED, 0xDFDFDF,
+			0xE8E8E8, 0x959595, 0x8E8E8E, 0xFFFFFF, 0xFFFFFF, 0x363636, 0x0A0A0A, 0xFFFFFF, 0xFFFFFF, 0x646464,
+			0x535353, 0xFFFFFF, 0xFFFFFF, 0x292929, 0x3C3C3C, 0xC4C4C4, 0xFEFEFE, 0xFEFEFE, 0xF3F3F3, 0xECECEC,
+			0xFFFFFF, 0xFFFFFF, 0xBBBBBB, 0x1F1F1F, 0xF7F7F7, 0xFFFFFF, 0x7B7B7B, 0x090909, 0xEAEAEA, 0xFFFFFF,
+			0xFCFCFC, 0xECECEC, 0xF2F2F2, 0xF2F2F2, 0xF2F2F2, 0xF2F2F2, 0xEEEEEE, 0xE0E0E0, 0xE6E6E6, 0x9B9B9B,
+			0x808080, 0xFFFFFF, 0xFFFFFF, 0x5A5A5A, 0x909090, 0xFFFFFF, 0xEEEEEE, 0x121212, 0x5D5D5D, 0xFFFFFF,
+			0xFFFFFF, 0x343434, 0xB3B3B3, 0xFFFFFF, 0xFEFEFE, 0x080808, 0xECECEC, 0xFFFFFF, 0xBABABA, 0x838383,
+			0xFFFFFF, 0xF5F5F5, 0x171717, 0x494949, 0xFFFFFF, 0xFFFFFF, 0x2C2C2C, 0x212121, 0xFFFFFF, 0xFFFFFF,
+			0x353535, 0x292929, 0xFFFFFF, 0xFFFFFF, 0x5D5D5D, 0x1A1A1A, 0xF5F5F5, 0xFFFFFF, 0x999999, 0x888888,
+			0xFFFFFF, 0xFFFFFF, 0x4A4A4A, 0x090909, 0xFFFFFF, 0xFFFFFF, 0x646464, 0x535353, 0xFFFFFF, 0xFFFFFF,
+			0x292929, 0xB4B4B4, 0xFFFFFF, 0xFFFFFF, 0x545454, 0x313131, 0xECECEC, 0xFFFFFF, 0xBBBBBB, 0x1F1F1F,
+			0xF7F7F7, 0xFFFFFF, 0x7B7B7B, 0x0A0A0A, 0xECECEC, 0xFFFFFF, 0xB9B9B9, 0x808080, 0xFFFFFF, 0xFFFFFF,
+			0x5A5A5A, 0x909090, 0xFFFFFF, 0xEEEEEE, 0x121212, 0x5D5D5D, 0xFFFFFF, 0xFFFFFF, 0x343434, 0xB3B3B3,
+			0xFFFFFF, 0xFCFCFC, 0x030303, 0xDCDCDC, 0xFFFFFF, 0xE1E1E1, 0x070707, 0x838383, 0xFFFFFF, 0xF5F5F5,
+			0x171717, 0x494949, 0xFFFFFF, 0xFFFFFF, 0x2C2C2C, 0x212121, 0xFFFFFF, 0xFFFFFF, 0x353535, 0x292929,
+			0xFFFFFF, 0xFFFFFF, 0x5D5D5D, 0x0F0F0F, 0xE9E9E9, 0xFFFFFF, 0xCFCFCF, 0x7D7D7D, 0xFFFFFF, 0xFFFFFF,
+			0x6C6C6C, 0x0D0D0D, 0xFFFFFF, 0xFFFFFF, 0x646464, 0x535353, 0xFFFFFF, 0xFFFFFF, 0x292929, 0x9B9B9B,
+			0xFFFFFF, 0xEFEFEF, 0xEFEFEF, 0xFFFFFF, 0xBBBBBB, 0x1F1F1F, 0xF7F7F7, 0xFFFFFF, 0x797979, 0x030303,
+			0xDCDCDC, 0xFFFFFF, 0xE0E0E0, 0x070707, 0x808080, 0xFFFFFF, 0xFFFFFF, 0x5A5A5A, 0x909090, 0xFFFFFF,
+			0xEEEEEE, 0x121212, 0x5D5D5D, 0xFFFFFF, 0xFFFFFF, 0x343434, 0xB4B4B4, 0xFFFFFF, 0xFFFFFF, 0xB0B0B0,
+			0xFFFFFF, 0xFCFCFC, 0x1D1D1D, 0x838383, 0xFFFFFF, 0xF5F5F5, 0x171717, 0x494949, 0xFFFFFF, 0xFFFFFF,
+			0x2C2C2C, 0x212121, 0xFFFFFF, 0xFFFFFF, 0x353535, 0x292929, 0xFFFFFF, 0xFFFFFF, 0x5D5D5D, 0xC8C8C8,
+			0xFFFFFF, 0xF4F4F4, 0x0A0A0A, 0x393939, 0xFFFFFF, 0xFFFFFF, 0x999999, 0x292929, 0xFFFFFF, 0xFFFFFF,
+			0x646464, 0x535353, 0xFFFFFF, 0xFFFFFF, 0x292929, 0xFFFFFF, 0xFFFFFF, 0x949494, 0xF4F4F4, 0xFFFFFF,
+			0xBBBBBB, 0x202020, 0xF7F7F7, 0xFFFFFF, 0x888888, 0xB0B0B0, 0xFFFFFF, 0xFCFCFC, 0x1C1C1C, 0x7F7F7F,
+			0xFFFFFF, 0xFFFFFF, 0x595959, 0x8E8E8E, 0xFFFFFF, 0xEEEEEE, 0x121212, 0x5D5D5D, 0xFFFFFF, 0xFFFFFF,
+			0x333333, 0xADADAD, 0xFFFFFF, 0xFFFFFF, 0x636363, 0xFFFFFF, 0xFFFFFF, 0x7B7B7B, 0x676767, 0x808080,
+			0xFFFFFF, 0xF5F5F5, 0x161616, 0x444444, 0xFFFFFF, 0xFFFFFF, 0x2B2B2B, 0x1C1C1C, 0xFFFFFF, 0xFFFFFF,
+			0x333333, 0x282828, 0xFFFFFF, 0xFFFFFF, 0x5C5C5C, 0x848484, 0xFFFFFF, 0xFFFFFF, 0x5C5C5C, 0x646464,
+			0x0F0F0F, 0xFFFFFF, 0xFFFFFF, 0xE4E4E4, 0x9C9C9C, 0xFFFFFF, 0xFFFFFF, 0x616161, 0x4E4E4E, 0xFFFFFF,
+			0xFFFFFF, 0x282828, 0xFFFFFF, 0xFFFFFF, 0x8D8D8D, 0x555555, 0xFFFFFF, 0xFFFFFF, 0xBABABA, 0x1D1D1D,
+			0xF6F6F6, 0xFFFFFF, 0xAEAEAE, 0x656565, 0xFFFFFF, 0xFFFFFF, 0x7A7A7A, 0x676767, 0x808080, 0xFFFFFF,
+			0xFFFFFF, 0x636363, 0x9E9E9E, 0xFFFFFF, 0xEEEEEE, 0x101010, 0x575757, 0xFFFFFF, 0xFFFFFF, 0x313131,
+			0x4A4A4A, 0xFFFFFF, 0xFFFFFF, 0xABABAB, 0x949494, 0xABABAB, 0xFCFCFC, 0xFFFFFF, 0xFFFFFF, 0x6D6D6D,
+			0x3B3B3B, 0xE7E7E7, 0xFFFFFF, 0x363636, 0xA4A4A4, 0xFFFFFF, 0xF5F5F5, 0x141414, 0x6F6F6F, 0xFFFFFF,
+			0xFFFFFF, 0x2B2B2B, 0x464646, 0xFFFFFF, 0xFFFFFF, 0x3A3A3A, 0x343434, 0xFFFFFF, 0xFFFFFF, 0x5C5C5C,
+			0x080808, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x5F5F5F, 0x3C3C3C, 0xFFFFFF, 0xFFFFFF, 0x252525, 0xA1A1A1,
+			0xFFFFFF, 0xFFFFFF, 0xB8B8B8, 0x0A0A0A, 0xA1A1A1, 0xEDEDED, 0xF8F8F8, 0xFFFFFF, 0x848484, 0x797979,
+			0xFFFFFF, 0xFFFFFF, 0x282828, 0xFFFFFF, 0xFFFFFF, 0xF3F3F3, 0x1C1C1C, 0x595959, 0xFFFFFF, 0xE1E1E1,
+			0xFFFFFF, 0xC0C0C0, 0xC9C9C9, 0xFFFFFF, 0xFFFFFF, 0x414141, 0x0F0F0F, 0xECECEC, 0x343434, 0xFDFDFD,
+			0xFFFFFF, 0xFFFFFF, 0x6C6C6C, 0x3B3B3B, 0xE8E8E8, 0xFFFFFF, 0x2F2F2F, 0xBBBBBB, 0xFFFFFF, 0xFFFFFF,
+			0xA1A1A1, 0x080808, 0xE8E8E8, 0xFFFFFF, 0xFFFFFF, 0x3F3F3F, 0xB4B4B4, 0xFFFFFF, 0xFFFFFF, 0x696969,
+			0x161616, 0xEDEDED, 0xFFFFFF, 0xFFFFFF, 0xE6E6E6, 0xEBEBEB, 0xFFFFFF, 0x545454, 0x373737, 0xFAFAFA,
+			0xFFFFFF, 0xFFFFFF, 0xEAEAEA, 0xDCDCDC, 0xE6E6E6, 0xFFFFFF, 0xF9F9F9, 0x333333, 0xE3E3E3, 0xFFFFFF,
+			0xFFFFFF, 0x4A4A4A, 0xBFBFBF, 0xFFFFFF, 0xFFFFFF, 0x6E6E6E, 0x9A9A9A, 0xFFFFFF, 0xFFFFFF, 0x828282,
+			0x828282, 0xFFFFFF, 0xFFFFFF, 0xA3A3A3, 0x454545, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xE7E7E7, 0xDCDCDC,
+			0xEAEAEA, 0xFFFFFF, 0xEEEEEE, 0x1F1F1F, 0xFAFAFA, 0xFFFFFF, 0xFFFFFF, 0xEAEAEA, 0xDEDEDE, 0xFFFFFF,
+			0xE8E8E8, 0xF9F9F9, 0xFFFFFF, 0xCECECE, 0xC9C9C9, 0xFFFFFF, 0xFFFFFF, 0x686868, 0x878787, 0xFFFFFF,
+			0xFFFFFF, 0xFCFCFC, 0xDEDEDE, 0xF1F1F1, 0xFFFFFF, 0x303030, 0xA5A5A5, 0xFFFFFF, 0xEEEEEE, 0x6D6D6D,
+			0xFFFFFF, 0xFFFFFF, 0xFDFDFD, 0xDFDFDF, 0xFFFFFF, 0xDCDCDC, 0x101010, 0x383838, 0xFBFBFB, 0xFFFFFF,
+			0xFFFFFF, 0xEAEAEA, 0xDCDCDC, 0xE6E6E6, 0xFFFFFF, 0xF8F8F8, 0x323232, 0xD7D7D7, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xCACACA, 0x0C0C0C, 0x141414, 0xDDDDDD, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0x4E4E4E, 0x010101, 0xBCBCBC, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x999999, 0x212121, 0xCDCDCD,
+			0xFFFFFF, 0xFFFFFF, 0xC6C6C6, 0x1F1F1F, 0x161616, 0x999999, 0xE5E5E5, 0xFFFFFF, 0xFFFFFF, 0xE4E4E4,
+			0x878787, 0x080808, 0x0F0F0F, 0xD7D7D7, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x8F8F8F, 0xBCBCBC,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x959595, 0xAFAFAF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xA4A4A4, 0x8E8E8E, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xBABABA, 0x202020, 0xA4A4A4, 0xEDEDED,
+			0xFFFFFF, 0xFFFFFF, 0xDBDBDB, 0x7D7D7D, 0x0E0E0E, 0xADADAD, 0xF7F7F7, 0xFFFFFF, 0xEFEFEF, 0x808080,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xDEDEDE, 0x070707, 0xBFBFBF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0x818181, 0x6C6C6C, 0xEEEEEE, 0xFFFFFF, 0xFBFBFB, 0xAAAAAA, 0x1C1C1C, 0xBDBDBD, 0xFFFFFF, 0xFFFFFF,
+			0xF8F8F8, 0x181818, 0x717171, 0xF2F2F2, 0xFFFFFF, 0xF5F5F5, 0x7F7F7F, 0x161616, 0x999999, 0xE6E6E6,
+			0xFFFFFF, 0xFFFFFF, 0xE4E4E4, 0x868686, 0x080808, 0xD6D6D6, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x5C5C5C, 0xB8B8B8,
+			0xFFFFFF, 0xFFFFFF, 0x7A7A7A, 0x151515, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x161616, 0xB9B9B9, 0xFFFFFF,
+			0xFFFFFF, 0x5C5C5C, 0x7B7B7B, 0xFFFFFF, 0xFFFFFF, 0x636363, 0xE3E3E3, 0xFFFFFF, 0x5C5C5C, 0xA2A2A2,
+			0xA5A5A5, 0x202020, 0x7B7B7B, 0xFFFFFF, 0xFFFFFF, 0x676767, 0x505050, 0xFFFFFF, 0x666666, 0xFFFFFF,
+			0xFFFFFF, 0x373737, 0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0x676767, 0x010101, 0x252525, 0x0B0B0B, 0x434343,
+			0xFFFFFF, 0xFFFFFF, 0x343434, 0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0x676767, 0xB6B6B6, 0xFFFFFF, 0xFFFFFF,
+			0x1C1C1C, 0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0x676767, 0x444444, 0x565656, 0x171717, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x5E5E5E, 0xD0D0D0, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xD4D4D4, 0x020202,
+			0x9C9C9C, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x9D9D9D, 0x323232, 0xD3D3D3, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0x868686, 0x4E4E4E, 0xF2F2F2, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xC5C5C5, 0x343434, 0xF1F1F1, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0x1F1F1F, 0x888888, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x6A6A6A, 0x333333, 0xF8F8F8,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x7C7C7C, 0xFFFFFF,
+			0xFFFFFF, 0x676767, 0xF1F1F1, 0xF0F0F0, 0xF2F2F2, 0xFFFFFF, 0xFFFFFF, 0x636363, 0xE7E7E7, 0xFFFFFF,
+			0x9C9C9C, 0x444444, 0xFFFFFF, 0xFFFFFF, 0x6A6A6A, 0x676767, 0xFFFFFF, 0xEDEDED, 0xE0E0E0, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0x9D9D9D, 0xB0B0B0, 0xFFFFFF, 0xE2E2E2, 0x444444, 0x181818, 0xA2A2A2, 0xFFFFFF,
+			0xFFFFFF, 0x484848, 0xB4B4B4, 0xFFFFFF, 0xFFFFFF, 0x0E0E0E, 0xD7D7D7, 0xF5F5F5, 0xEEEEEE, 0xFFFFFF,
+			0xFFFFFF, 0x616161, 0x0C0C0C, 0x202020, 0x707070, 0xFFFFFF, 0xFFFFFF, 0x4E4E4E, 0x191919, 0x1F1F1F,
+			0x202020, 0x191919, 0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0x545454, 0x5C5C5C, 0xFFFFFF, 0xDCDCDC, 0x323232,
+			0xFFFFFF, 0xFFFFFF, 0x9E9E9E, 0x1E1E1E, 0xFFFFFF, 0xCCCCCC, 0x131313, 0xF1F1F1, 0xFFFFFF, 0xD0D0D0,
+			0xFFFFFF, 0x515151, 0x3F3F3F, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x484848, 0x989898, 0xFFFFFF, 0xF6F6F6,
+			0xCACACA, 0xFFFFFF, 0xFFFFFF, 0x545454, 0xFFFFFF, 0xFFFFFF, 0xD9D9D9, 0xA6A6A6, 0xECECEC, 0xFFFFFF,
+			0x6A6A6A, 0x575757, 0xFFFFFF, 0xFFFFFF, 0x2F2F2F, 0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xDBDBDB, 0x767676, 0xFFFFFF, 0xFFFFFF, 0x3E3E3E, 0xF1F1F1,
+			0xEEEEEE, 0x020202, 0x151515, 0xF1F1F1, 0xFFFFFF, 0xFFFFFF, 0x212121, 0x424242, 0xFFFFFF, 0xFFFFFF,
+			0xCCCCCC, 0x181818, 0xFFFFFF, 0xFFFFFF, 0x505050, 0x3B3B3B, 0xFFFFFF, 0xFFFFFF, 0x606060, 0x474747,
+			0xFFFFFF, 0xFFFFFF, 0xAEAEAE, 0x3A3A3A, 0xB2B2B2, 0x3F3F3F, 0x5B5B5B, 0xFFFFFF, 0xFFFFFF, 0x343434,
+			0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0x7A7A7A, 0x151515, 0x1F1F1F, 0x131313, 0x9A9A9A, 0xFFFFFF, 0xDCDCDC,
+			0xCFCFCF, 0xFFFFFF, 0xE4E4E4, 0x7C7C7C, 0xFFFFFF, 0x393939, 0x161616, 0xF1F1F1, 0xFFFFFF, 0xA9A9A9,
+			0xFFFFFF, 0xFFFFFF, 0xFEFEFE, 0x7C7C7C, 0xFFFFFF, 0xFDFDFD, 0x282828, 0x292929, 0xFCFCFC, 0xFFFFFF,
+			0x8F8F8F, 0x494949, 0xFFFFFF, 0xFFFFFF, 0x3E3E3E, 0x5B5B5B, 0xFFFFFF, 0xFFFFFF, 0x343434, 0x7C7C7C,
+			0xFFFFFF, 0xFFFFFF, 0x636363, 0x040404, 0xFEFEFE, 0xEAEAEA, 0x1D1D1D, 0xFFFFFF, 0xFFFFFF, 0xB3B3B3,
+			0xFFFFFF, 0x797979, 0x161616, 0xF1F1F1, 0xFFFFFF, 0x8E8E8E, 0xDCDCDC, 0xFFFFFF, 0xFFFFFF, 0x0E0E0E,
+			0xBEBEBE, 0xFFFFFF, 0xE5E5E5, 0xEEEEEE, 0xFFFFFF, 0xC9C9C9, 0x494949, 0xFFFFFF, 0xFFFFFF, 0x303030,
+			0x5B5B5B, 0xFFFFFF, 0xFFFFFF, 0x343434, 0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0x676767, 0x717171, 0x8E8E8E,
+			0x6D6D6D, 0xFFFFFF, 0xFFFFFF, 0xBEBEBE, 0x161616, 0xF1F1F1, 0xFFFFFF, 0x919191, 0xC9C9C9, 0xFFFFFF,
+			0xFFFFFF, 0x282828, 0x010101, 0xE4E4E4, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xE9E9E9, 0x010101, 0x494949, 0xFFFFFF, 0xFFFFFF, 0x323232,
+			0x5B5B5B, 0xFFFFFF, 0xFFFFFF, 0x343434, 0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0x676767, 0x010101, 0xFFFFFF,
+			0xFFFFFF, 0xFCFCFC, 0x161616, 0xF1F1F1, 0xFFFFFF, 0x919191, 0xCBCBCB, 0xFFFFFF, 0xFFFFFF, 0x252525,
+			0x010101, 0xE6E6E6, 0xFFFFFF, 0xDCDCDC, 0x090909, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F, 0x1F1F1F,
+			0x1F1F1F, 0x212121, 0x1E1E1E, 0x494949, 0xFFFFFF, 0xFFFFFF, 0x323232, 0x5B5B5B, 0xFFFFFF, 0xFFFFFF,
+			0x343434, 0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0x676767, 0xBDBDBD, 0xFBFBFB, 0xF8F8F8, 0xFFFFFF, 0xB0B0B0,
+			0x161616, 0xF1F1F1, 0xFFFFFF, 0x919191, 0xC8C8C8, 0xFFFFFF, 0xFFFFFF, 0x141414, 0x010101, 0xE4E4E4,
+			0xFFFFFF, 0xDFDFDF, 0x494949, 0xFFFFFF, 0xFFFFFF, 0x323232, 0x5B5B5B, 0xFFFFFF, 0xFFFFFF, 0x333333,
+			0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0x676767, 0x272727, 0xFFFFFF, 0x838383, 0x878787, 0xFFFFFF, 0x282828,
+			0x4B4B4B, 0xFFFFFF, 0xFFFFFF, 0x606060, 0x161616, 0xF1F1F1, 0xFFFFFF, 0x8E8E8E, 0xDFDFDF, 0xFFFFFF,
+			0xF5F5F5, 0xB8B8B8, 0xFFFFFF, 0xFAFAFA, 0x232323, 0x494949, 0xFFFFFF, 0xFFFFFF, 0x323232, 0x5C5C5C,
+			0xFFFFFF, 0xFFFFFF, 0x353535, 0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0x676767, 0x5B5B5B, 0xFFFFFF, 0x686868,
+			0x323232, 0xFFFFFF, 0x8D8D8D, 0xC2C2C2, 0xFFFFFF, 0xF9F9F9, 0x252525, 0x161616, 0xF1F1F1, 0xFFFFFF,
+			0xB2B2B2, 0xFFFFFF, 0xFFFFFF, 0xB9B9B9, 0x747474, 0xFFFFFF, 0xFFFFFF, 0x575757, 0x131313, 0x474747,
+			0xFFFFFF, 0xFFFFFF, 0x323232, 0x5C5C5C, 0xFFFFFF, 0xFFFFFF, 0x454545, 0x797979, 0xFFFFFF, 0xFFFFFF,
+			0x676767, 0xD3D3D3, 0xFFFFFF, 0x5E5E5E, 0x090909, 0xF3F3F3, 0xEBEBEB, 0x010101, 0xFFFFFF, 0xFFFFFF,
+			0xCBCBCB, 0x161616, 0xF1F1F1, 0xFFFFFF, 0xE7E7E7, 0x555555, 0xFFFFFF, 0xFFFFFF, 0x3C3C3C, 0x151515,
+			0xFFFFFF, 0xFFFFFF, 0xFEFEFE, 0x444444, 0xFFFFFF, 0x555555, 0x545454, 0xFFFFFF, 0xFFFFFF, 0x2F2F2F,
+			0x1F1F1F, 0xFFFFFF, 0xFFFFFF, 0xB5B5B5, 0x5E5E5E, 0x939393, 0xFFFFFF, 0xFFFFFF, 0x585858, 0x7F7F7F,
+			0xFFFFFF, 0xFFFFFF, 0x565656, 0xDEDEDE, 0xFFFFFF, 0x282828, 0xA7A7A7, 0xFFFFFF, 0xFFFFFF, 0x8E8E8E,
+			0x161616, 0xF1F1F1, 0xFFFFFF, 0xFFFFFF, 0xB3B3B3, 0x171717, 0x4B4B4B, 0xFFFFFF, 0xFFFFFF, 0x8B8B8B,
+			0x7C7C7C, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x9C9C9C, 0x575757, 0x656565, 0xEFEFEF, 0xFFFFFF, 0xC2C2C2,
+			0x999999, 0xFFFFFF, 0xFFFFFF, 0x454545, 0xFCFCFC, 0xFFFFFF, 0xFFFFFF, 0xADADAD, 0x5B5B5B, 0xE7E7E7,
+			0xFFFFFF, 0x7B7B7B, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFEFEFE, 0xEFEFEF, 0xF2F2F2, 0xF2F2F2, 0xF2F2F2,
+			0xEEEEEE, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x515151, 0x242424, 0xE9E9E9, 0xFFFFFF, 0xFFFFFF, 0xC7C7C7,
+			0x040404, 0x282828, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xAAAAAA, 0x050505, 0x161616, 0xF1F1F1,
+			0xFFFFFF, 0xEEEEEE, 0xFFFFFF, 0xFFFFFF, 0xEFEFEF, 0xF7F7F7, 0xFFFFFF, 0xFFFFFF, 0x7B7B7B, 0x707070,
+			0xF4F4F4, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFCFCFC, 0x808080, 0x5F5F5F, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xF7F7F7, 0x5D5D5D, 0x404040, 0xFBFBFB, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xD0D0D0, 0x191919,
+			0x707070, 0x626262, 0x5F5F5F, 0x5F5F5F, 0x636363, 0x656565, 0x656565, 0x656565, 0x656565, 0x656565,
+			0x606060, 0x606060, 0x636363, 0x191919, 0x404040, 0x6D6D6D, 0x5F5F5F, 0x5F5F5F, 0x6F6F6F, 0x2F2F2F,
+			0x5F5F5F, 0x676767, 0x5F5F5F, 0x5F5F5F, 0x616161, 0x6A6A6A, 0x111111, 0x161616, 0xF1F1F1, 0xFFFFFF,
+			0x7F7F7F, 0x171717, 0x575757, 0x676767, 0x676767, 0x4F4F4F, 0x171717, 0x101010, 0x484848, 0x626262,
+			0x616161, 0x4D4D4D, 0x111111, 0x6B6B6B, 0x636363, 0x5F5F5F, 0x5F5F5F, 0x666666, 0x6A6A6A, 0x0A0A0A,
+			0x242424, 0x5B5B5B, 0x636363, 0x444444, 0x161616, 0xF1F1F1, 0xFFFFFF, 0x919191, 0x161616, 0xF1F1F1,
+			0xFFFFFF, 0x919191, 0x151515, 0xF1F1F1, 0xFFFFFF, 0x909090, 0x161616, 0xF3F3F3, 0xFFFFFF, 0x999999,
+			0x484848, 0xFFFFFF, 0xFFFFFF, 0xE5E5E5, 0x080808, 0x676767, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xEDEDED, 0x282828, 0x030301, 0x050503, 0x090903, 0x0A0A04, 0x0C0C05, 0x0C0C05, 0x0C0C05, 0x0C0C05,
+			0x0B0B04, 0x0B0B04, 0x0A0A04, 0x080803, 0x060602, 0x040402, 0x010100, 0x010100, 0x020201, 0x020201,
+			0x010100, 0x010100, 0x010100, 0x020201, 0x080802, 0x0C0C03, 0x141407, 0x1A1A09, 0x1D1D0B, 0x1D1D0A,
+			0x1B1B0A, 0x191909, 0x191909, 0x191909, 0x191909, 0x181809, 0x151508, 0x101007, 0x080803, 0x040402,
+			0x010100, 0x010100, 0x040401, 0x090904, 0x0B0B05, 0x0C0C05, 0x090904, 0x060601, 0x030301, 0x040401,
+			0x0B0B03, 0x202012, 0x282812, 0x303013, 0x353515, 0x333314, 0x2E2E12, 0x292910, 0x26260F, 0x29290F,
+			0x2A2A11, 0x26260B, 0x202007, 0x1B1B06, 0x151509, 0x0C0C05, 0x050502, 0x010100, 0x030301, 0x0B0B04,
+			0x101005, 0x0D0D00, 0x0D0D00, 0x0F0F02, 0x0C0C06, 0x060602, 0x010100, 0x050502, 0x060600, 0x8E8E83,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xEBEBE7,
+			0xC4C4B8, 0x626249, 0x1D1D01, 0x191909, 0x0C0C05, 0x030301, 0x070703, 0x101005, 0x2D2D1C, 0xA2A297,
+			0x9E9E94, 0x515141, 0x101003, 0x090904, 0x020200, 0x050501, 0x131308, 0x191901, 0x676749, 0xFFFFFF,
+			0xFFFFFF, 0xC0C0AD, 0x333306, 0x2F2F0F, 0x26260A, 0x2F2F12, 0x8A8A73, 0xEFEFEB, 0xFFFFFF, 0xFFFFFF,
+			0x91917C, 0x222208, 0x151508, 0x060603, 0x090903, 0x111104, 0x454531, 0xFFFFFF, 0xFFFFFF, 0x89897B,
+			0x111100, 0x0C0C05, 0x030301, 0x030301, 0x121207, 0x26260D, 0x515129, 0xFFFFFF, 0xFFFFFF, 0xC3C3B1,
+			0x35350A, 0x2C2C11, 0x21210D, 0x21210C, 0x272706, 0x595933, 0xF3F3EF, 0xFFFFFF, 0xFFFFFF, 0x4B4B2F,
+			0x1A1A07, 0x090904, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200,
+			0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020200, 0x020201, 0x0A0A04, 0x141406, 0x474732,
+			0xFFFFFF, 0xFFFFFF, 0x8A8A7C, 0x111100, 0x0D0D05, 0x040401, 0x010100, 0x020200, 0x020200, 0x010100,
+			0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x010100, 0x010100,
+			0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100,
+			0x010100, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020201,
+			0x111107, 0x25250D, 0x52522B, 0xFFFFFF, 0xFFFFFF, 0xC4C4B1, 0x32320A, 0x24240F, 0x161609, 0x17170A,
+			0x2B2B12, 0x35350A, 0xBCBCA9, 0xFFFFFF, 0xFFFFFF, 0x78785E, 0x1E1E07, 0x0C0C05, 0x010100, 0x010101,
+			0x040401, 0x070702, 0x0A0A04, 0x0B0B04, 0x0C0C05, 0x0A0A04, 0x070703, 0x040401, 0x020201, 0x010100,
+			0x030302, 0x060602, 0x090904, 0x0C0C05, 0x0E0E06, 0x0F0F06, 0x0F0F07, 0x0F0F07, 0x0F0F07, 0x0D0D05,
+			0x0A0A04, 0x0B0B04, 0x0F0F07, 0x1A1A0A, 0x33331C, 0x898977, 0x878774, 0x4B4B37, 0x151506, 0x0D0D05,
+			0x050502, 0x080803, 0x0A0A04, 0x0B0B04, 0x0B0B04, 0x090903, 0x070703, 0x080803, 0x090904, 0x0B0B05,
+			0x0B0B05, 0x090904, 0x050502, 0x030301, 0x010100, 0x010100, 0x050502, 0x090904, 0x0A0A04, 0x0B0B04,
+			0x0A0A04, 0x080803, 0x070703, 0x090904, 0x0B0B04, 0x0B0B05, 0x0B0B04, 0x080803, 0x040401, 0x020201,
+			0x010100, 0x030302, 0x060601, 0x080804, 0x0B0B04, 0x0C0C05, 0x0B0B05, 0x090904, 0x060601, 0x020202,
+			0x010100, 0x010100, 0x030301, 0x060602, 0x090904, 0x0B0B04, 0x0B0B04, 0x0A0A04, 0x080803, 0x080803,
+			0x090904, 0x0B0B04, 0x0B0B04, 0x0A0A04, 0x050503, 0x020201, 0x010100, 0x0E0E06, 0x22220B, 0x4F4F29,
+			0xFFFFFF, 0xFFFFFF, 0xC0C0B0, 0x272706, 0x18180A, 0x080803, 0x090904, 0x20200D, 0x32320C, 0xA8A88E,
+			0xFFFFFF, 0xFFFFFF, 0x87876F, 0x1F1F06, 0x0E0E06, 0x020201, 0x030301, 0x080803, 0x0E0E05, 0x131307,
+			0x141405, 0x151503, 0x171705, 0x151505, 0x141407, 0x101007, 0x090903, 0x050502, 0x010101, 0x030300,
+			0x070703, 0x0D0D06, 0x131308, 0x151506, 0x171705, 0x191905, 0x1C1C06, 0x1E1E07, 0x1F1F09, 0x1E1E07,
+			0x171705, 0x121202, 0x0F0F03, 0x161609, 0x191906, 0x222207, 0x242404, 0x222202, 0x1F1F08, 0x17170A,
+			0x0D0D06, 0x0B0B04, 0x0A0A01, 0x101002, 0x151504, 0x161604, 0x171707, 0x17170A, 0x18180A, 0x181808,
+			0x181806, 0x191906, 0x181808, 0x131307, 0x0A0A04, 0x060603, 0x060602, 0x090903, 0x0C0C00, 0x121203,
+			0x161604, 0x151504, 0x171709, 0x17170A, 0x191909, 0x181807, 0x1A1A06, 0x191906, 0x161609, 0x0F0F06,
+			0x080803, 0x030301, 0x020201, 0x050502, 0x0C0C04, 0x111107, 0x151507, 0x141404, 0x161605, 0x161604,
+			0x151506, 0x131308, 0x0B0B04, 0x060603, 0x040402, 0x060603, 0x0A0A02, 0x0E0E01, 0x131303, 0x161604,
+			0x161605, 0x171709, 0x18180A, 0x191909, 0x181806, 0x171705, 0x121203, 0x101006, 0x080803, 0x020201,
+			0x010100, 0x0E0E06, 0x21210B, 0x4F4F28, 0xFFFFFF, 0xFFFFFF, 0xC1C1B0, 0x2A2A07, 0x1B1B0C, 0x0D0D06,
+			0x0F0F07, 0x23230E, 0x303008, 0xBBBBAA, 0xFFFFFF, 0xFFFFFF, 0x656549, 0x1D1D08, 0x0C0C05, 0x050502,
+			0x090905, 0x131308, 0x181807, 0x191902, 0x40402C, 0x5E5E4C, 0x5D5D4A, 0x50503B, 0x28280F, 0x181805,
+			0x151508, 0x0C0C04, 0x070702, 0x090904, 0x111107, 0x191909, 0x181800, 0x393923, 0x5A5A45, 0x5F5F4B,
+			0x62624A, 0x64644B, 0x67674B, 0x66664C, 0x5F5F4A, 0x5B5B4B, 0x3C3C2C, 0x121200, 0x606051, 0x64644E,
+			0x65654B, 0x68684F, 0x393922, 0x181808, 0x0F0F06, 0x0A0A00, 0x4E4E44, 0x5E5E4D, 0x5D5D47, 0x62624D,
+			0x42422A, 0x26260D, 0x1F1F05, 0x3B3B22, 0x62624C, 0x65654D, 0x3A3A1E, 0x1D1D06, 0x171709, 0x0C0C05,
+			0x0A0A04, 0x101006, 0x65655A, 0x5B5B48, 0x5E5E48, 0x63634D, 0x2E2E14, 0x24240C, 0x222208, 0x4F4F38,
+			0x62624B, 0x5C5C44, 0x2B2B0F, 0x1B1B08, 0x121207, 0x080803, 0x020200, 0x020200, 0x070703, 0x0F0F06,
+			0x18180A, 0x141400, 0x30301A, 0x545441, 0x5D5D4A, 0x5A5A46, 0x3B3B23, 0x1A1A02, 0x191909, 0x101006,
+			0x0A0A04, 0x090902, 0x2A2A1F, 0x626255, 0x5B5B47, 0x60604A, 0x575740, 0x2B2B11, 0x212107, 0x2F2F12,
+			0x5A5A44, 0x5F5F49, 0x5B5B48, 0x1B1B0B, 0x0F0F05, 0x050502, 0x010100, 0x0E0E06, 0x22220B, 0x4F4F2A,
+			0xFFFFFF, 0xFFFFFF, 0xC4C4B2, 0x34340A, 0x282811, 0x1C1C0C, 0x1E1E0D, 0x2F2F12, 0x45451C, 0xE7E7DF,
+			0xFFFFFF, 0xE4E4DD, 0x363618, 0x191909, 0x0C0C05, 0x0A0A04, 0x141408, 0x191904, 0x43432A, 0xCBCBC2,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xE9E9E5, 0x55553C, 0x1D1D05, 0x18180A, 0x101006, 0x141408,
+			0x1C1C09, 0x2D2D10, 0xBBBBB0, 0xF9F9F8, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xAAAAA2, 0x0C0C00, 0x7E7E6E, 0xFCFCFB, 0xFFFFFF, 0xFFFFFF, 0x7B7B67, 0x181804,
+			0x121207, 0x0C0C01, 0x636354, 0xF4F4F0, 0xFFFFFF, 0xFFFFFF, 0x94947C, 0x272700, 0xA2A292, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xF2F2EF, 0x797963, 0x1D1D04, 0x151509, 0x101006, 0x131305, 0x9B9B8E, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0x3C3C13, 0x454524, 0xCBCBC2, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xE1E1DB, 0x3D3D1F,
+			0x1B1B09, 0x0F0F06, 0x060602, 0x050502, 0x101006, 0x1A1A09, 0x1C1C02, 0x969686, 0xF4F4F2, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xF9F9F7, 0xA8A89A, 0x202004, 0x1B1B0A, 0x121208, 0x0E0E04, 0x2E2E1E, 0xBFBFB6,
+			0xFFFFFF, 0xFFFFFF, 0xECECE7, 0x343409, 0x76765C, 0xF0F0EE, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x282811,
+			0x121207, 0x070703, 0x010100, 0x0E0E06, 0x22220B, 0x4F4F2A, 0xFFFFFF, 0xFFFFFF, 0xC1C1AE, 0x353505,
+			0x2B2B0C, 0x212108, 0x222205, 0x303005, 0xB4B4A0, 0xFFFFFF, 0xFFFFFF, 0x545434, 0x212109, 0x141409,
+			0x0C0C04, 0x131308, 0x1D1D06, 0x454528, 0xFFFFFF, 0xFFFFFF, 0x858570, 0x202000, 0x242401, 0x8B8B73,
+			0xFFFFFF, 0xFFFFFF, 0x606047, 0x1F1F08, 0x1D1D0C, 0x20200C, 0x303013, 0xE9E9E4, 0xFFFFFF, 0xC4C4B8,
+			0x42421F, 0x1F1F00, 0x52522C, 0xDCDCD3, 0xFFFFFF, 0xFFFFFF, 0x4E4E1F, 0x1F1F00, 0x181801, 0x20200E,
+			0x202003, 0x616142, 0xFFFFFF, 0xFFFFFF, 0x7A7A63, 0x1E1E06, 0x141408, 0x141409, 0x1C1C04, 0x41411C,
+			0xFFFFFF, 0xFFFFFF, 0x7E7E58, 0xDBDBD2, 0xEBEBE6, 0x9C9C87, 0xAFAF9B, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0x4A4A2A, 0x1B1B09, 0x141409, 0x191909, 0x191900, 0x9A9A85, 0xFFFFFF, 0xFFFFFF, 0x585829, 0xFFFFFF,
+			0xC9C9BE, 0x94947D, 0xD5D5CA, 0xFFFFFF, 0xFFFFFF, 0xD8D8CF, 0x252508, 0x18180A, 0x0C0C05, 0x0D0D05,
+			0x1A1A0A, 0x1E1E01, 0xC1C1B5, 0xFFFFFF, 0xC9C9C0, 0x3C3C1D, 0x191900, 0x4D4D2D, 0xEDEDE9, 0xFFFFFF,
+			0xBDBDB0, 0x25250A, 0x1A1A0A, 0x141408, 0x1B1B08, 0x252502, 0xCECEC2, 0xFFFFFF, 0xD1D1C3, 0x949476,
+			0xFFFFFF, 0x969680, 0xD6D6CD, 0xFFFFFF, 0xFFFFFF, 0x292910, 0x161607, 0x080803, 0x010100, 0x0E0E06,
+			0x21210B, 0x4F4F2A, 0xFFFFFF, 0xFFFFFF, 0xD8D8CC, 0x878767, 0x83836C, 0x7B7B65, 0xA2A291, 0xF6F6F3,
+			0xFFFFFF, 0xBABAA5, 0x515124, 0x30300E, 0x1F1F0D, 0x0F0F06, 0x0F0F06, 0x1D1D0B, 0x323213, 0xF4F4F0,
+			0xFFFFFF, 0x8C8C73, 0x2A2A04, 0x303013, 0x343415, 0x34340A, 0xC6C6B8, 0xFFFFFF, 0xE4E4DD, 0x353513,
+			0x2B2B11, 0x262607, 0xA0A08E, 0xFFFFFF, 0xFBFBFA, 0x3D3D15, 0x303010, 0x2F2F14, 0x33330E, 0x67673E,
+			0xFFFFFF, 0xFFFFFF, 0xBDBDAC, 0x2E2E08, 0x232310, 0x1D1D0C, 0x2C2C10, 0x484820, 0xFFFFFF, 0xFFFFFF,
+			0x808065, 0x242409, 0x151509, 0x131309, 0x262611, 0x2C2C00, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xAFAF9C,
+			0x292904, 0x2C2C09, 0x313106, 0x8B8B6A, 0xFFFFFF, 0xFFFFFF, 0x999984, 0x1E1E05, 0x18180A, 0x1A1A0B,
+			0x29290C, 0x7F7F60, 0xFFFFFF, 0xFFFFFF, 0xFFFFFC, 0x6C6C4E, 0x272704, 0x2E2E0A, 0x383807, 0xCCCCBC,
+			0xFFFFFF, 0xFFFFFF, 0x434323, 0x1E1E0A, 0x131307, 0x16160A, 0x1F1F05, 0x979783, 0xFFFFFF, 0xE0E0D9,
+			0x3B3B14, 0x2F2F0F, 0x313115, 0x32320D, 0x656541, 0xFFFFFF, 0xFFFFFF, 0x6A6A4F, 0x202008, 0x19190B,
+			0x21210E, 0x2B2B07, 0xBBBBA9, 0xFFFFFF, 0xFFFFFF, 0xDEDED4, 0x3B3B12, 0x2B2B06, 0x373714, 0xF2F2EF,
+			0xFFFFFF, 0x25250F, 0x121206, 0x070703, 0x010100, 0x0E0E06, 0x21210B, 0x50502A, 0xFFFFFF, 0xFFFFFF,
+			0xFDFDFC, 0xF5F5F1, 0xF6F6F4, 0xF5F5F3, 0xFAFAF9, 0xFFFFFF, 0xFFFFFF, 0xB3B39B, 0x4E4E20, 0x31310F,
+			0x20200E, 0x121207, 0x151509, 0x202007, 0x82826B, 0xFFFFFF, 0xF9F9F7, 0x56562C, 0x393916, 0x303015,
+			0x333316, 0x3B3B12, 0x929273, 0xFFFFFF, 0xFFFFFF, 0x616140, 0x333311, 0x2D2D06, 0xDBDBD3, 0xFFFFFF,
+			0xD7D7CB, 0x3B3B14, 0x2B2B11, 0x23230F, 0x2F2F12, 0x4B4B21, 0xE7E7DF, 0xFFFFFF, 0xD3D3C8, 0x2F2F0D,
+			0x1E1E0D, 0x19190A, 0x28280F, 0x494923, 0xFFFFFF, 0xFFFFFF, 0x818165, 0x26260A, 0x141409, 0x111107,
+			0x242410, 0x2D2D01, 0xFFFFFF, 0xFFFFFF, 0xD4D4C6, 0x353508, 0x2C2C11, 0x292911, 0x333313, 0x4D4D20,
+			0xFFFFFE, 0xFFFFFF, 0xC2C2B3, 0x222205, 0x1A1A0A, 0x1A1A0C, 0x27270B, 0x818162, 0xFFFFFF, 0xFFFFFF,
+			0x8C8C6D, 0x30300A, 0x2A2A12, 0x2A2A11, 0x373710, 0x848463, 0xFFFFFF, 0xFFFFFF, 0x707053, 0x222209,
+			0x19190A, 0x1E1E0B, 0x3F3F20, 0xEEEEEA, 0xFFFFFF, 0x9F9F85, 0x39390F, 0x343416, 0x2F2F14, 0x3A3A17,
+			0x4F4F21, 0xF6F6F2, 0xFFFFFF, 0xB5B5A5, 0x202003, 0x1C1C0C, 0x20200E, 0x2A2A07, 0xBCBCAB, 0xFFFFFF,
+			0xFCFCF9, 0x64643E, 0x323210, 0x2A2A12, 0x23230B, 0x3D3D28, 0x494938, 0x171709, 0x0E0E05, 0x040402,
+			0x010100, 0x0E0E06, 0x22220B, 0x4F4F2A, 0xFFFFFF, 0xFFFFFF, 0xBDBDA9, 0x313100, 0x262603, 0x1C1C00,
+			0x353516, 0x676744, 0xE4E4DC, 0xFFFFFF, 0xFCFCFB, 0x575736, 0x232309, 0x1A1A0B, 0x1E1E0D, 0x262605,
+			0xCECEC3, 0xFFFFFF, 0xDBDBCF, 0x464613, 0x30300C, 0x232306, 0x252507, 0x313108, 0x69693F, 0xFFFFFF,
+			0xFFFFFF, 0x838369, 0x33330E, 0x3A3A13, 0xEBEBE6, 0xFFFFFF, 0xCDCDBF, 0x383811, 0x26260F, 0x1B1B0C,
+			0x27270F, 0x3F3F18, 0xDCDCD2, 0xFFFFFF, 0xD5D5CB, 0x29290B, 0x171709, 0x131308, 0x24240D, 0x454521,
+			0xFFFFFF, 0xFFFFFF, 0x818165, 0x26260A, 0x121208, 0x0F0F06, 0x21210E, 0x292900, 0xFFFFFF, 0xFFFFFF,
+			0xA3A389, 0x30300B, 0x20200D, 0x19190B, 0x272711, 0x2F2F04, 0xF0F0EB, 0xFFFFFF, 0xCCCCBF, 0x242405,
+			0x1C1C0B, 0x19190A, 0x242409, 0x7E7E62, 0xFFFFFF, 0xFFFFFF, 0x57572E, 0x2D2D10, 0x1C1C0D, 0x1B1B0B,
+			0x2D2D10, 0x5E5E39, 0xFFFFFF, 0xFFFFFF, 0x7C7C60, 0x25250A, 0x1F1F0D, 0x23230A, 0x68684B, 0xFFFFFF,
+			0xFFFFFF, 0x6E6E43, 0x35350A, 0x272709, 0x222205, 0x2C2C0A, 0x3F3F0F, 0xDBDBCE, 0xFFFFFF, 0xE2E2DB,
+			0x262607, 0x1D1D0C, 0x1F1F0C, 0x272706, 0xBBBBAB, 0xFFFFFF, 0xE7E7DF, 0x46461D, 0x2A2A11, 0x19190B,
+			0x121207, 0x101004, 0x0D0D02, 0x0C0C05, 0x070703, 0x020201, 0x010100, 0x0E0E06, 0x22220B, 0x4F4F2A,
+			0xFFFFFF, 0xFFFFFF, 0xC4C4B2, 0x38380C, 0x2D2D13, 0x20200F, 0x21210C, 0x2E2E0D, 0x424217, 0xECECE6,
+			0xFFFFFF, 0xF2F2EF, 0x39391A, 0x23230D, 0x26260E, 0x41411F, 0xEAEAE3, 0xFFFFFF, 0xE4E4DD, 0xA1A186,
+			0x9B9B88, 0x949486, 0x959586, 0x9A9A86, 0xA9A992, 0xFFFFFF, 0xFFFFFF, 0x9E9E8C, 0x2C2C0A, 0x2D2D05,
+			0xDDDDD6, 0xFFFFFF, 0xE1E1D7, 0x3F3F15, 0x2E2E12, 0x262610, 0x2E2E12, 0x47471F, 0xE6E6DF, 0xFFFFFF,
+			0xB0B0A0, 0x1D1D02, 0x151509, 0x121207, 0x23230D, 0x454521, 0xFFFFFF, 0xFFFFFF, 0x818165, 0x26260A,
+			0x121207, 0x0F0F07, 0x21210E, 0x272700, 0xFFFFFF, 0xFFFFFF, 0x9F9F88, 0x2A2A09, 0x18180A, 0x101007,
+			0x1E1E0C, 0x292903, 0xE9E9E3, 0xFFFFFF, 0xCBCBBE, 0x262606, 0x1D1D0C, 0x19190A, 0x242409, 0x7C7C60,
+			0xFFFFFF, 0xFFFFFF, 0x51512B, 0x25250D, 0x131308, 0x121208, 0x24240B, 0x595938, 0xFFFFFF, 0xFFFFFF,
+			0x7B7B5F, 0x29290B, 0x24240F, 0x262608, 0x9A9A83, 0xFFFFFF, 0xFFFFFF, 0xAAAA90, 0x9F9F89, 0x979786,
+			0x939385, 0x989887, 0x9D9D86, 0xE9E9E2, 0xFFFFFF, 0xF2F2EE, 0x313117, 0x19190A, 0x1F1F0D, 0x262605,
+			0xBABAAB, 0xFFFFFF, 0xE6E6DF, 0x3F3F1B, 0x21210C, 0x0D0D06, 0x060602, 0x050502, 0x060602, 0x040401,
+			0x020201, 0x010100, 0x0E0E06, 0x22220B, 0x4F4F29, 0xFFFFFF, 0xFFFFFF, 0xC3C3B1, 0x2D2D08, 0x21210E,
+			0x121208, 0x121208, 0x25250F, 0x31310B, 0x9C9C81, 0xFFFFFF, 0xFFFFFF, 0x86866E, 0x282809, 0x2B2B10,
+			0x4C4C29, 0xF1F1EC, 0xFFFFFF, 0xF5F5F2, 0xDDDDD4, 0xDEDED8, 0xDBDBD7, 0xDADAD6, 0xDBDBD7, 0xDADAD4,
+			0xD0D0C8, 0xD7D7D1, 0x878777, 0x222208, 0x2C2C0B, 0x909079, 0xFFFFFF, 0xFFFFFF, 0x61613B, 0x2F2F0A,
+			0x2F2F12, 0x2A2A07, 0x686849, 0xFFFFFF, 0xFFFFFF, 0x59593D, 0x1C1C08, 0x101007, 0x111106, 0x23230D,
+			0x454521, 0xFFFFFF, 0xFFFFFF, 0x818165, 0x26260A, 0x121207, 0x0F0F07, 0x21210E, 0x282800, 0xFFFFFF,
+			0xFFFFFF, 0x9F9F88, 0x262607, 0x151508, 0x0E0E05, 0x1D1D0C, 0x272703, 0xEAEAE4, 0xFFFFFF, 0xCBCBBE,
+			0x272707, 0x1D1D0C, 0x19190A, 0x242409, 0x7D7D61, 0xFFFFFF, 0xFFFFFF, 0x4F4F2B, 0x23230C, 0x111106,
+			0x101006, 0x23230B, 0x575736, 0xFFFFFF, 0xFFFFFF, 0x7B7B5F, 0x29290C, 0x252510, 0x272707, 0xADAD99,
+			0xFFFFFF, 0xFFFFFF, 0xDEDED3, 0xDFDFD8, 0xDCDCD7, 0xDBDBD6, 0xDBDBD6, 0xDBDBD6, 0xD4D4CD, 0xD2D2CB,
+			0xC1C1B9, 0x2D2D19, 0x151507, 0x1E1E0D, 0x262605, 0xBABAAB, 0xFFFFFF, 0xE6E6DF, 0x3D3D1A, 0x1F1F0C,
+			0x090904, 0x010100, 0x010100, 0x0E0E06, 0x22220B, 0x4F4F29, 0xFFFFFF, 0xFFFFFF, 0xC0C0B0, 0x272706,
+			0x18180A, 0x080803, 0x060603, 0x19190A, 0x2D2D0D, 0x7E7E5C, 0xFFFFFF, 0xFFFFFF, 0xB1B19F, 0x2B2B09,
+			0x2F2F11, 0x4D4D29, 0xF1F1EC, 0xFFFFFF, 0xC0C0AC, 0x343400, 0x292905, 0x171700, 0x131300, 0x161600,
+			0x1A1A00, 0x1B1B00, 0x151500, 0x151503, 0x1F1F0D, 0x292910, 0x3D3D18, 0xD7D7CC, 0xFFFFFF, 0xEAEAE6,
+			0x747456, 0x3A3A17, 0x6A6A4F, 0xF4F4F2, 0xFFFFFF, 0xA1A190, 0x1D1D04, 0x161609, 0x0A0A04, 0x101007,
+			0x23230D, 0x454521, 0xFFFFFF, 0xFFFFFF, 0x818165, 0x26260A, 0x121207, 0x0F0F07, 0x21210E, 0x282800,
+			0xFFFFFF, 0xFFFFFF, 0x9E9E88, 0x262607, 0x141408, 0x0E0E05, 0x1C1C0C, 0x282803, 0xEAEAE4, 0xFFFFFF,
+			0xCBCBBE, 0x272707, 0x1D1D0C, 0x19190A, 0x242409, 0x7D7D61, 0xFFFFFF, 0xFFFFFF, 0x4F4F2B, 0x22220C,
+			0x101006, 0x0F0F06, 0x23230B, 0x575736, 0xFFFFFF, 0xFFFFFF, 0x7B7B5F, 0x29290C, 0x252510, 0x272707,
+			0xADAD99, 0xFFFFFF, 0xFFFFFF, 0x414108, 0x323207, 0x1E1E00, 0x121200, 0x141400, 0x181800, 0x1B1B00,
+			0x191900, 0x121200, 0x131307, 0x101007, 0x1C1C0B, 0x252505, 0xBABAAB, 0xFFFFFF, 0xE6E6DF, 0x3D3D1B,
+			0x1D1D0B, 0x090904, 0x010100, 0x0E0E06, 0x21210B, 0x4F4F28, 0xFFFFFF, 0xFFFFFF, 0xC0C0B0, 0x262605,
+			0x171709, 0x060602, 0x050502, 0x171709, 0x2B2B0D, 0x7C7C5A, 0xFFFFFF, 0xFFFFFF, 0xB6B6A5, 0x2A2A08,
+			0x2D2D12, 0x40401C, 0xE6E6E0, 0xFFFFFF, 0xD6D6C9, 0x49491A, 0x343416, 0x21210E, 0x19190B, 0x1B1B0B,
+			0x1D1D0D, 0x1E1E0D, 0x1A1A0B, 0x161608, 0x19190A, 0x252510, 0x30300C, 0x464618, 0xFFFFFF, 0xEAEAE5,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xD2D2CA, 0x75755D, 0x1D1D00, 0x1A1A0B, 0x0E0E05, 0x050502, 0x0E0E05,
+			0x23230D, 0x454521, 0xFFFFFF, 0xFFFFFF, 0x818165, 0x25250A, 0x121207, 0x0F0F06, 0x22220E, 0x272700,
+			0xFFFFFF, 0xFFFFFF, 0x9E9E88, 0x262607, 0x141408, 0x0E0E05, 0x1C1C0C, 0x272703, 0xEAEAE4, 0xFFFFFF,
+			0xCBCBBD, 0x262606, 0x1D1D0C, 0x19190B, 0x242408, 0x7C7C60, 0xFFFFFF, 0xFFFFFF, 0x4F4F2B, 0x22220C,
+			0x111106, 0x0F0F06, 0x23230B, 0x575736, 0xFFFFFF, 0xFFFFFF, 0x7A7A5F, 0x28280B, 0x23230F, 0x262609,
+			0x94947C, 0xFFFFFF, 0xFFFFFF, 0x69693D, 0x3C3C16, 0x292912, 0x1C1C0C, 0x1A1A0B, 0x1C1C0D, 0x1E1E0D,
+			0x1C1C0C, 0x171709, 0x0D0D05, 0x0D0D06, 0x1A1A0B, 0x252505, 0xBABAAB, 0xFFFFFF, 0xE6E6DF, 0x3D3D1B,
+			0x1D1D0B, 0x090904, 0x010100, 0x010100, 0x0F0F06, 0x23230B, 0x51512A, 0xFFFFFF, 0xFFFFFF, 0xC2C2B0,
+			0x2B2B07, 0x1D1D0D, 0x0E0E06, 0x0E0E05, 0x21210E, 0x31310C, 0x919173, 0xFFFFFF, 0xFFFFFF, 0x9A9A85,
+			0x272709, 0x272710, 0x292906, 0xCBCBBF, 0xFFFFFF, 0xF8F8F4, 0x545426, 0x363614, 0x252510, 0x1C1C0C,
+			0x1B1B0B, 0x1C1C0C, 0x161607, 0x0A0A00, 0x121206, 0x17170A, 0x22220C, 0x4A4A2A, 0xFFFFFF, 0xA4A487,
+			0x44440E, 0x424211, 0x38380C, 0x33330B, 0x30300B, 0x2B2B0D, 0x272711, 0x19190A, 0x0D0D05, 0x060602,
+			0x101007, 0x25250D, 0x484822, 0xFFFFFF, 0xFFFFFF, 0x838366, 0x27270A, 0x151509, 0x111107, 0x23230F,
+			0x2A2A00, 0xFFFFFF, 0xFFFFFF, 0xA0A089, 0x282808, 0x16160A, 0x101007, 0x1D1D0C, 0x2A2A03, 0xEAEAE4,
+			0xFFFFFF, 0xCDCDBE, 0x292907, 0x1F1F0C, 0x1C1C0C, 0x26260A, 0x7E7E62, 0xFFFFFF, 0xFFFFFF, 0x51512C,
+			0x24240C, 0x121208, 0x101006, 0x25250B, 0x595938, 0xFFFFFF, 0xFFFFFF, 0x7D7D5F, 0x2A2A0B, 0x22220E,
+			0x24240A, 0x666649, 0xFFFFFF, 0xFFFFFF, 0x9B9B7E, 0x37370D, 0x2D2D14, 0x1F1F0D, 0x1B1B0B, 0x1C1C0C,
+			0x1B1B0B, 0x0D0D00, 0x0D0D02, 0x0B0B05, 0x0C0C05, 0x1C1C0B, 0x272707, 0xBCBCAB, 0xFFFFFF, 0xE7E7DF,
+			0x3F3F1B, 0x1F1F0B, 0x0A0A04, 0x010100, 0x030301, 0x111107, 0x26260D, 0x52522A, 0xFFFFFF, 0xFFFFFF,
+			0xC4C4B1, 0x34340B, 0x282811, 0x1B1B0C, 0x1B1B0B, 0x2C2C11, 0x38380E, 0xD5D5C9, 0xFFFFFF, 0xFFFFFF,
+			0x58583A, 0x21210B, 0x1E1E0C, 0x222208, 0x7A7A60, 0xFFFFFF, 0xFFFFFF, 0xA4A48C, 0x333308, 0x2D2D11,
+			0x26260F, 0x22220C, 0x141400, 0x3C3C2B, 0xA2A29B, 0x1A1A0D, 0x19190A, 0x1D1D02, 0xB4B4A6, 0xFFFFFF,
+			0x7B7B53, 0x46460D, 0x494913, 0x434310, 0x3B3B0D, 0x38380C, 0x303008, 0x282809, 0x20200B, 0x161609,
+			0x0D0D06, 0x161609, 0x28280F, 0x4B4B24, 0xFFFFFF, 0xFFFFFF, 0x838366, 0x2A2A0B, 0x17170A, 0x141409,
+			0x262611, 0x2B2B00, 0xFFFFFF, 0xFFFFFF, 0xA1A189, 0x2A2A08, 0x19190A, 0x121208, 0x20200D, 0x2C2C04,
+			0xE9E9E3, 0xFFFFFF, 0xCDCDBE, 0x2D2D09, 0x23230E, 0x1F1F0E, 0x2A2A0C, 0x7F7F60, 0xFFFFFF, 0xFFFFFF,
+			0x52522C, 0x26260D, 0x151509, 0x141409, 0x27270C, 0x5A5A38, 0xFFFFFF, 0xFFFFFF, 0x7E7E5F, 0x2B2B0C,
+			0x20200D, 0x20200C, 0x3C3C1C, 0xE9E9E3, 0xFFFFFF, 0xEBEBE4, 0x4F4F25, 0x2F2F0D, 0x282810, 0x24240D,
+			0x1C1C06, 0x151500, 0x96968D, 0x4D4D43, 0x070700, 0x0E0E06, 0x1D1D0D, 0x2B2B07, 0xBCBCAB, 0xFFFFFF,
+			0xE6E6DF, 0x41411C, 0x21210D, 0x0C0C05, 0x020200, 0x030301, 0x121208, 0x24240B, 0x505029, 0xFFFFFF,
+			0xFFFFFF, 0xBFBFAC, 0x2D2D00, 0x252508, 0x1B1B03, 0x1D1D04, 0x242400, 0x9B9B86, 0xFFFFFF, 0xFFFFFF,
+			0xAEAE9C, 0x27270A, 0x19190A, 0x131307, 0x1D1D0B, 0x2F2F10, 0xE8E8E1, 0xFFFFFF, 0xFFFFFF, 0xA7A791,
+			0x44441E, 0x2B2B07, 0x353516, 0x8D8D7D, 0xFFFFFF, 0xE4E4E1, 0x242415, 0x1C1C0A, 0x1E1E00, 0xE2E2DC,
+			0xFFFFFF, 0xF1F1ED, 0xC7C7B6, 0xC8C8B7, 0xC8C8B7, 0xC6C6B6, 0xC5C5B6, 0xC6C6B9, 0x979781, 0x373717,
+			0x1E1E06, 0x19190A, 0x1B1B0C, 0x27270C, 0x595936, 0xFFFFFF, 0xFFFFFF, 0x838367, 0x262606, 0x1A1A0B,
+			0x171709, 0x25250E, 0x38380F, 0xFFFFFF, 0xFFFFFF, 0xA2A28B, 0x252503, 0x1A1A0A, 0x151509, 0x21210D,
+			0x242400, 0xEEEEE9, 0xFFFFFF, 0xCFCFC2, 0x262601, 0x25250F, 0x22220F, 0x272706, 0x8D8D72, 0xFFFFFF,
+			0xFFFFFF, 0x51512C, 0x24240A, 0x17170A, 0x16160A, 0x25250B, 0x565632, 0xFFFFFF, 0xFFFFFF, 0x7E7E61,
+			0x262607, 0x1D1D0C, 0x1B1B0B, 0x212106, 0x878770, 0xFFFFFF, 0xFFFFFF, 0xDADAD0, 0x6C6C4A, 0x2D2D07,
+			0x2B2B08, 0x61614A, 0xCECEC8, 0xFFFFFF, 0x65655B, 0x080800, 0x101007, 0x1E1E0C, 0x2B2B08, 0xC7C7B8,
+			0xFFFFFF, 0xE7E7E0, 0x3E3E18, 0x21210C, 0x0D0D06, 0x030301, 0x040402, 0x101006, 0x23230C, 0xABAB9B,
+			0xFFFFFF, 0xFFFFFF, 0xE6E6DE, 0x9D9D87, 0x9C9C8C, 0x979788, 0xAFAFA3, 0xFAFAF8, 0xFFFFFF, 0xFFFFFF,
+			0xA6A694, 0x1E1E00, 0x1C1C0B, 0x0F0F06, 0x090904, 0x121208, 0x1D1D08, 0x343414, 0xE3E3DD, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xA7A79B, 0x111100, 0x151506, 0x1F1F0E, 0x28280A,
+			0x88886C, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0x6A6A50, 0x212108, 0x21210D, 0x28280C, 0xBFBFB2, 0xFFFFFF, 0xFFFFFF, 0xDADAD1, 0x313116,
+			0x181808, 0x18180A, 0x1D1D06, 0xA6A695, 0xFFFFFF, 0xFFFFFF, 0xF0F0EC, 0x39391E, 0x171707, 0x161608,
+			0x161601, 0x7B7B65, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x58583C, 0x21210A, 0x1F1F0A, 0x333317, 0xEBEBE5,
+			0xFFFFFF, 0xFFFFFF, 0xB1B1A1, 0x212109, 0x171708, 0x161608, 0x27270E, 0xB7B7A9, 0xFFFFFF, 0xFFFFFF,
+			0xD5D5CC, 0x393921, 0x151506, 0x131307, 0x1B1B0B, 0x202003, 0x8F8F7A, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFAFAF8, 0x3E3E2A, 0x0A0A00, 0x0F0F06, 0x0F0F07, 0x131301, 0x5D5D45,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x898974, 0x191903, 0x0C0C05, 0x040401, 0x050502, 0x040400, 0x92928B,
+			0xD4D4CE, 0xCCCCC4, 0xCDCDC3, 0xD0D0C8, 0xD7D7D1, 0xD6D6D1, 0xD5D5D1, 0xD6D6D1, 0xB5B5AB, 0x71715C,
+			0x353519, 0x1F1F06, 0x1A1A0A, 0x0F0F06, 0x070703, 0x040402, 0x090903, 0x121207, 0x1D1D09, 0x262609,
+			0x6B6B52, 0xB5B5A7, 0xCECEC6, 0xD0D0C8, 0x969685, 0x47472F, 0x151500, 0x161608, 0x161608, 0x1E1E0D,
+			0x2E2E10, 0x47471A, 0xD8D8CC, 0xFFFFFE, 0xD1D1C3, 0xD1D1C5, 0xCFCFC4, 0xCFCFC4, 0xD0D0C3, 0xE6E6DE,
+			0xFFFFFF, 0xFFFFFF, 0xEDEDE9, 0x303010, 0x1D1D04, 0x8F8F82, 0xD5D5D0, 0xCBCBC3, 0xCCCCC3, 0xD1D1CB,
+			0xBBBBB5, 0x090900, 0x0D0D00, 0x717166, 0xD7D7D2, 0xCCCCC3, 0xCBCBC3, 0xCFCFC9, 0xC9C9C3, 0x131304,
+			0x0E0E02, 0x474739, 0xD8D8D4, 0xCCCCC4, 0xCBCBC3, 0xCDCDC6, 0xD7D7D3, 0x414131, 0x161604, 0xAFAFA7,
+			0xD2D2CC, 0xCBCBC3, 0xCCCCC3, 0xD4D4CF, 0x8C8C83, 0x0B0B00, 0x0B0B00, 0x8F8F85, 0xD4D4CF, 0xCBCBC3,
+			0xCBCBC3, 0xD1D1CB, 0xBABAB4, 0x121205, 0x0B0B04, 0x0F0F06, 0x191909, 0x1F1F05, 0x4A4A2E, 0x8E8E7A,
+			0xD2D2CA, 0xCDCDC5, 0xBABAB0, 0x6C6C58, 0x1F1F06, 0x141404, 0x111107, 0x0B0B04, 0x0A0A02, 0x313124,
+			0xC4C4BE, 0xCFCFC9, 0xCCCCC3, 0xCDCDC5, 0xD4D4CF, 0x828279, 0x050500, 0x040401, 0x030301, 0x0B0B04,
+			0x090900, 0x0F0F00, 0x191900, 0x1D1D00, 0x1C1C00, 0x181800, 0x131300, 0x121200, 0x121200, 0x151500,
+			0x191904, 0x1A1A09, 0x141408, 0x0D0D05, 0x050503, 0x020200, 0x030301, 0x090903, 0x101007, 0x19190A,
+			0x1C1C06, 0x1B1B01, 0x1B1B00, 0x181800, 0x181801, 0x191906, 0x141408, 0x0F0F06, 0x121208, 0x1F1F0B,
+			0x3A3A1A, 0xDCDCD4, 0xFFFFFF, 0x7A7A56, 0x373707, 0x2F2F08, 0x272704, 0x292905, 0x333307, 0x4E4E1D,
+			0xC2C2AE, 0xFFFFFF, 0xFDFDFC, 0x535334, 0x22220C, 0x151501, 0x101000, 0x171700, 0x181800, 0x111100,
+			0x0A0A00, 0x0F0F07, 0x0F0F05, 0x0D0D00, 0x0E0E00, 0x181800, 0x181800, 0x131300, 0x0A0A00, 0x0E0E05,
+			0x0D0D05, 0x0D0D02, 0x0C0C00, 0x151500, 0x191900, 0x151500, 0x0B0B00, 0x101004, 0x131308, 0x0D0D00,
+			0x111100, 0x191900, 0x181800, 0x0F0F00, 0x0A0A00, 0x0E0E05, 0x0E0E07, 0x0B0B00, 0x0F0F00, 0x171700,
+			0x191900, 0x111100, 0x090900, 0x0D0D04, 0x070703, 0x070702, 0x0D0D05, 0x151509, 0x1C1C09, 0x1C1C04,
+			0x1B1B00, 0x1A1A00, 0x171700, 0x181804, 0x181809, 0x101007, 0x0A0A04, 0x050502, 0x080803, 0x0C0C03,
+			0x0B0B00, 0x141400, 0x191900, 0x161600, 0x0D0D00, 0x090900, 0x090903, 0x030301, 0x010100, 0x060602,
+			0x0A0A04, 0x111107, 0x141408, 0x171709, 0x18180A, 0x17170A, 0x161609, 0x151509, 0x141408, 0x131308,
+			0x101007, 0x0C0C05, 0x070703, 0x030301, 0x010100, 0x020201, 0x060602, 0x0B0B04, 0x101007, 0x141409,
+			0x16160A, 0x16160A, 0x131307, 0x0E0E06, 0x080803, 0x080803, 0x111107, 0x1A1A03, 0x949482, 0xFFFFFF,
+			0xDEDED5, 0x323202, 0x363617, 0x272711, 0x1F1F0D, 0x22220E, 0x313114, 0x3E3E14, 0x75754D, 0xFFFFFF,
+			0xFEFEFD, 0x575738, 0x1F1F0A, 0x161609, 0x111106, 0x141409, 0x151509, 0x121207, 0x0D0D06, 0x090904,
+			0x070703, 0x0B0B04, 0x0F0F07, 0x131308, 0x151509, 0x121207, 0x0D0D06, 0x090903, 0x070703, 0x0A0A04,
+			0x0F0F05, 0x131308, 0x151509, 0x131307, 0x0F0F07, 0x0B0B04, 0x0B0B04, 0x0E0E06, 0x121207, 0x151509,
+			0x131308, 0x111107, 0x0B0B05, 0x080803, 0x080803, 0x0B0B05, 0x111107, 0x141409, 0x151509, 0x121207,
+			0x0C0C05, 0x070702, 0x030301, 0x020201, 0x030301, 0x080804, 0x0D0D05, 0x121207, 0x16160A, 0x17170A,
+			0x151509, 0x101007, 0x0B0B04, 0x060603, 0x020201, 0x020201, 0x040402, 0x090903, 0x0E0E06, 0x121208,
+			0x151509, 0x141408, 0x101007, 0x0B0B03, 0x040402, 0x020201, 0x010100, 0x030302, 0x050501, 0x050502,
+			0x060602, 0x060603, 0x060602, 0x070703, 0x060602, 0x050502, 0x040401, 0x030302, 0x010100, 0x010100,
+			0x010100, 0x030301, 0x040401, 0x040401, 0x040401, 0x040401, 0x020200, 0x040401, 0x101007, 0x171700,
+			0xC7C7BC, 0xFFFFFF, 0xC6C6B7, 0x333308, 0x303014, 0x20200E, 0x171709, 0x1B1B0B, 0x2A2A11, 0x343410,
+			0x6F6F4C, 0xFFFFFF, 0xF9F9F7, 0x373719, 0x1A1A09, 0x0C0C05, 0x050502, 0x050502, 0x050502, 0x050501,
+			0x030302, 0x030301, 0x020201, 0x030302, 0x050501, 0x050502, 0x050502, 0x050501, 0x030302, 0x030301,
+			0x020201, 0x030301, 0x040402, 0x050501, 0x050502, 0x050501, 0x040401, 0x030302, 0x030302, 0x040401,
+			0x050501, 0x050502, 0x050502, 0x050501, 0x030302, 0x020201, 0x030301, 0x030301, 0x050501, 0x050502,
+			0x050502, 0x050501, 0x040402, 0x010100, 0x010100, 0x010100, 0x020200, 0x040401, 0x040401, 0x050502,
+			0x040401, 0x020201, 0x020200, 0x010100, 0x020200, 0x040402, 0x060602, 0x050502, 0x050502, 0x040401,
+			0x030301, 0x020200, 0x030301, 0x0E0E06, 0x181802, 0x969684, 0xFFFFFF, 0xFAFAF8, 0x36360C, 0x282809,
+			0x22220C, 0x1A1A0A, 0x1F1F0C, 0x232307, 0x2E2E0A, 0xCACABD, 0xFFFFFF, 0x9B9B8A, 0x1C1C03, 0x131308,
+			0x060602, 0x020200, 0x0B0B05, 0x171708, 0x38381D, 0xE8E8E3, 0xFFFFFF, 0xE8E8E2, 0x72725B, 0x2F2F14,
+			0x222208, 0x202004, 0x6C6C57, 0xCFCFC6, 0xFFFFFF, 0xC2C2B8, 0x28280D, 0x19190A, 0x0C0C05, 0x040402,
+			0x060603, 0x101007, 0x191907, 0x28280D, 0x8D8D7C, 0xE0E0DA, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xCBCBC4, 0x6A6A56, 0x151500, 0x181809, 0x0F0F06, 0x050502, 0x030301, 0x080803, 0x101006,
+			0x171708, 0x161601, 0x1F1F07, 0x24240D, 0x26260F, 0x24240D, 0x24240E, 0x22220B, 0x191904, 0x151502,
+			0x151508, 0x0D0D06, 0x070703, 0x020201, 0x030302, 0x060602, 0x0C0C05, 0x111107, 0x141408, 0x161608,
+			0x171708, 0x171708, 0x171708, 0x161608, 0x121207, 0x0F0F07, 0x090904, 0x040401, 0x020200, 0x010100,
+			0x020201, 0x040402, 0x070703, 0x090903, 0x0A0A04, 0x0B0B04, 0x0A0A04, 0x090903, 0x070702, 0x040402,
+			0x010100, 0x010100, 0x020201, 0x040401, 0x030301, 0x030301, 0x030301, 0x020201, 0x020201, 0x010100,
+			0x040402, 0x080803, 0x090903, 0x090903, 0x070703, 0x040402, 0x020201, 0x010100, 0x040401, 0x080804,
+			0x0E0E06, 0x111107, 0x111108, 0x0F0F06, 0x0C0C05, 0x070702, 0x030301, 0x010100, 0x040401, 0x0A0A05,
+			0x121208, 0x161609, 0x18180A, 0x141408, 0x0C0C05, 0x060602, 0x030300, 0x010100, 0x030300, 0x040401,
+			0x050502, 0x050503, 0x020200, 0x010100, 0x020201, 0x090903, 0x090900, 0x111100, 0x181803, 0x1A1A04,
+			0x151502, 0x0C0C00, 0x090902, 0x060602, 0x020200, 0x010100, 0x020200, 0x070703, 0x0C0C02, 0x0A0A00,
+			0x0E0E00, 0x111100, 0x0C0C00, 0x171709, 0x0C0C06, 0x060601, 0x050502, 0x090903, 0x0E0E06, 0x101007,
+			0x0D0D06, 0x090903, 0x040402, 0x010100, 0x050501, 0x070700, 0x65655B, 0x858577, 0x83836E, 0x858570,
+			0x81816E, 0x8C8C81, 0x323226, 0x070701, 0x020201, 0x020201, 0x040401, 0x060602, 0x060602, 0x040401,
+			0x030301, 0x010100, 0x020200, 0x060600, 0x37372A, 0xF8F8F5, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x0F0F00,
+			0x151509, 0x0B0B05, 0x0B0B05, 0x141407, 0x0D0D00, 0x0D0D00, 0x0E0E00, 0x121207, 0x090904, 0x020201,
+			0x020201, 0x040401, 0x060602, 0x060602, 0x040401, 0x020201, 0x010100, 0x050502, 0x0C0C01, 0x51513F,
+			0xEBEBE6, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xA2A293, 0x262615, 0x0B0B03, 0x030301, 0x020200, 0x060602,
+			0x0C0C05, 0x0F0F06, 0x101007, 0x0D0D04, 0x070704, 0x030302, 0x020200, 0x090904, 0x141406, 0x232303,
+			0xD2D2C8, 0xFFFFFF, 0xFFFFFF, 0x1A1A00, 0x1B1B0C, 0x0F0F06, 0x0F0F06, 0x181806, 0xCCCCC7, 0xEFEFEC,
+			0xBABAB2, 0x191907, 0x0E0E05, 0x040401, 0x020200, 0x060603, 0x0C0C05, 0x101007, 0x101006, 0x0B0B05,
+			0x070702, 0x020201, 0x040401, 0x131308, 0x1E1E05, 0x585835, 0xFFFFFF, 0xFFFFFF, 0xE6E6DE, 0x1A1A00,
+			0x1C1C0B, 0x0B0B04, 0x010100, 0x040401, 0x0C0C04, 0x151509, 0x080800, 0x060600, 0x101001, 0x0D0D06,
+			0x060602, 0x010100, 0x070703, 0x18180B, 0x272706, 0x9E9E87, 0xFFFFFF, 0xFFFFFF, 0x232300, 0x1E1E0E,
+			0x101007, 0x111106, 0x1B1B06, 0xEAEAE8, 0xFFFFFF, 0xD5D5D0, 0x1C1C08, 0x101006, 0x050502, 0x050502,
+			0x0D0D05, 0x151506, 0x070700, 0x060600, 0x111104, 0x0C0C05, 0x040402, 0x030301, 0x111107, 0x26260E,
+			0x515129, 0xFFFFFF, 0xFFFFFF, 0xC9C9B9, 0x2D2D07, 0x1D1D0D, 0x0B0B05, 0x030300, 0x020201, 0x040401,
+			0x040401, 0x030301, 0x030301, 0x010100, 0x020201, 0x020201, 0x030301, 0x030301, 0x030301, 0x010100,
+			0x020200, 0x090903, 0x17170A, 0x121200, 0xFFFFFF, 0xFFFFFF, 0x6A6A57, 0x161603, 0x0F0F06, 0x060602,
+			0x020201, 0x010100, 0x010100, 0x010100, 0x030301, 0x030301, 0x030301, 0x030301, 0x020201, 0x010100,
+			0x010100, 0x010100, 0x030301, 0x040401, 0x040401, 0x030301, 0x020201, 0x010100, 0x010100, 0x030301,
+			0x030301, 0x030301, 0x030301, 0x030301, 0x030301, 0x040401, 0x040401, 0x030301, 0x020201, 0x010100,
+			0x010100, 0x020201, 0x030301, 0x030301, 0x020201, 0x010100, 0x010100, 0x010100, 0x010100, 0x030301,
+			0x030301, 0x020201, 0x010100, 0x010100, 0x010100, 0x030301, 0x030301, 0x030301, 0x030301, 0x020201,
+			0x010100, 0x020200, 0x030301, 0x040400, 0x0B0B05, 0x1B1B0C, 0x2D2D0B, 0x929278, 0xFFFFFF, 0xFFFFFF,
+			0x272700, 0x22220F, 0x131308, 0x121207, 0x1E1E07, 0xF7F7F6, 0xFFFFFF, 0xE0E0DC, 0x1C1C08, 0x101006,
+			0x050502, 0x010100, 0x020200, 0x030301, 0x040401, 0x040401, 0x030301, 0x010100, 0x010100, 0x010101,
+			0x0C0C04, 0x181809, 0x29290F, 0xFFFFFF, 0xFFFFFF, 0x42422D, 0x171706, 0x0D0D05, 0x050502, 0x030301,
+			0x010100, 0x010100, 0x010100, 0x010100, 0x030301, 0x030301, 0x030301, 0x030301, 0x010100, 0x020201,
+			0x101007, 0x23230C, 0x51512A, 0xFFFFFF, 0xFFFFFF, 0xC6C6B4, 0x2B2B06, 0x1C1C0C, 0x0B0B05, 0x050502,
+			0x0A0A04, 0x0D0D06, 0x0F0F05, 0x0E0E05, 0x0B0B04, 0x0A0A04, 0x0C0C05, 0x0D0D05, 0x101007, 0x0F0F05,
+			0x0B0B06, 0x070702, 0x030302, 0x020200, 0x040402, 0x111107, 0x22220D, 0x343410, 0xFFFFFF, 0xFFFFFF,
+			0x707054, 0x27270B, 0x1C1C0C, 0x101006, 0x090903, 0x050503, 0x030301, 0x020200, 0x040401, 0x070702,
+			0x0B0B05, 0x0F0F06, 0x101006, 0x101006, 0x0D0D05, 0x080803, 0x050502, 0x030300, 0x020201, 0x050501,
+			0x0A0A04, 0x0C0C06, 0x0E0E05, 0x0E0E05, 0x0C0C05, 0x0B0B04, 0x0B0B04, 0x0E0E06, 0x0F0F06, 0x0D0D05,
+			0x0C0C05, 0x0A0A04, 0x0B0B04, 0x0C0C05, 0x0E0E05, 0x0E0E05, 0x0C0C04, 0x0B0B04, 0x0B0B04, 0x0D0D06,
+			0x0F0F05, 0x0F0F07, 0x0C0C06, 0x090904, 0x060602, 0x060602, 0x080803, 0x0C0C04, 0x0E0E06, 0x101007,
+			0x0D0D06, 0x080803, 0x040401, 0x020200, 0x010100, 0x040401, 0x070702, 0x0B0B05, 0x0F0F06, 0x101006,
+			0x101006, 0x0D0D05, 0x080803, 0x050502, 0x010100, 0x020200, 0x050502, 0x0A0A03, 0x0C0C05, 0x0F0F06,
+			0x151509, 0x24240F, 0x33330E, 0x95957A, 0xFFFFFF, 0xFFFFFF, 0x282800, 0x23230F, 0x141409, 0x151509,
+			0x22220D, 0x494931, 0x515136, 0x42422C, 0x1C1C0A, 0x0F0F06, 0x050501, 0x010100, 0x020200, 0x050503,
+			0x080802, 0x0B0B05, 0x0F0F05, 0x101007, 0x111107, 0x0E0E05, 0x0A0A04, 0x060602, 0x030301, 0x020200,
+			0x050502, 0x141408, 0x24240C, 0x4F4F2E, 0xFFFFFF, 0xFEFEFC, 0x4F4F30, 0x28280E, 0x19190A, 0x0E0E05,
+			0x090904, 0x050502, 0x040401, 0x040401, 0x060602, 0x0A0A04, 0x0D0D05, 0x101007, 0x0F0F06, 0x0E0E06,
+			0x090904, 0x060602, 0x030302, 0x010100, 0x0E0E06, 0x21210B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC5C5B5,
+			0x282805, 0x1A1A0B, 0x0B0B05, 0x0A0A04, 0x080800, 0x101000, 0x141402, 0x151502, 0x181808, 0x18180A,
+			0x19190A, 0x171704, 0x181803, 0x171702, 0x181808, 0x121207, 0x0A0A04, 0x050501, 0x080804, 0x171709,
+			0x242407, 0x686846, 0xFFFFFF, 0xFFFFFF, 0x777752, 0x2C2C06, 0x1D1D06, 0x0F0F00, 0x070700, 0x090903,
+			0x060603, 0x080803, 0x0C0C05, 0x121207, 0x141405, 0x131302, 0x141401, 0x141401, 0x151504, 0x141408,
+			0x0D0D06, 0x090903, 0x060603, 0x0A0A04, 0x090900, 0x0F0F00, 0x131301, 0x151502, 0x171707, 0x19190A,
+			0x1A1A0A, 0x181806, 0x161602, 0x141401, 0x131304, 0x141408, 0x0F0F03, 0x0F0F00, 0x131301, 0x151502,
+			0x161604, 0x18180A, 0x18180A, 0x181808, 0x161602, 0x181804, 0x181806, 0x171709, 0x111107, 0x101007,
+			0x141408, 0x171707, 0x161602, 0x191904, 0x171705, 0x151508, 0x0D0D05, 0x050503, 0x010100, 0x020201,
+			0x060602, 0x0C0C05, 0x121207, 0x141406, 0x131302, 0x141401, 0x141401, 0x151504, 0x141408, 0x0D0D06,
+			0x080803, 0x030301, 0x010100, 0x040402, 0x090903, 0x0F0F06, 0x151508, 0x141404, 0x121200, 0x181803,
+			0x252509, 0x37370D, 0x9A9A7B, 0xFFFFFF, 0xFFFFFF, 0x292900, 0x242410, 0x161609, 0x111103, 0x1A1A04,
+			0x242406, 0x262605, 0x212107, 0x1B1B0A, 0x0F0F06, 0x050501, 0x050502, 0x090904, 0x0F0F06, 0x141408,
+			0x141406, 0x151504, 0x141401, 0x151502, 0x151503, 0x151508, 0x111107, 0x090904, 0x050501, 0x090903,
+			0x1B1B0B, 0x232302, 0x8B8B6F, 0xFFFFFF, 0xFDFDFA, 0x56562D, 0x2C2C09, 0x1A1A03, 0x0C0C00, 0x080800,
+			0x0A0A05, 0x090903, 0x0B0B04, 0x101007, 0x141407, 0x131302, 0x141401, 0x131301, 0x131304, 0x151508,
+			0x0F0F07, 0x090903, 0x030301, 0x010100, 0x010100, 0x0F0F06, 0x20200B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF,
+			0xC5C5B5, 0x262605, 0x1A1A0B, 0x0E0E06, 0x060600, 0x8B8B82, 0x818172, 0x81816D, 0x898977, 0x404025,
+			0x28280B, 0x202004, 0x61614B, 0x868672, 0x858571, 0x3A3A1E, 0x1D1D06, 0x171709, 0x0D0D05, 0x0D0D05,
+			0x151504, 0x4A4A2D, 0xF2F2EC, 0xFFFFFF, 0xFFFFFF, 0xB5B59E, 0x8D8D73, 0x848472, 0x7D7D71, 0x67675E,
+			0x0C0C02, 0x0F0F05, 0x111107, 0x1A1A09, 0x141400, 0x393922, 0x737363, 0x838374, 0x7F7F6F, 0x54543E,
+			0x1C1C02, 0x1B1B08, 0x141408, 0x0D0D06, 0x090900, 0x797970, 0x838375, 0x80806D, 0x878775, 0x4D4D33,
+			0x28280B, 0x252506, 0x56563D, 0x858573, 0x848473, 0x595946, 0x1A1A02, 0x656558, 0x87877A, 0x7F7F6D,
+			0x858573, 0x61614A, 0x28280D, 0x212105, 0x3E3E23, 0x878775, 0x848470, 0x58583D, 0x232304, 0x272710,
+			0x22220E, 0x191901, 0x404027, 0x82826F, 0x848470, 0x626249, 0x181800, 0x1B1B0B, 0x0E0E06, 0x050501,
+			0x030301, 0x070703, 0x101006, 0x191909, 0x141400, 0x383821, 0x737362, 0x838374, 0x7F7F6F, 0x55553F,
+			0x1C1C03, 0x1A1A08, 0x131307, 0x090903, 0x040402, 0x040401, 0x0B0B04, 0x151508, 0x191906, 0x1A1A01,
+			0x50503A, 0x838375, 0x838372, 0x898974, 0x5E5E32, 0x919170, 0xFFFFFF, 0xFFFFFF, 0x292900, 0x252510,
+			0x131304, 0x555549, 0x8B8B7D, 0x848470, 0x888873, 0x686853, 0x1D1D09, 0x101007, 0x0A0A03, 0x0B0B05,
+			0x141407, 0x171704, 0x111100, 0x383822, 0x626250, 0x848475, 0x828270, 0x737360, 0x303014, 0x1B1B06,
+			0x151508, 0x0C0C05, 0x0E0E05, 0x161602, 0x69694E, 0xFDFDFC, 0xFFFFFF, 0xFDFDFC, 0xA4A489, 0x8D8D75,
+			0x828272, 0x7C7C73, 0x57574C, 0x0C0C00, 0x151508, 0x19190A, 0x161601, 0x28280F, 0x676755, 0x848474,
+			0x848474, 0x60604B, 0x26260C, 0x1B1B06, 0x151509, 0x0A0A04, 0x030301, 0x010100, 0x0F0F06, 0x20200B,
+			0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC5C5B5, 0x272705, 0x1A1A0B, 0x0D0D06, 0x0C0C00, 0x6A6A58, 0xF5F5F2,
+			0xFFFFFF, 0xFFFFFF, 0x5C5C37, 0x454521, 0xD5D5CD, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFEFEFD, 0x696950,
+			0x1F1F07, 0x161609, 0x0C0C01, 0x4E4E40, 0xE7E7E2, 0xF4F4F0, 0xFFFFFF, 0xFFFFFF, 0xF8F8F5, 0xF5F5F2,
+			0xF5F5F3, 0xF8F8F8, 0xD3D3CF, 0x0D0D00, 0x171709, 0x1E1E0B, 0x252508, 0xA5A597, 0xFFFFFF, 0xFEFEFD,
+			0xF4F4F1, 0xFFFFFF, 0xFFFFFF, 0xCBCBC2, 0x36361A, 0x1D1D09, 0x17170A, 0x121203, 0x575745, 0xE5E5E0,
+			0xFFFFFF, 0xFFFFFF, 0x7C7C5F, 0x404019, 0xE2E2DC, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xB5B5A8, 0x1D1D00,
+			0x434328, 0xD2D2C8, 0xFFFFFF, 0xFFFFFF, 0xB3B3A0, 0x2F2F05, 0xA0A08F, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xA6A693, 0x303009, 0x2C2C0C, 0x959586, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xA7A796,
+			0x25250A, 0x181809, 0x0A0A04, 0x080803, 0x0F0F06, 0x1B1B09, 0x242409, 0xA3A395, 0xFFFFFF, 0xFEFEFD,
+			0xF4F4F1, 0xFFFFFF, 0xFFFFFF, 0xCDCDC3, 0x37371C, 0x1C1C08, 0x121207, 0x090904, 0x0C0C04, 0x161609,
+			0x1B1B03, 0x52523B, 0xDDDDD8, 0xFFFFFF, 0xFFFFFF, 0xF3F3F1, 0xFCFCFB, 0xFEFEFD, 0xF3F3EF, 0xFFFFFF,
+			0xFFFFFF, 0x2B2B01, 0x252510, 0x171707, 0x2F2F1C, 0xC3C3B9, 0xFFFFFF, 0xFFFFFF, 0xCFCFC7, 0x202008,
+			0x141408, 0x0D0D05, 0x121206, 0x22220F, 0x5D5D4A, 0xC8C8C0, 0xF6F6F5, 0xEAEAE6, 0xF4F4F1, 0xFFFFFF,
+			0xFFFFFF, 0xF4F4F1, 0x49492E, 0x1C1C08, 0x131309, 0x0A0A00, 0x747467, 0xECECE7, 0xF5F5F2, 0xFFFFFF,
+			0xFFFFFF, 0xF6F6F3, 0xF5F5F3, 0xF4F4F3, 0xFCFCFB, 0xAEAEA8, 0x0D0D00, 0x20200D, 0x202006, 0x777763,
+			0xFFFFFF, 0xFFFFFF, 0xF6F6F4, 0xFBFBF9, 0xFFFFFF, 0xE3E3DF, 0x56563C, 0x1B1B04, 0x141408, 0x080803,
+			0x010100, 0x010100, 0x0F0F06, 0x20200B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC5C5B5, 0x272705, 0x1A1A0B,
+			0x0D0D06, 0x141409, 0x1E1E01, 0x76765A, 0xFFFFFF, 0xFFFFFF, 0x68683D, 0xFBFBF9, 0xCDCDC3, 0x828268,
+			0xB9B9A8, 0xFFFFFF, 0xFFFFFF, 0xF1F1ED, 0x3A3A1C, 0x1C1C0A, 0x131307, 0x171706, 0x202000, 0x636338,
+			0xFFFFFF, 0xFFFFFF, 0x77774D, 0x2B2B00, 0x1A1A00, 0x080800, 0x050500, 0x18180A, 0x21210D, 0x191900,
+			0xC1C1B6, 0xFFFFFF, 0xCDCDC4, 0x3C3C1D, 0x1D1D00, 0x3F3F1E, 0xDBDBD3, 0xFFFFFF, 0xD4D4CB, 0x2E2E0F,
+			0x1F1F0C, 0x1D1D0C, 0x212106, 0x555533, 0xFFFFFF, 0xFFFFFF, 0x7E7E59, 0xFCFCF9, 0xAFAF9C, 0x93937B,
+			0xFEFEFE, 0xFFFFFF, 0xACAC9E, 0x232304, 0x2E2E0F, 0x3D3D15, 0xFBFBFA, 0xFFFFFF, 0x929273, 0xCECEC1,
+			0xF1F1EE, 0x898972, 0x9C9C84, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x57572A, 0xBBBBAC, 0xFFFFFE, 0x85856D,
+			0x989880, 0xFEFEFD, 0xFFFFFF, 0xFFFFFF, 0x6A6A50, 0x1C1C07, 0x121207, 0x0E0E06, 0x1A1A0A, 0x171700,
+			0xBFBFB3, 0xFFFFFF, 0xD0D0C8, 0x3D3D1D, 0x1D1D00, 0x3F3F1C, 0xD9D9D1, 0xFFFFFF, 0xD7D7CE, 0x2E2E10,
+			0x1A1A0A, 0x111107, 0x141409, 0x1D1D07, 0x474729, 0xFFFFFF, 0xFFFFFF, 0x9E9E8C, 0x303011, 0x1C1C00,
+			0x373712, 0xA4A48B, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x2B2B01, 0x252510, 0x19190A, 0x1C1C09, 0x32320E,
+			0xECECE7, 0xFFFFFF, 0xC8C8BD, 0x27270B, 0x19190A, 0x111108, 0x0B0B00, 0xA7A79D, 0xFFFFFF, 0xFFFFFF,
+			0x606048, 0x212101, 0x1B1B00, 0x6C6C4C, 0xFBFBFA, 0xFFFFFF, 0xD8D8CF, 0x242408, 0x1A1A0A, 0x131307,
+			0x171705, 0x242400, 0x838360, 0xFFFFFF, 0xFBFBF9, 0x585827, 0x2C2C01, 0x161600, 0x080800, 0x0D0D00,
+			0x21210E, 0x1E1E00, 0x888873, 0xFFFFFF, 0xF4F4F2, 0x525235, 0x202000, 0x2A2A05, 0xB7B7A8, 0xFFFFFF,
+			0xFFFFFF, 0x3D3D1E, 0x1C1C08, 0x0F0F07, 0x030301, 0x010100, 0x0F0F06, 0x20200B, 0x4E4E29, 0xFFFFFF,
+			0xFFFFFF, 0xC5C5B5, 0x272705, 0x19190B, 0x0C0C04, 0x121207, 0x29290E, 0x5D5D38, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0x808065, 0x212100, 0x2F2F0C, 0x323203, 0xA4A48A, 0xFFFFFF, 0xFFFFFF, 0x6F6F54, 0x212109,
+			0x141408, 0x1A1A0B, 0x2A2A0E, 0x6C6C48, 0xFFFFFF, 0xFFFFFF, 0x7D7D5A, 0x33330F, 0x22220F, 0x141408,
+			0x121207, 0x1C1C0C, 0x222207, 0x8F8F7A, 0xFFFFFF, 0xE6E6E0, 0x3D3D15, 0x2F2F0F, 0x313115, 0x353510,
+			0x4B4B21, 0xFFFFFF, 0xFFFFFF, 0x878770, 0x232308, 0x23230E, 0x2D2D11, 0x3E3E13, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0x828264, 0x292902, 0x262601, 0x707057, 0xFFFFFF, 0xB5B5AB, 0x1C1C01, 0x323215, 0x303004,
+			0xF7F7F4, 0xFFFFFF, 0xFFFFFF, 0xB7B7A6, 0x2A2A03, 0x2C2C0A, 0x313106, 0x787852, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xCECEC4, 0x282803, 0x292908, 0x333308, 0x606035, 0xFFFFFF, 0xFFFFFF, 0xBCBCAE, 0x212102,
+			0x1A1A0B, 0x1A1A0B, 0x1F1F05, 0x8B8B74, 0xFFFFFF, 0xE8E8E3, 0x3E3E16, 0x2E2E0F, 0x313115, 0x343411,
+			0x48481D, 0xFFFFFF, 0xFFFFFF, 0x8A8A73, 0x222207, 0x1D1D0D, 0x21210D, 0x2A2A09, 0xF8F8F4, 0xFFFFFF,
+			0xB5B5A4, 0x222200, 0x27270F, 0x24240F, 0x2E2E12, 0x313100, 0xDADACF, 0xFFFFFF, 0xFFFFFF, 0x2A2A01,
+			0x24240E, 0x18180B, 0x21210E, 0x2B2B03, 0xE4E4DC, 0xFFFFFF, 0xCACABD, 0x2D2D0D, 0x1D1D0B, 0x131307,
+			0x070700, 0xCBCBC6, 0xFFFFFF, 0x818170, 0x1A1A00, 0x272710, 0x2F2F14, 0x323208, 0x98987C, 0xFFFFFF,
+			0xFFFFFF, 0x393917, 0x1F1F0C, 0x131307, 0x1C1C0C, 0x2E2E0D, 0x8C8C6D, 0xFFFFFF, 0xFDFDFB, 0x5D5D36,
+			0x333312, 0x1F1F0D, 0x161609, 0x1C1C0C, 0x24240B, 0x646447, 0xFFFFFF, 0xFFFFFF, 0x50502A, 0x2D2D0C,
+			0x313114, 0x343414, 0x39390D, 0xEFEFEB, 0xFFFFFF, 0xBFBFB1, 0x242408, 0x171709, 0x060602, 0x010100,
+			0x0F0F06, 0x20200B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC5C5B5, 0x272705, 0x19190B, 0x0A0A04, 0x101007,
+			0x28280D, 0x60603C, 0xFFFFFF, 0xFFFFFF, 0xA7A78E, 0x33330A, 0x2B2B12, 0x292912, 0x373713, 0x5F5F36,
+			0xFFFFFF, 0xFFFFFF, 0x999983, 0x222207, 0x161609, 0x17170A, 0x25250C, 0x686846, 0xFFFFFF, 0xFFFFFF,
+			0x787858, 0x2A2A0C, 0x19190B, 0x0C0C06, 0x0F0F07, 0x1F1F0B, 0x3A3A1B, 0xE7E7E1, 0xFFFFFF, 0xADAD97,
+			0x3A3A0F, 0x353516, 0x2F2F14, 0x3A3A18, 0x424213, 0xF1F1EB, 0xFFFFFF, 0xCCCCC0, 0x232301, 0x262611,
+			0x2C2C12, 0x404017, 0xFFFFFF, 0xFFFFFF, 0xC2C2B1, 0x36360A, 0x2F2F13, 0x262610, 0x25250E, 0x474734,
+			0x313120, 0x1D1D09, 0x2A2A12, 0x303005, 0xF8F8F5, 0xFFFFFF, 0xF5F5F1, 0x3C3C10, 0x2F2F12, 0x292911,
+			0x333314, 0x515125, 0xECECE5, 0xFFFFFF, 0xF5F5F0, 0x4E4E27, 0x2C2C0F, 0x282811, 0x333314, 0x48481C,
+			0xE4E4DB, 0xFFFFFF, 0xDADAD2, 0x252502, 0x22220F, 0x22220C, 0x363618, 0xE6E6DE, 0xFFFFFF, 0xB1B19B,
+			0x3A3A0E, 0x353516, 0x2F2F14, 0x3A3A18, 0x404010, 0xF0F0EA, 0xFFFFFF, 0xCFCFC4, 0x252503, 0x282811,
+			0x27270B, 0x75755B, 0xFFFFFF, 0xFFFFFF, 0x626240, 0x2D2D0F, 0x1C1C0C, 0x17170A, 0x24240F, 0x33330C,
+			0xB1B19B, 0xFFFFFF, 0xFFFFFF, 0x292900, 0x23230F, 0x161609, 0x1F1F0D, 0x2B2B04, 0xE5E5DE, 0xFFFFFF,
+			0xCBCBBE, 0x2F2F0E, 0x1E1E0C, 0x101006, 0x0F0F04, 0x323222, 0x444432, 0x282812, 0x23230E, 0x23230F,
+			0x2D2D13, 0x3D3D15, 0x7B7B54, 0xFFFFFF, 0xFFFFFF, 0x575737, 0x21210B, 0x141408, 0x18180A, 0x29290B,
+			0x87876B, 0xFFFFFF, 0xFEFEFC, 0x575733, 0x29290F, 0x151509, 0x101007, 0x1C1C0C, 0x242403, 0xC6C6B8,
+			0xFFFFFF, 0xE4E4DA, 0x383808, 0x383818, 0x303014, 0x353517, 0x3C3C0D, 0xC6C6B4, 0xFFFFFF, 0xF5F5F1,
+			0x313110, 0x1C1C0A, 0x080803, 0x010100, 0x0F0F06, 0x20200B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC5C5B5,
+			0x272705, 0x19190A, 0x090903, 0x0F0F07, 0x24240C, 0x5C5C3B, 0xFFFFFF, 0xFFFFFF, 0x757552, 0x2F2F0F,
+			0x1F1F0C, 0x1B1B0B, 0x2C2C12, 0x3C3C10, 0xFFFFFF, 0xFFFFFF, 0xA4A48F, 0x242406, 0x161609, 0x161609,
+			0x22220A, 0x646444, 0xFFFFFF, 0xFFFFFF, 0x737356, 0x222208, 0x101007, 0x050501, 0x0C0C06, 0x20200A,
+			0x585837, 0xFFFFFF, 0xFFFFFF, 0x808059, 0x37370A, 0x2A2A0A, 0x232307, 0x2D2D0B, 0x373707, 0xD1D1C2,
+			0xFFFFFF, 0xF5F5F2, 0x292908, 0x262610, 0x2B2B10, 0x3D3D17, 0xFFFFFF, 0xFFFFFF, 0x929276, 0x32320D,
+			0x22220E, 0x151509, 0x121207, 0x0E0E02, 0x0D0D03, 0x151509, 0x23230F, 0x2B2B03, 0xF7F7F6, 0xFFFFFF,
+			0xC0C0AD, 0x33330C, 0x25250F, 0x1B1B0B, 0x26260F, 0x3D3D15, 0xE1E1D9, 0xFFFFFF, 0xCECEC0, 0x393911,
+			0x25250F, 0x1A1A0C, 0x25250E, 0x393914, 0xD4D4C8, 0xFFFFFF, 0xDEDED5, 0x2B2B07, 0x282810, 0x28280C,
+			0x545434, 0xFFFFFF, 0xFFFFFF, 0x82825D, 0x37370A, 0x2A2A0A, 0x232307, 0x2D2D0B, 0x363607, 0xD0D0BF,
+			0xFFFFFF, 0xF9F9F6, 0x2D2D0A, 0x303013, 0x2B2B08, 0xC0C0B1, 0xFFFFFF, 0xECECE7, 0x494925, 0x24240E,
+			0x0F0F06, 0x0B0B04, 0x19190A, 0x2A2A0A, 0x999980, 0xFFFFFF, 0xFFFFFF, 0x282800, 0x21210F, 0x141408,
+			0x1C1C0D, 0x282802, 0xE4E4DD, 0xFFFFFF, 0xCACABE, 0x30300E, 0x1C1C0B, 0x0E0E06, 0x0E0E06, 0x141406,
+			0x1A1A08, 0x21210D, 0x21210E, 0x1E1E0A, 0x27270D, 0x35350B, 0x6C6C42, 0xFFFFFF, 0xFFFFFF, 0x666646,
+			0x22220A, 0x131308, 0x161609, 0x252509, 0x858569, 0xFFFFFF, 0xFDFDFC, 0x525230, 0x21210B, 0x0E0E06,
+			0x0C0C05, 0x1C1C0C, 0x282801, 0xFFFFFF, 0xFFFFFF, 0xB5B59E, 0x373706, 0x2E2E0C, 0x232308, 0x28280A,
+			0x333306, 0xA0A085, 0xFFFFFF, 0xFFFFFF, 0x424222, 0x1C1C0A, 0x0A0A04, 0x010100, 0x0F0F06, 0x20200B,
+			0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC5C5B5, 0x272705, 0x19190A, 0x090904, 0x0E0E05, 0x24240C, 0x5B5B3A,
+			0xFFFFFF, 0xFFFFFF, 0x6F6F4F, 0x28280C, 0x141409, 0x111107, 0x23230E, 0x373711, 0xFFFFFF, 0xFFFFFF,
+			0xA3A38D, 0x262607, 0x171709, 0x151508, 0x22220B, 0x646444, 0xFFFFFF, 0xFFFFFF, 0x737355, 0x212108,
+			0x111107, 0x050503, 0x101007, 0x222207, 0x8A8A71, 0xFFFFFF, 0xFFFFFF, 0xA6A68B, 0x919176, 0x878774,
+			0x838373, 0x888874, 0x8C8C70, 0xDBDBD2, 0xFFFFFF, 0xFFFFFF, 0x3A3A1F, 0x21210C, 0x2A2A11, 0x3B3B15,
+			0xFFFFFF, 0xFFFFFF, 0x8E8E73, 0x29290A, 0x161609, 0x090904, 0x040401, 0x060603, 0x050501, 0x0E0E05,
+			0x1F1F0E, 0x292901, 0xF8F8F6, 0xFFFFFF, 0xBEBEAC, 0x2C2C0A, 0x1B1B0C, 0x111107, 0x1D1D0B, 0x2C2C07,
+			0xD9D9D0, 0xFFFFFF, 0xC8C8B9, 0x30300D, 0x1E1E0D, 0x111106, 0x1C1C0C, 0x2E2E0B, 0xC2C2B4, 0xFFFFFF,
+			0xE3E3DC, 0x373711, 0x2C2C12, 0x2B2B0B, 0x86866D, 0xFFFFFF, 0xFFFFFF, 0xA8A88D, 0x919175, 0x878774,
+			0x848473, 0x888874, 0x8B8B70, 0xDADACF, 0xFFFFFF, 0xFFFFFF, 0x414123, 0x2F2F11, 0x40401B, 0xE1E1D8,
+			0xFFFFFF, 0xDCDCD2, 0x393914, 0x20200D, 0x090903, 0x050502, 0x141408, 0x262609, 0x909077, 0xFFFFFF,
+			0xFFFFFF, 0x272700, 0x21210F, 0x141408, 0x1C1C0D, 0x282802, 0xE4E4DD, 0xFFFFFF, 0xCBCBBE, 0x30300E,
+			0x1C1C0B, 0x0E0E06, 0x0E0E06, 0x18180A, 0x1E1E0B, 0x1D1D05, 0x141400, 0x3E3E27, 0x515137, 0x939379,
+			0xADAD94, 0xFFFFFF, 0xFFFFFF, 0x676745, 0x24240B, 0x141408, 0x15150A, 0x252509, 0x848469, 0xFFFFFF,
+			0xFEFEFC, 0x515130, 0x21210A, 0x0E0E07, 0x0F0F06, 0x1E1E0A, 0x555534, 0xFFFFFF, 0xFFFFFF, 0xC5C5B2,
+			0x909073, 0x8A8A75, 0x848472, 0x858574, 0x8A8A71, 0xBCBCAA, 0xFFFFFF, 0xFFFFFF, 0x5D5D45, 0x171706,
+			0x0A0A04, 0x010100, 0x0F0F06, 0x20200B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC5C5B5, 0x272705, 0x19190A,
+			0x090904, 0x0E0E05, 0x24240C, 0x5A5A3A, 0xFFFFFF, 0xFFFFFF, 0x6E6E4F, 0x25250B, 0x121207, 0x0F0F06,
+			0x21210C, 0x353510, 0xFFFFFF, 0xFFFFFF, 0xA3A38D, 0x252508, 0x171709, 0x151508, 0x22220B, 0x646444,
+			0xFFFFFF, 0xFFFFFF, 0x737355, 0x212109, 0x111107, 0x060602, 0x121208, 0x232307, 0x9D9D87, 0xFFFFFF,
+			0xFFFFFF, 0xF3F3F0, 0xF5F5F3, 0xF5F5F3, 0xF4F4F3, 0xF4F4F2, 0xF3F3F2, 0xEBEBE8, 0xE8E8E4, 0xE2E2DE,
+			0x393925, 0x1D1D0A, 0x2A2A11, 0x3B3B15, 0xFFFFFF, 0xFFFFFF, 0x8D8D73, 0x27270A, 0x141408, 0x050502,
+			0x0A0A04, 0x1E1E0C, 0x282801, 0xF8F8F6, 0xFFFFFF, 0xBEBEAD, 0x2A2A08, 0x19190A, 0x0F0F07, 0x1C1C0C,
+			0x272702, 0xD6D6CE, 0xFFFFFF, 0xC7C7BB, 0x2E2E0C, 0x1B1B0B, 0x0E0E06, 0x1A1A0B, 0x2C2C0B, 0xC3C3B5,
+			0xFFFFFF, 0xE2E2DB, 0x363611, 0x2E2E12, 0x2C2C0A, 0x9A9A83, 0xFFFFFF, 0xFFFFFF, 0xF4F4F0, 0xF5F5F3,
+			0xF5F5F3, 0xF4F4F3, 0xF4F4F2, 0xF3F3F2, 0xEBEBE8, 0xE8E8E4, 0xE3E3E0, 0x414129, 0x2B2B0E, 0x484824,
+			0xEAEAE4, 0xFFFFFF, 0xD7D7CB, 0x34340F, 0x1F1F0D, 0x090903, 0x050503, 0x141408, 0x252508, 0x909078,
+			0xFFFFFF, 0xFFFFFF, 0x262600, 0x21210F, 0x141408, 0x1C1C0D, 0x282802, 0xE4E4DD, 0xFFFFFF, 0xCBCBBE,
+			0x2F2F0F, 0x1D1D0C, 0x101006, 0x151509, 0x1D1D08, 0x303015, 0x767662, 0xF0F0EE, 0xF6F6F5, 0xEEEEEB,
+			0xF6F6F3, 0xF6F6F4, 0xFFFFFF, 0xFFFFFF, 0x666645, 0x24240C, 0x141408, 0x15150A, 0x252509, 0x848469,
+			0xFFFFFF, 0xFEFEFC, 0x515130, 0x21210C, 0x0F0F06, 0x0F0F06, 0x1F1F09, 0x696948, 0xFFFFFF, 0xFFFFFF,
+			0xF7F7F5, 0xF4F4F2, 0xF5F5F3, 0xF4F4F3, 0xF4F4F2, 0xF4F4F2, 0xEEEEEC, 0xE6E6E2, 0xF4F4F2, 0x5B5B49,
+			0x101002, 0x080803, 0x010100, 0x0F0F06, 0x20200B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC5C5B5, 0x272705,
+			0x19190A, 0x090904, 0x0E0E05, 0x24240C, 0x5A5A3A, 0xFFFFFF, 0xFFFFFF, 0x6E6E4F, 0x24240B, 0x121207,
+			0x0E0E06, 0x21210C, 0x343410, 0xFFFFFF, 0xFFFFFF, 0xA3A38D, 0x252508, 0x171709, 0x151508, 0x22220B,
+			0x646444, 0xFFFFFF, 0xFFFFFF, 0x737356, 0x232309, 0x111107, 0x060603, 0x111108, 0x232306, 0x9F9F89,
+			0xFFFFFF, 0xFFFFFF, 0x4D4D17, 0x323205, 0x1E1E00, 0x121200, 0x141400, 0x191900, 0x1C1C00, 0x1A1A00,
+			0x121200, 0x151507, 0x19190A, 0x27270F, 0x3A3A16, 0xFFFFFF, 0xFFFFFF, 0x8C8C73, 0x26260A, 0x121208,
+			0x040402, 0x090904, 0x1D1D0C, 0x292901, 0xF8F8F6, 0xFFFFFF, 0xBEBEAD, 0x292908, 0x18180A, 0x0E0E06,
+			0x1B1B0C, 0x262602, 0xD7D7CE, 0xFFFFFF, 0xC7C7BB, 0x2C2C0B, 0x1A1A0A, 0x0E0E05, 0x19190A, 0x2C2C0B,
+			0xC4C4B4, 0xFFFFFF, 0xE2E2DB, 0x373711, 0x2E2E12, 0x2C2C0B, 0x9C9C85, 0xFFFFFF, 0xFFFFFF, 0x50501B,
+			0x313105, 0x1E1E00, 0x131300, 0x141400, 0x191900, 0x1C1C00, 0x191900, 0x131300, 0x1E1E0A, 0x28280F,
+			0x444421, 0xE7E7E1, 0xFFFFFF, 0xDDDDD3, 0x3A3A14, 0x20200C, 0x090903, 0x050502, 0x141409, 0x27270A,
+			0x909077, 0xFFFFFF, 0xFFFFFF, 0x272700, 0x21210F, 0x141408, 0x1C1C0D, 0x282802, 0xE4E4DD, 0xFFFFFF,
+			0xCBCBBE, 0x2F2F0F, 0x20200D, 0x18180A, 0x1B1B05, 0x48482F, 0xE9E9E5, 0xFFFFFF, 0xC0C0B6, 0x5B5B43,
+			0x46462A, 0x2E2E00, 0x69693B, 0xFFFFFF, 0xFFFFFF, 0x676745, 0x24240C, 0x141408, 0x15150A, 0x252509,
+			0x848469, 0xFFFFFF, 0xFDFDFC, 0x525231, 0x21210B, 0x0E0E06, 0x101006, 0x202009, 0x6A6A4B, 0xFFFFFF,
+			0xFFFFFF, 0x85855E, 0x323201, 0x232300, 0x151500, 0x131300, 0x171700, 0x1C1C00, 0x1B1B00, 0x141400,
+			0x141405, 0x0F0F06, 0x050502, 0x010100, 0x0E0E06, 0x21210B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC5C5B5,
+			0x272705, 0x19190A, 0x090903, 0x0F0F06, 0x24240C, 0x5A5A3A, 0xFFFFFF, 0xFFFFFF, 0x6E6E4F, 0x24240B,
+			0x121207, 0x0E0E06, 0x21210C, 0x353510, 0xFFFFFF, 0xFFFFFF, 0xA3A38D, 0x262608, 0x171709, 0x151508,
+			0x21210B, 0x636344, 0xFFFFFF, 0xFFFFFF, 0x757555, 0x27270B, 0x151508, 0x090904, 0x131308, 0x252509,
+			0x898970, 0xFFFFFF, 0xFFFFFF, 0x75754B, 0x3D3D16, 0x2A2A11, 0x1C1C0C, 0x1A1A0B, 0x1C1C0D, 0x1E1E0D,
+			0x1D1D0C, 0x171709, 0x101006, 0x161609, 0x25250F, 0x3B3B16, 0xFFFFFF, 0xFFFFFF, 0x8C8C73, 0x26260A,
+			0x121208, 0x040402, 0x0B0B04, 0x1E1E0C, 0x282801, 0xF8F8F6, 0xFFFFFF, 0xBEBEAD, 0x292908, 0x18180A,
+			0x0E0E06, 0x1B1B0C, 0x262602, 0xD7D7CD, 0xFFFFFF, 0xC7C7BB, 0x2C2C0B, 0x1A1A0A, 0x0D0D05, 0x19190A,
+			0x2C2C0B, 0xC3C3B4, 0xFFFFFF, 0xE2E2DB, 0x363610, 0x2D2D13, 0x2B2B0B, 0x86866C, 0xFFFFFF, 0xFFFFFF,
+			0x787851, 0x3D3D15, 0x2A2A11, 0x1C1C0C, 0x1A1A0B, 0x1C1C0D, 0x1E1E0D, 0x1D1D0C, 0x18180A, 0x18180A,
+			0x22220D, 0x3E3E1B, 0xE2E2DA, 0xFFFFFF, 0xE9E9E1, 0x484822, 0x24240D, 0x0D0D06, 0x0B0B04, 0x19190C,
+			0x2C2C0B, 0x95957B, 0xFFFFFF, 0xFFFFFF, 0x282800, 0x21210F, 0x141408, 0x1D1D0D, 0x282802, 0xE4E4DD,
+			0xFFFFFF, 0xCACABE, 0x31310F, 0x24240F, 0x20200C, 0x303013, 0xF1F1ED, 0xFFFFFF, 0x979780, 0x232300,
+			0x26260C, 0x2B2B10, 0x3E3E16, 0x727249, 0xFFFFFF, 0xFFFFFF, 0x686845, 0x24240C, 0x141408, 0x151509,
+			0x242409, 0x848469, 0xFFFFFF, 0xFDFDFB, 0x545431, 0x26260D, 0x121208, 0x121208, 0x22220B, 0x575734,
+			0xFFFFFF, 0xFFFFFF, 0xA9A98F, 0x3D3D11, 0x2E2E14, 0x20200E, 0x19190B, 0x1C1C0B, 0x1E1E0D, 0x1E1E0C,
+			0x19190A, 0x111107, 0x090904, 0x030301, 0x010100, 0x0F0F06, 0x22220B, 0x4F4F29, 0xFFFFFF, 0xFFFFFF,
+			0xC5C5B5, 0x292905, 0x1A1A0B, 0x0A0A04, 0x0F0F07, 0x25250C, 0x5D5D3B, 0xFFFFFF, 0xFFFFFF, 0x6F6F4F,
+			0x26260B, 0x131308, 0x0F0F07, 0x22220C, 0x373711, 0xFFFFFF, 0xFFFFFF, 0xA4A48D, 0x282808, 0x181809,
+			0x141408, 0x202009, 0x636345, 0xFFFFFF, 0xFFFFFF, 0x848464, 0x2F2F0D, 0x1F1F0D, 0x121208, 0x18180A,
+			0x27270D, 0x636343, 0xFFFFFF, 0xFFFFFF, 0x9F9F82, 0x3A3A0F, 0x2D2D13, 0x1E1E0D, 0x1A1A0B, 0x1C1C0C,
+			0x1C1C0C, 0x141404, 0x101004, 0x0E0E06, 0x141409, 0x25250F, 0x3D3D16, 0xFFFFFF, 0xFFFFFF, 0x8E8E73,
+			0x27270A, 0x131308, 0x040402, 0x0A0A04, 0x1F1F0D, 0x2A2A02, 0xF8F8F6, 0xFFFFFF, 0xBEBEAD, 0x2A2A09,
+			0x19190B, 0x0F0F07, 0x1C1C0C, 0x282804, 0xD7D7CE, 0xFFFFFF, 0xC7C7BA, 0x2E2E0C, 0x1B1B0B, 0x0F0F06,
+			0x1A1A0B, 0x2D2D0B, 0xC3C3B5, 0xFFFFFF, 0xE3E3DC, 0x363611, 0x2B2B12, 0x2A2A0E, 0x5D5D3D, 0xFFFFFF,
+			0xFFFFFF, 0xA2A286, 0x3A3A0F, 0x2D2D13, 0x1F1F0D, 0x1A1A0B, 0x1C1C0C, 0x1C1C0C, 0x141405, 0x111104,
+			0x131308, 0x1E1E0D, 0x2A2A09, 0xC9C9BD, 0xFFFFFF, 0xFBFBFA, 0x5E5E37, 0x2F2F11, 0x1B1B0C, 0x171709,
+			0x24240F, 0x313109, 0xB1B19B, 0xFFFFFF, 0xFFFFFF, 0x2A2A00, 0x23230F, 0x161609, 0x1E1E0D, 0x292903,
+			0xE4E4DE, 0xFFFFFF, 0xCBCBBE, 0x333310, 0x282811, 0x212108, 0x72725B, 0xFFFFFF, 0xFFFFFF, 0x545428,
+			0x3A3A16, 0x2F2F14, 0x2F2F13, 0x3B3B14, 0x7D7D57, 0xFFFFFF, 0xFFFFFF, 0x676745, 0x25250C, 0x141409,
+			0x141408, 0x232308, 0x84846B, 0xFFFFFF, 0xFFFFFF, 0x5F5F3A, 0x2F2F10, 0x1D1D0C, 0x1B1B0C, 0x262610,
+			0x35350C, 0xFFFFFF, 0xFFFFFF, 0xD5D5C6, 0x393909, 0x323215, 0x22220F, 0x1A1A0B, 0x1B1B0B, 0x1C1C0C,
+			0x181808, 0x0F0F02, 0x0E0E06, 0x080802, 0x020200, 0x020201, 0x111107, 0x24240D, 0x52522A, 0xFFFFFF,
+			0xFFFFFF, 0xC6C6B4, 0x2C2C07, 0x1D1D0D, 0x0D0D05, 0x121207, 0x28280E, 0x5E5E3B, 0xFFFFFF, 0xFFFFFF,
+			0x717150, 0x29290C, 0x161609, 0x121208, 0x24240E, 0x3A3A12, 0xFFFFFF, 0xFFFFFF, 0xA4A48E, 0x2B2B09,
+			0x19190A, 0x141409, 0x1D1D09, 0x59593A, 0xFFFFFF, 0xFFFFFF, 0x9E9E81, 0x36360C, 0x2D2D13, 0x1A1A07,
+			0x0C0C00, 0x26260D, 0x444421, 0xF2F2ED, 0xFFFFFF, 0xE2E2D8, 0x414114, 0x313110, 0x262610, 0x21210D,
+			0x1D1D0A, 0x0F0F00, 0x464637, 0x323228, 0x0B0B02, 0x17170A, 0x282810, 0x3F3F15, 0xFFFFFF, 0xFFFFFF,
+			0x909074, 0x2A2A0B, 0x161609, 0x060602, 0x010100, 0x0C0C05, 0x21210E, 0x2D2D03, 0xF7F7F5, 0xFFFFFF,
+			0xBEBEAD, 0x2D2D09, 0x1C1C0B, 0x131307, 0x20200E, 0x2B2B05, 0xD7D7CD, 0xFFFFFF, 0xC8C8BA, 0x30300D,
+			0x1E1E0D, 0x121207, 0x1E1E0D, 0x2F2F0D, 0xC4C4B4, 0xFFFFFF, 0xE3E3DC, 0x393911, 0x2A2A11, 0x27270F,
+			0x3D3D1D, 0xF1F1EB, 0xFFFFFF, 0xE4E4DB, 0x424215, 0x313110, 0x262610, 0x21210D, 0x1D1D0A, 0x0F0F00,
+			0x444434, 0x343429, 0x0E0E04, 0x19190B, 0x222207, 0x97977F, 0xFFFFFF, 0xFFFFFF, 0x97977A, 0x323208,
+			0x2D2D13, 0x26260F, 0x29290C, 0x404014, 0xFBFBF8, 0xFFFFFF, 0xFFFFFF, 0x2D2D00, 0x262610, 0x19190A,
+			0x22220E, 0x2D2D04, 0xE4E4DD, 0xFFFFFF, 0xCCCCBD, 0x363611, 0x2B2B12, 0x242408, 0x85856F, 0xFFFFFF,
+			0xFFFFFF, 0x545423, 0x3F3F17, 0x333316, 0x2E2E11, 0x2D2D00, 0xCDCDBD, 0xFFFFFF, 0xFFFFFF, 0x696945,
+			0x27270D, 0x16160A, 0x141409, 0x1F1F08, 0x7B7B60, 0xFFFFFF, 0xFFFFFF, 0x75754F, 0x393911, 0x292912,
+			0x1A1A05, 0x1A1A01, 0x2B2B06, 0xD6D6C9, 0xFFFFFF, 0xFFFFFF, 0x505023, 0x32320E, 0x292911, 0x22220D,
+			0x1F1F0B, 0x151500, 0x232311, 0x55554B, 0x070700, 0x080802, 0x020200, 0x030301, 0x121208, 0x25250C,
+			0x4F4F28, 0xFFFFFF, 0xFFFFFF, 0xCECEC0, 0x2A2A03, 0x1E1E0D, 0x101006, 0x151509, 0x27270C, 0x656543,
+			0xFFFFFF, 0xFFFFFF, 0x6F6F4E, 0x28280A, 0x19190A, 0x141408, 0x25250E, 0x34340B, 0xFFFFFF, 0xFFFFFF,
+			0xA4A48E, 0x292906, 0x19190B, 0x121207, 0x1B1B0C, 0x222200, 0xFFFFFF, 0xFFFFFF, 0xFEFEFC, 0x505022,
+			0x242400, 0x484833, 0xE4E4E3, 0x26260F, 0x282809, 0x919179, 0xFFFFFF, 0xFFFFFF, 0xC9C9BC, 0x53532C,
+			0x242400, 0x202000, 0x3A3A1E, 0x929285, 0xFFFFFF, 0xA5A59E, 0x060600, 0x1A1A0A, 0x27270E, 0x4C4C26,
+			0xFFFFFF, 0xFFFFFF, 0x8E8E73, 0x292909, 0x17170A, 0x070703, 0x010100, 0x030301, 0x0D0D05, 0x22220D,
+			0x37370D, 0xF9F9F7, 0xFFFFFF, 0xBEBEAC, 0x2B2B08, 0x1F1F0C, 0x161609, 0x21210D, 0x31310C, 0xDDDDD4,
+			0xFFFFFF, 0xCBCBBD, 0x31310C, 0x20200D, 0x141408, 0x20200D, 0x31310D, 0xC9C9BB, 0xFFFFFF, 0xE3E3DB,
+			0x35350F, 0x26260F, 0x21210E, 0x222207, 0x8B8B75, 0xFFFFFF, 0xFFFFFF, 0xCCCCBF, 0x53532C, 0x252500,
+			0x202000, 0x39391D, 0x919182, 0xFFFFFF, 0xA9A9A3, 0x050500, 0x141408, 0x1F1F0B, 0x363613, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0x7E7E5B, 0x252500, 0x242401, 0x555536, 0xFAFAF9, 0xD4D4C5, 0xFFFFFF, 0xFFFFFF,
+			0x35350A, 0x282810, 0x1D1D0C, 0x23230F, 0x34340C, 0xE9E9E2, 0xFFFFFF, 0xCCCCBD, 0x33330E, 0x2B2B12,
+			0x24240A, 0x72725A, 0xFFFFFF, 0xFFFFFF, 0xB3B39D, 0x3F3F11, 0x272700, 0x3A3A18, 0xC8C8BB, 0xECECE5,
+			0xF4F4F1, 0xFFFFFF, 0x6A6A49, 0x26260A, 0x17170A, 0x111107, 0x1E1E0B, 0x3B3B1A, 0xFFFFFF, 0xFFFFFF,
+			0xE0E0D5, 0x474719, 0x1E1E00, 0x6D6D5B, 0xD1D1CB, 0x222202, 0x6A6A4A, 0xFFFFFF, 0xFFFFFF, 0xEDEDE8,
+			0x63633E, 0x2E2E07, 0x202000, 0x303012, 0x777764, 0xFFFFFF, 0xE1E1DD, 0x0D0D02, 0x080802, 0x020200,
+			0x050502, 0x121207, 0x1A1A02, 0x7D7D62, 0xFFFFFF, 0xFFFFFF, 0xFCFCFA, 0x2A2A07, 0x181807, 0x111107,
+			0x161609, 0x1D1D01, 0xA2A290, 0xFFFFFF, 0xFFFFFF, 0x9F9F8B, 0x1E1E02, 0x181808, 0x161609, 0x1C1C05,
+			0x616144, 0xFFFFFF, 0xFFFFFF, 0xD0D0C5, 0x272708, 0x161606, 0x101007, 0x161609, 0x1C1C02, 0xABAB9C,
+			0xFFFFFF, 0xFFFFFF, 0xF5F5F2, 0xEAEAE6, 0xFFFFFF, 0xBABAB3, 0x191906, 0x24240D, 0x2C2C0B, 0xC4C4B8,
+			0xFFFFFF, 0xFFFFFF, 0xF7F7F5, 0xE6E6E1, 0xE7E7E3, 0xFDFDFC, 0xFFFFFF, 0x929287, 0x121200, 0x121206,
+			0x181809, 0x1C1C02, 0x83836C, 0xFFFFFF, 0xFFFFFF, 0xBDBDAE, 0x242404, 0x131306, 0x080803, 0x020200,
+			0x040401, 0x0E0E06, 0x151500, 0x626246, 0xFFFFFF, 0xFFFFFF, 0xE7E7DF, 0x2B2B0A, 0x1A1A07, 0x17170A,
+			0x171702, 0x4E4E31, 0xF2F2F0, 0xFFFFFF, 0xE8E8E1, 0x3E3E20, 0x181804, 0x161609, 0x191905, 0x3E3E1F,
+			0xEBEBE6, 0xFFFFFF, 0xF5F5F1, 0x515134, 0x191902, 0x1A1A0B, 0x1F1F0B, 0x272708, 0xC2C2B6, 0xFFFFFF,
+			0xFFFFFF, 0xF7F7F5, 0xE6E6E1, 0xE7E7E3, 0xFCFCFB, 0xFFFFFF, 0x96968B, 0x111100, 0x0E0E04, 0x0D0D05,
+			0x161609, 0x202006, 0x83836B, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xE5E5DF, 0xF0F0EE, 0xFFFFFF, 0x96967D,
+			0x7B7B58, 0xFFFFFF, 0xFFFFFF, 0x68684B, 0x1A1A00, 0x1E1E0C, 0x1A1A03, 0x57573A, 0xF8F8F7, 0xFFFFFF,
+			0xECECE7, 0x3B3B1B, 0x21210A, 0x23230E, 0x303013, 0xDDDDD6, 0xFFFFFF, 0xFFFFFF, 0xEDEDE8, 0xEBEBE6,
+			0xFFFFFF, 0xD3D3CA, 0x5B5B30, 0xEBEBE5, 0xFFFFFF, 0x999985, 0x1E1E03, 0x161609, 0x0E0E05, 0x18180A,
+			0x26260B, 0xCBCBC0, 0xFFFFFF, 0xFFFFFF, 0xF1F1ED, 0xECECE8, 0xFFFFFF, 0x96968A, 0x1F1F06, 0x2B2B0A,
+			0x95957F, 0xFFFFFF, 0xFFFFFF, 0xFDFDFC, 0xE9E9E4, 0xE5E5E1, 0xF6F6F4, 0xFFFFFF, 0xCACAC4, 0x171705,
+			0x0E0E04, 0x080803, 0x010100, 0x050502, 0x040400, 0xA0A097, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0x474739, 0x0E0E02, 0x090900, 0xAFAFA6, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xC0C0B8,
+			0x0A0A00, 0x0D0D00, 0x79796C, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x151507, 0x0C0C04,
+			0x0F0F06, 0x1B1B0A, 0x29290B, 0xAAAA9A, 0xFFFFFF, 0xFFFFFF, 0xF4F4F2, 0x7D7D6C, 0x121200, 0x161609,
+			0x19190A, 0x20200B, 0x272709, 0x888872, 0xD5D5CA, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xC8C8BF, 0x555540,
+			0x131300, 0x141407, 0x101006, 0x0A0A00, 0x8E8E83, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xF8F8F4,
+			0x222216, 0x060600, 0x020200, 0x040401, 0x070700, 0x555547, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFDFDFA, 0x343425, 0x0E0E00, 0x4F4F40, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x464637,
+			0x0E0E00, 0x3B3B2A, 0xF8F8F6, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x515143, 0x0D0D01, 0x141408,
+			0x1D1D0A, 0x282809, 0x858571, 0xD4D4C9, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xCACAC0, 0x565641, 0x131300,
+			0x131307, 0x0B0B05, 0x070703, 0x0E0E05, 0x1A1A0A, 0x1F1F02, 0x7E7E66, 0xE2E2DB, 0xFFFFFF, 0xFFFFFF,
+			0xCFCFC7, 0x6B6B53, 0x202000, 0x94947F, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xA6A69C, 0x0C0C00, 0x4B4B3A,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFCFCFA, 0x424231, 0x171708, 0x1F1F08, 0x414124, 0xBABAAC,
+			0xFFFFFF, 0xFFFFFF, 0xF1F1ED, 0x90907F, 0x2B2B06, 0x4E4E2B, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xCCCCC5,
+			0x040400, 0x0C0C05, 0x101007, 0x1B1B09, 0x303012, 0xCACABD, 0xFFFFFF, 0xFFFFFF, 0xE6E6E0, 0x5E5E4A,
+			0x151500, 0x1C1C0C, 0x22220D, 0x252507, 0x636349, 0xCACABD, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xD1D1C9,
+			0x767663, 0x191902, 0x141406, 0x0C0C05, 0x050502, 0x040401, 0x0C0C04, 0x0B0B00, 0x0D0D00, 0x181800,
+			0x1B1B00, 0x141400, 0x0A0A00, 0x0D0D02, 0x0D0D04, 0x0F0F06, 0x0D0D00, 0x0F0F00, 0x161600, 0x171700,
+			0x0F0F00, 0x0B0B00, 0x101006, 0x101006, 0x0E0E00, 0x0C0C00, 0x151500, 0x181800, 0x111100, 0x090900,
+			0x0E0E05, 0x080802, 0x080803, 0x0E0E06, 0x19190A, 0x191901, 0x181800, 0x171700, 0x151500, 0x151501,
+			0x141407, 0x0E0E05, 0x0C0C05, 0x101007, 0x19190A, 0x1C1C04, 0x1C1C00, 0x1A1A00, 0x191900, 0x161600,
+			0x151500, 0x171705, 0x141409, 0x0D0D05, 0x0A0A04, 0x0E0E05, 0x0E0E00, 0x0D0D00, 0x171700, 0x181800,
+			0x111100, 0x0A0A00, 0x0D0D04, 0x070702, 0x020200, 0x020201, 0x0A0A04, 0x0D0D02, 0x0C0C00, 0x151500,
+			0x181800, 0x121200, 0x0B0B00, 0x111104, 0x101006, 0x0F0F02, 0x0C0C00, 0x131300, 0x191900, 0x131300,
+			0x0C0C00, 0x101003, 0x101006, 0x101004, 0x0C0C00, 0x121200, 0x191900, 0x141400, 0x0C0C00, 0x0D0D01,
+			0x0B0B04, 0x0A0A04, 0x0F0F06, 0x181809, 0x1B1B04, 0x1B1B00, 0x1A1A00, 0x191900, 0x161600, 0x151500,
+			0x171705, 0x141409, 0x0C0C05, 0x060602, 0x030301, 0x050502, 0x0C0C05, 0x161609, 0x1B1B05, 0x1A1A00,
+			0x191900, 0x151500, 0x171700, 0x1C1C06, 0x242410, 0x1E1E05, 0x151500, 0x131300, 0x0B0B00, 0x0E0E00,
+			0x141408, 0x131305, 0x0C0C00, 0x131300, 0x191900, 0x121200, 0x0C0C00, 0x0F0F04, 0x101007, 0x131308,
+			0x1A1A08, 0x191900, 0x171700, 0x161600, 0x161600, 0x1A1A03, 0x21210D, 0x21210C, 0x151500, 0x131300,
+			0x0C0C00, 0x080800, 0x0D0D05, 0x070703, 0x080803, 0x0F0F06, 0x19190A, 0x181800, 0x171700, 0x171700,
+			0x141400, 0x151504, 0x131307, 0x0F0F06, 0x111107, 0x18180A, 0x1B1B06, 0x1C1C00, 0x191900, 0x191900,
+			0x161600, 0x151500, 0x171703, 0x161609, 0x0E0E06, 0x070703, 0x020201, 0x020200, 0x070702, 0x0D0D05,
+			0x16160A, 0x1B1B0B, 0x1C1C0D, 0x19190B, 0x121208, 0x0C0C05, 0x080803, 0x090904, 0x0F0F06, 0x161609,
+			0x1A1A0C, 0x1B1B0C, 0x16160A, 0x101006, 0x0A0A03, 0x0A0A03, 0x0E0E05, 0x141408, 0x1A1A0B, 0x1C1C0C,
+			0x18180A, 0x111108, 0x090903, 0x050502, 0x040401, 0x070703, 0x0D0D05, 0x141408, 0x19190A, 0x1B1B0C,
+			0x17170A, 0x111107, 0x0B0B05, 0x060602, 0x040401, 0x060603, 0x0C0C04, 0x121207, 0x19190A, 0x1D1D0D,
+			0x1E1E0D, 0x1B1B0B, 0x17170A, 0x101006, 0x090904, 0x050502, 0x050502, 0x070702, 0x0D0D06, 0x141409,
+			0x1A1A0B, 0x1C1C0C, 0x18180A, 0x111107, 0x090903, 0x040401, 0x010100, 0x020200, 0x060602, 0x0C0C05,
+			0x141407, 0x19190B, 0x1B1B0C, 0x18180A, 0x121207, 0x0C0C05, 0x0A0A04, 0x0D0D05, 0x131307, 0x19190B,
+			0x1B1B0B, 0x19190A, 0x121208, 0x0D0D05, 0x0A0A04, 0x0C0C05, 0x121207, 0x19190A, 0x1B1B0B, 0x19190B,
+			0x131307, 0x0B0B04, 0x060602, 0x040401, 0x060602, 0x0C0C05, 0x131307, 0x17170A, 0x1D1D0D, 0x1E1E0D,
+			0x1B1B0B, 0x17170A, 0x101006, 0x0A0A05, 0x050501, 0x010100, 0x010100, 0x050502, 0x0B0B04, 0x111107,
+			0x18180A, 0x1C1C0C, 0x1A1A0C, 0x171709, 0x141408, 0x131308, 0x151508, 0x18180A, 0x171709, 0x151509,
+			0x0F0F06, 0x0D0D05, 0x0E0E07, 0x151509, 0x19190B, 0x1B1B0B, 0x19190B, 0x111107, 0x0C0C04, 0x080803,
+			0x0A0A03, 0x0E0E05, 0x151509, 0x1A1A0A, 0x1B1B0C, 0x181809, 0x141408, 0x131308, 0x131308, 0x17170A,
+			0x17170A, 0x141409, 0x0E0E05, 0x080803, 0x040401, 0x040401, 0x070703, 0x0D0D05, 0x151509, 0x1A1A0A,
+			0x1A1A0B, 0x17170A, 0x101006, 0x0B0B04, 0x060602, 0x070702, 0x0B0B05, 0x101006, 0x17170A, 0x1C1C0B,
+			0x1E1E0D, 0x1C1C0B, 0x171709, 0x111107, 0x0B0B05, 0x060603, 0x020200, 0x030301, 0x050503, 0x090903,
+			0x0A0A04, 0x0A0A04, 0x090903, 0x070703, 0x050501, 0x040402, 0x040402, 0x060602, 0x090903, 0x0A0A04,
+			0x0A0A04, 0x090903, 0x060602, 0x040402, 0x040402, 0x050502, 0x080803, 0x090903, 0x0A0A04, 0x090903,
+			0x060603, 0x040402, 0x010100, 0x020201, 0x030301, 0x060602, 0x080803, 0x080803, 0x080803, 0x060602,
+			0x020201, 0x020201, 0x050502, 0x080803, 0x090904, 0x0A0A04, 0x090903, 0x070703, 0x040402, 0x020201,
+			0x010100, 0x020201, 0x050502, 0x080803, 0x0A0A04, 0x0A0A04, 0x090903, 0x060603, 0x040402, 0x010100,
+			0x010100, 0x020201, 0x040402, 0x080803, 0x0A0A04, 0x0A0A04, 0x090903, 0x070703, 0x050502, 0x050502,
+			0x050501, 0x070703, 0x0A0A04, 0x0A0A04, 0x0A0A04, 0x080803, 0x050501, 0x050502, 0x050501, 0x070703,
+			0x0A0A04, 0x0A0A04, 0x0A0A04, 0x070703, 0x040402, 0x020201, 0x010100, 0x010100, 0x020201, 0x050502,
+			0x080803, 0x090904, 0x0A0A04, 0x090903, 0x070703, 0x040402, 0x020201, 0x010100, 0x020200, 0x050502,
+			0x080803, 0x090903, 0x090903, 0x070703, 0x060602, 0x050502, 0x070703, 0x080803, 0x090903, 0x090903,
+			0x060603, 0x050502, 0x060603, 0x080803, 0x0A0A04, 0x0A0A04, 0x0A0A04, 0x070703, 0x040402, 0x020200,
+			0x020200, 0x030300, 0x060603, 0x080803, 0x090903, 0x080803, 0x050502, 0x050502, 0x050502, 0x080803,
+			0x080803, 0x080803, 0x060603, 0x030300, 0x010100, 0x020201, 0x040402, 0x060602, 0x080803, 0x080803,
+			0x080803, 0x050502, 0x020201, 0x020201, 0x040402, 0x070703, 0x090903, 0x0A0A04, 0x090903, 0x080803,
+			0x050502, 0x020201, 0x010100, 0x030301, 0x050503, 0x090903, 0x0A0A04, 0x0C0C05, 0x0C0C05, 0x0C0C05,
+			0x0C0C05, 0x0C0C05, 0x0C0C05, 0x0C0C05, 0x0B0B04, 0x0A0A04, 0x090903, 0x060602, 0x030301, 0x010100,
+			0x020201, 0x080802, 0x0C0C03, 0x141407, 0x1A1A09, 0x1D1D0B, 0x1D1D0A, 0x1B1B0A, 0x191909, 0x181808,
+			0x191909, 0x1A1A09, 0x1B1B0A, 0x1A1A09, 0x161608, 0x101005, 0x0B0B04, 0x040401, 0x010100, 0x040401,
+			0x0B0B03, 0x202012, 0x282812, 0x303013, 0x353515, 0x333314, 0x2E2E12, 0x28280F, 0x25250E, 0x26260F,
+			0x2A2A10, 0x2E2E12, 0x2F2F12, 0x2B2B11, 0x20200D, 0x121207, 0x090903, 0x020200, 0x010100, 0x020200,
+			0x040401, 0x020201, 0x020200, 0x010100, 0x050502, 0x060600, 0x8D8D82, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xADADA3,
+			0x111100, 0x0E0E06, 0x020201, 0x020201, 0x060602, 0x090904, 0x0C0C05, 0x0B0B04, 0x080803, 0x050502,
+			0x010100, 0x050501, 0x131308, 0x191901, 0x676748, 0xFFFFFF, 0xFFFFFF, 0xC2C2B1, 0x333306, 0x2E2E0F,
+			0x24240A, 0x23230B, 0x272706, 0x727257, 0xFDFDFB, 0xFFFFFF, 0xA2A294, 0x161600, 0x111107, 0x030301,
+			0x050501, 0x0E0E05, 0x111104, 0x080800, 0x090900, 0x121207, 0x0A0A04, 0x030301, 0x030301, 0x121207,
+			0x25250D, 0x515129, 0xFFFFFF, 0xFFFFFF, 0xC5C5B4, 0x35350A, 0x2B2B11, 0x1E1E0B, 0x1B1B0B, 0x26260E,
+			0x252504, 0x898974, 0xFFFFFF, 0xA1A194, 0x141400, 0x121207, 0x050502, 0x010100, 0x020200, 0x020200,
+			0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x020200, 0x020200, 0x010100,
+			0x010100, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x010100,
+			0x010100, 0x010100, 0x010100, 0x010100, 0x010100, 0x020200, 0x020200, 0x010100, 0x010100, 0x010100,
+			0x010100, 0x010100, 0x010100, 0x030301, 0x0C0C05, 0x161606, 0x474734, 0xE1E1DF, 0xD0D0CA, 0x141400,
+			0x131308, 0x080803, 0x020201, 0x010100, 0x020201, 0x111107, 0x24240D, 0x52522A, 0xFFFFFF, 0xFFFFFF,
+			0xC6C6B5, 0x313109, 0x24240F, 0x151509, 0x111107, 0x1A1A0B, 0x25250E, 0x252507, 0xFFFFFF, 0xABABA2,
+			0x101000, 0x131307, 0x0C0C05, 0x0B0B04, 0x0D0D05, 0x0D0D05, 0x0A0A04, 0x070702, 0x050502, 0x050502,
+			0x070703, 0x0A0A04, 0x0B0B04, 0x0B0B04, 0x0A0A04, 0x080804, 0x090904, 0x0B0B04, 0x0B0B04, 0x0A0A04,
+			0x090904, 0x070703, 0x080803, 0x0A0A04, 0x0B0B05, 0x0C0C05, 0x0A0A04, 0x070703, 0x040401, 0x020200,
+			0x010100, 0x030302, 0x070702, 0x0A0A04, 0x0B0B04, 0x0C0C05, 0x0B0B04, 0x090904, 0x050501, 0x030301,
+			0x010100, 0x020200, 0x050502, 0x090904, 0x0C0C04, 0x0B0B04, 0x0A0A04, 0x080803, 0x080803, 0x090904,
+			0x0B0B04, 0x0C0C05, 0x0A0A04, 0x0D0D04, 0x17170A, 0x232308, 0x74745B, 0xFFFFFF, 0xFAFAF8, 0x262604,
+			0x23230E, 0x141408, 0x0B0B04, 0x070703, 0x040401, 0x010100, 0x010100, 0x0E0E06, 0x21210B, 0x4E4E29,
+			0xFFFFFF, 0xFFFFFF, 0xC3C3B4, 0x272705, 0x1A1A0B, 0x0A0A05, 0x070703, 0x101007, 0x19190A, 0x1B1B0A,
+			0x080800, 0x0C0C00, 0x151508, 0x131308, 0x0E0E01, 0x151504, 0x1A1A06, 0x1A1A06, 0x121202, 0x0C0C02,
+			0x0B0B05, 0x0D0D05, 0x0D0D02, 0x111102, 0x161604, 0x121204, 0x0F0F02, 0x101006, 0x0F0F02, 0x111102,
+			0x151504, 0x161604, 0x161607, 0x17170A, 0x18180A, 0x181807, 0x181805, 0x1B1B06, 0x191907, 0x161608,
+			0x0F0F07, 0x080803, 0x020201, 0x030301, 0x070702, 0x0D0D06, 0x121208, 0x141406, 0x151503, 0x161605,
+			0x151504, 0x151508, 0x101007, 0x0B0B04, 0x060603, 0x070703, 0x0A0A03, 0x0C0C00, 0x131304, 0x161604,
+			0x161605, 0x171709, 0x17170A, 0x1A1A0A, 0x181806, 0x181805, 0x161605, 0x1B1B0A, 0x252510, 0x292902,
+			0xB6B6A3, 0xFFFFFF, 0xF6F6F0, 0x343405, 0x2C2C0E, 0x1A1A06, 0x0D0D00, 0x0A0A02, 0x070703, 0x020201,
+			0x010100, 0x0E0E06, 0x20200B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC4C4B4, 0x2A2A06, 0x1E1E0D, 0x121207,
+			0x101007, 0x101001, 0x0C0C00, 0x171707, 0x161609, 0x111107, 0x0F0F06, 0x0D0D01, 0x636356, 0x5B5B47,
+			0x616149, 0x616149, 0x60604D, 0x464637, 0x121204, 0x111103, 0x4E4E40, 0x5C5C4A, 0x5A5A46, 0x5A5A47,
+			0x58584A, 0x1B1B0A, 0x474739, 0x616150, 0x5C5C48, 0x61614B, 0x4D4D36, 0x26260C, 0x1F1F06, 0x323219,
+			0x5F5F48, 0x63634B, 0x525238, 0x242409, 0x1C1C09, 0x131308, 0x080803, 0x030301, 0x030301, 0x0A0A03,
+			0x121208, 0x191907, 0x161600, 0x3D3D28, 0x5D5D4B, 0x5D5D4A, 0x545440, 0x2B2B11, 0x191904, 0x171709,
+			0x0E0E06, 0x0B0B03, 0x222216, 0x636356, 0x5C5C47, 0x5F5F49, 0x5C5C45, 0x2C2C12, 0x232308, 0x2B2B0F,
+			0x56563F, 0x61614A, 0x5F5F4A, 0x323218, 0x282807, 0x727251, 0xFFFFFF, 0xFFFFFF, 0xF7F7F4, 0x717149,
+			0x6A6A4E, 0x5B5B49, 0x545449, 0x2B2B20, 0x070700, 0x040401, 0x010100, 0x0F0F06, 0x20200B, 0x4F4F29,
+			0xFFFFFF, 0xFFFFFF, 0xC6C6B4, 0x33330A, 0x2A2A12, 0x22220E, 0x1B1B06, 0x696958, 0xC7C7C1, 0x2D2D1B,
+			0x121206, 0x0D0D05, 0x0B0B04, 0x060600, 0xBEBEB6, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFBFBF8, 0x5F5F49,
+			0x1C1C08, 0x191905, 0x6F6F5D, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xA9A99F, 0x1B1B05, 0x5A5A47, 0xDFDFD9,
+			0xFFFFFF, 0xFFFFFF, 0xB8B8A8, 0x2A2A00, 0x83836F, 0xF9F9F8, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xCCCCC1,
+			0x38381A, 0x1D1D09, 0x111106, 0x080804, 0x090903, 0x131307, 0x1A1A05, 0x3A3A20, 0xBDBDB3, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xEAEAE6, 0x6B6B54, 0x1E1E05, 0x1A1A0B, 0x121206, 0x272716, 0xAFAFA3,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x35350B, 0x6C6C50, 0xE8E8E3, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x505031,
+			0x9B9B89, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x83837C,
+			0x010100, 0x050501, 0x010100, 0x0F0F06, 0x20200B, 0x4F4F29, 0xFFFFFF, 0xFFFFFF, 0xC4C4B1, 0x353505,
+			0x30300D, 0x2B2B0C, 0x1A1A00, 0xD4D4CB, 0xFFFFFF, 0x3C3C25, 0x141406, 0x0A0A04, 0x070702, 0x111107,
+			0x0F0F00, 0x8F8F7C, 0xFFFFFF, 0xFFFFFF, 0x999981, 0x292901, 0x2E2E14, 0x2C2C11, 0x1F1F00, 0xCCCCC2,
+			0xFFFFFF, 0x6F6F59, 0x161600, 0x1F1F0C, 0x212107, 0x3F3F1B, 0xEFEFEA, 0xFFFFFF, 0x989879, 0xBEBEAB,
+			0xFFFFFF, 0x9D9D8C, 0x9B9B85, 0xE0E0D7, 0xFFFFFF, 0xFFFFFF, 0xDBDBD2, 0x313111, 0x1B1B0A, 0x111106,
+			0x141408, 0x1C1C09, 0x3D3D1F, 0xFBFBFA, 0xFFFFFF, 0x93937F, 0x232301, 0x222200, 0x737358, 0xFFFFFF,
+			0xFFFFFF, 0x7C7C65, 0x1E1E05, 0x1D1D0D, 0x20200C, 0x1E1E00, 0xBEBEAD, 0xFFFFFF, 0xE9E9E1, 0x7B7B55,
+			0xFFFFFF, 0x9E9E8A, 0xC7C7BA, 0xFFFFFF, 0xFFFFFF, 0x535333, 0x303009, 0x2F2F00, 0xB2B29A, 0xFFFFFF,
+			0xF3F3EE, 0x333300, 0x262601, 0x111100, 0x010100, 0x060600, 0x090903, 0x030301, 0x010100, 0x0E0E06,
+			0x21210B, 0x4F4F29, 0xFFFFFF, 0xFFFFFF, 0xDADACF, 0x888866, 0x86866D, 0x818168, 0xA1A18D, 0xFFFFFF,
+			0xF5F5F3, 0x434327, 0x191908, 0x0C0C04, 0x050501, 0x0C0C05, 0x1F1F0C, 0x2B2B08, 0xC2C2B3, 0xFFFFFF,
+			0xF2F2EE, 0x535328, 0x3C3C17, 0x31310F, 0x626245, 0xFFFFFF, 0x969683, 0x1C1C01, 0x1D1D0C, 0x19190B,
+			0x26260E, 0x42421C, 0xE5E5DE, 0xFFFFFF, 0xFFFFFF, 0xC6C6B8, 0x31310C, 0x242406, 0x2B2B08, 0x3C3C0F,
+			0xC4C4B2, 0xFFFFFF, 0xFFFFFF, 0x8D8D75, 0x212107, 0x1D1D0D, 0x21210D, 0x212102, 0xECECE7, 0xFFFFFF,
+			0xA5A590, 0x292901, 0x303013, 0x333315, 0x2F2F07, 0xB3B39F, 0xFFFFFF, 0xF9F9F6, 0x373717, 0x22220D,
+			0x252510, 0x2C2C09, 0xA4A48E, 0xFFFFFF, 0xFFFFFF, 0xF2F2ED, 0x3E3E15, 0x2D2D08, 0x2A2A07, 0xE2E2DB,
+			0xFFFFFF, 0x4E4E34, 0x313111, 0x39390F, 0xB9B9A5, 0xFFFFFF, 0xF7F7F2, 0x3B3B0D, 0x313114, 0x1D1D0D,
+			0x101006, 0x0A0A04, 0x060602, 0x020200, 0x010100, 0x0E0E06, 0x21210B, 0x4F4F29, 0xFFFFFF, 0xFFFFFF,
+			0xFDFDFC, 0xF5F5F2, 0xF6F6F4, 0xF5F5F3, 0xFDFDFB, 0xFFFFFF, 0xF5F5F2, 0x444428, 0x191908, 0x0C0C04,
+			0x030301, 0x060602, 0x151509, 0x24240D, 0x41411D, 0xFCFCFA, 0xFFFFFF, 0xC1C1B0, 0x41410F, 0x44441A,
+			0xF1F1EE, 0xD3D3CB, 0x212104, 0x1E1E0C, 0x131308, 0x121207, 0x21210D, 0x41411C, 0xE6E6DF, 0xFFFFFF,
+			0xEAEAE3, 0x49491F, 0x2C2C0F, 0x21210F, 0x262610, 0x333313, 0x545426, 0xFFFFFF, 0xFFFFFF, 0xD7D7CD,
+			0x262603, 0x282812, 0x27270A, 0x6C6C4F, 0xFFFFFF, 0xFEFEFD, 0x66663E, 0x3A3A14, 0x313115, 0x323215,
+			0x3B3B12, 0x83835F, 0xFFFFFF, 0xFFFFFF, 0x707053, 0x24240A, 0x282811, 0x2C2C09, 0xA6A690, 0xFFFFFF,
+			0xFFFFFF, 0x767651, 0x31310E, 0x2B2B12, 0x23230C, 0x383822, 0x4A4A39, 0x272712, 0x292911, 0x31310B,
+			0xB7B7A4, 0xFFFFFF, 0xF6F6F2, 0x333309, 0x272711, 0x121208, 0x070703, 0x040402, 0x020200, 0x010100,
+			0x0F0F06, 0x20200B, 0x4F4F29, 0xFFFFFF, 0xFFFFFF, 0xC0C0AD, 0x313100, 0x2C2C04, 0x262600, 0x373710,
+			0xFDFDFB, 0xF8F8F6, 0x3F3F25, 0x171707, 0x0A0A03, 0x010100, 0x090904, 0x18180A, 0x252508, 0x7E7E61,
+			0xFFFFFF, 0xFFFFFF, 0x77774D, 0xBFBFAD, 0xFFFFFF, 0x3C3C1F, 0x1C1C09, 0x101007, 0x080803, 0x0B0B04,
+			0x1E1E0B, 0x3D3D1B, 0xE6E6DE, 0xFFFFFF, 0xBFBFAD, 0x303009, 0x24240F, 0x111107, 0x141409, 0x282811,
+			0x2F2F03, 0xEEEEE6, 0xFFFFFF, 0xFFFFFF, 0x303007, 0x323215, 0x2E2E09, 0xB9B9AA, 0xFFFFFF, 0xE8E8E0,
+			0x4D4D1C, 0x32320A, 0x232306, 0x242407, 0x2F2F08, 0x5F5F34, 0xFFFFFF, 0xFFFFFF, 0x9A9A87, 0x212106,
+			0x272711, 0x292908, 0xA4A490, 0xFFFFFF, 0xF7F7F4, 0x4E4E25, 0x2B2B0F, 0x1C1C0C, 0x121208, 0x111104,
+			0x0D0D02, 0x141407, 0x1F1F0E, 0x2A2A07, 0xB5B5A3, 0xFFFFFF, 0xF6F6F1, 0x2B2B06, 0x1F1F0D, 0x0B0B04,
+			0x010100, 0x010100, 0x0F0F06, 0x20200B, 0x4F4F29, 0xFFFFFF, 0xFFFFFF, 0xC7C7B4, 0x37370C, 0x303015,
+			0x2A2A11, 0x1D1D02, 0xA0A092, 0xFFFFFF, 0x383825, 0x121206, 0x0A0A04, 0x020200, 0x010100, 0x040402,
+			0x0D0D06, 0x20200D, 0x252500, 0xBFBFAF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x5C5C36, 0x252508, 0x19190A,
+			0x090903, 0x030301, 0x090904, 0x1D1D0B, 0x3D3D1B, 0xE6E6DE, 0xFFFFFF, 0xBDBDAD, 0x282807, 0x1C1C0B,
+			0x080803, 0x0A0A04, 0x1D1D0D, 0x2B2B07, 0xCECEBE, 0xFFFFFF, 0xFFFFFF, 0x4D4D26, 0x363614, 0x414119,
+			0xDCDCD3, 0xFFFFFF, 0xEEEEE9, 0xA2A286, 0x9D9D88, 0x949486, 0x959586, 0x999986, 0xA7A78F, 0xFFFFFF,
+			0xFFFFFF, 0xB7B7AB, 0x1B1B02, 0x27270F, 0x292908, 0xA3A38E, 0xFFFFFF, 0xF7F7F3, 0x474722, 0x22220C,
+			0x0F0F07, 0x060603, 0x050502, 0x050502, 0x0B0B04, 0x19190A, 0x262606, 0xB4B4A2, 0xFFFFFF, 0xF6F6F2,
+			0x2B2B06, 0x1E1E0D, 0x0A0A04, 0x010100, 0x0F0F06, 0x20200B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC5C5B4,
+			0x2D2D08, 0x23230F, 0x18180A, 0x161609, 0x20200E, 0x2A2A1A, 0x1A1A0A, 0x141408, 0x0D0D06, 0x050502,
+			0x020200, 0x020200, 0x090904, 0x19190B, 0x2F2F12, 0x4C4C1D, 0xEAEAE3, 0xFFFFFF, 0xD9D9CC, 0x404010,
+			0x2D2D13, 0x18180A, 0x070703, 0x020201, 0x090904, 0x1D1D0B, 0x3D3D1B, 0xE6E6DE, 0xFFFFFF, 0xBCBCAC,
+			0x262606, 0x19190A, 0x060603, 0x080802, 0x1B1B0C, 0x282806, 0xCACABA, 0xFFFFFF, 0xFFFFFF, 0x52522A,
+			0x393915, 0x484821, 0xE7E7DF, 0xFFFFFF, 0xF9F9F7, 0xDDDDD3, 0xDEDED8, 0xDBDBD7, 0xDADAD6, 0xDBDBD6,
+			0xDADAD5, 0xD1D1C9, 0xD5D5CF, 0x9A9A8E, 0x151502, 0x23230F, 0x272708, 0xA3A38E, 0xFFFFFF, 0xF7F7F4,
+			0x464622, 0x20200B, 0x0D0D05, 0x010101, 0x070702, 0x17170A, 0x262606, 0xB4B4A2, 0xFFFFFF, 0xF6F6F2,
+			0x2B2B06, 0x1F1F0D, 0x0A0A04, 0x010100, 0x0F0F06, 0x20200B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC4C4B4,
+			0x272705, 0x1A1A0B, 0x0C0C05, 0x090903, 0x0F0F05, 0x131306, 0x171709, 0x0E0E00, 0x090900, 0x0B0B05,
+			0x060602, 0x040401, 0x0A0A03, 0x19190B, 0x28280B, 0x62623C, 0xFAFAF8, 0xFFFFFF, 0xFFFFFF, 0x909073,
+			0x2C2C0C, 0x1E1E0C, 0x0B0B05, 0x030300, 0x090904, 0x1D1D0B, 0x3D3D1B, 0xE6E6DE, 0xFFFFFF, 0xBDBDAC,
+			0x262605, 0x1A1A0A, 0x060603, 0x080802, 0x1B1B0C, 0x282806, 0xC9C9BB, 0xFFFFFF, 0xFFFFFF, 0x4A4A22,
+			0x393915, 0x474721, 0xE7E7E0, 0xFFFFFF, 0xD5D5C7, 0x343400, 0x2B2B06, 0x181800, 0x121200, 0x151500,
+			0x1A1A00, 0x1B1B00, 0x171700, 0x111100, 0x151509, 0x1E1E0D, 0x262607, 0xA2A28E, 0xFFFFFF, 0xF6F6F4,
+			0x464622, 0x1E1E0B, 0x0B0B05, 0x060602, 0x161609, 0x262606, 0xB4B4A2, 0xFFFFFF, 0xF6F6F1, 0x2C2C07,
+			0x20200E, 0x0B0B04, 0x010100, 0x0E0E06, 0x21210B, 0x4E4E29, 0xFFFFFF, 0xFFFFFF, 0xC4C4B4, 0x252505,
+			0x18180B, 0x070703, 0x030301, 0x0B0B05, 0x151508, 0x161605, 0x86867B, 0x7F7F75, 0x0B0B00, 0x0D0D05,
+			0x080803, 0x0F0F06, 0x1C1C0A, 0x2A2A0B, 0xFCFCFD, 0xD3D3C6, 0xA1A183, 0xFFFFFF, 0xFFFFFF, 0x575735,
+			0x232309, 0x131308, 0x080803, 0x0B0B04, 0x1E1E0B, 0x3D3D1B, 0xE6E6DE, 0xFFFFFF, 0xBCBCAD, 0x282806,
+			0x1B1B0B, 0x070702, 0x0A0A04, 0x1D1D0D, 0x2A2A05, 0xCCCCBD, 0xFFFFFF, 0xFFFFFF, 0x33330A, 0x363615,
+			0x3C3C17, 0xD9D9CF, 0xFFFFFF, 0xE5E5DD, 0x4E4E1F, 0x363616, 0x22220E, 0x1A1A0B, 0x1A1A0B, 0x1D1D0D,
+			0x1E1E0D, 0x1B1B0B, 0x131308, 0x101007, 0x1B1B0C, 0x252506, 0xA3A38E, 0xFFFFFF, 0xF6F6F4, 0x464622,
+			0x1E1E0B, 0x0C0C05, 0x050502, 0x161609, 0x252506, 0xB4B4A2, 0xFFFFFF, 0xF5F5F0, 0x2F2F08, 0x24240F,
+			0x0F0F06, 0x040402, 0x030302, 0x010100, 0x010100, 0x010100, 0x0F0F06, 0x22220C, 0x505029, 0xFFFFFF,
+			0xFFFFFF, 0xC4C4B4, 0x2B2B07, 0x1E1E0D, 0x0C0C05, 0x080804, 0x141407, 0x20200C, 0x222204, 0xFFFFFF,
+			0xBDBDB5, 0x121200, 0x17170A, 0x141408, 0x1D1D0B, 0x1A1A00, 0xCFCFC8, 0xF3F3F1, 0x47471E, 0x393904,
+			0xE8E8E1, 0xFFFFFF, 0xEAEAE4, 0x383813, 0x22220C, 0x131308, 0x101006, 0x1F1F0C, 0x3E3E1B, 0xE6E6DE,
+			0xFFFFFF, 0xC2C2B1, 0x32320B, 0x23230F, 0x121207, 0x141408, 0x272711, 0x292900, 0xF9F9F7, 0xFFFFFF,
+			0xCFCFC2, 0x262604, 0x2D2D12, 0x2B2B09, 0xB5B5A5, 0xFFFFFF, 0xFCFCFB, 0x636339, 0x373713, 0x262610,
+			0x1D1D0C, 0x1B1B0B, 0x1C1C0C, 0x171708, 0x090900, 0x0E0E05, 0x0F0F06, 0x1B1B0C, 0x272708, 0xA5A58F,
+			0xFFFFFF, 0xF7F7F4, 0x484823, 0x20200B, 0x0D0D05, 0x010100, 0x050502, 0x141408, 0x222205, 0xB7B7A5,
+			0xFFFFFF, 0xFFFFFF, 0x373708, 0x303014, 0x1C1C0C, 0x0E0E05, 0x090902, 0x070703, 0x020201, 0x030301,
+			0x111107, 0x25250D, 0x52522A, 0xFFFFFF, 0xFFFFFF, 0xC6C6B4, 0x33330B, 0x282810, 0x18180A, 0x161609,
+			0x23230E, 0x29290A, 0x737359, 0xFFFFFF, 0xAEAEA0, 0x1E1E02, 0x21210E, 0x21210D, 0x232307, 0x878772,
+			0xFFFFFF, 0x59593C, 0x333310, 0x3B3B14, 0x66663F, 0xFFFFFF, 0xFFFFFF, 0xAFAF9B, 0x272705, 0x1F1F0D,
+			0x17170A, 0x22220D, 0x40401B, 0xE7E7DF, 0xFFFFFF, 0xDDDDD1, 0x444418, 0x2E2E12, 0x20200E, 0x22220F,
+			0x2C2C0E, 0x53532D, 0xFFFFFF, 0xFFFFFF, 0x7B7B62, 0x222208, 0x22220D, 0x23230B, 0x626245, 0xFFFFFF,
+			0xFFFFFF, 0xBABAA7, 0x343407, 0x2D2D10, 0x27270E, 0x23230D, 0x161600, 0x32321F, 0xA7A7A0, 0x1D1D13,
+			0x101004, 0x1E1E0D, 0x2A2A09, 0xA6A690, 0xFFFFFF, 0xF7F7F3, 0x494923, 0x22220C, 0x0E0E06, 0x030301,
+			0x050501, 0x111107, 0x202005, 0x9E9E89, 0xFFFFFF, 0xFFFFFF, 0x5D5D2F, 0x383812, 0x26260E, 0x191908,
+			0x19190F, 0x080802, 0x050501, 0x030301, 0x121208, 0x24240B, 0x505029, 0xFFFFFF, 0xFFFFFF, 0xC2C2AF,
+			0x2E2E00, 0x242407, 0x171701, 0x171701, 0x232305, 0x36360F, 0xD8D8D0, 0xFFFFFF, 0xA7A796, 0x242406,
+			0x272710, 0x1C1C01, 0x606047, 0xFFFFFF, 0xA6A695, 0x242403, 0x2C2C12, 0x303014, 0x2F2F05, 0xAEAE98,
+			0xFFFFFF, 0xFFFFFF, 0x616143, 0x1C1C02, 0x1D1D0C, 0x24240E, 0x40401B, 0xE6E6DF, 0xFFFFFF, 0xFFFFFF,
+			0x7E7E5B, 0x2C2C04, 0x202005, 0x222205, 0x2E2E0A, 0xC9C9BD, 0xFFFFFF, 0xD4D4CB, 0x2A2A0B, 0x1C1C0B,
+			0x161609, 0x1D1D0B, 0x222203, 0xDEDED4, 0xFFFFFF, 0xFFFFFF, 0xB2B29E, 0x4B4B25, 0x2D2D08, 0x2D2D0C,
+			0x878776, 0xFCFCFB, 0xFDFDFD, 0x2A2A1C, 0x111104, 0x1F1F0D, 0x272706, 0xB4B4A2, 0xFFFFFF, 0xF7F7F4,
+			0x47471F, 0x22220B, 0x0F0F07, 0x040401, 0x020200, 0x0D0D05, 0x1D1D08, 0x65654B, 0xFFFFFF, 0xFFFFFF,
+			0xD6D6CA, 0x48481D, 0x2B2B08, 0xBEBEB8, 0xB8B8B4, 0x030300, 0x060602, 0x050502, 0x111106, 0x22220C,
+			0xB0B09F, 0xFFFFFF, 0xFFFFFF, 0xE7E7E0, 0x9D9D86, 0x9C9C8C, 0x98988A, 0x98988A, 0x979785, 0xE2E2DC,
+			0xFFFFFF, 0xFFFFFF, 0x959582, 0x232307, 0x1B1B02, 0x787866, 0xFFFFFF, 0xFFFFFF, 0xAEAE9F, 0x1A1A00,
+			0x20200D, 0x21210E, 0x1F1F00, 0xAEAE9B, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0x737360, 0x191905, 0x28280F,
+			0x41411C, 0xE6E6DF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xD0D0C6, 0x979786, 0xA2A292, 0xF3F3EF, 0xFFFFFF,
+			0xCECEC4, 0x333317, 0x1B1B08, 0x101007, 0x0B0B04, 0x111106, 0x1C1C0A, 0x303010, 0xD0D0C6, 0xFFFFFF,
+			0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xBCBCB2, 0x1B1B07, 0x111102, 0x141407, 0x161605,
+			0x47472D, 0xFEFEFC, 0xFFFFFF, 0xFFFFFF, 0xA0A08E, 0x191902, 0x0F0F06, 0x050502, 0x010100, 0x090903,
+			0x181808, 0x2C2C10, 0xC3C3B7, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xF1F1EE, 0x272718, 0x0C0C01,
+			0x060602, 0x050502, 0x040400, 0x92928A, 0xD4D4CF, 0xCCCCC4, 0xCDCDC3, 0xD0D0C8, 0xD7D7D1, 0xD6D6D0,
+			0xD5D5D0, 0xD6D6D1, 0xD6D6D1, 0xD0D0C9, 0xCBCBC2, 0xD4D4CD, 0x6B6B58, 0x191902, 0x434333, 0xD9D9D5,
+			0xCBCBC5, 0xCACAC2, 0xD4D4CF, 0x707065, 0x101000, 0x0F0F01, 0x818176, 0xD3D3CD, 0xCCCCC3, 0xCCCCC3,
+			0xCFCFC7, 0xC9C9C4, 0x3C3C2C, 0x24240C, 0x41411B, 0xE6E6DF, 0xFFFFFF, 0xBEBEAA, 0x7B7B54, 0xBFBFB3,
+			0xD8D8D4, 0xD8D8D3, 0xADADA2, 0x5A5A44, 0x1E1E05, 0x1A1A08, 0x111107, 0x080803, 0x040402, 0x080803,
+			0x111106, 0x1D1D09, 0x252507, 0x636349, 0xADAD9E, 0xCFCFC6, 0xCFCFC7, 0xA0A092, 0x4E4E37, 0x181802,
+			0x161607, 0x101007, 0x0D0D03, 0x262618, 0xBBBBB5, 0xD1D1CA, 0xCBCBC3, 0xCCCCC4, 0xD5D5CF, 0x91918A,
+			0x0C0C02, 0x040401, 0x040401, 0x0E0E06, 0x1A1A09, 0x2A2A0E, 0x888874, 0xD1D1CA, 0xC7C7BF, 0x7F7F6D,
+			0x181801, 0x111104, 0x0C0C04, 0x030301, 0x030301, 0x0B0B04, 0x090900, 0x0F0F00, 0x191900, 0x1D1D00,
+			0x1C1C00, 0x181800, 0x131300, 0x111100, 0x121200, 0x161600, 0x191900, 0x181800, 0x141400, 0x151503,
+			0x171708, 0x131305, 0x0B0B00, 0x101000, 0x131300, 0x0D0D00, 0x0C0C00, 0x0E0E05, 0x0E0E06, 0x0C0C00,
+			0x101000, 0x191900, 0x1A1A00, 0x141400, 0x0C0C00, 0x161607, 0x25250E, 0x40401B, 0xE6E6DE, 0xFFFFFF,
+			0xC2C2AF, 0x393907, 0x292907, 0x161600, 0x111100, 0x131300, 0x161604, 0x161609, 0x0F0F06, 0x080803,
+			0x020200, 0x020201, 0x070703, 0x0F0F07, 0x191909, 0x1C1C07, 0x1C1C02, 0x1A1A00, 0x191900, 0x181801,
+			0x181807, 0x161609, 0x0E0E06, 0x080803, 0x090904, 0x0D0D04, 0x0A0A00, 0x141400, 0x191900, 0x181800,
+			0x0F0F00, 0x080800, 0x0A0A04, 0x040401, 0x010101, 0x060603, 0x0F0F07, 0x181809, 0x191903, 0x181800,
+			0x171700, 0x171703, 0x161609, 0x0E0E06, 0x060602, 0x020200, 0x010100, 0x060602, 0x0A0A04, 0x111107,
+			0x151508, 0x18180A, 0x18180A, 0x17170A, 0x151509, 0x151509, 0x161609, 0x161609, 0x17170A, 0x151508,
+			0x121208, 0x0E0E05, 0x0B0B04, 0x0C0C05, 0x0F0F05, 0x121207, 0x121207, 0x0F0F07, 0x0A0A04, 0x070703,
+			0x080803, 0x0B0B04, 0x101007, 0x151509, 0x161609, 0x131308, 0x0F0F06, 0x121207, 0x22220D, 0x3E3E1A,
+			0xE7E7DE, 0xFFFFFF, 0xC0C0AE, 0x34340C, 0x2B2B12, 0x1A1A0B, 0x131308, 0x111107, 0x0E0E06, 0x090903,
+			0x060602, 0x020201, 0x020201, 0x050502, 0x0A0A03, 0x0F0F06, 0x141409, 0x16160A, 0x16160A, 0x141407,
+			0x0F0F06, 0x0A0A03, 0x050502, 0x030301, 0x040401, 0x070703, 0x0D0D05, 0x121208, 0x151508, 0x151509,
+			0x111107, 0x0A0A04, 0x060602, 0x020200, 0x020200, 0x060602, 0x0A0A05, 0x101007, 0x131307, 0x141408,
+			0x101007, 0x0B0B05, 0x060602, 0x020201, 0x010100, 0x030302, 0x050501, 0x050502, 0x060602, 0x060603,
+			0x060603, 0x070703, 0x070703, 0x070703, 0x070703, 0x060602, 0x050502, 0x050501, 0x030302, 0x030301,
+			0x030302, 0x040401, 0x050501, 0x050501, 0x050501, 0x030301, 0x020200, 0x020201, 0x030301, 0x040401,
+			0x050502, 0x050502, 0x050502, 0x060601, 0x0E0E07, 0x23230D, 0x41411B, 0xE6E6DF, 0xFFFFFF, 0xBFBFAE,
+			0x2E2E08, 0x21210E, 0x0D0D06, 0x060602, 0x030301, 0x020200, 0x010101, 0x010100, 0x030301, 0x040401,
+			0x040401, 0x040401, 0x030301, 0x030301, 0x010100, 0x010100, 0x010100, 0x030302, 0x060602, 0x050502,
+			0x050502, 0x040401, 0x040402, 0x010100, 0x020200, 0x030301, 0x030301, 0x030301, 0x030301, 0x020200,
+			0x030300, 0x0D0D05, 0x22220D, 0x41411B, 0xE7E7E0, 0xFFFFFF, 0xBEBEAD, 0x2B2B07, 0x1E1E0D, 0x090904,
+			0x010100, 0x030301, 0x0D0D06, 0x1A1A04, 0x494929, 0xF4F4F1, 0xFFFFFF, 0xDCDCD3, 0x2E2E0D, 0x171705,
+			0x0A0A04, 0x020200, 0x040401, 0x060600, 0x5E5E50, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xF0F0EC,
+			0x424233, 0x070700, 0x020202, 0x030301, 0x080803, 0x1A1A0E, 0x282814, 0x2E2E11, 0x313113, 0x2C2C11,
+			0x282816, 0x17170C, 0x080802, 0x020200, 0x010100, 0x050503, 0x0B0B03, 0x121206, 0x181808, 0x1B1B09,
+			0x171708, 0x111105, 0x0B0B03, 0x050503, 0x020200, 0x010100, 0x020201, 0x050501, 0x080803, 0x0A0A04,
+			0x0A0A04, 0x0A0A04, 0x080803, 0x050501, 0x020201, 0x010100, 0x030303, 0x060505, 0x0D0B0B, 0x161212,
+			0x282222, 0x3A3030, 0x493B3B, 0x504142, 0x4F3F3F, 0x4F3F40, 0x4E3F3F, 0x4E4040, 0x483C3C, 0x3E3535,
+			0x322A2B, 0x292323, 0x191515, 0x0D0B0B, 0x040404, 0x030303, 0x040303, 0x070606, 0x080707, 0x131010,
+			0x241E1E, 0x332A2A, 0x3E3333, 0x423635, 0x433636, 0x453839, 0x403535, 0x362D2D, 0x292323, 0x1C1818,
+			0x100E0E, 0x050505, 0x040404, 0x030303, 0x090707, 0x221C1B, 0x3E3333, 0x4E4242, 0x4B4040, 0x473C3C,
+			0x362C2C, 0x151111, 0x050404, 0x090808, 0x191615, 0x372E2E, 0x594A4A, 0xAC8E8E, 0xBF9A9A, 0xF1C2C2,
+			0xF1C0C0, 0xEDBCBC, 0xECBBBB, 0xEFBFBF, 0xF6C7C7, 0xFBD0D0, 0xCFAEAE, 0xBA9D9E, 0xB79B9B, 0x766363,
+			0x443838, 0x201A1A, 0x060505, 0x030303, 0x050505, 0x0A0909, 0x1A1616, 0x332B2B, 0x594949, 0xAE8F8F,
+			0xC9A2A2, 0xF5C6C6, 0xF1C0C0, 0xF1BFBF, 0xF4C3C3, 0xF7C9C9, 0xD2ACAC, 0xB19594, 0x7B6867, 0x3D3434,
+			0x211C1C, 0x0E0C0C, 0x040404, 0x030303, 0x050404, 0x191313, 0x806464, 0xFFCFCE, 0xFFD5D5, 0xFED7D7,
+			0xFED2D2, 0xD9ADAD, 0x2C2323, 0x030202, 0x050404, 0x0F0C0C, 0x282121, 0x564747, 0xBA9A9B, 0xF8CBCB,
+			0xF2BFC0, 0xEAB3B3, 0xE1A7A7, 0xC99090, 0xB98585, 0xB88484, 0xC58D8D, 0xDAA2A2, 0xE5B0B1, 0xEFBCBD,
+			0xF7CAC9, 0xFBD1D0, 0xFCCFCE, 0xFCC9CA, 0x624C4C, 0x14100F, 0x050404, 0x080707, 0x110E0E, 0x2B2424,
+			0x695756, 0xCFABAC, 0xF8C9C9, 0xF2BCBC, 0xEDB1B2, 0xD79B9B, 0xC08A8A, 0xBB8686, 0xC88F8F, 0xDDA4A5,
+			0xEAB2B3, 0xF3BFBF, 0xF8CBCA, 0xE4BEBE, 0x897373, 0x352C2C, 0x171313, 0x0B0909, 0x030303, 0x030303,
+			0x060505, 0x1C1515, 0x8C6868, 0xFAC0C0, 0xFCC7C9, 0xFCCACA, 0xFBC4C4, 0xD49E9E, 0x3A2C2C, 0x040303,
+			0x110E0E, 0x382E2E, 0x8C7271, 0xECC2C2, 0xF2C2C2, 0xE8B1B2, 0xD19595, 0x936969, 0x6C4E4E, 0x483434,
+			0x3E2D2D, 0x3C2C2B, 0x443131, 0x694C4C, 0x8F6767, 0xC28B8B, 0xE4ABAA, 0xF0BABA, 0xF6C0C0, 0xF7BBBB,
+			0x6C5050, 0x171111, 0x050404, 0x070606, 0x110E0E, 0x322929, 0x957A7A, 0xF8C9C8, 0xF2BEBE, 0xE9ACAD,
+			0xBB8585, 0x745454, 0x4C3838, 0x392929, 0x352626, 0x3C2C2C, 0x654949, 0x8F6666, 0xC99090, 0xE8AFB0,
+			0xF2C1C2, 0xFACBCB, 0xBC9999, 0x413535, 0x161212, 0x080707, 0x030303, 0x070505, 0x1A1313, 0x6C4F4F,
+			0xEDAAAA, 0xF4B6B5, 0xF5B8B8, 0xF1AFAF, 0xBA8686, 0x332626, 0x030202, 0x070505, 0x0E0C0C, 0x372C2C,
+			0x9B7C7B, 0xF5C6C5, 0xEEBBBC, 0xDFA8A8, 0xAE7C7C, 0x6E4F4F, 0x362727, 0x1E1616, 0x100C0C, 0x0B0909,
+			0x0B0909, 0x100C0D, 0x1D1616, 0x372728, 0x785555, 0xA67676, 0xD39999, 0xE6A8A8, 0xE8A5A5, 0x634747,
+			0x140F0F, 0x040303, 0x040303, 0x0F0D0D, 0x362C2C, 0xAD8B8B, 0xF5C3C3, 0xECB6B6, 0xD79C9C, 0x946868,
+			0x483434, 0x201818, 0x110D0D, 0x0A0808, 0x090707, 0x0E0A0A, 0x171111, 0x2F2222, 0x674949, 0xA87777,
+			0xDDA3A3, 0xEEBBBB, 0xF6C4C4, 0xD7AEAE, 0x413434, 0x151111, 0x040303, 0x030303, 0x030202, 0x040303,
+			0x130E0E, 0x5F4444, 0xD49797, 0xE7A4A4, 0xEAA7A8, 0xD99A9A, 0x9B6F6F, 0x2D2020, 0x050505, 0x0B0808,
+			0x2F2525, 0x8A6D6D, 0xF3BFBE, 0xEDB7B7, 0xDBA2A3, 0xA87777, 0x664949, 0x2B1F1F, 0x110C0C, 0x070606,
+			0x030303, 0x050404, 0x040202, 0x050404, 0x060505, 0x130E0E, 0x342525, 0x865F5F, 0xAD7A7A, 0xCB8F8F,
+			0xD29595, 0x5D4242, 0x140F0F, 0x030303, 0x030303, 0x090707, 0x292121, 0xA07E7E, 0xF3BFBF, 0xEBB3B4,
+			0xD39999, 0x926868, 0x3D2C2C, 0x151010, 0x070606, 0x030303, 0x030303, 0x030303, 0x040303, 0x050404,
+			0x0E0A0A, 0x241A1A, 0x664848, 0xA77676, 0xDCA0A0, 0xEEB5B5, 0xF4BFBF, 0xB89090, 0x352929, 0x0C0A0A,
+			0x0E0B0B, 0x503939, 0xD09393, 0xE09E9E, 0xE2A0A1, 0xD69797, 0x986B6B, 0x281D1C, 0x030202, 0x080707,
+			0x221A1A, 0x674F4F, 0xE4AFB0, 0xEBB3B4, 0xDDA3A3, 0xB47E7E, 0x795454, 0x2B1F1F, 0x0F0B0B, 0x040404,
+			0x030202, 0x080606, 0x191213, 0x573D3D, 0x986A6A, 0xAD7878, 0xB98282, 0x523A3A, 0x130E0E, 0x030202,
+			0x030303, 0x050404, 0x1B1515, 0x674F4F, 0xEFB8B9, 0xEBB1B2, 0xDB9E9C, 0xA87575, 0x503939, 0x171111,
+			0x050505, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x030202, 0x050404, 0x0B0909, 0x291D1D,
+			0x835B5B, 0xB78080, 0xE1A3A2, 0xEEB3B2, 0xEFB6B6, 0x856665, 0x201919, 0x070505, 0x030202, 0x0E0A0B,
+			0x402E2D, 0xCB8E8E, 0xDA9898, 0xDD9B9B, 0xD09292, 0x8B6262, 0x251B1B, 0x040404, 0x100D0D, 0x3F3030,
+			0xC39393, 0xE9AFAF, 0xE1A5A5, 0xC78B8B, 0x996A6A, 0x432F30, 0x130E0E, 0x040404, 0x040303, 0x0B0808,
+			0x291D1D, 0x7C5656, 0x885E5E, 0x986A6A, 0x483232, 0x120D0D, 0x030303, 0x030303, 0x100C0C, 0x372929,
+			0xCD9999, 0xEAAFAE, 0xE1A1A1, 0xBC8383, 0x805858, 0x251B1B, 0x070606, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x150F0F, 0x573C3C, 0xA37171, 0xCC8E8E,
+			0xE3A5A5, 0xEAAEAE, 0xCE9999, 0x3E2E2E, 0x0F0B0B, 0x040303, 0x030303, 0x0C0909, 0x3C2A2A, 0xC58989,
+			0xD49493, 0xD69594, 0xCA8C8C, 0x865D5D, 0x1F1616, 0x030303, 0x070506, 0x201718, 0x755555, 0xE5A8A8,
+			0xE2A5A6, 0xD49596, 0xAF7878, 0x775353, 0x251A1A, 0x0A0807, 0x050404, 0x050404, 0x181111, 0x553A3A,
+			0x714D4D, 0x7A5454, 0x372626, 0x0D0909, 0x030303, 0x040404, 0x030202, 0x030202, 0x030303, 0x030202,
+			0x030303, 0x040303, 0x030202, 0x030303, 0x030202, 0x030202, 0x050404, 0x1A1313, 0x7D5C5C, 0xE5A8A8,
+			0xE2A3A3, 0xD09291, 0xAA7575, 0x593D3D, 0x161010, 0x040404, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030202, 0x0B0809, 0x2C1F1F, 0x926364, 0xB77E7E, 0xD89898,
+			0xE4A4A5, 0xE5A6A6, 0x805D5D, 0x1D1515, 0x040303, 0x030303, 0x030303, 0x030202, 0x030202, 0x030202,
+			0x030202, 0x040404, 0x030303, 0x030202, 0x030303, 0x030202, 0x030303, 0x030202, 0x030303, 0x030303,
+			0x030303, 0x030303, 0x030202, 0x030303, 0x040303, 0x030303, 0x040303, 0x030303, 0x030303, 0x040404,
+			0x0A0808, 0x392828, 0xB77E7E, 0xCE8E8E, 0xD1908F, 0xC48686, 0x704D4D, 0x1B1313, 0x030303, 0x0A0808,
+			0x362727, 0xB37F80, 0xDFA1A1, 0xD89999, 0xC58686, 0xA36E6E, 0x533838, 0x140E0E, 0x040404, 0x030202,
+			0x090707, 0x160F0F, 0x211717, 0x1E1515, 0x120D0D, 0x060505, 0x030303, 0x040404, 0x050505, 0x070606,
+			0x060505, 0x0A0808, 0x0A0808, 0x0A0808, 0x0A0808, 0x090808, 0x090908, 0x070606, 0x040404, 0x030202,
+			0x060404, 0x090707, 0x090707, 0x090707, 0x0A0909, 0x090808, 0x090808, 0x070606, 0x030303, 0x040404,
+			0x030303, 0x070606, 0x080707, 0x0A0908, 0x090808, 0x090808, 0x060505, 0x040404, 0x030202, 0x040404,
+			0x060505, 0x080707, 0x0B0A0A, 0x0A0809, 0x060606, 0x050404, 0x030303, 0x040303, 0x050505, 0x070606,
+			0x0A0808, 0x090808, 0x090808, 0x080707, 0x070606, 0x060505, 0x050404, 0x030303, 0x080606, 0x312323,
+			0xB27F7F, 0xDFA09F, 0xD89998, 0xC18383, 0x9B6969, 0x2F2020, 0x0D0A0A, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060505, 0x1C1414, 0x744E4E,
+			0xAB7474, 0xCB8B8B, 0xDC9B9B, 0xDE9E9E, 0xB27D7D, 0x2E2020, 0x090707, 0x030303, 0x050404, 0x0B0808,
+			0x080707, 0x080707, 0x080707, 0x0C0A0A, 0x100D0D, 0x0B0909, 0x0A0808, 0x0A0808, 0x0A0808, 0x060505,
+			0x030202, 0x030202, 0x060505, 0x070606, 0x0B0808, 0x0A0808, 0x0C0A0A, 0x0C0A0A, 0x0A0808, 0x0C0A0A,
+			0x0A0808, 0x080707, 0x050404, 0x040303, 0x030303, 0x050303, 0x060605, 0x070606, 0x0B0909, 0x0B0909,
+			0x0B0909, 0x080707, 0x090808, 0x070606, 0x060505, 0x030202, 0x060505, 0x090808, 0x0B0909, 0x0D0A0A,
+			0x0B0909, 0x0D0B0B, 0x0B0909, 0x0A0909, 0x070606, 0x040404, 0x060505, 0x0A0808, 0x0C0A0A, 0x0E0C0C,
+			0x0E0B0B, 0x090808, 0x080707, 0x040404, 0x0B0808, 0x352525, 0xB27878, 0xCA8988, 0xCB8A8B, 0xBE8181,
+			0x614343, 0x171010, 0x030303, 0x150F0F, 0x4E3636, 0xD59494, 0xD99898, 0xD08F8F, 0xB67A7A, 0x956363,
+			0x342323, 0x0B0808, 0x030202, 0x030303, 0x050404, 0x060505, 0x070505, 0x040303, 0x040404, 0x050505,
+			0x080707, 0x0E0C0C, 0x1D1717, 0x281F1F, 0x332828, 0x392D2D, 0x3E3232, 0x3E3332, 0x3E3333, 0x392F2F,
+			0x262020, 0x110F0F, 0x0A0909, 0x020202, 0x030303, 0x030202, 0x110C0C, 0x291D1D, 0x372929, 0x3A2D2E,
+			0x3C3131, 0x3C3232, 0x3B3130, 0x312827, 0x1A1516, 0x070606, 0x050404, 0x0A0808, 0x141011, 0x282121,
+			0x342A2A, 0x3C3232, 0x3B3131, 0x322B2B, 0x241E1E, 0x120F0F, 0x060505, 0x030303, 0x030202, 0x040303,
+			0x0C0909, 0x171313, 0x251F1F, 0x372D2D, 0x3B3232, 0x3A3030, 0x322B2B, 0x1E1919, 0x100E0E, 0x060505,
+			0x030303, 0x050404, 0x0A0808, 0x0E0C0C, 0x211B1B, 0x2E2626, 0x372C2C, 0x3A2E2E, 0x3A2E2E, 0x372C2B,
+			0x312828, 0x251E1F, 0x141111, 0x0C0A0A, 0x060606, 0x030202, 0x030303, 0x120D0D, 0x4C3535, 0xD39393,
+			0xD89897, 0xD08F8F, 0xB67A7A, 0x7F5656, 0x231818, 0x080606, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050404, 0x130E0E, 0x533838, 0xA56F6F,
+			0xBF8181, 0xD39091, 0xD89695, 0xD28F8F, 0x3F2B2B, 0x0D0909, 0x030303, 0x0D0A0A, 0x271C1C, 0x3A2C2C,
+			0x413333, 0x423636, 0x443939, 0x463B3B, 0x413636, 0x433736, 0x443434, 0x372828, 0x211818, 0x0D090A,
+			0x030303, 0x040303, 0x150F0F, 0x302222, 0x3E2F2E, 0x413433, 0x413535, 0x473B3B, 0x463A3A, 0x423535,
+			0x413231, 0x362828, 0x1D1515, 0x090707, 0x030303, 0x040404, 0x070606, 0x130F0F, 0x231D1C, 0x352B2B,
+			0x3C2F30, 0x423435, 0x403332, 0x413434, 0x382E2E, 0x2B2323, 0x191515, 0x0A0809, 0x050505, 0x050404,
+			0x161010, 0x322424, 0x423030, 0x453636, 0x463838, 0x473A3B, 0x473B3B, 0x3B3030, 0x1D1818, 0x0B0909,
+			0x070606, 0x0F0C0C, 0x1B1616, 0x2F2727, 0x433737, 0x483C3C, 0x473B3B, 0x433636, 0x322827, 0x171313,
+			0x060505, 0x090708, 0x322322, 0xA97171, 0xC48484, 0xC58686, 0xB97C7C, 0x543939, 0x130D0D, 0x070606,
+			0x251919, 0x8A5D5D, 0xD39090, 0xD18E8F, 0xC68484, 0xAD7272, 0x815656, 0x281B1B, 0x080606, 0x030202,
+			0x030202, 0x050404, 0x060505, 0x0A0808, 0x1B1616, 0x2C2323, 0x3F3232, 0x826665, 0x9B7676, 0xB98C8C,
+			0xD2A0A0, 0xD3A4A3, 0xD8AAAA, 0xE0B4B4, 0xDDB6B7, 0xA18585, 0x5A4949, 0x231C1C, 0x0C0A0A, 0x050404,
+			0x040303, 0x1E1515, 0xD49292, 0xD79C9C, 0xDDA7A8, 0xE2B4B5, 0xE4BCBD, 0xE4BBBB, 0xE1B3B3, 0x584545,
+			0x110E0E, 0x110D0D, 0x271E1E, 0x584546, 0x9D7B7D, 0xE3B7B7, 0xE3BBBA, 0xE5BEBD, 0xDEBBBA, 0x9E8484,
+			0x4A3C3C, 0x1E1818, 0x0A0808, 0x040303, 0x080707, 0x100D0D, 0x2C2222, 0x735A5A, 0xA78685, 0xE2B7B8,
+			0xE3BBBB, 0xE5BDBD, 0xD6B4B4, 0x9B8282, 0x3A2F30, 0x1B1616, 0x050404, 0x050404, 0x0E0C0C, 0x251E1E,
+			0x413434, 0x997A7A, 0xB69191, 0xD8A7A7, 0xD4A2A3, 0xD5A3A3, 0xD9AAAA, 0xC8A2A2, 0x9F8080, 0x5D4B4B,
+			0x282121, 0x0E0C0C, 0x070505, 0x050404, 0x1E1515, 0x805656, 0xD28E8F, 0xD28F90, 0xC78686, 0xAF7474,
+			0x764E4E, 0x1C1313, 0x060504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030303, 0x0D0909, 0x322222, 0x9D6868, 0xB47777, 0xC98687, 0xD18C8C,
+			0xD08989, 0x664444, 0x171010, 0x040404, 0x171010, 0x9B6A6A, 0xD69C9C, 0xD9A6A7, 0xDEB3B4, 0xE4BBBC,
+			0xE5BDBD, 0xE4BABA, 0xDEB1B1, 0xD7A3A3, 0xD49898, 0x7A5353, 0x150F0F, 0x040404, 0x030303, 0x201616,
+			0xC38787, 0xD89D9D, 0xDCAAAA, 0xE0B5B5, 0xE4BBBB, 0xE2B8B8, 0xDCAEAE, 0xD6A1A1, 0xD49797, 0x5C3F3F,
+			0x0F0B0B, 0x030202, 0x030303, 0x070606, 0x110E0E, 0x282121, 0x483939, 0x9F7E7E, 0xBB9292, 0xD6A5A6,
+			0xD29FA0, 0xD3A1A2, 0xD8A7A7, 0xCBA2A2, 0xA48484, 0x645151, 0x2C2324, 0x130F0F, 0x050505, 0x040404,
+			0x030202, 0x040303, 0x251A1A, 0xD39292, 0xD69C9C, 0xDAA7A7, 0xE0B4B3, 0xE4BBBB, 0xE4B9B8, 0xE1B4B3,
+			0x634D4E, 0x181313, 0x1A1414, 0x352929, 0x705857, 0xA58383, 0xE2B8B8, 0xE3BABB, 0xE4BBBB, 0xE2B5B5,
+			0xCEA1A1, 0x312525, 0x090707, 0x0A0707, 0x312120, 0xA06969, 0xBE7E7D, 0xBF807F, 0xB37777, 0x472F2F,
+			0x100B0B, 0x0B0808, 0x312121, 0xA06868, 0xCB8686, 0xCA8686, 0xBE7C7C, 0xA76C6C, 0x6C4646, 0x201515,
+			0x060505, 0x040303, 0x0E0B0B, 0x1F1818, 0x3A2E2E, 0x7A6161, 0xA98686, 0xD7A5A6, 0xCE9696, 0xC48383,
+			0xAD7070, 0x9E6767, 0xA26969, 0xB77777, 0xC48E8E, 0xD09F9F, 0xDBACAB, 0xDCB0B0, 0x745B5B, 0x201819,
+			0x0A0808, 0x040303, 0x030303, 0x140E0E, 0x352525, 0x7E5454, 0xBF7C7C, 0xD19697, 0xD8A6A6, 0xD9A8A8,
+			0xD7A1A1, 0x5B4545, 0x211919, 0x332626, 0x8F6B6C, 0xCC9899, 0xC69190, 0xC48E8F, 0xC89593, 0xD09F9F,
+			0xDAABAB, 0xDDB2B1, 0xD7ACAC, 0x685252, 0x1F1919, 0x0D0B0B, 0x181212, 0x372929, 0xAB8181, 0xCB9796,
+			0xC58E8F, 0xC38E8D, 0xC89495, 0xD0A0A0, 0xD8ABAB, 0xDDB0B0, 0xCDA3A4, 0x584444, 0x191313, 0x040404,
+			0x030303, 0x030303, 0x070606, 0x120E0E, 0x352A2A, 0x987A7B, 0xD7AAAA, 0xCF9B9C, 0xC58989, 0xB17373,
+			0x9E6666, 0xA16868, 0xB87777, 0xC89090, 0xD3A2A2, 0xDBADAF, 0x9B7B7B, 0x352A2A, 0x130F0F, 0x050505,
+			0x080606, 0x251918, 0x966161, 0xCB8585, 0xCB8787, 0xC07D7D, 0xA96D6D, 0x5B3C3C, 0x160F0F, 0x040303,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030202, 0x070505, 0x261919, 0x895958, 0xAC6F6F, 0xC27E7E, 0xC98383, 0xC68080, 0x794F4E, 0x1C1313,
+			0x070505, 0x100C0C, 0x332323, 0x7B5252, 0xC07D7D, 0xC99393, 0xD3A0A0, 0xD8A7A7, 0xD5A1A0, 0xCD9292,
+			0xAA7171, 0x714C4C, 0x2C1E1E, 0x0D0909, 0x030303, 0x030303, 0x040303, 0x150F0F, 0x3A2928, 0x8F5F5F,
+			0xCA8585, 0xCF9999, 0xD39FA0, 0xCE999A, 0xC58989, 0xA76C6C, 0x604141, 0x251A1A, 0x0B0808, 0x050404,
+			0x080707, 0x191414, 0x3C2F2F, 0x9D7D7D, 0xD6A9A9, 0xCE9A9B, 0xC48889, 0xB17373, 0x9E6666, 0xA16868,
+			0xB87777, 0xC7918F, 0xD2A1A1, 0xD9ACAD, 0x9F807F, 0x392D2D, 0x171212, 0x050505, 0x030303, 0x020202,
+			0x060505, 0x171011, 0x3C2A2A, 0x865959, 0xBF7C7C, 0xCE9796, 0xD7A4A4, 0xD9A8A7, 0xD8A3A3, 0x664E4D,
+			0x2F2324, 0x503B3A, 0xB08281, 0xCA9695, 0xC69393, 0xCB9896, 0xD19E9F, 0xD5A3A2, 0xD39E9F, 0xC58B8B,
+			0x3A2A29, 0x0A0707, 0x030303, 0x070505, 0x2B1D1D, 0x9A6363, 0xB87777, 0xB87978, 0xAD7171, 0x382625,
+			0x0B0807, 0x0B0808, 0x362323, 0xA76A6A, 0xC47E7E, 0xC37F7F, 0xB77676, 0xA46969, 0x593939, 0x191010,
+			0x040404, 0x070606, 0x1B1414, 0x765858, 0xC29494, 0xD3A4A4, 0xCC9898, 0xC08181, 0x885858, 0x543737,
+			0x372424, 0x2F1F1F, 0x322121, 0x523636, 0x7D5050, 0xAD6F6F, 0xC78E8E, 0xD29D9C, 0xD39E9E, 0x533D3D,
+			0x161010, 0x040303, 0x040303, 0x0E0A0A, 0x271A1A, 0x694444, 0xAA6D6D, 0xC58585, 0xCC9090, 0xCE9292,
+			0x553D3D, 0x4D3737, 0xAD7C7C, 0xBE8181, 0xA16767, 0x7F5151, 0x724949, 0x7C5050, 0x9D6464, 0xBC8182,
+			0xCC9998, 0xD5A3A3, 0xCA9D9E, 0x4B3A3B, 0x2B2020, 0x533D3D, 0xB48282, 0xBD7F7E, 0x9A6262, 0x7A4E4E,
+			0x724949, 0x7F5151, 0xA16767, 0xBD8585, 0xCE9899, 0xD39F9F, 0xC69293, 0x332525, 0x0E0A0A, 0x060404,
+			0x060506, 0x140F0F, 0x382B2B, 0xB9908F, 0xD1A0A0, 0xC38C8D, 0xA46969, 0x694545, 0x402A2A, 0x2F1F1F,
+			0x302020, 0x4C3131, 0x7E5151, 0xB77777, 0xCA9594, 0xD5A3A2, 0xB08887, 0x332727, 0x100C0C, 0x030303,
+			0x090606, 0x291B1B, 0xA16767, 0xC47E7E, 0xC4807F, 0xB97777, 0xA56A6A, 0x462D2D, 0x0F0A0A, 0x030202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x080505, 0x211516, 0x7C5050, 0xA96C6C, 0xBA7878, 0xC27D7D, 0xBF7B7B, 0x875656, 0x221616,
+			0x060505, 0x050404, 0x0F0B0B, 0x291B1B, 0x6A4444, 0x9B6363, 0xB67878, 0xC28585, 0xC07F7F, 0xA96C6C,
+			0x503534, 0x211616, 0x0D0909, 0x040404, 0x020202, 0x020202, 0x030202, 0x060505, 0x130E0D, 0x372424,
+			0x825454, 0xB37373, 0xB6797A, 0xA96C6C, 0x8B5858, 0x482F2F, 0x1E1515, 0x0A0808, 0x050404, 0x060505,
+			0x151010, 0x3E3030, 0xBB9191, 0xD09E9F, 0xC38C8C, 0xA46969, 0x6B4747, 0x442D2D, 0x342222, 0x372424,
+			0x513434, 0x805151, 0xB57777, 0xCA9493, 0xD3A3A3, 0xB38A89, 0x392B2B, 0x120E0E, 0x050505, 0x030303,
+			0x040404, 0x040404, 0x100B0B, 0x2F1F1F, 0x6F4848, 0xAA6D6D, 0xC48585, 0xCC9090, 0xCE9292, 0x634748,
+			0x644646, 0xBA8383, 0xBA7B7B, 0x9B6363, 0x895757, 0x8F5B5B, 0xA66B6B, 0xB47B7B, 0xBC7E7E, 0xB07272,
+			0x372424, 0x0B0808, 0x030202, 0x070505, 0x261919, 0x8B5958, 0xB37272, 0xB37373, 0xA46A6A, 0x342222,
+			0x090706, 0x0D0909, 0x3B2525, 0xAD6C6C, 0xBC7676, 0xBB7778, 0xB06F6F, 0x9F6464, 0x462C2C, 0x100B0B,
+			0x040303, 0x030202, 0x050404, 0x261A1A, 0xA36E6E, 0xBA8282, 0xB47C7D, 0xA46868, 0x714747, 0x2E1E1E,
+			0x140E0E, 0x0D0909, 0x070505, 0x0C0808, 0x181010, 0x392424, 0x794B4B, 0xA86969, 0xC18584, 0xC88B8B,
+			0x9A6969, 0x251919, 0x060505, 0x050404, 0x0F0A0A, 0x402929, 0x945D5D, 0xB16F6F, 0xC07E7E, 0xC38384,
+			0x624242, 0xA97271, 0xAF6E6E, 0x714646, 0x3A2525, 0x261919, 0x251818, 0x402929, 0x5E3B3B, 0x885555,
+			0xB37474, 0xC78E8F, 0xCE9A9B, 0x977171, 0x634848, 0xB88181, 0xB16F6F, 0x694343, 0x342222, 0x241817,
+			0x251818, 0x442B2B, 0x643E3E, 0x8C5858, 0xB57777, 0xC58989, 0xC68A8A, 0x7D5555, 0x1A1212, 0x060505,
+			0x030303, 0x0C0909, 0x302324, 0xAC8080, 0xCA9696, 0xBC8382, 0x945D5D, 0x503333, 0x201616, 0x100B0B,
+			0x090606, 0x0B0808, 0x140E0E, 0x342222, 0x794C4C, 0xAF6F6F, 0xC48D8D, 0xCC9696, 0x906868, 0x251B1B,
+			0x060505, 0x030202, 0x070505, 0x2E1E1E, 0xAA6A6A, 0xBC7676, 0xBE7979, 0xB2706F, 0xA16565, 0x322020,
+			0x090606, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x080505, 0x1D1313, 0x744848, 0xA56868, 0xB47272, 0xBB7677, 0xB77373,
+			0x8F5A5A, 0x271919, 0x070505, 0x050404, 0x050404, 0x100B0B, 0x2D1D1D, 0x794C4C, 0x915B5B, 0xAA6B6B,
+			0xAD6C6C, 0x975E5E, 0x342122, 0x0D0909, 0x050404, 0x020202, 0x020202, 0x020202, 0x020202, 0x050303,
+			0x090606, 0x1F1414, 0x6D4444, 0x9F6363, 0x9A6161, 0x815151, 0x5A3838, 0x1C1212, 0x080606, 0x040303,
+			0x030303, 0x0F0B0B, 0x382A2A, 0xAE8281, 0xC99594, 0xBC8282, 0x945D5D, 0x543636, 0x251818, 0x110B0B,
+			0x0B0707, 0x0C0908, 0x191010, 0x382424, 0x7B4D4D, 0xAE6F6F, 0xC38C8B, 0xCC9695, 0x946B6B, 0x281D1D,
+			0x080606, 0x040303, 0x060404, 0x130D0D, 0x472D2D, 0x945D5D, 0xB16F6F, 0xBF7D7D, 0xC18182, 0x784F4F,
+			0xAD7272, 0xA16464, 0x603E3E, 0x392525, 0x342222, 0x503232, 0x684141, 0x825252, 0x955D5D, 0x925C5C,
+			0x2E1D1D, 0x0A0707, 0x060404, 0x271919, 0x855454, 0xAC6B6C, 0xAD6D6D, 0x9A6161, 0x30201F, 0x0A0707,
+			0x0F0A0A, 0x3E2726, 0xAC6969, 0xB36E6E, 0xB46F6F, 0xA96768, 0x9B5F5F, 0x362222, 0x0F0A0A, 0x030202,
+			0x050404, 0x241717, 0x804F4F, 0x885353, 0x764848, 0x653E3E, 0x2E1D1D, 0x0E0909, 0x060404, 0x030303,
+			0x020202, 0x020202, 0x080606, 0x1A1110, 0x5A3737, 0x905858, 0xB16F6F, 0xBA7878, 0xB47171, 0x2F1E1E,
+			0x090606, 0x040303, 0x080606, 0x2C1B1C, 0x995E5E, 0xAB6969, 0xB67372, 0xB47272, 0xA26566, 0x9A5E5E,
+			0x543434, 0x221515, 0x100A0B, 0x080606, 0x090606, 0x130D0C, 0x322020, 0x754848, 0x975D5D, 0xB67677,
+			0xC18585, 0xB57E7F, 0xAD7373, 0xA66565, 0x513333, 0x201515, 0x0E0909, 0x080606, 0x0A0707, 0x140D0D,
+			0x382323, 0x774949, 0x9B5F5F, 0xB57474, 0xBB7878, 0x9A6161, 0x251818, 0x060505, 0x030303, 0x060505,
+			0x201717, 0x886161, 0xC58D8D, 0xBA7F80, 0x9B5F5F, 0x5F3C3C, 0x1F1414, 0x0B0707, 0x040303, 0x030202,
+			0x020202, 0x060404, 0x150D0D, 0x4A2E2E, 0x8D5656, 0xB27373, 0xC08484, 0xBC8282, 0x432E2F, 0x100C0C,
+			0x030303, 0x040303, 0x080606, 0x311F1F, 0xAB6969, 0xB36D6D, 0xB57070, 0xAA6869, 0x9C6060, 0x2D1C1D,
+			0x080606, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x050404, 0x1C1212, 0x6A4141, 0xA16262, 0xAE6B6B, 0xB46E6F, 0xAF6B6B,
+			0x8F5858, 0x281919, 0x070505, 0x040303, 0x030303, 0x060505, 0x1B1211, 0x5C3939, 0x885353, 0x9F6262,
+			0xAA6969, 0xAA6869, 0x362222, 0x0C0808, 0x050404, 0x020202, 0x020202, 0x020202, 0x020202, 0x030202,
+			0x070505, 0x231516, 0x7A4B4B, 0xA16263, 0x925959, 0x784949, 0x301E1E, 0x0C0808, 0x040303, 0x030303,
+			0x080606, 0x251B1B, 0x8F6666, 0xC58B8B, 0xB97F7E, 0x9B5F5F, 0x633D3D, 0x221616, 0x0C0808, 0x050404,
+			0x020202, 0x040404, 0x080505, 0x191010, 0x4E3030, 0x8D5656, 0xB17372, 0xC18383, 0xBD8181, 0x493232,
+			0x150E0E, 0x040303, 0x030303, 0x0D0909, 0x342020, 0x995E5E, 0xAB6969, 0xB37171, 0xB16F70, 0xA16463,
+			0x915959, 0x4E3031, 0x211616, 0x0F0A0A, 0x100B0B, 0x1F1414, 0x4D2F2F, 0x5F3A3A, 0x6E4343, 0x764848,
+			0x251717, 0x070505, 0x070505, 0x211515, 0x7B4C4C, 0xA66566, 0xA76766, 0x905959, 0x2C1B1C, 0x0A0707,
+			0x100A0A, 0x472B2B, 0xA26161, 0xAB6666, 0xAC6767, 0xA26161, 0x8F5656, 0x321F1F, 0x090606, 0x030202,
+			0x050404, 0x160E0E, 0x5A3737, 0x583434, 0x583434, 0x422727, 0x130D0D, 0x070505, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x100A0A, 0x432928, 0x8D5454, 0xA66464, 0xB06B6B, 0xAA6666, 0x3B2424,
+			0x0E0909, 0x040303, 0x080505, 0x291A19, 0x995B5B, 0xA56363, 0xA96565, 0x9E5E5E, 0x895252, 0x4F3031,
+			0x1A1110, 0x0A0707, 0x050404, 0x020202, 0x040303, 0x060404, 0x1B1111, 0x613A3A, 0x8B5353, 0xA56464,
+			0xAE6C6D, 0xA86565, 0x925757, 0x513232, 0x1B1111, 0x090606, 0x040303, 0x020202, 0x030303, 0x070505,
+			0x1E1212, 0x663D3D, 0x905656, 0xA96666, 0xAF6A6A, 0x9F6060, 0x2A1A1A, 0x080606, 0x030303, 0x0F0B0B,
+			0x412C2C, 0xB67D7E, 0xBB7D7D, 0xAA6767, 0x814D4D, 0x301D1D, 0x0D0808, 0x050303, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x090606, 0x281818, 0x7F4C4C, 0xA06060, 0xB37473, 0xB77777, 0x805252, 0x1D1313,
+			0x050303, 0x0C0808, 0x331F1F, 0xA26161, 0xAA6666, 0xAD6969, 0xA46262, 0x955959, 0x2C1B1B, 0x090606,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030202, 0x040404, 0x180F0F, 0x603A3A, 0x9B5D5D, 0xA86464, 0xAC6767, 0xA66363, 0x8D5454,
+			0x29191A, 0x080505, 0x050404, 0x0F0A0A, 0x412728, 0x7F4C4C, 0x975A5B, 0xA86666, 0xAE6969, 0x5D3939,
+			0x150E0E, 0x050404, 0x020202, 0x020202, 0x020202, 0x020202, 0x030202, 0x090606, 0x2C1B1B, 0x915757,
+			0x9F6060, 0x8A5252, 0x5A3535, 0x1B1111, 0x060505, 0x030303, 0x060404, 0x130D0D, 0x483031, 0xB77D7D,
+			0xB97C7C, 0xA86767, 0x824D4D, 0x372121, 0x100B0B, 0x050404, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x0C0808, 0x2C1B1B, 0x7F4C4C, 0xA06060, 0xB47373, 0xB77677, 0x825454, 0x221616, 0x050404, 0x0B0808,
+			0x321F1E, 0x995B5B, 0xA46363, 0xA76465, 0x9C5D5D, 0x875151, 0x4E3030, 0x1E1313, 0x0A0707, 0x050404,
+			0x060405, 0x0C0808, 0x291818, 0x583434, 0x583434, 0x5D3737, 0x191010, 0x050404, 0x070505, 0x1E1313,
+			0x734545, 0xA16060, 0xA16060, 0x875151, 0x281918, 0x080505, 0x140C0C, 0x4D2D2D, 0x9A5A5A, 0xA25F5F,
+			0xA56060, 0x9F5C5C, 0x8E5353, 0x301D1D, 0x090606, 0x030202, 0x030303, 0x030303, 0x030303, 0x030303,
+			0x030202, 0x040303, 0x0B0707, 0x140D0D, 0x191010, 0x180F0F, 0x110A0B, 0x080505, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x0C0808, 0x35201F, 0x8E5353, 0xA15E5E, 0xA76162, 0x9F5D5D,
+			0x4B2C2C, 0x100A0A, 0x030202, 0x070505, 0x281818, 0x955757, 0x9F5D5D, 0x9C5B5B, 0x8A5050, 0x6A3F3F,
+			0x201313, 0x0A0707, 0x040303, 0x020202, 0x020202, 0x020202, 0x060404, 0x130C0C, 0x4F2F2F, 0x895050,
+			0x9B5A5A, 0x9D5B5B, 0x8C5252, 0x653A3A, 0x211414, 0x090606, 0x040303, 0x020202, 0x020202, 0x020202,
+			0x040303, 0x160E0E, 0x5B3636, 0x8D5252, 0xA05E5E, 0xA66160, 0x9F5C5C, 0x2A191A, 0x070505, 0x050404,
+			0x1C1212, 0x7C5050, 0xB37575, 0xAE6E6E, 0x975858, 0x6C3F3F, 0x1E1213, 0x050404, 0x030202, 0x020202,
+			0x020202, 0x020202, 0x030202, 0x080505, 0x1E1212, 0x6F4141, 0x935656, 0xA96767, 0xAE6B6B, 0x915757,
+			0x281919, 0x060505, 0x030202, 0x030202, 0x0D0808, 0x422727, 0x9A5A5A, 0xA35F5F, 0xA86262, 0x9F5D5C,
+			0x8D5252, 0x2A1919, 0x080505, 0x040303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040303, 0x170E0E, 0x573333, 0x975858, 0xA25E5F,
+			0xA56060, 0x9E5C5C, 0x854D4D, 0x271717, 0x080606, 0x090606, 0x241616, 0x6F4040, 0x8B5151, 0xA15F60,
+			0xAB6767, 0x855252, 0x251717, 0x050404, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x110B0B,
+			0x422828, 0xA36262, 0x9A5B5B, 0x7F4A4A, 0x382121, 0x0F0A09, 0x050303, 0x030303, 0x060405, 0x211515,
+			0x815253, 0xB37475, 0xAE6E6E, 0x975858, 0x6F4040, 0x231515, 0x080606, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030202, 0x070505, 0x231515, 0x714242, 0x935656, 0xA96667, 0xAE6B6B, 0x935858, 0x2B1A1A,
+			0x080606, 0x090707, 0x301D1D, 0x955757, 0x9E5D5D, 0x9D5B5B, 0x8A5050, 0x683C3C, 0x251616, 0x0B0707,
+			0x030303, 0x030202, 0x040303, 0x070404, 0x0D0909, 0x180F0F, 0x1C1111, 0x180F0F, 0x0C0808, 0x040303,
+			0x070505, 0x1F1213, 0x6E4141, 0x9C5B5B, 0x9D5B5B, 0x7A4847, 0x251616, 0x070505, 0x120B0B, 0x4A2A2A,
+			0x915252, 0x9B5757, 0x9F5A5A, 0x9A5757, 0x8B4E4E, 0x2E1A1B, 0x090606, 0x040303, 0x060505, 0x080606,
+			0x0B0808, 0x0B0909, 0x0C0A0A, 0x0A0909, 0x0B0909, 0x0C0A0A, 0x0A0808, 0x080606, 0x070505, 0x040303,
+			0x050404, 0x050404, 0x040304, 0x040303, 0x030303, 0x020202, 0x030303, 0x020202, 0x030303, 0x020202,
+			0x040404, 0x070505, 0x2C1A19, 0x945454, 0x9E5A5A, 0xA05B5B, 0x965454, 0x512E2E, 0x110B0B, 0x030202,
+			0x070404, 0x251515, 0x905151, 0x985656, 0x955554, 0x844B4B, 0x4E2C2C, 0x140C0C, 0x050404, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x040303, 0x100A0A, 0x412525, 0x884D4D, 0x945454, 0x935353, 0x834A4A,
+			0x4C2B2B, 0x130C0B, 0x050303, 0x020202, 0x020202, 0x020202, 0x020202, 0x040303, 0x130C0C, 0x512E2F,
+			0x8A4E4E, 0x995757, 0x9D5959, 0x955454, 0x2A1818, 0x090606, 0x040303, 0x080505, 0x271818, 0x975B5B,
+			0xAA6A69, 0xA66464, 0x935353, 0x633838, 0x1A0F0F, 0x060404, 0x020202, 0x040404, 0x020202, 0x020202,
+			0x030303, 0x060404, 0x1B1010, 0x673B3B, 0x945353, 0xA35F5F, 0xA56161, 0x9D5959, 0x2E1B1B, 0x0A0707,
+			0x030202, 0x040303, 0x0D0808, 0x402424, 0x905252, 0x9A5858, 0xA15B5B, 0x9B5757, 0x8A4F4F, 0x291818,
+			0x080505, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x040303, 0x150D0D, 0x532F2F, 0x935353, 0x9B5858, 0x9D5959, 0x945454,
+			0x7D4747, 0x231515, 0x060404, 0x030202, 0x030202, 0x050404, 0x170E0E, 0x553030, 0x7D4646, 0x955756,
+			0xA36362, 0x9E6060, 0x342020, 0x0D0808, 0x030202, 0x020202, 0x020202, 0x030202, 0x080505, 0x1E1313,
+			0x734646, 0xA05F5F, 0x8F5151, 0x613737, 0x1E1212, 0x080606, 0x030303, 0x020202, 0x0A0606, 0x2E1C1C,
+			0x995C5C, 0xAA6969, 0xA66465, 0x935353, 0x663A3A, 0x1C1010, 0x070505, 0x020202, 0x030303, 0x040404,
+			0x030303, 0x020202, 0x080606, 0x1D1111, 0x6A3C3C, 0x945353, 0xA25E5E, 0xA56160, 0x9D5959, 0x321D1D,
+			0x0B0707, 0x040303, 0x080505, 0x2D1A1A, 0x905151, 0x995656, 0x965455, 0x864B4B, 0x553030, 0x190E0E,
+			0x060404, 0x030303, 0x030202, 0x040303, 0x050404, 0x060404, 0x040303, 0x030303, 0x050404, 0x1D1111,
+			0x653939, 0x965554, 0x975555, 0x754242, 0x231414, 0x080506, 0x0F0909, 0x442626, 0x884A4A, 0x935050,
+			0x985354, 0x955152, 0x874949, 0x2F1A1A, 0x080505, 0x060404, 0x150D0D, 0x2B1C1C, 0x362525, 0x3A2C2C,
+			0x3D3030, 0x3F3333, 0x3D3131, 0x392D2D, 0x392B2A, 0x312222, 0x221716, 0x100A0A, 0x030202, 0x030303,
+			0x040404, 0x060505, 0x080606, 0x060505, 0x070505, 0x0D0909, 0x301C1D, 0x9F5A5A, 0x9E5A5A, 0x9A5555,
+			0x8D4D4D, 0x4D2A2A, 0x100A0A, 0x030303, 0x060404, 0x261615, 0x8A4B4B, 0x935050, 0x924F50, 0x854949,
+			0x472827, 0x110A0A, 0x040303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0A0606, 0x371E1F,
+			0x854949, 0x904F4E, 0x904E4E, 0x834747, 0x381F1F, 0x0D0808, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030202, 0x110A0A, 0x482828, 0x864949, 0x935151, 0x965252, 0x8D4D4D, 0x321C1C, 0x090606,
+			0x030202, 0x040303, 0x0C0707, 0x371F1F, 0x9D5656, 0xA25F5F, 0xA16060, 0x9B5555, 0x583333, 0x190F10,
+			0x090707, 0x090707, 0x090707, 0x090707, 0x070505, 0x080606, 0x090606, 0x1C1111, 0x673D3C, 0x995556,
+			0x9C5858, 0x9A5756, 0x955252, 0x3F2424, 0x0E0808, 0x030303, 0x030303, 0x0B0707, 0x3A2020, 0x874A4A,
+			0x925050, 0x995353, 0x965251, 0x8F4E4E, 0x2A1818, 0x070505, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030202, 0x050404, 0x140B0B,
+			0x522E2D, 0x8F4E4E, 0x975252, 0x955252, 0x8B4C4C, 0x713E3E, 0x211312, 0x060404, 0x0B0707, 0x301B1B,
+			0x723E3E, 0x8A4B4B, 0x9B595A, 0xA1605F, 0x5C3737, 0x170E0E, 0x050303, 0x020202, 0x030202, 0x050404,
+			0x0B0707, 0x2F1D1D, 0x945959, 0x975656, 0x7D4444, 0x3D2222, 0x100A09, 0x040303, 0x050404, 0x0F0909,
+			0x3D2222, 0x9D5656, 0xA25F5F, 0xA05F5F, 0x9B5555, 0x5E3636, 0x1C1212, 0x0B0808, 0x0B0908, 0x0A0808,
+			0x090707, 0x090707, 0x090707, 0x0C0808, 0x201313, 0x6C3D3E, 0x995555, 0x9A5657, 0x9A5657, 0x955251,
+			0x442525, 0x100909, 0x050303, 0x040303, 0x090606, 0x2C1919, 0x8A4B4B, 0x925050, 0x935050, 0x874949,
+			0x4E2B2B, 0x150C0C, 0x050303, 0x030202, 0x040303, 0x1B0F0F, 0x603434, 0x904F4E, 0x914E4E, 0x663939,
+			0x1E1111, 0x060404, 0x0C0707, 0x381E1E, 0x804444, 0x8A4949, 0x914D4D, 0x914C4C, 0x8A4949, 0x301A1A,
+			0x0B0707, 0x030202, 0x0A0707, 0x351F1F, 0xA16262, 0xA97071, 0xB48383, 0xBD9392, 0xC49B9A, 0xC49B9B,
+			0xBD9393, 0xB38181, 0xA87070, 0x844F4F, 0x170F0F, 0x040303, 0x030303, 0x060505, 0x090707, 0x100C0C,
+			0x1A1414, 0x1F1717, 0x241B1B, 0x2B1F1F, 0x2F1F1F, 0x442A2A, 0xA0605F, 0x9D5A5A, 0x954F4F, 0x874747,
+			0x492727, 0x10090A, 0x050404, 0x050404, 0x241414, 0x844646, 0x8F4A4B, 0x8E4B4B, 0x854646, 0x472525,
+			0x110A0A, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x090606, 0x2E1919, 0x814444,
+			0x8C4A4A, 0x8C4B4A, 0x834545, 0x361D1D, 0x0C0707, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x0D0808, 0x391E1E, 0x834545, 0x8E4B4C, 0x8F4C4C, 0x874747, 0x381E1E, 0x0E0808, 0x040303,
+			0x030202, 0x120A0A, 0x4F2A2A, 0x924D4D, 0x995655, 0x9C5A59, 0x9D5B5B, 0x563434, 0x352222, 0x2F2020,
+			0x312222, 0x2E2121, 0x302222, 0x2E2121, 0x2D2020, 0x2E1F1F, 0x362121, 0x603738, 0x8D4D4C, 0x864849,
+			0x824646, 0x814444, 0x482626, 0x0F0909, 0x040303, 0x090606, 0x281616, 0x7E4343, 0x894848, 0x924D4D,
+			0x914C4C, 0x8A4949, 0x2C1818, 0x0A0606, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030202, 0x050303, 0x160C0C, 0x562E2E, 0x8B4949,
+			0x914D4C, 0x8E4B4B, 0x834545, 0x673636, 0x1D1010, 0x060404, 0x030202, 0x070505, 0x1E1010, 0x613333,
+			0x7B4141, 0x91514F, 0x9B5A59, 0x7A4646, 0x231415, 0x070505, 0x020202, 0x020202, 0x040303, 0x160E0D,
+			0x533131, 0x985757, 0x8B4A4A, 0x633535, 0x221212, 0x080505, 0x030303, 0x050303, 0x150C0C, 0x542C2C,
+			0x924D4D, 0x995555, 0x9C5959, 0x9B5A5A, 0x5D3737, 0x3A2525, 0x352424, 0x342525, 0x342526, 0x352526,
+			0x352526, 0x342424, 0x342322, 0x3B2424, 0x653A3A, 0x8C4C4C, 0x854747, 0x824546, 0x814444, 0x4C2828,
+			0x120A0A, 0x040303, 0x0A0606, 0x2B1717, 0x844646, 0x8E4B4A, 0x8E4B4B, 0x864646, 0x4E2A2A, 0x140B0B,
+			0x050303, 0x050303, 0x170D0D, 0x562D2D, 0x894847, 0x894848, 0x623434, 0x1A0F0F, 0x060404, 0x0A0606,
+			0x2B1717, 0x773C3C, 0x814141, 0x894646, 0x8B4646, 0x864343, 0x381D1D, 0x0D0707, 0x030303, 0x030303,
+			0x080505, 0x1A1010, 0x452727, 0x713C3B, 0x934E4E, 0xA46D6D, 0xAE7B7C, 0xAF7C7A, 0xA46E6D, 0x934F4F,
+			0x6C3A3A, 0x321D1D, 0x110B0B, 0x030303, 0x040303, 0x050505, 0x080707, 0x120E0E, 0x221B1B, 0x2E2222,
+			0x423030, 0x785757, 0x775353, 0x7D5556, 0xA16E6D, 0x9B6464, 0x935656, 0x925151, 0x904E4E, 0x8B4747,
+			0x814141, 0x452323, 0x100909, 0x030303, 0x030202, 0x060404, 0x241313, 0x7E4040, 0x884444, 0x8A4645,
+			0x804141, 0x452323, 0x100909, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060404,
+			0x221212, 0x7C3F3F, 0x874444, 0x884545, 0x7F4040, 0x351B1B, 0x0C0707, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x0B0606, 0x351B1B, 0x7E4040, 0x894545, 0x894545, 0x804141, 0x361C1C,
+			0x0B0707, 0x040303, 0x040303, 0x160C0C, 0x582D2D, 0x884545, 0x8F4A4A, 0x914D4D, 0x8E4C4C, 0x905151,
+			0x955C5D, 0x986665, 0x9C696A, 0x9B6B6A, 0x9B6C6B, 0x9C6A6A, 0x9B6868, 0x956061, 0x8A5051, 0x794040,
+			0x6B3636, 0x5D2F2F, 0x5B2E2E, 0x623131, 0x3C1F1F, 0x0F0809, 0x030202, 0x070405, 0x221212, 0x733A3A,
+			0x7F4040, 0x894646, 0x8A4546, 0x854343, 0x3B1E1E, 0x0D0808, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040303, 0x190D0E,
+			0x5C2F2F, 0x884444, 0x8B4646, 0x874444, 0x7A3E3E, 0x572C2C, 0x180D0C, 0x060404, 0x040303, 0x130B0B,
+			0x482424, 0x6D3737, 0x854444, 0x925050, 0x925050, 0x2F1A1B, 0x0A0606, 0x020202, 0x040202, 0x0B0606,
+			0x231515, 0x7A4646, 0x8E4C4C, 0x783C3C, 0x452424, 0x130A0A, 0x050303, 0x050303, 0x180D0C, 0x5C2E2E,
+			0x884545, 0x8F4A4A, 0x914D4D, 0x8E4C4C, 0x8E5051, 0x935A5A, 0x996465, 0x996768, 0x9A6868, 0x9B696A,
+			0x9A6969, 0x986666, 0x936060, 0x885050, 0x783F3F, 0x6A3637, 0x5D2F2F, 0x5B2E2E, 0x623131, 0x3F2121,
+			0x110909, 0x040303, 0x030303, 0x090606, 0x2A1616, 0x7E4040, 0x874444, 0x8A4645, 0x804141, 0x4B2727,
+			0x130A0A, 0x050404, 0x050303, 0x130A0A, 0x482525, 0x783C3C, 0x773D3D, 0x532B2B, 0x170D0D, 0x050404,
+			0x080505, 0x261313, 0x6A3333, 0x773939, 0x823E3E, 0x854040, 0x823E3E, 0x411F1F, 0x100808, 0x040303,
+			0x030202, 0x040303, 0x070505, 0x140B0B, 0x2C1717, 0x602E2E, 0x7C3B3B, 0x8E4B4B, 0x8E4D4D, 0x7E3C3C,
+			0x612F2F, 0x291515, 0x100909, 0x070505, 0x030303, 0x090707, 0x130F0F, 0x2A2020, 0x4D3A3A, 0x7D5C5C,
+			0xA77677, 0x9B6667, 0x915657, 0x864040, 0x783939, 0x6D3434, 0x693232, 0x6C3333, 0x753838, 0x803E3E,
+			0x813E3E, 0x7B3B3B, 0x432020, 0x110909, 0x040303, 0x060404, 0x231211, 0x783939, 0x823E3E, 0x843F3F,
+			0x7B3B3B, 0x412020, 0x100809, 0x040303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060404,
+			0x211110, 0x773939, 0x823E3E, 0x833E3E, 0x793A3A, 0x331919, 0x0C0707, 0x040303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x0A0606, 0x331919, 0x793A3A, 0x833E3E, 0x833E3E, 0x7A3A3A, 0x341919,
+			0x0C0707, 0x040303, 0x170C0C, 0x582A2A, 0x7F3D3D, 0x844040, 0x803E3E, 0x733737, 0x693232, 0x632F2F,
+			0x5F2E2E, 0x5F2D2D, 0x5F2E2E, 0x5F2E2E, 0x5F2E2E, 0x5E2D2D, 0x5B2C2C, 0x532828, 0x462121, 0x442020,
+			0x442020, 0x442020, 0x452121, 0x371B1B, 0x0C0707, 0x030303, 0x080505, 0x1F1010, 0x663131, 0x763838,
+			0x823E3E, 0x853F3F, 0x823E3E, 0x442121, 0x0F0808, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060404, 0x1B0E0E, 0x5E2D2D,
+			0x833F3F, 0x854040, 0x7E3C3C, 0x713636, 0x4A2424, 0x140B0B, 0x050303, 0x030303, 0x0B0607, 0x291414,
+			0x632F2F, 0x773939, 0x884646, 0x8E4B4B, 0x532C2C, 0x140C0B, 0x050303, 0x050303, 0x100A09, 0x3A2020,
+			0x8A4A4A, 0x803F3F, 0x632F2F, 0x221111, 0x0A0606, 0x050404, 0x180C0C, 0x5B2C2C, 0x7F3D3D, 0x84403F,
+			0x803E3E, 0x733737, 0x693232, 0x632F2F, 0x5F2E2E, 0x5F2D2D, 0x5F2E2E, 0x5F2E2E, 0x5F2E2E, 0x5E2D2D,
+			0x5B2C2C, 0x532828, 0x462121, 0x442020, 0x442020, 0x442020, 0x452121, 0x381C1C, 0x0E0808, 0x030303,
+			0x030303, 0x070404, 0x271313, 0x783939, 0x823E3E, 0x843F3F, 0x7B3B3B, 0x482223, 0x130A0A, 0x040303,
+			0x040303, 0x0E0808, 0x3A1D1D, 0x5F2E2E, 0x5F2D2D, 0x412020, 0x120A0A, 0x040303, 0x070404, 0x1F0F0F,
+			0x5D2A2A, 0x6D3131, 0x7A3737, 0x7F3A3A, 0x7E3939, 0x522625, 0x150A0A, 0x050303, 0x030303, 0x060404,
+			0x170C0C, 0x472120, 0x672E2E, 0x753535, 0x773535, 0x6A3030, 0x4A2121, 0x170B0B, 0x060404, 0x040303,
+			0x030303, 0x090707, 0x1C1515, 0x4C3737, 0x946D6D, 0xA57676, 0x935E5E, 0x7C3838, 0x622C2C, 0x472222,
+			0x3C1D1D, 0x2F1717, 0x221111, 0x211010, 0x2E1716, 0x602B2B, 0x733434, 0x7A3636, 0x743434, 0x401D1D,
+			0x100808, 0x030202, 0x030202, 0x060404, 0x200F0F, 0x723333, 0x7C3838, 0x7D3838, 0x743434, 0x3F1D1D,
+			0x0F0707, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060303, 0x210F0F, 0x723333,
+			0x7B3737, 0x7C3838, 0x733434, 0x311717, 0x0B0606, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030202, 0x0C0606, 0x311717, 0x733434, 0x7C3838, 0x7C3838, 0x733434, 0x321717, 0x0B0606, 0x030202,
+			0x050303, 0x150A0A, 0x522525, 0x753535, 0x7A3737, 0x743535, 0x622C2C, 0x2E1616, 0x1F1010, 0x1D0F0F,
+			0x1D0F0F, 0x1B0E0E, 0x1D0F0F, 0x1D0E0E, 0x1C0E0E, 0x1B0E0E, 0x180D0C, 0x170C0C, 0x150B0B, 0x150B0B,
+			0x150B0B, 0x140A0A, 0x0D0707, 0x060404, 0x030202, 0x050404, 0x180C0C, 0x582727, 0x6D3131, 0x793736,
+			0x803A3A, 0x7E3939, 0x502424, 0x160B0B, 0x050303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060404, 0x1E0F0F, 0x652D2D, 0x7E3939,
+			0x7D3939, 0x733434, 0x662E2E, 0x361919, 0x0E0707, 0x040303, 0x050303, 0x190C0C, 0x4F2323, 0x682F2F,
+			0x7D3A3A, 0x874445, 0x6B3636, 0x201111, 0x060404, 0x060404, 0x1B100F, 0x643635, 0x824141, 0x703232,
+			0x482020, 0x150A0A, 0x060404, 0x060303, 0x170B0B, 0x542626, 0x753535, 0x7B3737, 0x743535, 0x622C2C,
+			0x331818, 0x231212, 0x201010, 0x1F100F, 0x201010, 0x1F1010, 0x201010, 0x1F1010, 0x1E0F0F, 0x1B0E0D,
+			0x190C0D, 0x170C0C, 0x170B0C, 0x170C0C, 0x150B0B, 0x0F0808, 0x070404, 0x030303, 0x080505, 0x261212,
+			0x723333, 0x7C3738, 0x7C3838, 0x743434, 0x441F1F, 0x120909, 0x040303, 0x030202, 0x090505, 0x251111,
+			0x492121, 0x482121, 0x2E1615, 0x0D0707, 0x030202, 0x050404, 0x190B0B, 0x4D2121, 0x652B2B, 0x723131,
+			0x7B3636, 0x7C3636, 0x5D2828, 0x1B0D0D, 0x060404, 0x030202, 0x050303, 0x100808, 0x3C1A1A, 0x692D2D,
+			0x723130, 0x733131, 0x6C2D2E, 0x471F1F, 0x130909, 0x040303, 0x030303, 0x050404, 0x171010, 0x533939,
+			0xA17170, 0x9D6968, 0x864848, 0x612A2A, 0x3C1C1C, 0x20100F, 0x150A0A, 0x0F0808, 0x0B0606, 0x090606,
+			0x090505, 0x1E0E0E, 0x602929, 0x703030, 0x763232, 0x703030, 0x3D1B1B, 0x0E0707, 0x040303, 0x050404,
+			0x1F0E0E, 0x6D2F2F, 0x763232, 0x783333, 0x703030, 0x3C1B1B, 0x0E0707, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x060404, 0x1E0E0E, 0x6D2F2F, 0x763232, 0x773332, 0x6E2F2F, 0x2E1515,
+			0x0A0505, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0C0606, 0x2F1515, 0x6E2F2F,
+			0x773333, 0x763333, 0x6E2F2F, 0x311515, 0x0B0606, 0x030202, 0x040303, 0x130909, 0x4C2121, 0x6D2F2F,
+			0x753232, 0x723030, 0x652B2B, 0x210F0F, 0x0B0606, 0x060404, 0x070404, 0x050303, 0x040303, 0x050303,
+			0x050303, 0x060303, 0x050303, 0x060404, 0x050303, 0x040303, 0x040303, 0x040303, 0x030303, 0x030202,
+			0x040303, 0x130909, 0x461E1E, 0x642B2B, 0x723030, 0x7A3635, 0x7C3736, 0x5F2929, 0x1B0C0D, 0x060303,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030202, 0x070404, 0x220F10, 0x6F3030, 0x7A3635, 0x763333, 0x692D2D, 0x5B2727, 0x1F0E0E, 0x090505,
+			0x040202, 0x100808, 0x391919, 0x5D2828, 0x723232, 0x7F3D3D, 0x7F3E3E, 0x2B1616, 0x0E0808, 0x0E0808,
+			0x2A1616, 0x7B3E3D, 0x773535, 0x5F2828, 0x271212, 0x0B0606, 0x040303, 0x030202, 0x040303, 0x150A0A,
+			0x4F2222, 0x6D2F2F, 0x733132, 0x713030, 0x652B2B, 0x261010, 0x0D0606, 0x070404, 0x070404, 0x060404,
+			0x070404, 0x060404, 0x070404, 0x050403, 0x070404, 0x060404, 0x050404, 0x050404, 0x050303, 0x050303,
+			0x040303, 0x040303, 0x070404, 0x241010, 0x6D2F2F, 0x753232, 0x773333, 0x703030, 0x411D1D, 0x120809,
+			0x060303, 0x050303, 0x0C0606, 0x150B0B, 0x160B0B, 0x0E0708, 0x060404, 0x030202, 0x050303, 0x130808,
+			0x3C1818, 0x5C2424, 0x692929, 0x753030, 0x783333, 0x662A2A, 0x210F0F, 0x080404, 0x040303, 0x0F0707,
+			0x3B1818, 0x672828, 0x6E2B2B, 0x702C2C, 0x692929, 0x471C1C, 0x130909, 0x040303, 0x040303, 0x0D0808,
+			0x352020, 0x8C5959, 0x925C5B, 0x7F3F3F, 0x5A2424, 0x2F1414, 0x130909, 0x090505, 0x050303, 0x040303,
+			0x030303, 0x030303, 0x060404, 0x1C0C0C, 0x652828, 0x6E2B2B, 0x712C2C, 0x6A2929, 0x391717, 0x0D0606,
+			0x030303, 0x060303, 0x1E0D0D, 0x672929, 0x6F2C2C, 0x712C2C, 0x6A2929, 0x391717, 0x0E0607, 0x030303,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040303, 0x1D0C0C, 0x672929, 0x702C2C, 0x712C2C,
+			0x682929, 0x2D1313, 0x0A0505, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x030202, 0x090505,
+			0x2E1313, 0x682929, 0x702C2C, 0x702C2C, 0x682929, 0x2E1313, 0x0A0505, 0x030202, 0x100707, 0x401A1A,
+			0x632727, 0x6E2B2B, 0x712C2C, 0x6C2B2B, 0x2F1313, 0x0B0505, 0x030303, 0x030202, 0x0D0606, 0x371516,
+			0x592323, 0x662828, 0x732F2F, 0x793535, 0x672B2B, 0x221010, 0x090505, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040303, 0x0A0505, 0x291212,
+			0x722E2E, 0x743031, 0x6B2B2B, 0x5B2424, 0x491D1D, 0x170A0A, 0x040303, 0x030202, 0x040202, 0x080404,
+			0x1E0C0D, 0x522020, 0x652828, 0x763434, 0x7D3B3B, 0x4C2726, 0x170D0D, 0x190E0E, 0x4C2727, 0x793939,
+			0x692929, 0x441B1B, 0x150A09, 0x060404, 0x030202, 0x030302, 0x130809, 0x431B1B, 0x632727, 0x6D2B2B,
+			0x702C2C, 0x6C2B2B, 0x331515, 0x0D0606, 0x040303, 0x030202, 0x030202, 0x070404, 0x230F0F, 0x672929,
+			0x6F2C2C, 0x702C2C, 0x6A2929, 0x3F1919, 0x100808, 0x040303, 0x030303, 0x050303, 0x050303, 0x050303,
+			0x030202, 0x020202, 0x030202, 0x0B0505, 0x260F0F, 0x521E1E, 0x5D2222, 0x6B2828, 0x753131, 0x743232,
+			0x2A1313, 0x0B0606, 0x040303, 0x040303, 0x0F0606, 0x391515, 0x642424, 0x6B2626, 0x6B2627, 0x652424,
+			0x441818, 0x110707, 0x040303, 0x050303, 0x170B0B, 0x5C302F, 0x854949, 0x7F4242, 0x632424, 0x3E1616,
+			0x150909, 0x070404, 0x040303, 0x020202, 0x020202, 0x020202, 0x020202, 0x060403, 0x1F0C0C, 0x682525,
+			0x6D2828, 0x6C2727, 0x642424, 0x371514, 0x0D0606, 0x030202, 0x060303, 0x1D0B0B, 0x622323, 0x6A2626,
+			0x6B2626, 0x642424, 0x361414, 0x0D0606, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030202,
+			0x060303, 0x1D0B0B, 0x622323, 0x6B2626, 0x6B2626, 0x632424, 0x2B1010, 0x0A0505, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x0A0505, 0x2B1010, 0x632424, 0x6B2626, 0x6A2626, 0x632424,
+			0x2B1111, 0x090505, 0x0B0505, 0x2D1111, 0x5A2020, 0x662525, 0x6F2A2A, 0x702929, 0x441A1A, 0x120808,
+			0x040303, 0x030202, 0x080404, 0x1B0B0B, 0x4D1C1C, 0x592020, 0x6A2727, 0x743232, 0x773434, 0x311717,
+			0x0E0707, 0x040303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x040303, 0x120909, 0x451D1D, 0x732F2F, 0x6D2A2A, 0x5F2323, 0x4F1D1D, 0x321313, 0x0E0707,
+			0x040202, 0x050303, 0x150808, 0x421818, 0x592020, 0x6C2828, 0x793939, 0x673536, 0x251515, 0x261515,
+			0x683535, 0x702F2F, 0x5A2020, 0x2A1010, 0x0B0605, 0x040303, 0x030202, 0x0D0606, 0x301212, 0x5A2020,
+			0x662525, 0x6E2A2A, 0x6F2929, 0x471B1B, 0x140909, 0x050303, 0x030202, 0x030202, 0x080404, 0x220D0D,
+			0x622323, 0x6A2626, 0x6B2626, 0x642424, 0x3C1616, 0x100707, 0x030303, 0x030202, 0x040303, 0x030303,
+			0x030202, 0x040303, 0x030202, 0x030202, 0x080303, 0x170808, 0x421616, 0x511B1B, 0x612020, 0x6E2C2D,
+			0x753535, 0x4F2525, 0x180C0C, 0x050303, 0x040303, 0x100606, 0x381313, 0x612020, 0x672222, 0x672222,
+			0x602020, 0x401616, 0x110707, 0x040202, 0x060303, 0x1D0C0C, 0x682626, 0x763534, 0x713030, 0x5D1F1F,
+			0x311111, 0x0D0606, 0x040303, 0x020202, 0x020202, 0x020202, 0x020202, 0x040202, 0x0C0606, 0x2B1010,
+			0x6B2424, 0x6E2929, 0x682323, 0x602020, 0x351212, 0x0C0505, 0x030303, 0x050303, 0x1B0A0A, 0x5E1F1F,
+			0x652121, 0x662121, 0x602020, 0x341212, 0x0C0505, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x060303, 0x1B0A0A, 0x5E1F1F, 0x652121, 0x662121, 0x5E1F1F, 0x290E0F, 0x0A0404, 0x040203,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030202, 0x090404, 0x290E0E, 0x5E1F1F, 0x662121, 0x652121,
+			0x5E1F1F, 0x2A0F0F, 0x090404, 0x030202, 0x080404, 0x1E0B0B, 0x511B1B, 0x5C1E1E, 0x692625, 0x712D2D,
+			0x582424, 0x190C0C, 0x060404, 0x040303, 0x030202, 0x050404, 0x040303, 0x030303, 0x050303, 0x110707,
+			0x391313, 0x4C1919, 0x5D1F1F, 0x6E2C2C, 0x763536, 0x552728, 0x170C0C, 0x060404, 0x030202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x070505, 0x1D0D0E, 0x5C2828,
+			0x6F2D2E, 0x642222, 0x511B1B, 0x431616, 0x180909, 0x080404, 0x040202, 0x0E0606, 0x2E1010, 0x501A1A,
+			0x632121, 0x753636, 0x7F4444, 0x372020, 0x3D2424, 0x7B3F3F, 0x652121, 0x451717, 0x170909, 0x060303,
+			0x030202, 0x080404, 0x210C0C, 0x511B1B, 0x5C1E1E, 0x692525, 0x6F2C2C, 0x5A2525, 0x1C0D0D, 0x070405,
+			0x030303, 0x040303, 0x040303, 0x050404, 0x050404, 0x070303, 0x200B0B, 0x5E1F1F, 0x652121, 0x652121,
+			0x602020, 0x391313, 0x0F0606, 0x040303, 0x040303, 0x050404, 0x090707, 0x0B0909, 0x0B0909, 0x0B0808,
+			0x070606, 0x040303, 0x030303, 0x0E0505, 0x2F0E0E, 0x441414, 0x521818, 0x632020, 0x723232, 0x6B3434,
+			0x261414, 0x0C0707, 0x030202, 0x030202, 0x100606, 0x391111, 0x5F1C1C, 0x641F1F, 0x621D1D, 0x5B1A1A,
+			0x3D1212, 0x100606, 0x040202, 0x030202, 0x060303, 0x1C0909, 0x5E1B1B, 0x652121, 0x692626, 0x5F1B1B,
+			0x2D0F0F, 0x0C0606, 0x040202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050303, 0x160A0A, 0x4B1F1F,
+			0x6B2827, 0x692525, 0x621D1D, 0x5A1A1A, 0x330F0F, 0x0D0505, 0x040303, 0x060303, 0x1B0909, 0x591A1A,
+			0x601C1C, 0x621C1C, 0x5A1A1A, 0x310F0F, 0x0D0505, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x050303, 0x190808, 0x591A1A, 0x611C1C, 0x601C1C, 0x591A1A, 0x270C0C, 0x090404, 0x030202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030202, 0x080404, 0x270C0C, 0x5A1A1A, 0x611C1C, 0x611C1C,
+			0x591A1A, 0x270C0C, 0x080404, 0x050303, 0x130707, 0x3F1313, 0x4F1717, 0x5F1C1C, 0x6F2E2E, 0x703535,
+			0x271515, 0x0C0708, 0x050404, 0x030303, 0x040404, 0x0A0808, 0x130E0E, 0x181111, 0x0F0B0A, 0x060404,
+			0x040202, 0x090404, 0x200A0A, 0x411313, 0x4D1616, 0x611C1C, 0x703131, 0x723839, 0x271515, 0x0D0807,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060404, 0x0E0808,
+			0x311818, 0x6F3131, 0x662727, 0x541919, 0x421313, 0x2D0E0E, 0x0E0505, 0x040202, 0x070303, 0x1A0909,
+			0x441414, 0x561919, 0x6E2E2E, 0x7F4544, 0x5D3838, 0x683A3B, 0x6F3231, 0x551919, 0x2E0E0E, 0x0D0505,
+			0x030202, 0x050303, 0x160707, 0x411313, 0x4F1717, 0x601C1C, 0x6C2D2E, 0x703535, 0x2C1717, 0x0F0909,
+			0x050404, 0x030202, 0x030202, 0x040404, 0x0B0908, 0x171010, 0x1C1414, 0x110C0C, 0x050404, 0x080303,
+			0x1E0A0A, 0x591A1A, 0x601C1C, 0x611C1C, 0x5A1A1A, 0x361010, 0x0F0606, 0x040303, 0x030202, 0x0A0707,
+			0x17100F, 0x2D1F20, 0x372A2A, 0x392C2C, 0x312424, 0x211717, 0x0D0909, 0x070303, 0x160707, 0x360E0E,
+			0x411010, 0x541515, 0x682829, 0x763A3A, 0x4D2A29, 0x1A100F, 0x0B0707, 0x030303, 0x060303, 0x140809,
+			0x401415, 0x621D1D, 0x631F1F, 0x5E1818, 0x561616, 0x3A0F0F, 0x0F0505, 0x050302, 0x030202, 0x050303,
+			0x190808, 0x511414, 0x591616, 0x642020, 0x672323, 0x441A1A, 0x130A0A, 0x050404, 0x040303, 0x030202,
+			0x030303, 0x070405, 0x0F0808, 0x2C1414, 0x642727, 0x611D1D, 0x5F1818, 0x5C1717, 0x571616, 0x300D0D,
+			0x0C0505, 0x030202, 0x060303, 0x1A0808, 0x561616, 0x5D1818, 0x5E1818, 0x571616, 0x300D0D, 0x0B0404,
+			0x040202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050303, 0x1A0808, 0x561616, 0x5D1818,
+			0x5D1818, 0x561616, 0x260B0A, 0x090404, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030202,
+			0x090404, 0x260A0A, 0x571616, 0x5D1818, 0x5D1818, 0x561616, 0x260B0B, 0x090303, 0x030202, 0x040303,
+			0x0C0504, 0x2C0C0C, 0x431111, 0x521515, 0x652726, 0x763B3A, 0x5E3636, 0x1F1414, 0x0C0808, 0x040303,
+			0x030303, 0x030303, 0x030303, 0x050404, 0x060505, 0x0C0909, 0x1F1616, 0x4B3534, 0x7B5152, 0x2A1717,
+			0x0C0606, 0x030202, 0x060303, 0x100605, 0x2F0D0C, 0x3E1010, 0x4F1414, 0x642525, 0x743738, 0x562F2E,
+			0x1B1010, 0x080505, 0x040303, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040303, 0x0C0707,
+			0x1F1111, 0x582A2A, 0x6A2B2B, 0x561616, 0x411010, 0x340D0D, 0x140607, 0x070303, 0x030202, 0x050303,
+			0x110606, 0x360E0E, 0x4B1313, 0x601919, 0x753839, 0x693939, 0x713737, 0x5D1717, 0x421112, 0x180707,
+			0x070403, 0x030202, 0x040303, 0x0E0505, 0x2D0C0C, 0x431111, 0x511515, 0x642626, 0x75393A, 0x623737,
+			0x241616, 0x0E0A0A, 0x060505, 0x040404, 0x030303, 0x030202, 0x040404, 0x060505, 0x0D0A0A, 0x231818,
+			0x503637, 0x7C5252, 0x2F1A1A, 0x0D0606, 0x040202, 0x030202, 0x070303, 0x1F0909, 0x561616, 0x5D1818,
+			0x5E1818, 0x571616, 0x350E0E, 0x0F0505, 0x040302, 0x040303, 0x100909, 0x462A2A, 0x946262, 0xA07476,
+			0xA37978, 0x976A6A, 0x6C4343, 0x180E0E, 0x030202, 0x0B0404, 0x1F0708, 0x340B0B, 0x3F0D0D, 0x541212,
+			0x6B2E2E, 0x743E3F, 0x382221, 0x180F0F, 0x090707, 0x060404, 0x040303, 0x030202, 0x030202, 0x050404,
+			0x0C0707, 0x1F0E0E, 0x562423, 0x632121, 0x5E1B1B, 0x581313, 0x521111, 0x360C0C, 0x0F0405, 0x040202,
+			0x040202, 0x140505, 0x420E0E, 0x4B1010, 0x591313, 0x692A2A, 0x663435, 0x2B1A1A, 0x150F0F, 0x0C0909,
+			0x090606, 0x0E0909, 0x180E0E, 0x2E1717, 0x5F2829, 0x581212, 0x4F1111, 0x521111, 0x561212, 0x561212,
+			0x310C0C, 0x0D0404, 0x030202, 0x080303, 0x200808, 0x561212, 0x5C1818, 0x5D1919, 0x561212, 0x300B0B,
+			0x0C0404, 0x030202, 0x020202, 0x020202, 0x020202, 0x030202, 0x040202, 0x070303, 0x210808, 0x561212,
+			0x5D1818, 0x5D1818, 0x561212, 0x280A0A, 0x0B0404, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030202, 0x0B0404, 0x290A0A, 0x561212, 0x5E1818, 0x5C1717, 0x551212, 0x270A0A, 0x0A0404, 0x030202,
+			0x070303, 0x160606, 0x350B0B, 0x3F0D0D, 0x531212, 0x6B3030, 0x7E4949, 0x533635, 0x261B1B, 0x161111,
+			0x0C0909, 0x090707, 0x080706, 0x120D0D, 0x1C1414, 0x2C1D1D, 0x5F3E3E, 0x834F4E, 0x733839, 0x4C1515,
+			0x0F0606, 0x040202, 0x030202, 0x080303, 0x160606, 0x300B0B, 0x3A0C0C, 0x4E1010, 0x652929, 0x733E3D,
+			0x3E2425, 0x190F0F, 0x0A0707, 0x060404, 0x020202, 0x030202, 0x040303, 0x050404, 0x0A0707, 0x1B1010,
+			0x442424, 0x6E3232, 0x571313, 0x400D0D, 0x310B0B, 0x1A0707, 0x090303, 0x030202, 0x030202, 0x0B0404,
+			0x250808, 0x430E0E, 0x521111, 0x622322, 0x672929, 0x5C1818, 0x4A1010, 0x2D0A0A, 0x0D0505, 0x050203,
+			0x030202, 0x080303, 0x180607, 0x350B0B, 0x3F0D0D, 0x531212, 0x6B2E30, 0x7E4848, 0x593838, 0x2B1E1E,
+			0x191212, 0x0F0B0B, 0x0A0808, 0x0C0909, 0x100C0C, 0x1F1616, 0x301F1F, 0x633E3E, 0x814D4D, 0x713939,
+			0x4D1616, 0x120707, 0x040202, 0x030202, 0x0A0404, 0x260A0A, 0x561212, 0x5C1818, 0x5C1919, 0x561212,
+			0x350C0C, 0x100505, 0x040303, 0x040303, 0x110808, 0x411B1B, 0x773D3D, 0x875555, 0x8B5859, 0x7E4747,
+			0x592726, 0x1B0C0D, 0x030202, 0x050303, 0x0E0403, 0x220606, 0x2D0707, 0x390909, 0x4F0D0D, 0x662D2D,
+			0x704041, 0x402728, 0x211514, 0x130C0C, 0x0A0606, 0x080505, 0x0B0707, 0x140C0C, 0x201111, 0x46201F,
+			0x5F2121, 0x530E0E, 0x4E0D0D, 0x4C0D0D, 0x4A0C0C, 0x320909, 0x0E0404, 0x030202, 0x030202, 0x0E0404,
+			0x2E0808, 0x3A0A0A, 0x480C0C, 0x5E1F20, 0x743E3E, 0x734B4A, 0x4C3434, 0x2D1F1F, 0x291B1B, 0x331F1F,
+			0x5B3333, 0x672E2F, 0x500D0D, 0x340A0A, 0x340A0A, 0x490C0C, 0x530E0E, 0x591515, 0x3D1010, 0x100505,
+			0x040202, 0x030202, 0x0C0404, 0x2F0C0C, 0x5A1515, 0x5A1817, 0x5C1817, 0x581414, 0x380E0E, 0x100505,
+			0x040202, 0x030202, 0x020202, 0x020202, 0x030202, 0x040202, 0x0C0404, 0x2F0C0C, 0x5A1516, 0x5D1919,
+			0x5C1818, 0x591514, 0x330D0D, 0x0E0505, 0x040202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040202,
+			0x0E0505, 0x380E0E, 0x5A1515, 0x5B1818, 0x5B1717, 0x581314, 0x2F0B0B, 0x0E0404, 0x040202, 0x030202,
+			0x040202, 0x0A0303, 0x1F0606, 0x300808, 0x3A0909, 0x4E0D0D, 0x6A3130, 0x814E4F, 0x765050, 0x573F3F,
+			0x302323, 0x2C2020, 0x2E1F20, 0x392828, 0x664444, 0x7A4A4B, 0x6C3636, 0x510D0D, 0x400B0B, 0x1F090A,
+			0x0B0404, 0x030202, 0x090303, 0x190505, 0x2A0707, 0x340909, 0x480C0C, 0x612827, 0x6E3B3C, 0x482A2B,
+			0x231616, 0x160F0F, 0x0B0707, 0x090606, 0x0D0808, 0x170F0F, 0x251616, 0x4A2929, 0x693231, 0x530E0E,
+			0x3C0A0A, 0x2C0707, 0x1B0505, 0x0A0303, 0x040202, 0x060303, 0x150505, 0x390909, 0x450B0B, 0x4F0D0D,
+			0x500D0D, 0x470C0C, 0x3A0A0A, 0x170505, 0x070303, 0x050303, 0x0C0404, 0x200707, 0x300808, 0x3A0909,
+			0x4E0D0D, 0x68302F, 0x7F4C4C, 0x775050, 0x5B4142, 0x372827, 0x322424, 0x322223, 0x3E2A2A, 0x674544,
+			0x7A4947, 0x6B3433, 0x510D0D, 0x400C0C, 0x220B0A, 0x0B0404, 0x040202, 0x040202, 0x0F0505, 0x330D0D,
+			0x5A1515, 0x5A1617, 0x5A1717, 0x591514, 0x3E1010, 0x130606, 0x050303, 0x040202, 0x0F0505, 0x340C0C,
+			0x540E0E, 0x652828, 0x682C2C, 0x581313, 0x440D0D, 0x170707, 0x030202, 0x060302, 0x0D0303, 0x1D0504,
+			0x280505, 0x300606, 0x430808, 0x5B2222, 0x703B3B, 0x5C3535, 0x3B2223, 0x271616, 0x251414, 0x271414,
+			0x452625, 0x562A2A, 0x561A1A, 0x450808, 0x390707, 0x360707, 0x3A0707, 0x3D0808, 0x2C0606, 0x0D0303,
+			0x030202, 0x030202, 0x080303, 0x170404, 0x2C0606, 0x320606, 0x400808, 0x551313, 0x6D3738, 0x7B4949,
+			0x815152, 0x7C4C4C, 0x6E3A39, 0x5A1717, 0x430808, 0x280707, 0x170505, 0x2C0606, 0x3F0808, 0x460909,
+			0x4E0B0B, 0x450F10, 0x180505, 0x090303, 0x040202, 0x030202, 0x070202, 0x140404, 0x3E0E0E, 0x4F0A0A,
+			0x4C0A0A, 0x4B0909, 0x4E0A0A, 0x450E0E, 0x170505, 0x090303, 0x040202, 0x020202, 0x020202, 0x030202,
+			0x070202, 0x150505, 0x3E0E0E, 0x500B0B, 0x4C0A0A, 0x4B0A0A, 0x4F0A0A, 0x3D0D0E, 0x160405, 0x070202,
+			0x030202, 0x020202, 0x020202, 0x030202, 0x080202, 0x170504, 0x400E0E, 0x4E0A0A, 0x4B0A0A, 0x4A0A0A,
+			0x4E0A0A, 0x3C0C0D, 0x150505, 0x080202, 0x040202, 0x050202, 0x0C0303, 0x1C0505, 0x280505, 0x300606,
+			0x410808, 0x5A1717, 0x6F3C3C, 0x805050, 0x875859, 0x88595A, 0x855555, 0x7A4A4A, 0x693434, 0x4F0A0A,
+			0x3C0707, 0x2D0606, 0x160505, 0x0A0303, 0x040303, 0x030202, 0x040202, 0x0A0303, 0x160404, 0x260505,
+			0x2C0505, 0x3D0808, 0x521010, 0x693334, 0x643939, 0x4B2D2D, 0x291717, 0x261515, 0x291516, 0x502E2E,
+			0x623535, 0x5F2727, 0x490909, 0x340606, 0x270505, 0x180404, 0x0A0303, 0x050202, 0x030202, 0x040202,
+			0x0E0303, 0x2A0606, 0x380707, 0x3C0808, 0x3B0707, 0x370707, 0x280606, 0x0D0303, 0x040202, 0x050202,
+			0x0D0303, 0x1D0505, 0x280505, 0x300606, 0x410808, 0x581717, 0x6E3B3A, 0x7E4E4E, 0x855656, 0x865757,
+			0x825153, 0x794747, 0x673333, 0x4F0A0A, 0x3C0707, 0x2E0606, 0x180505, 0x0B0304, 0x050303, 0x030202,
+			0x040202, 0x090202, 0x190505, 0x3F0D0D, 0x4D0A0A, 0x4B0A0A, 0x4C0A0A, 0x4E0A0A, 0x460F0F, 0x1C0606,
+			0x0D0404, 0x050202, 0x030202, 0x030202, 0x0D0303, 0x2A0606, 0x430808, 0x450909, 0x460909, 0x430808,
+			0x380707, 0x120303, 0x030202, 0x050202, 0x0B0203, 0x160303, 0x220303, 0x260303, 0x310404, 0x420505,
+			0x511212, 0x5D2928, 0x673233, 0x683333, 0x602A2B, 0x55191A, 0x440505, 0x330404, 0x250303, 0x1F0303,
+			0x250303, 0x260303, 0x2E0404, 0x240303, 0x0A0302, 0x030202, 0x040202, 0x090303, 0x180303, 0x250303,
+			0x260303, 0x2E0404, 0x390404, 0x410505, 0x440505, 0x400505, 0x380404, 0x2D0505, 0x1C0404, 0x0E0303,
+			0x0E0303, 0x260404, 0x2F0404, 0x320404, 0x3A0404, 0x410505, 0x390505, 0x1E0506, 0x0A0303, 0x030202,
+			0x060202, 0x110202, 0x320505, 0x420505, 0x3B0505, 0x320404, 0x320404, 0x390404, 0x410505, 0x350505,
+			0x180404, 0x090202, 0x030202, 0x020202, 0x060202, 0x110202, 0x320505, 0x410505, 0x3B0505, 0x330404,
+			0x320404, 0x3A0505, 0x410505, 0x350606, 0x140302, 0x060202, 0x030202, 0x020202, 0x070202, 0x120202,
+			0x340505, 0x400505, 0x3A0404, 0x320404, 0x320404, 0x3A0505, 0x400505, 0x320505, 0x120303, 0x070202,
+			0x030202, 0x030202, 0x040202, 0x0A0202, 0x170303, 0x240303, 0x260303, 0x2C0303, 0x380404, 0x420505,
+			0x480606, 0x490606, 0x460505, 0x3E0505, 0x330404, 0x290303, 0x1E0303, 0x0F0303, 0x070202, 0x030202,
+			0x040202, 0x080202, 0x0E0303, 0x1D0303, 0x260303, 0x2D0404, 0x3D0505, 0x4C0606, 0x5A2523, 0x633131,
+			0x653131, 0x602B2B, 0x551D1D, 0x460505, 0x360404, 0x290303, 0x1F0303, 0x0F0303, 0x080202, 0x040202,
+			0x030202, 0x080202, 0x190303, 0x2C0303, 0x290303, 0x280303, 0x2A0303, 0x150303, 0x070202, 0x030202,
+			0x060202, 0x0B0303, 0x180303, 0x240303, 0x260303, 0x2C0303, 0x380404, 0x420505, 0x480606, 0x490606,
+			0x460505, 0x3E0505, 0x330404, 0x290303, 0x1E0303, 0x100303, 0x080302, 0x040202, 0x080202, 0x140303,
+			0x330505, 0x3F0505, 0x3A0505, 0x320404, 0x320404, 0x390404, 0x400505, 0x3A0707, 0x230506, 0x0E0303,
+			0x050202, 0x030202, 0x030202, 0x0A0202, 0x220303, 0x330404, 0x2F0404, 0x2F0404, 0x320404, 0x2E0404,
+			0x100202, 0x040202, 0x080202, 0x0C0203, 0x150101, 0x1D0101, 0x220101, 0x270202, 0x2D0202, 0x310202,
+			0x320202, 0x300202, 0x280403, 0x220303, 0x180201, 0x0E0202, 0x0C0202, 0x150101, 0x240101, 0x200101,
+			0x150202, 0x070202, 0x030202, 0x030202, 0x040202, 0x080202, 0x0F0202, 0x1B0101, 0x240101, 0x250101,
+			0x250101, 0x250101, 0x200101, 0x1B0202, 0x0E0302, 0x080202, 0x050202, 0x080202, 0x200202, 0x250101,
+			0x250101, 0x250101, 0x290202, 0x340202, 0x3E0303, 0x0C0202, 0x030202, 0x080202, 0x2E0303, 0x360202,
+			0x2A0202, 0x250101, 0x250101, 0x250101, 0x250101, 0x290202, 0x350202, 0x3E0303, 0x0C0202, 0x040202,
+			0x030202, 0x0A0202, 0x340303, 0x360202, 0x2A0202, 0x250101, 0x250101, 0x250101, 0x250101, 0x2A0202,
+			0x350202, 0x390303, 0x0B0202, 0x030202, 0x020202, 0x090202, 0x330303, 0x350202, 0x290202, 0x250101,
+			0x250101, 0x250101, 0x250101, 0x2A0202, 0x360202, 0x340303, 0x0A0202, 0x030202, 0x040202, 0x070202,
+			0x0C0202, 0x190101, 0x1D0101, 0x250101, 0x250101, 0x250101, 0x250101, 0x250101, 0x200101, 0x1B0202,
+			0x0F0202, 0x090202, 0x050202, 0x030202, 0x030202, 0x050202, 0x090202, 0x0E0202, 0x1B0202, 0x1F0101,
+			0x250202, 0x2C0202, 0x300202, 0x310202, 0x300202, 0x2A0202, 0x220303, 0x1D0202, 0x100202, 0x0A0202,
+			0x060202, 0x030202, 0x050202, 0x0D0202, 0x210101, 0x250101, 0x250101, 0x1D0101, 0x0A0202, 0x040202,
+			0x030202, 0x040202, 0x080202, 0x0E0202, 0x1B0101, 0x1E0101, 0x250101, 0x250101, 0x250101, 0x250101,
+			0x250101, 0x210101, 0x1C0202, 0x100202, 0x0A0202, 0x050202, 0x030202, 0x030202, 0x0A0202, 0x300303,
+			0x360202, 0x2A0202, 0x250101, 0x250101, 0x250101, 0x250101, 0x290202, 0x340202, 0x3E0303, 0x200202,
+			0x070202, 0x030202, 0x030202, 0x070202, 0x1B0202, 0x250202, 0x250101, 0x250101, 0x250101, 0x230202,
+			0x0A0202, 0x030202, 0x040202, 0x070202, 0x090202, 0x0B0101, 0x0D0202, 0x0F0202, 0x100202, 0x110202,
+			0x100202, 0x0D0202, 0x0A0202, 0x070202, 0x050202, 0x050202, 0x070202, 0x0A0202, 0x0A0202, 0x070202,
+			0x030202, 0x030202, 0x040202, 0x080202, 0x0A0202, 0x0B0101, 0x0C0101, 0x0B0101, 0x0A0202, 0x070202,
+			0x040202, 0x030202, 0x030202, 0x050202, 0x080202, 0x0B0101, 0x0B0101, 0x0D0101, 0x0E0202, 0x0F0202,
+			0x0D0202, 0x070202, 0x030202, 0x050202, 0x0C0202, 0x0F0202, 0x0D0202, 0x0C0101, 0x0C0101, 0x0C0101,
+			0x0C0101, 0x0E0202, 0x0F0203, 0x0E0202, 0x070202, 0x030202, 0x030202, 0x060202, 0x0D0202, 0x0F0203,
+			0x0E0202, 0x0C0101, 0x0C0101, 0x0C0101, 0x0C0101, 0x0E0202, 0x100202, 0x0D0303, 0x070202, 0x020202,
+			0x030202, 0x060202, 0x0D0202, 0x100302, 0x0E0202, 0x0C0101, 0x0C0101, 0x0C0101, 0x0D0101, 0x0E0202,
+			0x100202, 0x0D0202, 0x070202, 0x030202, 0x050202, 0x070202, 0x090202, 0x0B0101, 0x0D0101, 0x0D0101,
+			0x0D0101, 0x0B0101, 0x0A0202, 0x080202, 0x050202, 0x030202, 0x030202, 0x050202, 0x080202, 0x0A0202,
+			0x0D0202, 0x0F0202, 0x100202, 0x110202, 0x100202, 0x0F0202, 0x0B0202, 0x080202, 0x050202, 0x030202,
+			0x030202, 0x030202, 0x050202, 0x0A0202, 0x0D0101, 0x0C0101, 0x090202, 0x050202, 0x030202, 0x030202,
+			0x050202, 0x080202, 0x0A0202, 0x0D0101, 0x0E0101, 0x0E0101, 0x0E0101, 0x0D0101, 0x0B0202, 0x080202,
+			0x050202, 0x030202, 0x070202, 0x0E0202, 0x110202, 0x100202, 0x0F0101, 0x0E0101, 0x0E0101, 0x0E0101,
+			0x100202, 0x130202, 0x130303, 0x0C0202, 0x050202, 0x040202, 0x090202, 0x0C0101, 0x0E0101, 0x0E0101,
+			0x0D0101, 0x0A0202, 0x050202, 0x030202, 0x030202, 0x030202, 0x040202, 0x040202, 0x040202, 0x040202,
+			0x040202, 0x040202, 0x030202, 0x030202, 0x020202, 0x030202, 0x020202, 0x030202, 0x030202, 0x030202,
+			0x030202, 0x030202, 0x030202, 0x030202, 0x040202, 0x040202, 0x030202, 0x030202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030202, 0x030202, 0x030202, 0x040202, 0x030202, 0x040202, 0x030202, 0x020202,
+			0x020202, 0x030202, 0x030202, 0x040202, 0x040202, 0x030202, 0x030202, 0x040202, 0x030202, 0x040202,
+			0x040202, 0x040202, 0x030202, 0x020202, 0x020202, 0x020202, 0x030202, 0x040202, 0x040202, 0x030202,
+			0x030202, 0x040202, 0x030202, 0x040202, 0x040202, 0x030202, 0x030202, 0x020202, 0x020202, 0x020202,
+			0x030202, 0x040202, 0x030202, 0x030202, 0x040202, 0x040202, 0x030202, 0x040202, 0x040202, 0x030202,
+			0x030202, 0x030202, 0x030202, 0x030202, 0x040202, 0x040202, 0x030202, 0x030202, 0x030202, 0x030202,
+			0x030202, 0x030202, 0x040202, 0x040202, 0x040202, 0x040202, 0x040202, 0x040202, 0x040202, 0x030202,
+			0x030202, 0x030202, 0x040202, 0x030202, 0x030202, 0x030202, 0x040202, 0x030202, 0x040202, 0x040202,
+			0x040202, 0x040202, 0x030202, 0x030202, 0x030202, 0x030202, 0x040202, 0x040202, 0x040202, 0x040202,
+			0x040202, 0x040202, 0x040202, 0x040202, 0x040202, 0x040202, 0x030202, 0x030202, 0x040202, 0x040202,
+			0x040202, 0x040202, 0x030202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x080807, 0x060606, 0x0A0A09, 0x0B0B0A, 0x0A0A09,
+			0x0E0E0B, 0x0D0E0B, 0x0E0F0D, 0x0D0D0B, 0x0B0B0A, 0x0C0C0B, 0x070706, 0x060605, 0x040404, 0x030303,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302,
+			0x070706, 0x181913, 0x26271E, 0x26271F, 0x2A2B23, 0x2B2C25, 0x2A2B25, 0x292A23, 0x1C1D18, 0x0C0C0A,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x070706,
+			0x0A0A09, 0x0A0A08, 0x0E0E0C, 0x0C0C0A, 0x0A0A08, 0x060605, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030303, 0x040404, 0x070706, 0x0B0B09, 0x181915, 0x2B2B24, 0x3A3B30,
+			0x48493C, 0x4F5041, 0x4F5141, 0x505142, 0x4F5042, 0x4D4E41, 0x4A4B40, 0x3C3D34, 0x2F3029, 0x252520,
+			0x151512, 0x070706, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x0E0E0B, 0x8B8E68, 0xF9FEBF, 0xF9FEC7, 0xFAFED1, 0xFBFFD7, 0xFCFFDA, 0xFCFFD5,
+			0xE5E8BB, 0x1E1F19, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x070706, 0x050504, 0x090908, 0x070706, 0x050505, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x0D0D0A, 0x23241D, 0x424337, 0x4B4C3F, 0x494A3F, 0x47483C, 0x34342B, 0x181914, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0C0C0B, 0x191916, 0x38392F, 0x595B4B,
+			0xA9AC8E, 0xBABD99, 0xECF0C2, 0xEDF1C0, 0xE9EEBD, 0xEAEFBE, 0xEEF3C3, 0xF3F9CA, 0xF7FBD1, 0xCBCDAD,
+			0xB5B79B, 0xAEB094, 0x4D4F40, 0x282820, 0x12120F, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x080806, 0x181813, 0x444533, 0xA2A679, 0xF3F9B9, 0xF6FAC4,
+			0xF9FDCC, 0xF9FDC9, 0xE3E7AF, 0x26271E, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x060605, 0x151511, 0x2A2A23, 0x32332B, 0x34352D, 0x2E2E27, 0x181914, 0x0A0A08,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x040403, 0x191A14, 0x818367, 0xF9FECD, 0xFAFED3, 0xFAFED5, 0xF9FDCF, 0xD6DAAD, 0x2D2E24,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x060605, 0x11120F, 0x2C2D25, 0x545646,
+			0xB9BC9A, 0xF3F8C8, 0xECF0BE, 0xE5EAB2, 0xDBDFA5, 0xC3C88F, 0xB6BA85, 0xB8BD88, 0xCACF94, 0xDDE2A9,
+			0xE7EBB5, 0xEEF2C2, 0xF5F9CC, 0xF8FCCD, 0xF8FCC8, 0x969977, 0x1E1E17, 0x050504, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x060605, 0x0F100C, 0x26271D,
+			0xA0A476, 0xE2E8A7, 0xF3F7B8, 0xF3F8B7, 0xD6DB9E, 0x24251C, 0x050504, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030303, 0x0C0C09, 0x4F503F, 0xF7FCCD, 0xF9FCD5, 0xF9FCD5, 0xF8FCCF,
+			0x898B6E, 0x181813, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x040402, 0x1C1D16, 0x8A8D69, 0xF6F9BF, 0xF7FAC8, 0xF7FBCA, 0xF5FBC2,
+			0xD0D49F, 0x37382B, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x060605, 0x151611, 0x3A3B30,
+			0x93967A, 0xE7EBC0, 0xEEF2C1, 0xE3E7B0, 0xC8CD92, 0x8D9168, 0x66684B, 0x454733, 0x3D3E2D, 0x3E402E,
+			0x54553E, 0x717353, 0xA1A576, 0xCFD49C, 0xE5EBB2, 0xEFF4BB, 0xF1F6BA, 0x9FA277, 0x26271D, 0x050503,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040404, 0x030303,
+			0x040404, 0x020202, 0x050505, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x151610, 0x727554, 0xC7CC92, 0xE4E9A7, 0xE3E8A6, 0xC5C98F, 0x23241A, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x030303, 0x050504, 0x040404, 0x060605, 0x040404, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x10100C, 0x575842, 0xF1F6BD, 0xF3F7C5,
+			0xF3F7C7, 0xF2F6BF, 0x939670, 0x1B1B15, 0x040404, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x191A13, 0x6B6D4F, 0xE7ECA9, 0xEEF3B4,
+			0xEEF5B7, 0xEAF0AE, 0xB6BA86, 0x323325, 0x020202, 0x020202, 0x020202, 0x020202, 0x040404, 0x141411,
+			0x3D3E31, 0xA2A585, 0xF2F6C5, 0xEBEFBA, 0xDBDFA5, 0xA7AB79, 0x646648, 0x303123, 0x1A1A13, 0x0F0F0B,
+			0x0B0B08, 0x0D0D0B, 0x13130E, 0x23241A, 0x51533B, 0x8F9368, 0xBCC189, 0xDBE1A1, 0xE1E7A6, 0x93966B,
+			0x24251B, 0x040504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303,
+			0x080807, 0x1C1C17, 0x20211C, 0x20211B, 0x1A1A15, 0x090908, 0x030303, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x12120E, 0x727553, 0xD0D597, 0xE4E9A6, 0xE1E6A3, 0xC2C68D, 0x202118,
+			0x070706, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x040403, 0x0E0E0C, 0x1D1E19, 0x2B2B24, 0x2C2C25, 0x21221C, 0x0B0B09, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x090A07, 0x4B4C37,
+			0xD4D99D, 0xDAE0A3, 0xDCE1A4, 0xD6DB9F, 0x81845F, 0x1A1B14, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x13130E, 0x5D5F44,
+			0xCFD497, 0xE2E7A4, 0xE3EAA7, 0xD4D99A, 0x9A9E70, 0x2A2B1F, 0x020202, 0x020202, 0x030303, 0x060606,
+			0x0C0D0A, 0x303126, 0x929475, 0xF0F4C0, 0xEAEDB7, 0xD8DCA1, 0xA1A575, 0x5A5D41, 0x232319, 0x0C0D0A,
+			0x050504, 0x030303, 0x020202, 0x030303, 0x040404, 0x080806, 0x1F2017, 0x646749, 0x9CA071, 0xBFC48B,
+			0xCCD295, 0x888C63, 0x1E1F16, 0x060605, 0x020302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x060605, 0x1B1C16, 0xCED2AA, 0xF4F7D0, 0xF3F7CE, 0xC1C49C, 0x191A14, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x040404, 0x13130E, 0x757956, 0xD5DA9A, 0xE4EAA5, 0xDFE5A2,
+			0xBFC58B, 0x202118, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x060605, 0x20211A, 0xD1D5AB, 0xF4F8CF, 0xF4F8CD, 0xC7CAA0, 0x1B1C16,
+			0x060605, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303,
+			0x0A0A08, 0x3E3F2D, 0x9EA273, 0x92966A, 0x909469, 0x9B9E70, 0x696B4D, 0x13130E, 0x040404, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303,
+			0x0F100C, 0x50513A, 0xCCD194, 0xDCE19E, 0xDEE3A1, 0xD1D698, 0x969A6D, 0x28281D, 0x020202, 0x020202,
+			0x030302, 0x090907, 0x1D1D17, 0x65674F, 0xE7ECB6, 0xE9EEB5, 0xDCE1A3, 0xAEB17C, 0x6E704F, 0x26271C,
+			0x0B0B08, 0x040403, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x040404, 0x0D0D0A, 0x2E2F22,
+			0x898C63, 0xA6AB78, 0xB5B983, 0x7C7E59, 0x1C1D15, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x050504, 0x23241C, 0xE3E7B1, 0xF0F4C4, 0xEEF3C0, 0xC2C591, 0x1C1D16,
+			0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060604, 0x12120D, 0x767954, 0xD4D998,
+			0xE4E9A4, 0xDEE3A0, 0xBDC187, 0x1F2017, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x080806, 0x2D2E24, 0xE5E9B3, 0xF0F4C3, 0xEFF3BF,
+			0xC6CA95, 0x25261D, 0x090907, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x080806, 0x2E2F22, 0x797B56, 0x747753, 0x747753, 0x747753, 0x53543C, 0x0E0E0A,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x0E0F0B, 0x40422F, 0xC8CC8F, 0xD7DC9B, 0xD9DF9C, 0xCED293, 0x8B8E65, 0x26261C,
+			0x020202, 0x030302, 0x050504, 0x0E0E0B, 0x3E3F30, 0xC0C495, 0xE9EEB3, 0xE1E5A9, 0xC5CA8D, 0x94986A,
+			0x363827, 0x0F0F0B, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x050504, 0x1A1A13, 0x616446, 0x878B61, 0x969A6C, 0x6A6D4D, 0x191912, 0x060605, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x090907, 0x434431, 0xE8EEAD, 0xEBF0B5, 0xE8EDAD,
+			0xB5B982, 0x1D1D15, 0x040404, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x12120D,
+			0x737653, 0xD2D897, 0xE1E6A1, 0xDAE09D, 0xBABF86, 0x1D1E16, 0x040404, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0C0C09, 0x4D4F3A, 0xE8EEAD,
+			0xEBF0B5, 0xE8EDAD, 0xB9BE85, 0x222319, 0x070706, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040404, 0x0C0C09, 0x161610, 0x1B1C14, 0x1A1A13, 0x171811,
+			0x11110C, 0x060705, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x040403, 0x0A0A07, 0x3D3F2C, 0xC5CA8D, 0xD3D997, 0xD6DA99, 0xC9CE90,
+			0x888B61, 0x222319, 0x020202, 0x030303, 0x090907, 0x25251C, 0x707355, 0xE5EBAE, 0xE3E8AA, 0xD6DB9B,
+			0xAFB37C, 0x747753, 0x1E1E16, 0x070705, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x0D0D0A, 0x3B3C2A, 0x717450, 0x767954, 0x54573D, 0x10100C, 0x050504,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0E0F0B, 0x707353, 0xE4EAA8,
+			0xE5EAAB, 0xE2E8A1, 0xB0B47E, 0x1B1C14, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x12120D, 0x717451, 0xCFD493, 0xDDE39E, 0xD7DD99, 0xB7BC82, 0x1F2017, 0x040404, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x040404, 0x151610,
+			0x7B7E5B, 0xE4EAA8, 0xE5EAAA, 0xE2E8A1, 0xB4B881, 0x24251A, 0x050504, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x040403, 0x040403, 0x040404,
+			0x040403, 0x040404, 0x030303, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x020202, 0x020202,
+			0x030303, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x020202, 0x030302, 0x020202, 0x030302,
+			0x020202, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x030303, 0x020202, 0x030303,
+			0x020202, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x030303, 0x020202, 0x040404, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x090907, 0x3A3C2A, 0xB7BC83, 0xCED393,
+			0xD0D595, 0xC4C98C, 0x727551, 0x1E1F16, 0x020202, 0x030303, 0x0A0A08, 0x363728, 0xBABE8A, 0xE0E6A8,
+			0xDBE0A1, 0xC7CC8E, 0xA5AA75, 0x454731, 0x11110D, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060605, 0x10110C, 0x1B1C14, 0x1D1E15, 0x151610,
+			0x080907, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303,
+			0x030303, 0x050504, 0x060706, 0x070706, 0x070806, 0x070706, 0x080807, 0x040404, 0x060605, 0x040404,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303,
+			0x030303, 0x030303, 0x050505, 0x060605, 0x060605, 0x070706, 0x050504, 0x050504, 0x040403, 0x020202,
+			0x020202, 0x030303, 0x020202, 0x050504, 0x020202, 0x070706, 0x050504, 0x040404, 0x060605, 0x030302,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x050504, 0x020202, 0x050504, 0x040403,
+			0x040403, 0x040404, 0x040403, 0x030303, 0x050504, 0x050505, 0x040404, 0x040404, 0x040403, 0x030303,
+			0x030303, 0x030303, 0x040403, 0x050504, 0x040403, 0x050504, 0x050504, 0x040404, 0x040404, 0x030303,
+			0x020202, 0x030303, 0x020202, 0x020202, 0x050504, 0x050505, 0x050504, 0x030303, 0x070706, 0x030303,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x020202, 0x040403, 0x030303, 0x050505, 0x040404, 0x030303, 0x040403, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x070806, 0x212119,
+			0xAFB385, 0xE3E8AA, 0xE2E8A9, 0xE0E6A4, 0xB7BC87, 0x1A1B14, 0x060605, 0x050504, 0x040404, 0x040403,
+			0x030303, 0x050504, 0x030303, 0x030303, 0x020202, 0x050504, 0x050504, 0x060605, 0x060605, 0x040404,
+			0x030303, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x040403, 0x040404,
+			0x040404, 0x040404, 0x050504, 0x050504, 0x040404, 0x040404, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x11110C, 0x70734F, 0xCBD08F, 0xD9DE99, 0xD3D995, 0xB4B980, 0x1F2016,
+			0x040404, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x040404, 0x050505, 0x050605, 0x060605, 0x080807, 0x040404, 0x050504,
+			0x030303, 0x020202, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040404,
+			0x090907, 0x292A20, 0xB5B989, 0xE3E8AA, 0xE1E7A8, 0xE0E6A4, 0xBCC18B, 0x25251B, 0x080807, 0x070606,
+			0x050504, 0x050504, 0x050504, 0x040403, 0x040403, 0x030303, 0x040403, 0x050504, 0x070706, 0x060605,
+			0x080806, 0x070806, 0x060606, 0x060605, 0x070806, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x070706, 0x060605,
+			0x070706, 0x070706, 0x050605, 0x080807, 0x060606, 0x050504, 0x040404, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x060605, 0x080807, 0x090908,
+			0x090907, 0x080907, 0x090908, 0x050504, 0x040404, 0x020202, 0x030303, 0x030303, 0x070705, 0x080806,
+			0x060706, 0x080807, 0x0A0A08, 0x090907, 0x070706, 0x060605, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x040404,
+			0x070706, 0x090908, 0x0C0C0A, 0x0A0A08, 0x0B0B09, 0x0C0C0A, 0x0D0E0B, 0x0C0C0A, 0x080807, 0x090906,
+			0x070706, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0B0B08, 0x353727,
+			0xB4B87F, 0xCBD18F, 0xCDD391, 0xC0C587, 0x636647, 0x181812, 0x020202, 0x050504, 0x15150F, 0x4B4D37,
+			0xD7DC9C, 0xDCE1A0, 0xD4D997, 0xB9BE82, 0x959A69, 0x2D2E20, 0x090906, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020302, 0x030303, 0x040403,
+			0x050503, 0x050504, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x050505, 0x0C0C0A, 0x1A1A16, 0x25261F, 0x2E2F26, 0x313228, 0x2E2F25, 0x2F3027, 0x2B2B24,
+			0x22231D, 0x171713, 0x0D0D0B, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x0A0B08, 0x202018, 0x26271E, 0x282821, 0x2A2A23, 0x292923, 0x282822, 0x1E1E19,
+			0x0F0F0D, 0x070806, 0x030303, 0x080807, 0x0A0A09, 0x171814, 0x22221D, 0x262721, 0x252620, 0x24241F,
+			0x11120F, 0x0A0A09, 0x050504, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0C0C0A, 0x11120F, 0x1C1C18, 0x1E1F19,
+			0x21211B, 0x22221B, 0x24241D, 0x24251E, 0x21211C, 0x1F1F1B, 0x21211D, 0x25251F, 0x23241E, 0x21221C,
+			0x20211A, 0x1E1E18, 0x191A14, 0x10110D, 0x0D0D0A, 0x181912, 0x1E1F18, 0x22221C, 0x24251F, 0x23231E,
+			0x20201B, 0x1C1C17, 0x0E0E0B, 0x060606, 0x040403, 0x050504, 0x090908, 0x151512, 0x1E1F1A, 0x23231E,
+			0x25251F, 0x22231D, 0x151612, 0x090907, 0x040404, 0x020202, 0x020202, 0x030303, 0x020202, 0x020202,
+			0x060605, 0x0E0F0C, 0x131310, 0x1B1C16, 0x20201A, 0x1F1F19, 0x1F201A, 0x24251F, 0x1B1C18, 0x161613,
+			0x0A0A09, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040404, 0x090907,
+			0x1A1B14, 0x707256, 0xDFE4A9, 0xDFE4A5, 0xDEE3A4, 0xDEE3A3, 0xB9BD8B, 0x323326, 0x23241C, 0x23231C,
+			0x21211B, 0x22231C, 0x22221B, 0x1E1F17, 0x191A13, 0x141410, 0x202119, 0x24251D, 0x25261F, 0x252620,
+			0x252620, 0x22231D, 0x191915, 0x0A0A08, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0B0C09,
+			0x1D1D16, 0x26261E, 0x26271F, 0x272721, 0x262721, 0x24251E, 0x1D1D18, 0x0C0C0A, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030403, 0x0E0E0A, 0x6E714D, 0xC7CD8C, 0xD5DB96, 0xCFD591,
+			0xB0B67C, 0x1D1E15, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x050505, 0x0B0B0A, 0x11110E, 0x191915, 0x1E1F19, 0x26271F, 0x2B2C23, 0x282821,
+			0x2D2D26, 0x252620, 0x1A1A16, 0x0D0D0B, 0x080807, 0x030302, 0x020202, 0x020202, 0x020202, 0x020302,
+			0x060605, 0x0C0D0A, 0x22231A, 0x7B7E5E, 0xDEE3A8, 0xDEE4A6, 0xDDE3A4, 0xDEE2A3, 0xBEC28F, 0x414231,
+			0x2E2F24, 0x2C2D23, 0x2D2E24, 0x2D2E24, 0x323227, 0x292A20, 0x1B1C15, 0x0B0B09, 0x10100C, 0x212219,
+			0x303125, 0x303027, 0x33342B, 0x31322A, 0x2F3028, 0x2B2B24, 0x171813, 0x070706, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x050504, 0x0D0D0B,
+			0x191915, 0x272820, 0x2E2E25, 0x34352B, 0x323329, 0x33342A, 0x2F2F26, 0x272720, 0x1A1B17, 0x10110E,
+			0x070706, 0x050505, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x11120D, 0x28291E,
+			0x36372A, 0x393B2E, 0x3B3C31, 0x3C3C32, 0x3C3C32, 0x303027, 0x1A1A15, 0x070706, 0x070706, 0x070706,
+			0x151511, 0x262620, 0x35362D, 0x3C3D33, 0x3E3F36, 0x373930, 0x272822, 0x141411, 0x080807, 0x050504,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x050504,
+			0x070706, 0x12120F, 0x1F201A, 0x2E2F26, 0x393A2E, 0x404234, 0x3D3E31, 0x414235, 0x434437, 0x424337,
+			0x37372F, 0x2E2E27, 0x26261F, 0x191A15, 0x0B0B09, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403,
+			0x0A0A08, 0x343525, 0xACB179, 0xC7CD8B, 0xC8CF8D, 0xBCC184, 0x55573C, 0x14140F, 0x020202, 0x050504,
+			0x222318, 0x888C61, 0xD8DE9A, 0xD7DC99, 0xCCD18F, 0xAFB47A, 0x7F8259, 0x232419, 0x060605, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x0C0C0A, 0x1C1C17, 0x36372D, 0x94977B, 0xAEB18F, 0xDFE3B4, 0xDADEAF, 0xD9DDAD,
+			0xDDE1B1, 0xE1E5B8, 0xA2A487, 0x93957C, 0x2F3028, 0x1C1C17, 0x0B0B09, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x050504, 0x161711, 0xD9DE9C, 0xDCE1A7, 0xE2E6B4, 0xE7EAC0, 0xE9EDC5,
+			0xE8EBC4, 0xE5E8BB, 0x4B4C3C, 0x080807, 0x090907, 0x191A14, 0x424436, 0x8F9177, 0xE7EBC3, 0xE8EBC6,
+			0xE9ECC7, 0xEAEDC9, 0x90917A, 0x414237, 0x141411, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0A0A09, 0x151612, 0x45463A, 0x8B8C74,
+			0xB9BC9A, 0xE1E4B7, 0xDDE2B0, 0xDEE1B1, 0xE0E4B4, 0xE4E7BC, 0xE8EAC4, 0xE9EDC8, 0xEAEDC9, 0xEAEDC7,
+			0xE7EBC2, 0xE4E7BB, 0xDFE3B2, 0xDADEAA, 0xD9DDA4, 0x50523B, 0x181912, 0xDADFA1, 0xDDE2A8, 0xE2E6B6,
+			0xE7EAC1, 0xEAECC6, 0xE8EBC4, 0xE5E9BC, 0x48493A, 0x080807, 0x0D0D0B, 0x181914, 0x4F5041, 0x8B8D75,
+			0xE8ECC5, 0xE9EDC8, 0xEAEDC8, 0xE7EBC1, 0xCCD1A3, 0x181813, 0x050504, 0x020202, 0x040404, 0x070706,
+			0x0B0B09, 0x181814, 0x24251E, 0x6E705A, 0x8A8B6E, 0xB5B990, 0xDADFAE, 0xDEE1B1, 0xE3E6B9, 0xE6EAC1,
+			0xDCDFBC, 0x8E9079, 0x434438, 0x12120F, 0x070706, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403,
+			0x0D0D0A, 0x2C2D20, 0x8A8E65, 0xD1D697, 0xD2D795, 0xD3D995, 0xD5DB97, 0xD5DC98, 0xD4DB9B, 0xD4D99E,
+			0xD5DAA5, 0xD7DBA8, 0xD6DAA9, 0xD6DAA9, 0xD7DBA7, 0xD6DBA3, 0x979A72, 0x585B43, 0xDCE1A7, 0xDFE4AF,
+			0xE4E8BA, 0xE8EBC5, 0xE9EBC6, 0xE7EABF, 0xB5B890, 0x171813, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x13140F, 0xD9DE9F, 0xDDE2AB, 0xE3E7B9, 0xE7EBC3, 0xE9ECC6, 0xE6EAC1, 0xCDD1A3, 0x1B1C15,
+			0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0F100B, 0x6C6F4B, 0xC4C988,
+			0xD1D792, 0xCCD28E, 0xAEB278, 0x1F2016, 0x040404, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x040404, 0x080807, 0x11110F, 0x1D1D18, 0x2A2A22, 0x74765E, 0x909273, 0xB6B991, 0xD9DDAD,
+			0xDBDEAF, 0xE1E4B6, 0xE6E9BE, 0xE0E3BE, 0x95987F, 0x4A4B3E, 0x1A1A15, 0x060605, 0x040403, 0x020202,
+			0x030302, 0x030302, 0x11110C, 0x343626, 0x8F9368, 0xCED495, 0xCFD494, 0xD1D895, 0xD3DA96, 0xD4DA98,
+			0xD3D899, 0xD2D79D, 0xD4D7A2, 0xD4D8A6, 0xD4D7A7, 0xD4D8A5, 0xD3D8A4, 0xD3D8A0, 0x989B71, 0x151510,
+			0x191912, 0xD9DE9E, 0xDBE1A6, 0xE1E4B3, 0xE6E9BF, 0xE8ECC5, 0xE7EBC2, 0xE4E8B9, 0x63654D, 0x10100C,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x0D0D0B,
+			0x1D1E18, 0x383A2F, 0x97997D, 0xAFB28F, 0xDCE1B1, 0xD7DBAC, 0xD6D9A9, 0xDADDAE, 0xE1E4B7, 0xAAAC8C,
+			0x9A9C81, 0x3A3B30, 0x1F201A, 0x0E0E0C, 0x040403, 0x030303, 0x020202, 0x020202, 0x020202, 0x050504,
+			0x1E1F16, 0xD8DD9C, 0xDBE0A6, 0xE0E4B1, 0xE6E9BD, 0xE8EBC3, 0xE7EAC1, 0xE4E8BA, 0x5B5C49, 0x12130F,
+			0x10110D, 0x23241C, 0x595A49, 0x9FA283, 0xE4E8BD, 0xE4E7C1, 0xE7E9C5, 0xE7EBC6, 0xA5A88C, 0x5B5D4C,
+			0x22231D, 0x070706, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x050505, 0x12120F, 0x282921, 0x46473A, 0xA0A184, 0xA7A884, 0xD9DDAD, 0xD4D8A7, 0xD1D6A5, 0xD6D8A9,
+			0xDBDEB0, 0xE2E5B8, 0xD1D4AF, 0xABAC8F, 0xA2A586, 0x646650, 0x1B1B15, 0x050504, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x090906, 0x2F3021, 0xA4A871, 0xC2C988, 0xC4C988, 0xB8BD80, 0x474932, 0x0F0F0B,
+			0x020202, 0x070705, 0x2F3020, 0xA1A66F, 0xD2D892, 0xD0D692, 0xC4C988, 0xAAAF75, 0x676B47, 0x191A12,
+			0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x060605, 0x11120F, 0x2F3027, 0x97997D, 0xDFE3B6, 0xD8DDAA, 0xCED298, 0xBCC181,
+			0xA4A971, 0x9FA46E, 0xADB277, 0xC8CD8D, 0xD3D7A1, 0xDDE0B3, 0xE3E6BC, 0x919378, 0x282921, 0x0E0E0C,
+			0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0C0C09, 0x24251A, 0x737650, 0xC2C886,
+			0xD7DCA2, 0xDEE2B1, 0xDFE3B2, 0xDCE1AB, 0x484938, 0x11120E, 0x21221A, 0x888B6C, 0xD7DBA7, 0xD0D6A0,
+			0xCED39D, 0xD2D6A0, 0xD9DDAB, 0xDFE3B6, 0xE3E6BC, 0xE2E6BA, 0x61634F, 0x11110D, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x030303, 0x0C0C0A, 0x323329, 0xADAF8F,
+			0xE1E5BA, 0xDADEAC, 0xD0D598, 0xB8BE7F, 0xA3A870, 0xA1A56F, 0xAFB478, 0xC6CB8B, 0xD2D79E, 0xDADFAD,
+			0xDFE3B4, 0xDFE2B2, 0xDADFA5, 0xD1D790, 0xB3B87B, 0xA2A770, 0xA2A770, 0x41432E, 0x0F100C, 0x1E1F17,
+			0x6F724E, 0xC1C685, 0xD7DCA3, 0xDEE2B2, 0xDFE4B3, 0xDDE1AC, 0x434435, 0x13130F, 0x303126, 0xA7AA83,
+			0xD7DCA6, 0xD2D7A4, 0xD5DAA6, 0xDBDFAE, 0xDFE2B2, 0xDCE1AC, 0xC4C88F, 0x191A13, 0x040504, 0x060705,
+			0x10100D, 0x1D1D18, 0x606251, 0x96997E, 0xE0E3B6, 0xD7DDA5, 0xCED490, 0xB3B87B, 0xA4A971, 0xA8AD74,
+			0xBEC483, 0xD0D49A, 0xDADFAE, 0xE2E5B9, 0xE2E6BA, 0x60624D, 0x141410, 0x050504, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x292B1D, 0xB6BB7D, 0xA6AA72, 0x9DA16C, 0xA1A66F, 0xB2B77B, 0xC1C685, 0xBEC483,
+			0xAFB479, 0xA1A66F, 0x989D69, 0x949966, 0x939765, 0x949866, 0x969A67, 0x9CA06B, 0x72764F, 0x1F2017,
+			0x454732, 0x939766, 0xD3D796, 0xDBDFAA, 0xDFE3B2, 0xDCE0AB, 0xB1B581, 0x1B1B14, 0x050504, 0x020202,
+			0x020202, 0x020202, 0x030302, 0x0D0E0A, 0x3A3B29, 0x888D5F, 0xD1D693, 0xD9DEA7, 0xDFE3B2, 0xDDE1AC,
+			0xC5C990, 0x202018, 0x050605, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x10100B,
+			0x696D49, 0xBFC484, 0xCDD28D, 0xC8CE8A, 0xA9AF75, 0x1C1D14, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x060605, 0x11120E, 0x22231C, 0x696B57, 0x9DA082, 0xDFE3B2, 0xD6DCA4, 0xCDD390,
+			0xB3B87B, 0xA4A971, 0xA8AD74, 0xBEC383, 0xCED19A, 0xD9DDAC, 0xE1E4B7, 0xE2E5B9, 0x6A6C55, 0x191A14,
+			0x050505, 0x020202, 0x020202, 0x070706, 0x313222, 0xB6BB7D, 0xA6AA72, 0x9DA16C, 0xA1A66F, 0xB2B77B,
+			0xC0C685, 0xBEC483, 0xAFB479, 0xA1A66F, 0x989D69, 0x949966, 0x939765, 0x949866, 0x979B68, 0x9FA46E,
+			0x7B7F56, 0x161610, 0x10100C, 0x2C2D21, 0x7C7F57, 0xC4CA87, 0xD5DAA2, 0xDDE1B0, 0xDEE2B1, 0xD9DEA4,
+			0x686B4B, 0x11120D, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403,
+			0x11110E, 0x2E2F26, 0x96987B, 0xE0E3B5, 0xD6DBA9, 0xCCD197, 0xBCC181, 0xA4A971, 0x9FA46E, 0xADB277,
+			0xC7CB8D, 0xCFD59F, 0xDBDFB1, 0xE2E5BA, 0x9B9E81, 0x2F3027, 0x11110E, 0x040404, 0x020202, 0x020202,
+			0x020202, 0x050504, 0x13130E, 0x343526, 0x82865C, 0xC5CA87, 0xD5DAA1, 0xDDE1AF, 0xDEE3B0, 0xDCE1AB,
+			0x5A5C47, 0x21221A, 0x353728, 0x959975, 0xD2D6A1, 0xCACE98, 0xC6CC97, 0xC9CD9C, 0xCFD6A6, 0xDAE0B2,
+			0xE0E4B9, 0xE1E4B9, 0x7A7C62, 0x23241C, 0x090908, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x060605, 0x12120F, 0x37372C, 0xA0A283, 0xDFE3B4, 0xD7DBA7, 0xCED197, 0xBABF80, 0xA1A66F,
+			0x9CA06B, 0xA5A972, 0xBCC182, 0xC6CB94, 0xD1D6A3, 0xDADEAE, 0xDAE0AC, 0xBDC190, 0x2D2E22, 0x080806,
+			0x020202, 0x020202, 0x020202, 0x020302, 0x090907, 0x2D2E1F, 0x9FA36E, 0xBFC483, 0xC0C385, 0xB3B97C,
+			0x3A3B29, 0x0D0D09, 0x030302, 0x080806, 0x343524, 0xAAAE74, 0xCDD38C, 0xCCD18D, 0xBEC483, 0xA9AE73,
+			0x4D4F35, 0x11110C, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x050504, 0x141410, 0x424335, 0xBDC098, 0xDBDFAF, 0xCFD59D, 0xB2B87A,
+			0x73774F, 0x42432D, 0x27281B, 0x242519, 0x2F3021, 0x575A3D, 0x959966, 0xC4C98B, 0xD5D9A5, 0xDDE1B2,
+			0xB9BC96, 0x292A21, 0x0C0C0A, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0A0A08,
+			0x1A1B12, 0x5F6240, 0xB1B679, 0xCED292, 0xD4D99D, 0xD5DA9E, 0x3C3D2E, 0x37382A, 0xAEB284, 0xCBD08F,
+			0xA9AE73, 0x84885A, 0x757950, 0x7D8156, 0x9CA16B, 0xC5CA8A, 0xD5D9A3, 0xDBDFAC, 0xD9DFA9, 0x414332,
+			0x0C0C09, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x0D0D0A, 0x3E3F31,
+			0xC9CDA2, 0xDDE1B1, 0xD1D69E, 0xB0B578, 0x666A46, 0x2F3121, 0x1A1A12, 0x1A1B12, 0x2E2F20, 0x5A5C3E,
+			0x8D9261, 0xB2B87A, 0xCBD090, 0xCED493, 0xA9AE74, 0x313223, 0x1E1F15, 0x1A1B13, 0x13140E, 0x0A0A07,
+			0x040404, 0x080806, 0x15150F, 0x5A5D3E, 0xB1B679, 0xCED392, 0xD4D99D, 0xD5DA9E, 0x3B3C2C, 0x424432,
+			0xC0C490, 0xC6CB89, 0xA2A66E, 0x8E9261, 0x959966, 0xAEB377, 0xC4C989, 0xCACF8D, 0xB2B67A, 0x191A12,
+			0x040404, 0x0D0E0A, 0x64664E, 0xBFC299, 0xDEE2B4, 0xD8DCAA, 0xCBD08E, 0x83875B, 0x40412C, 0x1F1F15,
+			0x181911, 0x1C1D14, 0x464831, 0x7E8256, 0xB4B97B, 0xD1D69C, 0xDADEAB, 0xD9DEA9, 0x3E3F2F, 0x090907,
+			0x020202, 0x020202, 0x020202, 0x040403, 0x0C0C09, 0x161710, 0x1B1C13, 0x1F2016, 0x5C5F3E, 0xA2A76F,
+			0xB5BA7C, 0xADB276, 0x7B7E53, 0x232519, 0x191A12, 0x181911, 0x171811, 0x181811, 0x171710, 0x15160F,
+			0x10100B, 0x090907, 0x0C0C09, 0x232418, 0x959966, 0xC0C683, 0xCFD494, 0xCED390, 0xA1A56F, 0x1B1C13,
+			0x030403, 0x020302, 0x020202, 0x020202, 0x020202, 0x020202, 0x0A0B08, 0x1E1F15, 0x7E8156, 0xBBC07F,
+			0xCED394, 0xCED492, 0xB2B87A, 0x1C1D14, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x0E0F0B, 0x676A47, 0xBBC180, 0xC8CE89, 0xC3C986, 0xA6AB72, 0x1A1B13, 0x050504, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030403, 0x10100C, 0x6B6C52, 0xC1C59A, 0xDCE0B2, 0xD6DAA6, 0xCAD08E,
+			0x878A5C, 0x464731, 0x25261A, 0x222318, 0x25261A, 0x4C4E35, 0x808457, 0xB4B97B, 0xCFD49C, 0xDADEAA,
+			0xD9DEA9, 0x454735, 0x0E0F0B, 0x020202, 0x030303, 0x040404, 0x0D0E0A, 0x1D1E15, 0x202117, 0x27281B,
+			0x636644, 0xA2A76F, 0xB4BA7C, 0xADB276, 0x7F8356, 0x2E2F20, 0x202117, 0x1E1F15, 0x1F2016, 0x1F1F16,
+			0x212117, 0x1F1F15, 0x15150F, 0x0A0A08, 0x050504, 0x0B0B09, 0x222318, 0x666946, 0xB1B679, 0xCBD190,
+			0xCED495, 0xCAD08A, 0x616343, 0x12120D, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303,
+			0x040404, 0x11120E, 0x404134, 0xBDC098, 0xDADDAD, 0xCED29C, 0xB2B87A, 0x737750, 0x44472F, 0x2B2C1E,
+			0x292B1D, 0x343624, 0x5D6040, 0x959966, 0xC3C88B, 0xD5D8A4, 0xDDE0B1, 0xBCC199, 0x34352A, 0x0F0F0C,
+			0x040404, 0x020202, 0x020202, 0x030303, 0x040403, 0x0D0D0A, 0x25261A, 0x6B6E4A, 0xB1B679, 0xCCD192,
+			0xD3D99D, 0xD4D99E, 0x585942, 0x4E513A, 0xB2B785, 0xC5CA8D, 0xA9AE73, 0x84885A, 0x757950, 0x7D8156,
+			0x9CA16B, 0xBEC389, 0xD1D79F, 0xD9DDA9, 0xD9DEA8, 0x575942, 0x161611, 0x040404, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x10100D, 0x353529, 0xAEB289, 0xD9DEAE, 0xD1D5A0, 0xBABF7F, 0x777A52,
+			0x464831, 0x343524, 0x303222, 0x363826, 0x575A3C, 0x7F8257, 0xAAAE74, 0xC0C58B, 0xC9CB92, 0xB4B97F,
+			0x2F3122, 0x080806, 0x020202, 0x020202, 0x020202, 0x020202, 0x090907, 0x292A1D, 0x909563, 0xBABF7F,
+			0xBBC080, 0xABB075, 0x373726, 0x0A0B08, 0x030403, 0x0B0B08, 0x373926, 0xB6BA7B, 0xC7CD87, 0xC6CC88,
+			0xBBC07E, 0xA8AD72, 0x363825, 0x0B0B08, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0E0F0B, 0x2F3024, 0xBFC295, 0xD6DAA7, 0xCACF95,
+			0xA4A96F, 0x575A3C, 0x1E1F15, 0x0D0D0A, 0x070706, 0x060605, 0x090907, 0x12130D, 0x383A26, 0x828658,
+			0xB9BE7E, 0xD0D59E, 0xD8DCA8, 0xA9AC84, 0x22221A, 0x090907, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x0B0B08, 0x333523, 0x9DA26A, 0xBBC07E, 0xCBD18E, 0xCED394, 0x4D4E36, 0xB0B47E,
+			0xB9BF7E, 0x6D704A, 0x313322, 0x1A1A12, 0x171710, 0x2F3120, 0x595C3C, 0x888C5C, 0xBABE7F, 0xCED497,
+			0xD2D69B, 0x95996C, 0x151610, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x070705,
+			0x1D1D16, 0xB7BC8D, 0xD6DAA7, 0xCED297, 0xA8AD72, 0x535538, 0x13140D, 0x080806, 0x050505, 0x040404,
+			0x060605, 0x11120C, 0x4C4E33, 0x868A5B, 0xAAAF73, 0xBFC683, 0xBCC17F, 0x5D603F, 0x0E0E0A, 0x040403,
+			0x040403, 0x030302, 0x020202, 0x020202, 0x080806, 0x2E3020, 0x9DA26A, 0xBBC07E, 0xCBD08E, 0xCDD393,
+			0x505239, 0xB6BC80, 0xA6AB71, 0x4D4F35, 0x1B1B13, 0x191911, 0x42442C, 0x6E724B, 0x8A8E5D, 0x9EA36C,
+			0x959A65, 0x161710, 0x030303, 0x13130E, 0xA3A774, 0xCACE94, 0xC4CA8F, 0xAFB376, 0x6B6E48, 0x191A11,
+			0x090A07, 0x040404, 0x040404, 0x060605, 0x0B0B08, 0x28291B, 0x7C8054, 0xB1B778, 0xCDD295, 0xD1D69B,
+			0x93966A, 0x161610, 0x030403, 0x020202, 0x020202, 0x030303, 0x020202, 0x040403, 0x030303, 0x0F0F0B,
+			0x5B5E3E, 0xA8AD72, 0xB7BD7C, 0xAEB375, 0x7D8055, 0x14140E, 0x050504, 0x030302, 0x030303, 0x040403,
+			0x030303, 0x040403, 0x030302, 0x040403, 0x030302, 0x11120C, 0x676946, 0xA7AC71, 0xBEC381, 0xBBC07E,
+			0x939863, 0x191A12, 0x040404, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0F100B,
+			0x585B3B, 0xA3A86E, 0xBCC27F, 0xBCC27F, 0xA3A86E, 0x1A1B13, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x12120D, 0x656945, 0xB8BD7C, 0xC4C985, 0xBFC582, 0xA3A86E, 0x1E1F15,
+			0x050604, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x191912, 0xA5A976, 0xC7CB93, 0xC2C88D,
+			0xAFB376, 0x6E724B, 0x202117, 0x0D0D0A, 0x070705, 0x040403, 0x070806, 0x10110C, 0x2F3121, 0x7D8155,
+			0xB1B778, 0xCCD194, 0xD1D69A, 0x9A9E70, 0x1B1C14, 0x030303, 0x020202, 0x030303, 0x040404, 0x040403,
+			0x060605, 0x12130D, 0x616443, 0xA8AD72, 0xB6BB7B, 0xAEB376, 0x808457, 0x1A1B12, 0x060604, 0x060604,
+			0x050504, 0x060604, 0x060605, 0x040403, 0x050504, 0x030302, 0x020202, 0x040403, 0x0C0D09, 0x393B28,
+			0x9DA26A, 0xB8BD7C, 0xC0C583, 0xB5BB7B, 0x575A3B, 0x10110B, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x040403, 0x0E0E0B, 0x2D2E23, 0xC1C497, 0xD6DAA6, 0xC9CC95, 0xA4A96F, 0x5B5E3F, 0x202117,
+			0x0E0F0B, 0x080906, 0x070705, 0x0A0B08, 0x181911, 0x3E402B, 0x83875A, 0xB8BC7E, 0xD0D29C, 0xD7DBA8,
+			0xB0B389, 0x2D2E23, 0x0B0B09, 0x040404, 0x020202, 0x020202, 0x020202, 0x050504, 0x0D0D09, 0x3F412B,
+			0x9DA26A, 0xBBC07E, 0xC9CF8E, 0xCDD192, 0x686B4B, 0xB1B57E, 0xB7BD7E, 0x797C50, 0x43442D, 0x27291B,
+			0x26271A, 0x3E402B, 0x5E6140, 0x888C5C, 0xB8BC7F, 0xCBD195, 0xD1D699, 0xA4A877, 0x23241A, 0x050504,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x070705, 0x222219, 0x969870, 0xD4D8A2, 0xD0D49C, 0xBAC07E,
+			0x6F714C, 0x292A1C, 0x13140E, 0x0A0A07, 0x0A0A07, 0x0D0D09, 0x1A1B13, 0x3A3B28, 0x6D7049, 0x8E9260,
+			0xA1A670, 0x969B66, 0x2A2B1D, 0x080906, 0x020202, 0x020202, 0x020202, 0x030303, 0x070806, 0x27281B,
+			0x8E9260, 0xB6BC7B, 0xB6BC7B, 0xA3A86E, 0x313222, 0x090906, 0x030303, 0x0C0C08, 0x3B3D28, 0xB8BD7B,
+			0xC1C681, 0xC1C782, 0xB5BB79, 0xA2A76C, 0x323321, 0x0A0A07, 0x030303, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040404, 0x060605, 0x1F1F17, 0x8D8F6A, 0xD0D59D,
+			0xC8CD92, 0xABB072, 0x6F734B, 0x1D1E14, 0x080806, 0x030303, 0x030302, 0x020202, 0x020202, 0x050504,
+			0x11120C, 0x494B31, 0x8D925F, 0xBBC180, 0xCDD298, 0xD0D59D, 0x767958, 0x13140F, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x070705, 0x1F2015, 0xA4A96D, 0xB8BE7B, 0xC4CA86, 0xC3C884,
+			0xACB173, 0xA4A96D, 0x505235, 0x171810, 0x090907, 0x040403, 0x030303, 0x080906, 0x1E1F14, 0x71734B,
+			0x9BA068, 0xC1C682, 0xC8CE8C, 0xBEC383, 0x1D1E14, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x0E0F0B, 0x6F7250, 0xCDD297, 0xCBD194, 0xB7BC7B, 0x828657, 0x1A1B12, 0x050504, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x060605, 0x1E1F15, 0x7E8254, 0xA1A66C, 0xBEC480, 0xC3C983, 0xA2A76C,
+			0x171710, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x1C1D13, 0xA4A96D, 0xB8BE7B,
+			0xC3CA85, 0xC2C883, 0xA6AC6F, 0x999D66, 0x373925, 0x10100B, 0x050504, 0x060604, 0x0E0E0A, 0x474930,
+			0x656944, 0x76794F, 0x7B7E51, 0x13140E, 0x040404, 0x13130D, 0x818456, 0x919661, 0x7F8355, 0x6A6E47,
+			0x1E1E14, 0x070705, 0x030302, 0x020202, 0x020202, 0x020202, 0x030403, 0x10100B, 0x525437, 0x9A9F67,
+			0xC0C682, 0xC7CD8A, 0xBDC280, 0x191A12, 0x040404, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x0F100B, 0x656844, 0xAEB475, 0xBBC07D, 0xB4B978, 0x868B5A, 0x13140D, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x10100B, 0x656843, 0xACB173,
+			0xBCC17D, 0xB7BD7B, 0x8F9360, 0x181911, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x0D0E0A, 0x515336, 0xA8AD70, 0xB9BF7C, 0xB8BE7B, 0x9FA46B, 0x1A1B12, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030403, 0x11110C, 0x616541, 0xB3B978, 0xBFC580, 0xBBC07D,
+			0x9FA46B, 0x1C1D13, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x15150F, 0x838658,
+			0x919661, 0x7F8355, 0x6B6F47, 0x242518, 0x0A0A07, 0x040403, 0x030302, 0x020202, 0x020202, 0x050504,
+			0x11120C, 0x575A3A, 0x9A9F67, 0xBFC481, 0xC7CD8B, 0xBFC481, 0x212217, 0x040403, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030302, 0x13140E, 0x6B6E47, 0xAEB475, 0xBAC07C, 0xB3B978, 0x8B905D, 0x191A11,
+			0x040403, 0x020202, 0x030302, 0x020202, 0x020202, 0x030302, 0x020202, 0x020202, 0x020202, 0x030303,
+			0x060605, 0x26271A, 0xA4A96D, 0xB6BB79, 0xBBC07D, 0xB1B676, 0x56593A, 0x11110C, 0x030403, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x050504, 0x1F2018, 0x8C8F69, 0xD0D59D, 0xC8CD92, 0xABB072, 0x71744C,
+			0x202116, 0x090907, 0x040403, 0x020202, 0x020202, 0x030303, 0x060605, 0x14150E, 0x4F5235, 0x8D925F,
+			0xBAC080, 0xCCD097, 0xD0D59C, 0x818461, 0x1D1D15, 0x040504, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x080806, 0x2C2D1E, 0xA4A96D, 0xB7BD7B, 0xC1C785, 0xC0C583, 0xADB275, 0xA4A96D, 0x5F6140, 0x232418,
+			0x0F100B, 0x090907, 0x090906, 0x11110C, 0x2E2F1F, 0x73764D, 0x9BA068, 0xBEC481, 0xC6CD8B, 0xC1C685,
+			0x363726, 0x0A0B08, 0x040404, 0x020202, 0x020202, 0x020202, 0x0B0B08, 0x303222, 0xBCC185, 0xCAD093,
+			0xC5CA8A, 0xA1A66B, 0x383926, 0x10100B, 0x040403, 0x030303, 0x040404, 0x040403, 0x060705, 0x14140E,
+			0x42452C, 0x676A45, 0x767A4F, 0x777B50, 0x232418, 0x060705, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x080806, 0x26261A, 0x85895A, 0xB2B877, 0xB2B878, 0x9BA067, 0x303120, 0x080806, 0x030303, 0x0E0E0A,
+			0x43462D, 0xB0B674, 0xB9BF7B, 0xBBC17C, 0xB1B675, 0x9CA167, 0x2E2F1F, 0x080806, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040404, 0x0F0F0B, 0x4A4C36,
+			0xC9CE92, 0xC7CC8F, 0xB7BD7C, 0x90945F, 0x40422B, 0x0D0D09, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x090907, 0x1B1B12, 0x797D50, 0xA0A56A, 0xC0C585, 0xC8CD90, 0xB7BB82, 0x212218,
+			0x070706, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x1D1E13, 0xA6AB6D, 0xB4BA77,
+			0xB9BE7A, 0xAAAF70, 0x939761, 0x46482E, 0x14150E, 0x060605, 0x050503, 0x020202, 0x020202, 0x040403,
+			0x0E0E0A, 0x515335, 0x929760, 0xB3B876, 0xBFC581, 0xBEC37D, 0x45472E, 0x080806, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030302, 0x15160F, 0x9EA36C, 0xC5CA89, 0xC1C784, 0xA6AB6D, 0x616440, 0x11120C,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020302, 0x0F100B, 0x5E613F, 0x9DA268, 0xB9BF7A,
+			0xBFC580, 0xBBC17C, 0x1D1E14, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x181911,
+			0xA6AB6D, 0xB3B977, 0xB9BE79, 0xA9AF70, 0x939761, 0x3D3E29, 0x0D0E0A, 0x050504, 0x030302, 0x020202,
+			0x070705, 0x1C1D13, 0x5F623F, 0x5F623F, 0x616441, 0x0E0E0A, 0x030303, 0x0C0D09, 0x5C5E3C, 0x5F623F,
+			0x5F623F, 0x3E402A, 0x0B0B08, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0A0A07,
+			0x353623, 0x999E65, 0xB6BB78, 0xBFC47F, 0xB9BF7A, 0x2B2C1D, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x040403, 0x10110B, 0x676A44, 0xB0B674, 0xBBC17C, 0xB4B977, 0x8B8F5B, 0x14150E,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0F100B,
+			0x666944, 0xAEB373, 0xBAC07B, 0xB4B977, 0x8C905C, 0x14150E, 0x030303, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030302, 0x0C0C09, 0x4B4D32, 0xA9AF70, 0xB8BD79, 0xB5BB78, 0x9B9F66, 0x1A1B12,
+			0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x10100B, 0x626440, 0xAFB473,
+			0xBBC07B, 0xB6BC79, 0x9BA066, 0x1C1C13, 0x030303, 0x030302, 0x020202, 0x020202, 0x020202, 0x030303,
+			0x10100B, 0x5E613E, 0x5F623F, 0x5F623F, 0x42442C, 0x0D0E0A, 0x030403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x0A0A07, 0x3B3D28, 0x999E65, 0xB6BB78, 0xBFC580, 0xB9BF7A, 0x343623, 0x070705,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x030303, 0x14150E, 0x6E7149, 0xB0B674, 0xBAC07B, 0xB4B977,
+			0x8F935E, 0x1E1F15, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x060605, 0x252518, 0xA6AB6D, 0xB4BA77, 0xB7BE79, 0xACB272, 0x555839, 0x10110B,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x030302, 0x0F0F0B, 0x4B4D37, 0xC9CE91, 0xC7CC90, 0xB7BD7C,
+			0x90945F, 0x44462E, 0x0F0F0A, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x080806,
+			0x212116, 0x7A7E51, 0xA0A56A, 0xBFC485, 0xC7CC8F, 0xB9BE84, 0x2B2D1F, 0x090907, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x080906, 0x2B2D1D, 0xA6AB6D, 0xB3B877, 0xB6BB79, 0xAAAF70, 0x939761, 0x555839,
+			0x1F1F15, 0x0A0A07, 0x040403, 0x020402, 0x020202, 0x070705, 0x191A11, 0x5C5F3D, 0x929760, 0xB1B676,
+			0xBEC380, 0xBEC37D, 0x5A5C3B, 0x10110B, 0x030302, 0x020202, 0x020202, 0x020302, 0x0B0B08, 0x494B31,
+			0xBAC07B, 0xC1C584, 0xBEC483, 0xA7AC6F, 0x333423, 0x0B0B08, 0x040404, 0x030303, 0x020202, 0x020202,
+			0x030303, 0x080806, 0x1A1B12, 0x565839, 0x5F623F, 0x606340, 0x191A11, 0x040404, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x050504, 0x212217, 0x7D8052, 0xAEB473, 0xAEB473, 0x929760, 0x2C2D1D, 0x080906,
+			0x030303, 0x10110B, 0x4B4D32, 0xA8AE6F, 0xB3B875, 0xB6BC78, 0xAEB372, 0x9A9F65, 0x2A2C1C, 0x070705,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040404,
+			0x1A1A12, 0x808359, 0xC1C788, 0xBDC282, 0xA5AA6C, 0x7B8051, 0x1E1F14, 0x060605, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x11120C, 0x575A39, 0x929760, 0xB2B877, 0xBEC584,
+			0xBFC483, 0x4E5035, 0x0D0D09, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x1D1D13,
+			0xA3A96B, 0xAFB472, 0xADB372, 0x979C63, 0x646641, 0x13140D, 0x070705, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x090907, 0x343522, 0x929760, 0xAAB070, 0xB7BD78, 0xB2B875, 0x555838, 0x090A07,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x1A1A11, 0xAEB271, 0xBCC27E, 0xB9BF7B, 0xA2A76A,
+			0x535537, 0x0B0B08, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0B0B08, 0x505336,
+			0x9DA267, 0xB1B774, 0xB5BB77, 0xADB271, 0x323421, 0x060605, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x17180F, 0xA3A96B, 0xAEB472, 0xACB271, 0x979C63, 0x626640, 0x12120C, 0x060604, 0x020202,
+			0x020202, 0x030302, 0x030303, 0x070705, 0x0C0C08, 0x0F100B, 0x0C0D09, 0x050504, 0x030303, 0x060605,
+			0x0C0D09, 0x0F100B, 0x0E0E0A, 0x090A07, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x060605, 0x242518, 0x9BA066, 0xB1B774, 0xB8BE79, 0xAEB472, 0x3D3F29, 0x090907, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0F100B, 0x656842, 0xABB170, 0xB6BD78, 0xB0B573,
+			0x878C59, 0x15160F, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x0E0E0A, 0x646842, 0xABB170, 0xB7BC78, 0xB0B573, 0x888C5A, 0x16160F, 0x040403, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0A0A07, 0x494B30, 0xA7AC6E, 0xB5BA76, 0xB1B774,
+			0x979B63, 0x191911, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0F0F0A,
+			0x5E623E, 0xAAAF6F, 0xB6BB77, 0xB2B774, 0x979B63, 0x1C1C12, 0x050503, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x060705, 0x0E0E09, 0x13140D, 0x11110C, 0x0C0C09, 0x060605, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030303, 0x070805, 0x2B2C1C, 0x9BA066, 0xB1B774, 0xB8BE79, 0xAEB472,
+			0x46482E, 0x0C0C09, 0x030303, 0x020202, 0x020202, 0x020202, 0x040403, 0x13140D, 0x6B6F47, 0xABB170,
+			0xB6BB77, 0xB0B573, 0x8B905B, 0x1C1D13, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x060604, 0x232518, 0xA3A96B, 0xB0B774, 0xB4BA76, 0xA8AD6E,
+			0x525436, 0x0F0F0A, 0x030302, 0x020202, 0x020202, 0x020202, 0x030303, 0x1A1B13, 0x818459, 0xC1C688,
+			0xBCC283, 0xA5AA6C, 0x7C8152, 0x1F2015, 0x080806, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x050605, 0x14140E, 0x5C5F3C, 0x929760, 0xB1B776, 0xBEC583, 0xBFC483, 0x585A3C, 0x0F0F0B,
+			0x030303, 0x020202, 0x020202, 0x030303, 0x050504, 0x2A2B1C, 0xA3A96B, 0xADB371, 0xABB271, 0x979C63,
+			0x6D7048, 0x202216, 0x090907, 0x040403, 0x020202, 0x020202, 0x020202, 0x040403, 0x10100B, 0x45482D,
+			0x929760, 0xA9AF6F, 0xB6BC77, 0xB2B875, 0x6A6D46, 0x16160F, 0x050504, 0x020202, 0x020202, 0x030303,
+			0x0F0F0A, 0x44472D, 0xA3A96B, 0xB3B877, 0xBCC280, 0xB9BD7F, 0x4C4E36, 0x181912, 0x070706, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030303, 0x0A0A07, 0x15160F, 0x1B1C13, 0x17170F, 0x0C0C09, 0x040504,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x060605, 0x202116, 0x787C4F, 0xABB070, 0xABB070, 0x858957,
+			0x26281A, 0x080806, 0x030303, 0x11120C, 0x484B2F, 0xA2A768, 0xADB270, 0xB2B873, 0xACB16F, 0x999D62,
+			0x2A2C1C, 0x090907, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x050504, 0x242519, 0xA5AA6D, 0xBBC07F, 0xB5BA78, 0x9CA164, 0x656942, 0x16170F, 0x040403,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0B0B08, 0x383A25, 0x8E935B,
+			0xA8AE6C, 0xB7BD79, 0xB9BE7A, 0x7C8050, 0x15150E, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x1C1D13, 0xA1A667, 0xABB16E, 0xA9AF6D, 0x959A60, 0x474A2E, 0x0A0A07, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x040403, 0x191A10, 0x94995F, 0xA7AC6C, 0xB0B672, 0xA9AF6D,
+			0x5B5F3B, 0x0D0D09, 0x030303, 0x020202, 0x020202, 0x030302, 0x040403, 0x272819, 0xA8AD6C, 0xB3B974,
+			0xB4BA74, 0xA3A969, 0x44472C, 0x0B0B07, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x030403,
+			0x090906, 0x44472C, 0xA0A567, 0xAEB36F, 0xACB16E, 0xA1A667, 0x30311F, 0x050504, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x040403, 0x181910, 0xA1A667, 0xABB16E, 0xA9AF6D, 0x959A60, 0x45472D, 0x0A0A07,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x030303, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020302, 0x050504, 0x191A11, 0xA6AB6A, 0xB2B873, 0xB3B974, 0xA7AD6B, 0x46482D,
+			0x080806, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0E0E0A, 0x626640, 0xA8AD6C,
+			0xB2B873, 0xACB26F, 0x858955, 0x13140D, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x11110C, 0x656841, 0xA8AD6C, 0xB3B973, 0xACB26F, 0x858955, 0x15150E,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x090A07, 0x47492E, 0xA4AA6A,
+			0xB1B772, 0xAEB470, 0x94985F, 0x181810, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x10100B, 0x5C603B, 0xA6AC6B, 0xB2B872, 0xADB370, 0x94985F, 0x191910, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x050504, 0x202115, 0xA6AB6A, 0xB1B773,
+			0xB3B974, 0xA7AD6B, 0x4D5032, 0x0E0E09, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x13130D,
+			0x696C44, 0xA8AD6C, 0xB2B772, 0xACB26F, 0x888C57, 0x1C1D12, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020302, 0x060604, 0x232518, 0xA1A667, 0xAEB46F,
+			0xB0B671, 0xA4AA6A, 0x515434, 0x0F0F0A, 0x030302, 0x020202, 0x020202, 0x020202, 0x050504, 0x222417,
+			0xA6AC6E, 0xBABF7E, 0xB4BA78, 0x9CA164, 0x676A43, 0x15160F, 0x050504, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x040404, 0x0D0D09, 0x3F4129, 0x8E935B, 0xA7AD6B, 0xB6BB79, 0xB8BD79,
+			0x868A57, 0x1C1D13, 0x030302, 0x020202, 0x020202, 0x020202, 0x050504, 0x28291A, 0xA1A667, 0xAAAF6D,
+			0xA7AE6B, 0x959A60, 0x565A37, 0x16160F, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303,
+			0x090906, 0x2A2B1C, 0x94995F, 0xA5AC6B, 0xAFB470, 0xA9AF6D, 0x6F7247, 0x191A11, 0x050503, 0x030302,
+			0x020202, 0x020202, 0x0B0B08, 0x323421, 0x8F935C, 0xA0A567, 0xB3B978, 0xBDC387, 0x999C72, 0x393A2C,
+			0x171813, 0x0A0A09, 0x060604, 0x020202, 0x020202, 0x020202, 0x030303, 0x050504, 0x050504, 0x040403,
+			0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x1E1F14, 0x707449, 0xA7AD6B,
+			0xA8AB6B, 0x818554, 0x232518, 0x070705, 0x040404, 0x10110B, 0x44462B, 0x9BA062, 0xA7AC6A, 0xAEB46E,
+			0xA9AF6B, 0x979B5F, 0x2C2D1C, 0x090906, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x0C0C08, 0x373823, 0xB1B771, 0xB4BA76, 0xADB36F, 0x979C60, 0x565937,
+			0x11110B, 0x060604, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504,
+			0x1C1D12, 0x878C55, 0xA0A565, 0xB0B571, 0xB2B772, 0x878B56, 0x17180F, 0x030302, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x040403, 0x1D1D13, 0x9CA163, 0xA7AD6A, 0xA8AE6A, 0x999E61, 0x42442A, 0x0A0A07,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x15160E, 0x888D56, 0xA5A968,
+			0xACB16C, 0xA2A867, 0x565A37, 0x0E0E09, 0x040403, 0x020202, 0x020202, 0x020202, 0x060604, 0x2C2D1C,
+			0x999F61, 0xA7AD6A, 0xAFB56E, 0xA6AC69, 0x505232, 0x0C0C08, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x0B0B07, 0x44462B, 0xA3A967, 0xABB06B, 0xA2A766, 0x93985D, 0x2C2D1C, 0x050504,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x15150E, 0x9CA163, 0xA8AD6A, 0xA8AE6A, 0x999E61,
+			0x404229, 0x0B0B08, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x030303, 0x030303, 0x030303, 0x020202, 0x060605, 0x1C1D13, 0xB2B874, 0xB3B975, 0xAFB56F,
+			0xA0A665, 0x43452B, 0x0B0B07, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0F0F0A,
+			0x60633D, 0xA3A967, 0xAEB36E, 0xA7AD6A, 0x818552, 0x14140D, 0x030303, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x10110B, 0x60633D, 0xA3A967, 0xAEB46E, 0xA7AD6A,
+			0x818652, 0x16160E, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0B0B07,
+			0x47492D, 0xA0A665, 0xADB26D, 0xA9AF6B, 0x8F945B, 0x191A10, 0x030403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x0F0F0A, 0x5A5D39, 0xA2A766, 0xADB36E, 0xA9AE6B, 0x8F945B, 0x1A1A11,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x020202, 0x060605, 0x040404, 0x070705, 0x232417,
+			0xB2B874, 0xB3B975, 0xAFB56F, 0xA0A665, 0x4C4F30, 0x0E0E09, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x13140D, 0x666A41, 0xA3A967, 0xADB36D, 0xA7AD6A, 0x858954, 0x1A1B11, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x222316,
+			0x9CA163, 0xA9AF6B, 0xABB16C, 0xA0A565, 0x4E5032, 0x0F0F0A, 0x040403, 0x020202, 0x020202, 0x040403,
+			0x090906, 0x363822, 0xB1B771, 0xB4B975, 0xAEB36F, 0x979C60, 0x585B38, 0x12130C, 0x040402, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x070705, 0x242517, 0x898E57, 0xA0A565,
+			0xAFB470, 0xB1B771, 0x8E935A, 0x1F2014, 0x040403, 0x030302, 0x020202, 0x030303, 0x070705, 0x27291A,
+			0x9CA163, 0xA6AC69, 0xA6AB69, 0x999E61, 0x505333, 0x13140D, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x050504, 0x262818, 0x8C9159, 0xA4A967, 0xA9AF6C, 0xA2A867, 0x696D43, 0x181910,
+			0x060604, 0x020202, 0x020202, 0x020202, 0x060605, 0x1F2014, 0x6F7345, 0x818552, 0x9DA165, 0xB3B87C,
+			0xC2C490, 0xABAE87, 0x515241, 0x2D2D25, 0x171813, 0x0D0E0B, 0x050505, 0x050504, 0x040404, 0x020302,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040504, 0x1C1D12,
+			0x6C7045, 0xA3A967, 0xA3A767, 0x74784A, 0x212216, 0x070705, 0x030303, 0x0A0A07, 0x373923, 0x93985B,
+			0xA0A563, 0xA9AF69, 0xA5AB68, 0x999E5F, 0x2C2D1B, 0x080806, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x10110B, 0x525533, 0xA8AE68, 0xADB36E, 0xA7AD69,
+			0x959A5D, 0x47492C, 0x0F0F0A, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x060604, 0x191A10, 0x7B804D, 0x9A9F60, 0xAAB06A, 0xAAB06B, 0x969A5D, 0x1A1B11, 0x030303,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x1B1C11, 0x989D5E, 0xA5AA66, 0xA6AC67, 0x999E5F,
+			0x414329, 0x0A0A07, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x15160E,
+			0x888D55, 0xA1A765, 0xA7AD68, 0x9DA362, 0x535634, 0x0D0E09, 0x030403, 0x020202, 0x020202, 0x020202,
+			0x040504, 0x15160E, 0x8A8F56, 0x989E5F, 0xA8AE69, 0xA9AF69, 0x65683F, 0x0F0F0A, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x0A0B07, 0x525433, 0xA7AD68, 0xA5AB66, 0x93985B, 0x80844F,
+			0x13140C, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x16170F, 0x989D5E, 0xA4AA66,
+			0xA6AC67, 0x999E5F, 0x404228, 0x090906, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302,
+			0x020202, 0x040404, 0x070706, 0x0E0F0C, 0x11110D, 0x141410, 0x191913, 0x1E1E16, 0x2B2C1E, 0xB5BA7C,
+			0xB1B776, 0xAAB06B, 0x9BA161, 0x42442A, 0x090906, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x0F0F0A, 0x5E613A, 0x9FA463, 0xA9AF69, 0xA3A865, 0x7D814D, 0x14140D, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0F0F0A, 0x5F623B, 0x9FA463,
+			0xA9AF69, 0xA3A865, 0x7E824E, 0x16170E, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x0A0A07, 0x45472B, 0x9CA161, 0xA8AE68, 0xA4AA66, 0x8B9056, 0x191A10, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0F0F0A, 0x575B37, 0x9DA362, 0xA8AE69, 0xA4AA66,
+			0x8C9056, 0x1A1B10, 0x050503, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x030303, 0x050504, 0x080807, 0x141410, 0x171712, 0x1A1B15, 0x1F2018,
+			0x25261B, 0x373826, 0xB5BA7C, 0xB2B775, 0xAAB06B, 0x9BA161, 0x494C2E, 0x0D0D09, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x11120B, 0x64683E, 0x9FA463, 0xA8AE68, 0xA3A865, 0x808550, 0x1A1B11,
+			0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040404, 0x222316, 0x989D5E, 0xA4AA66, 0xA7AC68, 0x9BA161, 0x4C4E2F, 0x10100A, 0x030303, 0x020202,
+			0x020202, 0x030303, 0x0F100A, 0x535634, 0xA8AE68, 0xADB26D, 0xA7AC68, 0x959A5D, 0x4A4C2F, 0x10100B,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060604, 0x1E1F14,
+			0x7E834F, 0x9A9F60, 0xA9AF6A, 0xAAB06A, 0x989D5E, 0x242517, 0x070704, 0x020202, 0x020202, 0x020202,
+			0x070705, 0x272919, 0x989D5E, 0xA3A965, 0xA4A966, 0x999E5F, 0x505332, 0x12120C, 0x050503, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x252718, 0x8C9158, 0xA1A664, 0xA6AA67, 0x9DA362,
+			0x666A40, 0x18190F, 0x050504, 0x020202, 0x020202, 0x020202, 0x040403, 0x11110B, 0x404228, 0x63673E,
+			0x747848, 0x929860, 0xACB179, 0xBDC090, 0xC8CC9E, 0x9FA181, 0x5D5F4D, 0x32322A, 0x1D1E18, 0x0C0C0A,
+			0x070706, 0x060606, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x181910, 0x61643C, 0x9CA161, 0x9CA161, 0x6F7245, 0x202114, 0x080805, 0x030303, 0x0A0A06,
+			0x2A2C1A, 0x8B9155, 0x979C5C, 0xA3A863, 0xA3A964, 0x9CA15F, 0x2D2F1C, 0x090906, 0x040402, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x14140C, 0x5E613A, 0x9FA561,
+			0xA6AC67, 0xA1A763, 0x929759, 0x434529, 0x0D0D08, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x040404, 0x17180F, 0x757948, 0x969B5C, 0xA3AA65, 0xA3A964, 0x92985A,
+			0x1B1C11, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x1A1C11, 0x93995A, 0xA0A561,
+			0xA2A863, 0x969B5C, 0x3F4127, 0x090A07, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x15160E, 0x868B52, 0x9EA561, 0xA4AA63, 0x999E5D, 0x525532, 0x0B0B07, 0x020302, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x10110B, 0x6A6E41, 0x868A52, 0x9DA461, 0xA8AE6B, 0x727649, 0x14150E,
+			0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x11120C, 0x717548, 0xA7AD69, 0x9A9F5E,
+			0x80854E, 0x5C5F38, 0x0E0F09, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x15160E,
+			0x93995A, 0x9FA662, 0xA2A863, 0x969B5C, 0x3E4026, 0x080805, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x050505, 0x0A0A08, 0x12130F, 0x191A14, 0x303025, 0x777A5C, 0x77795A, 0x7D7F5E, 0xB9BD8B, 0xB3B882,
+			0xADB276, 0xAAAF6E, 0xA9AF6B, 0xA3A964, 0x979C5C, 0x404328, 0x0A0A07, 0x030302, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x0C0C08, 0x5B5E37, 0x9A9F5E, 0xA4AA64, 0x9EA460, 0x797E4A, 0x11120B,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0F100A,
+			0x5C6038, 0x9A9F5E, 0xA3A964, 0x9EA460, 0x7A7F4B, 0x14150D, 0x020302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x0A0A06, 0x434529, 0x979D5C, 0xA3A964, 0x9FA562, 0x868C52, 0x16170F,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0C0D08, 0x555834, 0x999E5D,
+			0xA3AA64, 0x9FA562, 0x878D53, 0x18180F, 0x040404, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x030303, 0x050505, 0x0C0C0A, 0x171712, 0x20211A, 0x38382B, 0x7B7D5E, 0x7B7D5D,
+			0x828561, 0xB6BA89, 0xB1B580, 0xAAB074, 0xA9AE6E, 0xA9AF6B, 0xA3A964, 0x979C5C, 0x47492B, 0x0C0C08,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x030303, 0x10110B, 0x60643B, 0x9A9F5E, 0xA3A864, 0x9EA460,
+			0x7C814C, 0x191A10, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x060604, 0x212315, 0x93995A, 0xA0A662, 0xA2A762, 0x979C5C, 0x4A4D2D, 0x0E0E09,
+			0x030302, 0x020202, 0x020202, 0x050504, 0x12130C, 0x60633B, 0x9FA561, 0xA5AC66, 0xA0A662, 0x929759,
+			0x484A2C, 0x0E0E09, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x050504, 0x1D1D12, 0x797D4A, 0x969B5C, 0xA3A864, 0xA2A863, 0x959B5B, 0x252617, 0x050504, 0x020202,
+			0x020202, 0x020202, 0x050604, 0x252617, 0x93995A, 0x9EA461, 0xA1A662, 0x969B5C, 0x4F5331, 0x10110A,
+			0x060604, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060605, 0x262718, 0x8A8F55, 0x9EA360,
+			0xA2A762, 0x999E5D, 0x62663D, 0x18190F, 0x050504, 0x020202, 0x020202, 0x020202, 0x030302, 0x080805,
+			0x15150D, 0x3A3C24, 0x535633, 0x61643B, 0x818650, 0x9DA26A, 0xB2B582, 0xBEC192, 0xC7CCA0, 0xAEB08E,
+			0x74765F, 0x37372C, 0x1D1E18, 0x0B0B0A, 0x040403, 0x030403, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x050504, 0x14150E, 0x515432, 0x8C9055, 0x8C9155, 0x60643B, 0x1A1B10, 0x060604,
+			0x020202, 0x070705, 0x252717, 0x7C814A, 0x8E9355, 0x9BA15D, 0x9EA460, 0x9AA05C, 0x424427, 0x0D0D08,
+			0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x12130C,
+			0x606439, 0x969B5A, 0x9FA560, 0x9DA35E, 0x919657, 0x353720, 0x0A0B07, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x15150D, 0x6A6E40, 0x939958, 0x9EA45F,
+			0x9BA05C, 0x909656, 0x1C1E12, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x1A1B10,
+			0x8F9456, 0x9CA25D, 0x9DA35E, 0x929857, 0x3E4126, 0x090A06, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030302, 0x15160E, 0x83874F, 0x9AA05D, 0x9FA55F, 0x949A59, 0x4E522F, 0x0B0C08,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x0A0A07, 0x424528, 0x707443, 0x8A8F53, 0xA3A866,
+			0xA5AB6F, 0x2A2C1E, 0x0B0B09, 0x030303, 0x040404, 0x030303, 0x020202, 0x080806, 0x1C1D13, 0x9CA167,
+			0xA0A662, 0x84894F, 0x6B6F40, 0x353720, 0x080805, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x16170E, 0x8F9456, 0x9BA15D, 0x9DA35E, 0x929857, 0x3C3F25, 0x090A06, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040404, 0x0D0E0B, 0x161712, 0x3C3D30, 0x7A7C61, 0xC0C394, 0xB4B884, 0xAAB074, 0x9EA460, 0x8F9456,
+			0x82874E, 0x7D814B, 0x80854D, 0x8B9053, 0x999F5C, 0x9BA15D, 0x929857, 0x3E4026, 0x080806, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x0E0E09, 0x575B35, 0x959B59, 0x9FA55F, 0x999F5C,
+			0x767A47, 0x11120B, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x0F0F09, 0x595C35, 0x959B59, 0x9FA55F, 0x999F5C, 0x767A47, 0x12130C, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x090A06, 0x414428, 0x939858, 0x9EA35F, 0x9BA05D,
+			0x83884F, 0x16170E, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040402, 0x0D0D09,
+			0x535632, 0x949A59, 0x9FA55F, 0x9BA05D, 0x83884F, 0x18180F, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x050504, 0x0D0D0A, 0x191A15, 0x434436, 0x7F8264, 0xBCBF91, 0xB2B682,
+			0xA9AE73, 0x9EA460, 0x8F9456, 0x82874E, 0x7D814B, 0x80854D, 0x8B9053, 0x9A9F5C, 0x9BA15D, 0x929857,
+			0x45472A, 0x0C0C08, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x12120B, 0x5E6138, 0x959B59,
+			0x9EA45F, 0x999F5C, 0x797E49, 0x191B10, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x212214, 0x8F9456, 0x9BA05D, 0x9DA25D, 0x929857,
+			0x484A2B, 0x0E0E09, 0x030303, 0x020202, 0x020202, 0x040403, 0x13140C, 0x62663B, 0x969B5A, 0x9EA55F,
+			0x9CA25E, 0x919657, 0x383A22, 0x0A0B07, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x050504, 0x1A1B10, 0x6E7242, 0x939958, 0x9CA35E, 0x9A9F5C, 0x909656, 0x232516,
+			0x050504, 0x030302, 0x020202, 0x020202, 0x060604, 0x252617, 0x8F9456, 0x9AA05D, 0x9CA25D, 0x929857,
+			0x4D4F2E, 0x10110A, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x232416,
+			0x878B51, 0x9A9E5C, 0x9EA45E, 0x949A59, 0x5E6239, 0x16170E, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x070705, 0x12130C, 0x2E301C, 0x4B4E2C, 0x515430, 0x61643A, 0x80854D, 0x999D65,
+			0xACB07C, 0xBABE8D, 0xC3C699, 0xAEB18C, 0x70735A, 0x2D2E24, 0x11110E, 0x050504, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x11120B, 0x44462A, 0x727644, 0x717544, 0x4D4E2E,
+			0x14140D, 0x030303, 0x020202, 0x060604, 0x1F2012, 0x6E7140, 0x85894E, 0x959A58, 0x9BA15C, 0x9BA05A,
+			0x535631, 0x14140C, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x11110B, 0x5B5E35, 0x8F9353, 0x9A9E5A, 0x9A9F59, 0x909554, 0x3C3D23, 0x0A0A06, 0x030303,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x15150C, 0x696C3D,
+			0x939756, 0x999E5A, 0x929755, 0x888C4F, 0x191B0F, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x191A0F, 0x8B9051, 0x989D59, 0x9A9E5A, 0x8F9353, 0x3E4025, 0x0A0B07, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x13140C, 0x7F844A, 0x969C58, 0x9BA05A, 0x909554,
+			0x4C4F2D, 0x0B0B07, 0x040402, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x15160D, 0x585B33,
+			0x717542, 0x959A58, 0xAAAE72, 0x81855E, 0x1D1E16, 0x0D0D0A, 0x080806, 0x070706, 0x0B0B09, 0x171710,
+			0x6D6F4C, 0xA1A567, 0x85894F, 0x64683A, 0x4A4C2B, 0x0D0D09, 0x040503, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x040403, 0x15150D, 0x8B9051, 0x979C58, 0x9A9E5A, 0x8F9353, 0x3C3F23, 0x080805,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x040404, 0x0E0F0C, 0x3A3B2E, 0x969878, 0xBFC293, 0xAFB47E, 0x989D59, 0x787C46, 0x4A4D2D,
+			0x3C3E24, 0x292B19, 0x15160D, 0x15150D, 0x1F2013, 0x767945, 0x8E9253, 0x959A57, 0x8F9353, 0x3C3E23,
+			0x0A0A06, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0E0F09, 0x555932, 0x929655,
+			0x9BA05B, 0x959A57, 0x727643, 0x14140C, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x0E0F09, 0x565933, 0x929655, 0x9CA15B, 0x969B57, 0x747744, 0x14150C,
+			0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x080906, 0x404226, 0x8F9453,
+			0x999F5A, 0x969C58, 0x80844A, 0x16170D, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x0E0F09, 0x50532F, 0x909554, 0x9B9F5A, 0x969B58, 0x80844A, 0x17180E, 0x040403, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040404, 0x141510, 0x3E3F31, 0x999C7B, 0xBCBF91, 0xACB17C,
+			0x989D59, 0x787C46, 0x4E502E, 0x404226, 0x2F301C, 0x1B1C11, 0x191A10, 0x272918, 0x767945, 0x8E9253,
+			0x959A57, 0x8F9353, 0x434527, 0x0C0C08, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x11110A,
+			0x5C5F35, 0x929655, 0x9A9F5A, 0x959A57, 0x757944, 0x18190F, 0x060604, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050503, 0x1E2012, 0x8B9051, 0x979C58,
+			0x999E59, 0x8F9353, 0x474929, 0x0D0D08, 0x040403, 0x020202, 0x020202, 0x030302, 0x14140C, 0x5E6136,
+			0x8F9353, 0x989D5A, 0x999E59, 0x909554, 0x404226, 0x0C0C08, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x191A0F, 0x6E7240, 0x939756, 0x989E59, 0x929755,
+			0x888C4F, 0x212114, 0x060604, 0x030302, 0x020202, 0x020202, 0x070705, 0x242616, 0x8B9051, 0x969B58,
+			0x979C59, 0x8F9353, 0x4C4E2C, 0x12120B, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x060604, 0x232516, 0x83884C, 0x959957, 0x989D59, 0x909554, 0x5C6037, 0x15160D, 0x060604, 0x030302,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x070705, 0x0C0C08, 0x17180E, 0x353720, 0x494B2A,
+			0x4F512E, 0x595C34, 0x787B46, 0x94985B, 0xA9AC78, 0xB7BB8B, 0xBEC396, 0x939672, 0x323327, 0x11110D,
+			0x040404, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0B0B07, 0x2A2B19, 0x5A5D34,
+			0x595B34, 0x373920, 0x0D0E08, 0x030303, 0x020202, 0x050504, 0x16170E, 0x5A5E34, 0x7C8147, 0x8D9252,
+			0x979D58, 0x999F58, 0x696D3C, 0x19190F, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x10100A, 0x4F522D, 0x868B4C, 0x939854, 0x959B55, 0x8E9452, 0x434627,
+			0x0C0C08, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040402,
+			0x15150C, 0x6E723F, 0x919753, 0x949A55, 0x898E4E, 0x747943, 0x15170D, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x18190F, 0x868B4D, 0x929854, 0x949A55, 0x898F4E, 0x3B3E22, 0x090A06,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x13130B, 0x7B7F47, 0x909753,
+			0x959B55, 0x8B904F, 0x4A4D2B, 0x0C0C08, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303,
+			0x080906, 0x242515, 0x666A3A, 0x7E8348, 0x989D5B, 0xA7AC72, 0x8A8E65, 0x4E4F3B, 0x202016, 0x1A1B13,
+			0x373829, 0x7C805A, 0x9AA064, 0x7D8249, 0x5B5E34, 0x434726, 0x14150C, 0x060604, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020302, 0x15150D, 0x868B4D, 0x929854, 0x949A55, 0x898F4E,
+			0x3A3C22, 0x090A06, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x0C0D09, 0x434432, 0xB3B78A, 0xB6BA86, 0xA1A667, 0x777C44, 0x3D3F24,
+			0x15150D, 0x0D0E09, 0x0A0A07, 0x060604, 0x040403, 0x040403, 0x14140C, 0x767B44, 0x8A904F, 0x919653,
+			0x898F4E, 0x3B3D22, 0x090906, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0C0D08,
+			0x52552F, 0x8C9250, 0x969C56, 0x909653, 0x707440, 0x12130B, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0E0E09, 0x535630, 0x8C9250, 0x969C57, 0x919753,
+			0x707440, 0x12120B, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x090906,
+			0x3E4124, 0x8A904F, 0x959B55, 0x919754, 0x7B8047, 0x14150C, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x040402, 0x0F0F09, 0x4E502D, 0x8B904F, 0x959B55, 0x919753, 0x7B8047, 0x18190E,
+			0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x10100C, 0x474935, 0xB4B78A, 0xB4B986,
+			0x9FA567, 0x777C44, 0x414326, 0x1A1B10, 0x0F0F0A, 0x0C0C08, 0x080805, 0x050504, 0x070705, 0x1B1C10,
+			0x767B44, 0x8A904F, 0x919653, 0x898F4E, 0x404225, 0x0B0B07, 0x030303, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x11120B, 0x595C33, 0x8C9250, 0x959B55, 0x909653, 0x727641, 0x191A0F, 0x040403, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050503, 0x1D1E11,
+			0x868B4D, 0x929753, 0x939955, 0x898F4E, 0x444728, 0x0D0D08, 0x040403, 0x020202, 0x020202, 0x030403,
+			0x11120B, 0x51542F, 0x868B4C, 0x929753, 0x959B55, 0x8E9452, 0x484B2A, 0x0E0F09, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x191B0F, 0x737742, 0x919653,
+			0x929854, 0x898E4E, 0x767A43, 0x1D1F11, 0x050604, 0x020202, 0x020202, 0x020202, 0x070705, 0x232415,
+			0x868B4D, 0x919653, 0x939954, 0x898F4E, 0x494C2A, 0x10110A, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x070705, 0x212214, 0x7E8349, 0x909652, 0x939954, 0x8B904F, 0x5A5D33, 0x14150C,
+			0x060603, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x040403, 0x070705,
+			0x0E0F09, 0x17170E, 0x2C2E19, 0x3F4224, 0x4C4F2B, 0x585B32, 0x7A7F46, 0x999E64, 0xACB27B, 0xB4B985,
+			0x8F9469, 0x2B2D1F, 0x0F0F0B, 0x040404, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504,
+			0x0E0E09, 0x17180E, 0x18180F, 0x0F100A, 0x060604, 0x030302, 0x020202, 0x040403, 0x10110A, 0x444726,
+			0x737740, 0x84894A, 0x929754, 0x969C57, 0x7B8045, 0x1F2012, 0x060705, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040404, 0x040404, 0x040404,
+			0x040404, 0x030303, 0x030303, 0x020202, 0x040403, 0x0D0E08, 0x424525, 0x7D8245, 0x8B914E, 0x929752,
+			0x8D934F, 0x4C502B, 0x0D0D08, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x040403, 0x17170D, 0x737840, 0x8F9650, 0x8E944F, 0x7F8447, 0x676A3A, 0x12120B, 0x030303,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x16170D, 0x828748, 0x8D934F, 0x8F9550, 0x858A4A,
+			0x3B3D21, 0x090906, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030403, 0x12130B,
+			0x777C42, 0x8C914E, 0x909650, 0x868C4B, 0x484A28, 0x0A0B07, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x050504, 0x0B0C07, 0x2E2F1A, 0x626737, 0x737740, 0x7D8245, 0x8C9150, 0x989D64,
+			0xA0A46E, 0xA0A56F, 0x979C63, 0x878C4D, 0x686D3A, 0x4D502B, 0x35371E, 0x11110A, 0x060604, 0x030302,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x14150C, 0x828748, 0x8D934F,
+			0x8F9550, 0x858A4A, 0x383A1F, 0x0A0A06, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x070705, 0x26271B, 0x9EA171, 0xADB27D, 0x9B9F60, 0x72763F,
+			0x292B18, 0x0C0C08, 0x050504, 0x030302, 0x020202, 0x020202, 0x020202, 0x040403, 0x14150C, 0x7F8447,
+			0x8B914E, 0x8E944F, 0x858A4A, 0x393B20, 0x0A0A06, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x0C0D08, 0x51542D, 0x878D4C, 0x929852, 0x8D934F, 0x6D713D, 0x10110A, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0D0E08, 0x50542D, 0x878D4C,
+			0x929852, 0x8E944F, 0x6E733E, 0x13140B, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x0A0B07, 0x3D4023, 0x898E4C, 0x929852, 0x8E934F, 0x777C42, 0x15160D, 0x050504, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x0E0E08, 0x4B4E2A, 0x868C4B, 0x909550, 0x8C914E,
+			0x777C42, 0x15160D, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x080806, 0x2B2D1E, 0x9FA371,
+			0xACB17A, 0x9B9F60, 0x72763F, 0x2D2F1A, 0x0F0F09, 0x060605, 0x040402, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x19190E, 0x7F8447, 0x8B914D, 0x8E944F, 0x858A4A, 0x3E4123, 0x0B0C07, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x11110A, 0x565930, 0x878D4C, 0x919751, 0x8D934F, 0x6F733E, 0x16170D,
+			0x060604, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x1D1E11, 0x828748, 0x8C924E, 0x8F954F, 0x858A4A, 0x424425, 0x0D0D08, 0x020202, 0x020202,
+			0x020202, 0x040403, 0x0E0F09, 0x454827, 0x7D8245, 0x8A904D, 0x909651, 0x8D934F, 0x50532D, 0x11110A,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x1C1D10,
+			0x777C42, 0x8F944F, 0x8C924E, 0x7F8447, 0x6B6E3C, 0x18190E, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x060704, 0x222314, 0x828748, 0x8C924E, 0x8E934F, 0x858A4A, 0x454827, 0x0E0F09, 0x040403, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x060705, 0x212213, 0x7A7F44, 0x8B914D, 0x8F954F, 0x868C4B,
+			0x575B30, 0x14150C, 0x050503, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x050503, 0x060604, 0x0C0C07, 0x13130B, 0x232414, 0x3D4022, 0x4E522C, 0x6E723D,
+			0x929857, 0xA3A86F, 0xA7AB72, 0x6C7048, 0x1A1B11, 0x050504, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x030303, 0x050504, 0x060604, 0x040403, 0x020202, 0x030302, 0x020202, 0x030302,
+			0x0A0A06, 0x282916, 0x696D39, 0x777C40, 0x898F4C, 0x929754, 0x8D9351, 0x2A2B19, 0x0A0B07, 0x030502,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050505,
+			0x141510, 0x21221A, 0x24251D, 0x151510, 0x090907, 0x020202, 0x020202, 0x090906, 0x31331C, 0x73783F,
+			0x828747, 0x8D934E, 0x8D934C, 0x5B5E32, 0x11110A, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x040403, 0x1A1A0F, 0x7F8445, 0x8D924D, 0x868C49, 0x757A3F, 0x4B4E28,
+			0x0F0F09, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x040503, 0x16170D, 0x7D8344, 0x898E4A,
+			0x8B904B, 0x808545, 0x37391E, 0x090906, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x12130B, 0x72783E, 0x878D4A, 0x8B914B, 0x828746, 0x454725, 0x0B0B07, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x12120C, 0x3E4023, 0x71763D, 0x51552C, 0x34361C,
+			0x474A26, 0x53562D, 0x5A5E31, 0x5B5F32, 0x55582E, 0x3E4122, 0x2D2F19, 0x18190E, 0x090A06, 0x050504,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x14140B,
+			0x7D8344, 0x888E4A, 0x8A904B, 0x808545, 0x36391E, 0x090906, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0D0D09, 0x5F623D, 0xA0A56B, 0x9CA266,
+			0x7F8445, 0x414323, 0x0D0D08, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403,
+			0x15160D, 0x858A48, 0x8D924D, 0x8B914C, 0x808545, 0x37391E, 0x080805, 0x030302, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020302, 0x0C0C07, 0x4D502A, 0x838847, 0x8D934E, 0x8B914B, 0x6B703A, 0x13130B,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0D0E08,
+			0x4D502A, 0x828746, 0x8D934E, 0x8C914C, 0x73783E, 0x14150C, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x0B0B07, 0x3D4022, 0x8A904B, 0x909651, 0x898F4A, 0x73783F, 0x14140B,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0B0B07, 0x494C28, 0x828746,
+			0x8B914B, 0x878D4A, 0x73783F, 0x14150C, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x10100A,
+			0x646740, 0x9FA46A, 0x9CA165, 0x7F8445, 0x464825, 0x101009, 0x040503, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x060604, 0x1B1D0F, 0x858A48, 0x8D924D, 0x8B914C, 0x808545, 0x3C3F21, 0x0B0B07,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x101009, 0x52552D, 0x838847, 0x8C924D, 0x8A904B,
+			0x6E723B, 0x17180D, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030302, 0x040404, 0x1B1C0F, 0x7D8344, 0x888D4A, 0x8A904B, 0x808545, 0x3F4223, 0x0D0D08,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x090906, 0x33341C, 0x73783F, 0x818746, 0x8B914D, 0x8C934C,
+			0x5E6234, 0x15150C, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020302,
+			0x080804, 0x1F2011, 0x818646, 0x8C924C, 0x868A48, 0x757A3F, 0x52552D, 0x14150C, 0x050503, 0x020202,
+			0x020202, 0x020202, 0x050504, 0x222313, 0x7D8344, 0x888D4A, 0x898F4A, 0x808545, 0x444725, 0x0E0F09,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060604, 0x202112, 0x767B40, 0x878C49,
+			0x89904B, 0x828746, 0x55582E, 0x14140B, 0x050503, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302,
+			0x020202, 0x030302, 0x020202, 0x020202, 0x030302, 0x020202, 0x030403, 0x060604, 0x0A0A06, 0x14140C,
+			0x31321B, 0x575B2F, 0x757A3F, 0x8E9456, 0x969B5C, 0x878C50, 0x252616, 0x060605, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x030303, 0x020202, 0x020202, 0x030302, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x030302, 0x050504, 0x18190D, 0x53562C, 0x686C36, 0x7D8242, 0x8C924F, 0x919655, 0x4E512E,
+			0x12130C, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x10110D, 0x4A4C38, 0xBABD93, 0xB6BA8F, 0x606245, 0x0E0F0A, 0x040403, 0x020202, 0x060604,
+			0x1E2011, 0x696D37, 0x757A3E, 0x868B47, 0x8C924D, 0x6F743C, 0x15160C, 0x040403, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x070705, 0x252615, 0x8A9049, 0x898E4A, 0x7C8142,
+			0x696E37, 0x3B3D1F, 0x0B0C07, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x15160C,
+			0x797E40, 0x848A46, 0x868B46, 0x7C8141, 0x35371D, 0x080905, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x13140B, 0x6F733B, 0x838845, 0x868C46, 0x7D8342, 0x434724, 0x0B0C07,
+			0x030403, 0x020202, 0x020202, 0x020202, 0x030302, 0x040403, 0x10110C, 0x575B3C, 0x999E62, 0x72783C,
+			0x242613, 0x0B0B07, 0x0C0C07, 0x0D0E08, 0x0D0E08, 0x0E0F09, 0x0D0D08, 0x0B0B07, 0x070805, 0x040503,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x13140B, 0x797F40, 0x848A45, 0x858B46, 0x7C8141, 0x34361C, 0x080805, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x12130B, 0x808545,
+			0x939958, 0x8E9452, 0x787D3F, 0x30321A, 0x080805, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x080805, 0x232514, 0x898F49, 0x8C924E, 0x878D48, 0x7C8141, 0x36381D, 0x090906, 0x030302,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0B0B07, 0x494D27, 0x7C8141, 0x888E48, 0x888E49,
+			0x767C3E, 0x13130B, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x0B0C07, 0x484C27, 0x7A8040, 0x888E48, 0x8A904B, 0x797D3F, 0x16170D, 0x060604, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0F1009, 0x595C31, 0x8E934F, 0x8E9451, 0x858B46,
+			0x6F753B, 0x13140B, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030402, 0x0C0D07,
+			0x474A25, 0x7D8342, 0x868C46, 0x838845, 0x6F743B, 0x14150C, 0x030303, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x15160C, 0x818646, 0x939858, 0x8E9452, 0x787D3F, 0x36381C, 0x0A0B06, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x060705, 0x292A17, 0x898F49, 0x8D924E, 0x878D48, 0x7C8141,
+			0x3A3D1F, 0x0A0B06, 0x030303, 0x020202, 0x020202, 0x020202, 0x030303, 0x101009, 0x4D5129, 0x7C8141,
+			0x888D48, 0x888E48, 0x787D3F, 0x191A0E, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x060604, 0x1C1D10, 0x797F40, 0x838945, 0x858A45, 0x7C8141,
+			0x3D4021, 0x0C0D07, 0x020202, 0x020202, 0x020202, 0x020202, 0x070704, 0x202212, 0x696D37, 0x757A3E,
+			0x858A47, 0x8B914C, 0x72773E, 0x1A1B0F, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030302, 0x0B0C07, 0x2F301A, 0x8A9049, 0x888D4A, 0x7B8141, 0x696E37, 0x414523, 0x0F0F09,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x060604, 0x202112, 0x797E40, 0x838845, 0x848A45, 0x7C8141,
+			0x414523, 0x0F1009, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060604, 0x1F2011,
+			0x72773C, 0x828844, 0x848A46, 0x7D8342, 0x50542B, 0x14150B, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x050605, 0x070706, 0x080806, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x080805, 0x16170C, 0x444724, 0x696E37, 0x7F8545, 0x878C48, 0x7F8542, 0x252715, 0x080805,
+			0x030302, 0x020202, 0x020202, 0x030303, 0x020202, 0x050504, 0x090907, 0x0A0A08, 0x0C0C0A, 0x080807,
+			0x080806, 0x030303, 0x020202, 0x020202, 0x050503, 0x0E0F08, 0x35371B, 0x595D2D, 0x6C7137, 0x818744,
+			0x8E9354, 0x737847, 0x1E1F13, 0x070705, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x060605, 0x1B1C14, 0x767A54, 0xAEB283, 0xA6AB77, 0x5A5D38, 0x12130C, 0x050504,
+			0x030303, 0x040403, 0x111209, 0x4B4F27, 0x666B34, 0x7C803F, 0x898F4C, 0x878C4D, 0x1F2013, 0x050604,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0D0E08, 0x494C2A, 0x8A8F4C,
+			0x808642, 0x6C7137, 0x5D612F, 0x1A1B0E, 0x050504, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x14150B, 0x767B3C, 0x808541, 0x818742, 0x777C3C, 0x33361B, 0x090905, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x101009, 0x6B7036, 0x7E8440, 0x828842, 0x797E3D,
+			0x414321, 0x0A0B06, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x090A06, 0x393A26, 0xA2A771,
+			0x9FA36D, 0x55592E, 0x101009, 0x040403, 0x030302, 0x030302, 0x030302, 0x030303, 0x020202, 0x020202,
+			0x030302, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030403, 0x13130A, 0x767B3C, 0x7F8541, 0x818642, 0x777C3C, 0x32341A, 0x070705,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403,
+			0x13140B, 0x7C813F, 0x868B46, 0x878E4A, 0x7D823F, 0x272814, 0x070805, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x040403, 0x0E0F09, 0x4F532F, 0x8A904D, 0x898F4C, 0x828842, 0x777C3C, 0x33341A,
+			0x070805, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0B0C07, 0x444623, 0x72783A,
+			0x818742, 0x888E49, 0x7F8540, 0x18190E, 0x050504, 0x020202, 0x020202, 0x020202, 0x030303, 0x020202,
+			0x030303, 0x020202, 0x020202, 0x0B0B06, 0x3E4120, 0x71773A, 0x818642, 0x888F4C, 0x868C47, 0x252615,
+			0x070705, 0x030302, 0x020202, 0x020202, 0x020202, 0x030303, 0x070705, 0x1A1B10, 0x777B46, 0x8C9250,
+			0x8A904E, 0x7F8541, 0x6C7137, 0x13140B, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x0C0C07, 0x444722, 0x797E3D, 0x828742, 0x7F8540, 0x6C7036, 0x14150B, 0x040403, 0x020202,
+			0x020202, 0x020202, 0x040403, 0x18190D, 0x7C813F, 0x868B46, 0x878D4A, 0x7D823F, 0x2B2D16, 0x090A06,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x11120B, 0x545831, 0x8A904D, 0x898F4B,
+			0x828842, 0x777C3C, 0x393B1E, 0x0B0B06, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0E0E08,
+			0x484C25, 0x72783A, 0x808642, 0x878D48, 0x808641, 0x1F2111, 0x060705, 0x030302, 0x020202, 0x030303,
+			0x040403, 0x020202, 0x030303, 0x030303, 0x020202, 0x020202, 0x040403, 0x1B1D0F, 0x767B3C, 0x7F8440,
+			0x808641, 0x777C3C, 0x3C3E1F, 0x0B0C07, 0x030302, 0x020202, 0x020202, 0x020202, 0x030303, 0x13140B,
+			0x4E5128, 0x666B34, 0x7B7F3F, 0x888F4C, 0x888D4D, 0x252716, 0x090906, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x050504, 0x12120B, 0x51552F, 0x888E4A, 0x7F8541, 0x6C7137, 0x5D612F,
+			0x212211, 0x080805, 0x030302, 0x020202, 0x020202, 0x020202, 0x050504, 0x1F2111, 0x767B3C, 0x7F8440,
+			0x808541, 0x777C3C, 0x404321, 0x0F1008, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x060604, 0x1D1E10, 0x6E7338, 0x7D833F, 0x808642, 0x797E3D, 0x4E5228, 0x15160B, 0x050503, 0x020202,
+			0x020202, 0x050504, 0x0F0F0B, 0x23241B, 0x2F3025, 0x282920, 0x12130F, 0x070706, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x050503, 0x0E0E08, 0x32341A, 0x6C7137, 0x797D3E, 0x787E3E, 0x72773A,
+			0x232412, 0x060604, 0x020202, 0x020202, 0x020202, 0x030303, 0x090907, 0x191A13, 0x2F3024, 0x393A2D,
+			0x3A3B2F, 0x333428, 0x212119, 0x0E0E0B, 0x020202, 0x020202, 0x030303, 0x070805, 0x15160B, 0x464A23,
+			0x585C2B, 0x707538, 0x868B4D, 0x92975C, 0x40422A, 0x13140D, 0x040404, 0x030302, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x050504, 0x0C0D09, 0x323423, 0x989C67, 0x9EA26E, 0x8D9253, 0x4E5229,
+			0x101009, 0x020202, 0x020202, 0x030302, 0x0B0C07, 0x34361A, 0x585C2B, 0x6B7035, 0x7F8644, 0x8C9253,
+			0x555835, 0x11120B, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050504, 0x18190F,
+			0x767B46, 0x868B4A, 0x717639, 0x5A5E2C, 0x3D401E, 0x0C0C07, 0x040402, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030403, 0x14150B, 0x747939, 0x7D833E, 0x7E843F, 0x757A3A, 0x33351A, 0x070805,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x12120A, 0x696E34, 0x7C823D,
+			0x808540, 0x767C3A, 0x404220, 0x0A0A06, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0E0F09,
+			0x6A6F3D, 0x999D65, 0x9EA26C, 0x5D603C, 0x14140E, 0x060605, 0x030303, 0x040403, 0x030403, 0x030403,
+			0x020202, 0x040404, 0x040403, 0x030303, 0x040404, 0x040404, 0x030303, 0x030302, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x13140A, 0x747A39, 0x7D833E, 0x7E843F, 0x757A3A,
+			0x33351A, 0x070805, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x12120A, 0x6D7236, 0x787E3B, 0x848A46, 0x868B48, 0x434626, 0x0B0C08, 0x030303,
+			0x020202, 0x020202, 0x020202, 0x030303, 0x090A07, 0x232516, 0x7E8449, 0x818743, 0x7F853F, 0x7C823D,
+			0x757A3A, 0x33351A, 0x080905, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x080805,
+			0x333519, 0x686D33, 0x787E3C, 0x868C4A, 0x8B904F, 0x373821, 0x0B0B08, 0x030303, 0x020202, 0x030302,
+			0x060605, 0x0B0B08, 0x0C0C09, 0x060604, 0x030303, 0x080805, 0x2F3117, 0x676C33, 0x777C3B, 0x868C4A,
+			0x8B9151, 0x4A4D2E, 0x0F100A, 0x040403, 0x020202, 0x030303, 0x030302, 0x080806, 0x15160E, 0x5B5E38,
+			0x878D4B, 0x828843, 0x818742, 0x7B813D, 0x6B6F34, 0x13140A, 0x030303, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x0C0C07, 0x434621, 0x777D3B, 0x808540, 0x7C833E, 0x6A6F34, 0x13140A,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x040403, 0x14150B, 0x6D7236, 0x787E3B, 0x838A46, 0x858C48,
+			0x484C29, 0x10110B, 0x030302, 0x030302, 0x020202, 0x030303, 0x050605, 0x0D0D09, 0x2A2B1A, 0x7F8449,
+			0x818743, 0x7E843F, 0x7C823D, 0x757A3A, 0x383A1C, 0x0A0A06, 0x030403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x0A0A06, 0x373A1B, 0x686D33, 0x787D3C, 0x868B49, 0x8A904F, 0x3E4026, 0x0E0F0A, 0x030303,
+			0x030403, 0x030303, 0x0A0A08, 0x10100C, 0x0F100B, 0x080806, 0x030303, 0x020202, 0x060604, 0x1B1C0E,
+			0x747A39, 0x7D833E, 0x7D843E, 0x757A3A, 0x3A3C1D, 0x0C0D07, 0x040402, 0x020202, 0x020202, 0x020202,
+			0x040402, 0x0C0C07, 0x36381A, 0x585C2B, 0x6A7035, 0x7F8543, 0x8B9051, 0x5A5E37, 0x13140C, 0x040403,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040402, 0x090A07, 0x1F2013, 0x797E48, 0x848948, 0x717538,
+			0x5A5E2C, 0x414421, 0x101109, 0x050503, 0x020202, 0x020202, 0x020202, 0x020202, 0x050604, 0x1F2110,
+			0x747939, 0x7D823E, 0x7E833E, 0x757A3A, 0x3F411F, 0x0E0E08, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x060604, 0x1D1E0F, 0x6C7136, 0x7B813D, 0x7F843F, 0x767C3A, 0x4D5026, 0x14150B,
+			0x050503, 0x020202, 0x030302, 0x040404, 0x1E1F15, 0x8E9167, 0xB3B78B, 0xA9AB85, 0x2E2F24, 0x0B0B09,
+			0x030303, 0x020202, 0x020202, 0x020202, 0x030302, 0x050503, 0x0D0D08, 0x36391C, 0x757B39, 0x747A39,
+			0x6C7135, 0x5F632E, 0x1D1E0F, 0x060704, 0x020202, 0x020202, 0x020202, 0x030303, 0x11120C, 0x525538,
+			0xA9AD7E, 0xB5B78B, 0xB5B98F, 0xADB184, 0x7F815A, 0x1C1C13, 0x020202, 0x020202, 0x020202, 0x030403,
+			0x0B0B06, 0x242512, 0x464A21, 0x555A28, 0x717637, 0x878D51, 0x868B58, 0x292A1D, 0x0F100B, 0x040504,
+			0x030302, 0x020202, 0x020202, 0x020302, 0x050504, 0x0B0B08, 0x1D1E15, 0x6E714B, 0x979B64, 0x8E9358,
+			0x787E39, 0x434721, 0x0E0E08, 0x030302, 0x020202, 0x020202, 0x050503, 0x101209, 0x444820, 0x545828,
+			0x6D7234, 0x83894B, 0x858A55, 0x1F2014, 0x0A0A07, 0x020202, 0x020202, 0x020202, 0x020202, 0x040404,
+			0x10110B, 0x46472D, 0x8A8F51, 0x767B39, 0x5A5E2A, 0x474921, 0x1A1A0D, 0x050604, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x070805, 0x16170B, 0x767B37, 0x7E833E, 0x7E843F, 0x757B37,
+			0x35371A, 0x080905, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x111209,
+			0x6A6F32, 0x7C823C, 0x808541, 0x777D38, 0x424420, 0x0A0B06, 0x030402, 0x020202, 0x020202, 0x020202,
+			0x040403, 0x101109, 0x707535, 0x848949, 0x969B63, 0x929667, 0x575A42, 0x1E1F18, 0x1C1D17, 0x1D1D19,
+			0x1C1C17, 0x1C1D18, 0x1C1D18, 0x1E1E19, 0x1C1D18, 0x1C1C17, 0x1C1D18, 0x191915, 0x11110F, 0x080807,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x050604, 0x1C1D0E, 0x767B37, 0x7D833E,
+			0x7E843F, 0x757B37, 0x333519, 0x080805, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x0E0E08, 0x5A5D2A, 0x666B30, 0x797F3A, 0x8A8F51, 0x74774B,
+			0x1A1B13, 0x0B0B08, 0x040404, 0x050504, 0x080806, 0x0E0F0B, 0x242518, 0x797D48, 0x787D38, 0x6C7133,
+			0x6F7535, 0x777C38, 0x767B37, 0x343619, 0x080905, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x050503, 0x18190C, 0x5C612B, 0x6A6F32, 0x7E8442, 0x8D9356, 0x777A4F, 0x1A1A13, 0x0A0A08,
+			0x060605, 0x080907, 0x161610, 0x5C5F45, 0x5D5F41, 0x0D0D08, 0x040403, 0x060604, 0x18190C, 0x5B602B,
+			0x676C31, 0x7B813E, 0x8D9255, 0x858A59, 0x1F1F16, 0x0E0E0B, 0x070706, 0x060705, 0x0B0C09, 0x171810,
+			0x5D603B, 0x828847, 0x656B30, 0x6E7434, 0x777D38, 0x797F39, 0x707535, 0x14150B, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0C0C07, 0x444721, 0x777C38, 0x7F8440, 0x7D833D,
+			0x6C7033, 0x14150B, 0x040503, 0x020202, 0x020202, 0x020202, 0x030303, 0x121209, 0x5B5F2B, 0x666B30,
+			0x797F3A, 0x898F50, 0x767B4C, 0x202117, 0x0F0F0B, 0x070806, 0x060705, 0x090907, 0x13130E, 0x2B2C1C,
+			0x7A7F47, 0x787D38, 0x6C7133, 0x6F7535, 0x777D38, 0x767B37, 0x3A3C1C, 0x0B0B06, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x060604, 0x1C1D0E, 0x5C612B, 0x6A6F32, 0x7D8241, 0x8C9255, 0x797D51,
+			0x232419, 0x0E0E0B, 0x080806, 0x0E0E0B, 0x1D1E16, 0x616448, 0x626545, 0x13130C, 0x030303, 0x030303,
+			0x060604, 0x252613, 0x767B37, 0x7C823D, 0x7D833E, 0x757B37, 0x3B3E1D, 0x0C0C07, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x030303, 0x060604, 0x13140A, 0x454921, 0x545828, 0x6C7134, 0x838849, 0x878B55,
+			0x262819, 0x0B0B08, 0x050504, 0x020202, 0x020202, 0x030302, 0x070805, 0x16170F, 0x4D5031, 0x868D4E,
+			0x747839, 0x5A5E2A, 0x484B22, 0x1F2010, 0x090905, 0x030302, 0x020202, 0x020202, 0x020202, 0x030302,
+			0x070705, 0x232412, 0x767B37, 0x7D823D, 0x7E833F, 0x757B37, 0x40431F, 0x0F1008, 0x050503, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x070704, 0x1E1F0F, 0x6D7234, 0x7B813C, 0x7F833F, 0x777D38,
+			0x4F5326, 0x14150B, 0x040503, 0x020202, 0x020202, 0x070705, 0x222315, 0x7E824E, 0xA2A572, 0xA9AC7C,
+			0x6E7350, 0x202017, 0x080806, 0x040403, 0x030302, 0x030303, 0x040504, 0x070705, 0x16160D, 0x464825,
+			0x787E3A, 0x6C7133, 0x5C602B, 0x464A21, 0x15160A, 0x050604, 0x020202, 0x020202, 0x020202, 0x050503,
+			0x12120B, 0x4F532E, 0x92975D, 0x9FA36F, 0xA2A673, 0x989D65, 0x717541, 0x1F2013, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x050503, 0x0E0E07, 0x292B13, 0x3E421C, 0x505424, 0x6C7132, 0x848A50, 0x82855A,
+			0x363725, 0x161710, 0x0D0D0A, 0x070706, 0x060605, 0x0A0A08, 0x151510, 0x212318, 0x626545, 0x92975F,
+			0x858B50, 0x767B36, 0x676C2E, 0x3C401C, 0x0D0D07, 0x030403, 0x020202, 0x020202, 0x030302, 0x080805,
+			0x1E1F0E, 0x41441D, 0x4F5323, 0x6B7031, 0x84894E, 0x70734B, 0x202116, 0x10100C, 0x070705, 0x040404,
+			0x090907, 0x13130D, 0x343623, 0x818551, 0x747A38, 0x575C27, 0x43461E, 0x222410, 0x090905, 0x040403,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x090905, 0x2F3118, 0x7B813D, 0x7D8441,
+			0x7D8340, 0x797F3A, 0x3E411F, 0x0A0A06, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302,
+			0x040403, 0x15160B, 0x737937, 0x7D833F, 0x7E8442, 0x7B813D, 0x4C4F25, 0x0C0C07, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x040403, 0x0E0E07, 0x5B5F29, 0x686D2F, 0x818646, 0x989C67, 0xA9AD80, 0xB4B78F,
+			0xB8BC97, 0xBABD99, 0xBABD99, 0xBABD99, 0xBABD9A, 0xBABD9A, 0xBABE9A, 0xBABE9A, 0xBBBE9A, 0xA9AC8C,
+			0x71735C, 0x323328, 0x11110D, 0x070705, 0x040402, 0x020202, 0x020202, 0x020302, 0x070704, 0x2E3018,
+			0x7A803C, 0x7D8341, 0x7D8340, 0x7A803C, 0x3D401F, 0x0B0B06, 0x040403, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x090A05, 0x383C1A, 0x515524, 0x63692D,
+			0x7E8243, 0x949962, 0x81845E, 0x3F4132, 0x1B1C15, 0x181912, 0x292A1E, 0x606244, 0x848951, 0x6F7432,
+			0x393C1A, 0x3C3F1C, 0x656A2D, 0x747934, 0x7A803C, 0x454823, 0x0C0C07, 0x030302, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x0C0C06, 0x454920, 0x555926, 0x696E30, 0x82884B, 0x959965,
+			0x787A58, 0x2D2E21, 0x1C1C14, 0x2B2C1F, 0x757955, 0x939861, 0x818645, 0x18190D, 0x020202, 0x030302,
+			0x0C0C06, 0x40441D, 0x535725, 0x666B2E, 0x7F8446, 0x939761, 0x878B64, 0x434433, 0x1F1F17, 0x1D1E15,
+			0x494B35, 0x73764D, 0x7C8140, 0x575D28, 0x2B2D15, 0x5F642B, 0x6E7332, 0x787E3A, 0x7A7F3B, 0x17180C,
+			0x050503, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030303, 0x0E0F08, 0x4F5227, 0x7A7F3B,
+			0x7E8342, 0x7C813F, 0x7A803B, 0x191B0D, 0x050504, 0x020202, 0x020202, 0x020202, 0x030303, 0x0B0C06,
+			0x3C3E1B, 0x515524, 0x63692D, 0x7C8143, 0x929660, 0x82865E, 0x474837, 0x24241B, 0x212219, 0x2E2F21,
+			0x646646, 0x828850, 0x6F7432, 0x3E411D, 0x41441D, 0x656A2D, 0x737834, 0x797F3B, 0x4A4D25, 0x0E0F08,
+			0x030302, 0x030302, 0x020202, 0x020202, 0x020202, 0x040403, 0x101108, 0x464A20, 0x555926, 0x696E30,
+			0x808749, 0x949863, 0x7C7F5A, 0x353627, 0x222319, 0x333425, 0x777A55, 0x919760, 0x828746, 0x1C1E10,
+			0x040503, 0x030303, 0x0A0A06, 0x37391C, 0x7A7F3C, 0x7C8240, 0x7B813F, 0x787E3A, 0x454922, 0x101008,
+			0x050503, 0x030302, 0x020202, 0x020202, 0x020202, 0x030302, 0x090905, 0x20220F, 0x41441D, 0x4F5323,
+			0x6A6E31, 0x80854B, 0x717549, 0x252619, 0x13140E, 0x080806, 0x050504, 0x0A0A07, 0x181911, 0x3D3F28,
+			0x7F834D, 0x727838, 0x575C27, 0x43461E, 0x282A13, 0x0C0C07, 0x040403, 0x030302, 0x020202, 0x020202,
+			0x020202, 0x040403, 0x0D0D07, 0x3C3F1E, 0x7A7F3C, 0x7B813D, 0x7B7F3E, 0x787E39, 0x4A4D24, 0x12130A,
+			0x050503, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x090905, 0x252612, 0x747A38, 0x7A7F3C,
+			0x7C813D, 0x797E3B, 0x585C2B, 0x18190C, 0x050503, 0x030302, 0x030302, 0x050504, 0x1A1B0E, 0x62672D,
+			0x818546, 0x8E945C, 0x939862, 0x494B32, 0x212117, 0x11110C, 0x090906, 0x0A0A07, 0x0F0F0A, 0x1A1A12,
+			0x2E301C, 0x717540, 0x6D7233, 0x595E28, 0x4A4D21, 0x282A13, 0x0B0B06, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x030303, 0x111209, 0x42451F, 0x747A34, 0x808649, 0x84894C, 0x797F39, 0x5D622B, 0x1B1C0E,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040402, 0x050503, 0x0D0E07, 0x23240F, 0x383B18, 0x44481D,
+			0x5F6428, 0x787C43, 0x8A8D5D, 0x676948, 0x323322, 0x232418, 0x212317, 0x27291B, 0x606346, 0x797D54,
+			0x858A53, 0x717735, 0x5F6428, 0x525623, 0x4E5321, 0x343717, 0x0B0B06, 0x030302, 0x020202, 0x020202,
+			0x020202, 0x030302, 0x090905, 0x1D1E0D, 0x383B18, 0x45491D, 0x616729, 0x7C8146, 0x818557, 0x52553A,
+			0x1D1E13, 0x1A1B11, 0x1D1E12, 0x5F6340, 0x828650, 0x6B702E, 0x4E5321, 0x3B3E19, 0x21220F, 0x090A05,
+			0x030302, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x101008, 0x4B4E25,
+			0x6F7531, 0x6A702E, 0x6A6F2E, 0x6D742F, 0x565A29, 0x111108, 0x060604, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x040403, 0x0E0E07, 0x373A1B, 0x707631, 0x6B712E, 0x6A702E, 0x6E742F, 0x61652E, 0x14140A,
+			0x070704, 0x030302, 0x020202, 0x020202, 0x020202, 0x090905, 0x3A3D19, 0x555924, 0x656B2B, 0x7A803F,
+			0x898E56, 0x929563, 0x959868, 0x979A6A, 0x969B6B, 0x969B6B, 0x969B6A, 0x979B6B, 0x989C6C, 0x9B9F71,
+			0xA1A578, 0xA8AC7F, 0xACAF86, 0xACAF85, 0x61644A, 0x13130E, 0x050504, 0x020202, 0x020202, 0x050603,
+			0x0F1008, 0x494D23, 0x6F7530, 0x6B702E, 0x6A702E, 0x6F7530, 0x565A2B, 0x13140A, 0x060704, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060603, 0x15160A,
+			0x3C3F1A, 0x45491D, 0x5A5E26, 0x747937, 0x8B8F59, 0x9A9E6E, 0xA0A376, 0x9A9F72, 0x8C915D, 0x767B3B,
+			0x5D6228, 0x2A2C13, 0x111208, 0x353716, 0x575C25, 0x646A2B, 0x6F7431, 0x575B2A, 0x13140A, 0x080804,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x070804, 0x272911, 0x41441B, 0x4A4E1F,
+			0x606529, 0x787D3F, 0x8D915C, 0x979B6B, 0x979C6C, 0x8C915B, 0x787C3B, 0x616729, 0x2D2E15, 0x0A0A06,
+			0x030303, 0x030303, 0x060604, 0x1F210E, 0x3F431B, 0x474B1E, 0x5B6027, 0x737837, 0x898D58, 0x989A6B,
+			0x9C9F71, 0x949767, 0x80854D, 0x696E2C, 0x46491E, 0x14150A, 0x1D1E0D, 0x515522, 0x5D6228, 0x686E2D,
+			0x707532, 0x393A1C, 0x0E0E07, 0x050604, 0x020202, 0x020202, 0x020202, 0x040503, 0x090905, 0x16170B,
+			0x61642D, 0x6D722F, 0x6A6F2E, 0x6B712E, 0x707632, 0x393B1C, 0x0E0E07, 0x040503, 0x020202, 0x020202,
+			0x020202, 0x060704, 0x17190B, 0x3D401A, 0x45491D, 0x5A5E26, 0x737837, 0x898D58, 0x989C6D, 0x9DA074,
+			0x999D6F, 0x8A8F5A, 0x767B3B, 0x5D6228, 0x2E3016, 0x17170B, 0x373A18, 0x575C25, 0x64692B, 0x6E7430,
+			0x595E2B, 0x17180B, 0x080805, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x090A05, 0x292B12,
+			0x41441B, 0x4A4E1F, 0x606529, 0x767C3F, 0x898E58, 0x949868, 0x95986A, 0x898D59, 0x777B3B, 0x616729,
+			0x313418, 0x0D0E08, 0x060603, 0x060704, 0x15160A, 0x505426, 0x6D7330, 0x6A6F2E, 0x686F2E, 0x6C722F,
+			0x5A5D2A, 0x191A0C, 0x080804, 0x040402, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x0B0B06,
+			0x1F210E, 0x383B18, 0x45491D, 0x606629, 0x787D45, 0x808355, 0x56583C, 0x242518, 0x212315, 0x252617,
+			0x636642, 0x7E824B, 0x6A6E2E, 0x4E5321, 0x3B3E19, 0x252810, 0x0D0D07, 0x050504, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x030302, 0x080905, 0x191A0C, 0x535628, 0x6E7330, 0x696F2E, 0x696E2E, 0x6C712F,
+			0x5C5F2B, 0x1F1F0E, 0x0A0B06, 0x040403, 0x030302, 0x020202, 0x040403, 0x080805, 0x15160A, 0x42451F,
+			0x6E7331, 0x6A6F2E, 0x686E2E, 0x6B712F, 0x66692F, 0x242611, 0x0E0F07, 0x070704, 0x020202, 0x040403,
+			0x15160A, 0x4B4E20, 0x565B25, 0x656A2B, 0x767A3F, 0x848B53, 0x6A6C47, 0x383A26, 0x2B2C1D, 0x292A1B,
+			0x30311F, 0x5F6341, 0x737746, 0x686E32, 0x545924, 0x40431B, 0x2F3114, 0x101108, 0x050503, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x0E0F07, 0x393C18, 0x5D6228, 0x606529, 0x616629, 0x5E6328,
+			0x4E5121, 0x17180B, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x050503, 0x0B0B06,
+			0x1A1B0B, 0x303213, 0x363916, 0x474A1C, 0x5E6326, 0x6F7439, 0x7D814A, 0x858955, 0x858957, 0x818552,
+			0x767B44, 0x686C2B, 0x555A22, 0x41451A, 0x363916, 0x363916, 0x383C17, 0x282A10, 0x070804, 0x030302,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x080904, 0x17190A, 0x303314, 0x383B17, 0x4C501F,
+			0x646928, 0x767A40, 0x818550, 0x818753, 0x7C814A, 0x6C712E, 0x565B23, 0x40431A, 0x313314, 0x18180B,
+			0x070704, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040503, 0x0D0D06,
+			0x40431A, 0x5E6326, 0x535721, 0x474B1D, 0x474A1C, 0x515521, 0x5D6226, 0x45491C, 0x16170A, 0x060603,
+			0x030302, 0x020202, 0x030403, 0x0C0C06, 0x3A3D19, 0x595E24, 0x555A23, 0x494D1E, 0x474A1C, 0x4F5320,
+			0x5B6026, 0x4F5321, 0x272812, 0x080804, 0x020202, 0x020202, 0x020202, 0x050503, 0x141509, 0x494C1E,
+			0x585D24, 0x5A5F24, 0x565B23, 0x515521, 0x4D521F, 0x4D511F, 0x4D511F, 0x4D511F, 0x4D511F, 0x4D511F,
+			0x4F5320, 0x565B23, 0x626828, 0x777C3A, 0x8D925C, 0x9A9D6C, 0x989C6A, 0x575A39, 0x0C0D08, 0x020202,
+			0x040403, 0x0D0D06, 0x3F421A, 0x5E6326, 0x535721, 0x474B1D, 0x474A1C, 0x515621, 0x5E6326, 0x4B4F1F,
+			0x202210, 0x090905, 0x030403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x070704, 0x191A0B, 0x343715, 0x363916, 0x41451A, 0x515521, 0x5C6125, 0x606527, 0x5A5F24,
+			0x4F5320, 0x3C3F18, 0x1B1C0C, 0x090A05, 0x0A0A05, 0x303314, 0x43471B, 0x474B1D, 0x525621, 0x5D6226,
+			0x4B4E1E, 0x1F210F, 0x070704, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x080905,
+			0x22240E, 0x363916, 0x383C17, 0x45491C, 0x525721, 0x5A5F24, 0x585D24, 0x4E5320, 0x3C4019, 0x1E200E,
+			0x0B0B06, 0x050503, 0x020202, 0x020202, 0x030303, 0x080904, 0x1F210E, 0x363916, 0x363916, 0x42451B,
+			0x505520, 0x5A5F24, 0x5B6125, 0x545922, 0x494D1E, 0x2D2F12, 0x0F0F07, 0x080805, 0x16180A, 0x42461B,
+			0x43461B, 0x494D1D, 0x555A23, 0x5E6227, 0x42461F, 0x111208, 0x060704, 0x030302, 0x020202, 0x090905,
+			0x20220F, 0x4A4E1E, 0x5B6025, 0x4F5320, 0x464A1C, 0x494D1D, 0x555A23, 0x5D6227, 0x3C401B, 0x0F1007,
+			0x050603, 0x020202, 0x020202, 0x040402, 0x080905, 0x1B1C0C, 0x343715, 0x363916, 0x41451A, 0x515521,
+			0x5C6125, 0x606527, 0x5A5F24, 0x4F5320, 0x3D4119, 0x1F210E, 0x0B0B06, 0x0C0C06, 0x323515, 0x43471B,
+			0x474B1D, 0x525621, 0x5C6126, 0x4C501F, 0x222410, 0x080804, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x050503, 0x0B0C06, 0x252610, 0x363916, 0x383C17, 0x45491C, 0x525721, 0x5A5F24, 0x585D24, 0x4E5320,
+			0x3F4219, 0x22240F, 0x0D0D06, 0x050504, 0x050603, 0x121308, 0x43461B, 0x5C6126, 0x525621, 0x474B1D,
+			0x474A1C, 0x515521, 0x5B6126, 0x484B1E, 0x1D1E0D, 0x090A05, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x040403, 0x090A05, 0x1A1C0B, 0x313414, 0x383B17, 0x4C501F, 0x636828, 0x72763E, 0x7D814C,
+			0x7F844F, 0x777C44, 0x696F2E, 0x565B23, 0x40431A, 0x323414, 0x1B1C0B, 0x0B0B06, 0x050503, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x060604, 0x141509, 0x44491D, 0x5B6025, 0x525721, 0x474B1D,
+			0x474A1C, 0x515521, 0x5B5F25, 0x4A4D1E, 0x20210E, 0x0A0A05, 0x040402, 0x020202, 0x070704, 0x141509,
+			0x41451C, 0x585C24, 0x545822, 0x494D1E, 0x474A1C, 0x4F5320, 0x595D25, 0x545621, 0x303215, 0x0E0E07,
+			0x040403, 0x050503, 0x0E0F07, 0x393C17, 0x383C17, 0x393C17, 0x474A1C, 0x5C6025, 0x6A6F35, 0x767A44,
+			0x7E824F, 0x81834F, 0x7A7D49, 0x6D713A, 0x5D6326, 0x464A1C, 0x363916, 0x262810, 0x101008, 0x070704,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0C0D06, 0x2D3014, 0x484C1D, 0x43461B,
+			0x42451B, 0x464A1C, 0x40431A, 0x131409, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x050503, 0x080804, 0x0C0C06, 0x17180A, 0x25270F, 0x2D2F12, 0x393D16, 0x414519, 0x464A1B,
+			0x474B1B, 0x43471A, 0x3D4017, 0x343714, 0x2C2E11, 0x24260F, 0x23250E, 0x1A1B0B, 0x0D0E06, 0x080904,
+			0x050403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x060604, 0x0B0B05,
+			0x191B0B, 0x23260E, 0x313413, 0x3C3F17, 0x434719, 0x45491A, 0x414519, 0x333714, 0x24260F, 0x191B0B,
+			0x0A0B05, 0x060603, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x070704, 0x3D4118, 0x4D511D, 0x3C4017, 0x343714, 0x343714, 0x343714, 0x343714, 0x3A3E16, 0x4B4F1C,
+			0x4F541E, 0x080904, 0x020202, 0x020202, 0x060603, 0x323514, 0x50541E, 0x404318, 0x343714, 0x343714,
+			0x343714, 0x343714, 0x383B15, 0x484C1B, 0x565B21, 0x161709, 0x030302, 0x020202, 0x020202, 0x040403,
+			0x0E0E08, 0x20210F, 0x555921, 0x45491A, 0x343714, 0x343714, 0x343714, 0x343714, 0x343714, 0x343714,
+			0x343714, 0x343714, 0x343714, 0x343714, 0x343714, 0x464A1B, 0x5E6324, 0x7A7E41, 0x83884D, 0x7A7E44,
+			0x1B1C0F, 0x040503, 0x070704, 0x3D4118, 0x4D511D, 0x3C4017, 0x343714, 0x343714, 0x343714, 0x343714,
+			0x3A3D16, 0x4A4E1C, 0x585D22, 0x23250E, 0x050503, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x060603, 0x0D0E06, 0x21230D, 0x323513, 0x343714, 0x343714,
+			0x343714, 0x282A10, 0x1C1E0C, 0x0B0B05, 0x050603, 0x030302, 0x060604, 0x2A2C10, 0x343714, 0x343714,
+			0x343714, 0x3A3D16, 0x494D1C, 0x585C21, 0x0A0A05, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x040403, 0x080804, 0x1A1C0B, 0x292B10, 0x343714, 0x343714, 0x343714, 0x2C2E11, 0x20210C,
+			0x0B0B05, 0x060704, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x070704, 0x141508,
+			0x24260E, 0x343714, 0x343714, 0x343714, 0x323513, 0x24260E, 0x121208, 0x090A05, 0x050503, 0x050503,
+			0x121308, 0x343714, 0x343714, 0x343714, 0x343714, 0x3F4318, 0x4F541E, 0x535820, 0x090904, 0x020202,
+			0x030302, 0x17180A, 0x575C21, 0x484D1C, 0x383C15, 0x343714, 0x343714, 0x343714, 0x343714, 0x3F4318,
+			0x4F541E, 0x404319, 0x080904, 0x030302, 0x020202, 0x020202, 0x030302, 0x070704, 0x101107, 0x22250E,
+			0x323513, 0x343714, 0x343714, 0x343714, 0x292B10, 0x20210C, 0x0D0E06, 0x080804, 0x040403, 0x080904,
+			0x2B2D10, 0x343714, 0x343714, 0x343714, 0x3A3D16, 0x494D1C, 0x585D21, 0x0B0C05, 0x030303, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x040403, 0x090A05, 0x1D1F0C, 0x2A2C10, 0x343714, 0x343714, 0x343714,
+			0x2D3012, 0x22240E, 0x0F1007, 0x090905, 0x040403, 0x030303, 0x090905, 0x3F4318, 0x4D511D, 0x3C4017,
+			0x343714, 0x343714, 0x343714, 0x343714, 0x3A3E16, 0x4B4F1C, 0x50551F, 0x0C0D06, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x030303, 0x060604, 0x0C0D06, 0x1C1D0C, 0x27290F, 0x313413,
+			0x3C3F17, 0x434719, 0x45491A, 0x414519, 0x353915, 0x292B10, 0x1E200C, 0x0E0E06, 0x070704, 0x040403,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0A0A05, 0x40441A, 0x4D511D, 0x3C4017,
+			0x343714, 0x343714, 0x343714, 0x343714, 0x3A3E16, 0x4B4F1C, 0x51551F, 0x0D0E06, 0x030402, 0x030302,
+			0x0A0A04, 0x383B16, 0x50541E, 0x404318, 0x343714, 0x343714, 0x343714, 0x343714, 0x383B15, 0x484C1B,
+			0x565B21, 0x1F200D, 0x060704, 0x030303, 0x070704, 0x0F0F07, 0x1B1D0B, 0x26280F, 0x292B10, 0x313413,
+			0x383C15, 0x414419, 0x464A1B, 0x464A1B, 0x434719, 0x3C3F17, 0x2D2F12, 0x27290F, 0x131509, 0x0C0C06,
+			0x060604, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x0A0A05, 0x24260F,
+			0x353814, 0x343714, 0x343714, 0x343714, 0x313413, 0x0D0E06, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030302, 0x020202, 0x030302, 0x060603, 0x090905, 0x0C0C05, 0x0E0F06,
+			0x101107, 0x111207, 0x111208, 0x101107, 0x0E0F06, 0x0C0D06, 0x0B0B05, 0x090905, 0x080904, 0x060603,
+			0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x040403, 0x050603, 0x080804, 0x0A0A05, 0x0C0D06, 0x0D0E06, 0x0D0F06, 0x0C0D05, 0x0A0B05,
+			0x080804, 0x050503, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x050503, 0x090A05, 0x0D0E06, 0x0B0C05, 0x0A0A05, 0x0A0A05, 0x090A05, 0x0A0A04,
+			0x0B0C05, 0x0D0E06, 0x0A0A05, 0x050503, 0x020202, 0x020202, 0x040403, 0x080804, 0x0C0D06, 0x0B0B05,
+			0x0A0B05, 0x090905, 0x090905, 0x0A0A05, 0x0A0B05, 0x0D0D06, 0x0B0C06, 0x070704, 0x030303, 0x020202,
+			0x040403, 0x0C0D08, 0x373921, 0x707339, 0x595D1F, 0x3C3F15, 0x191B09, 0x0A0B05, 0x090A05, 0x090A05,
+			0x090904, 0x090904, 0x090A05, 0x090905, 0x090A05, 0x0A0B05, 0x20220C, 0x303211, 0x464918, 0x5C6120,
+			0x6C712E, 0x6B702C, 0x333614, 0x070704, 0x040503, 0x090A05, 0x0B0C05, 0x0B0B05, 0x0A0A05, 0x090905,
+			0x090A05, 0x090A05, 0x0A0B05, 0x0C0D06, 0x0C0C06, 0x080804, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x030302, 0x050603, 0x080904,
+			0x090A05, 0x090905, 0x080904, 0x070804, 0x050503, 0x040403, 0x030302, 0x020202, 0x040403, 0x070704,
+			0x090905, 0x0A0A05, 0x0A0A05, 0x0B0C05, 0x0D0E06, 0x0B0B05, 0x060603, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x050603, 0x070704, 0x090A05, 0x0A0A05, 0x090A05,
+			0x080904, 0x060603, 0x030402, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x040403, 0x070704, 0x0A0A05, 0x0A0B05, 0x0B0C05, 0x090905, 0x070704, 0x040403, 0x030302,
+			0x020202, 0x030302, 0x050503, 0x080904, 0x0B0B05, 0x0A0B05, 0x0B0C05, 0x0D0D06, 0x0E0F06, 0x0B0B05,
+			0x060604, 0x030302, 0x030303, 0x080804, 0x0C0C06, 0x0E0E06, 0x0C0D06, 0x0C0C06, 0x0B0B05, 0x0B0C06,
+			0x0B0C05, 0x0E0E06, 0x0E0F07, 0x0B0C05, 0x050503, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302,
+			0x040503, 0x070804, 0x0A0B05, 0x0B0C05, 0x0B0C06, 0x0B0C05, 0x090904, 0x070704, 0x030302, 0x030302,
+			0x020202, 0x040403, 0x080804, 0x0B0C05, 0x0B0C05, 0x0C0C06, 0x0D0E06, 0x0F1007, 0x0D0D06, 0x070704,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040402, 0x060704, 0x090905, 0x0B0C05,
+			0x0C0D06, 0x0B0C05, 0x0A0B05, 0x070704, 0x040403, 0x030302, 0x020202, 0x020202, 0x040403, 0x0C0C06,
+			0x101107, 0x0F1007, 0x0D0D06, 0x0D0D06, 0x0C0D06, 0x0E0E06, 0x0F1007, 0x111207, 0x0F0F07, 0x070704,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x040403, 0x070704,
+			0x090A05, 0x0C0D06, 0x0F1007, 0x111207, 0x111208, 0x101107, 0x0D0E06, 0x090A05, 0x070704, 0x040403,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060604, 0x0D0E06,
+			0x121408, 0x111207, 0x0F1007, 0x0F1007, 0x0E0F07, 0x101007, 0x121308, 0x131508, 0x111208, 0x090905,
+			0x020202, 0x020202, 0x060603, 0x0E0E06, 0x131408, 0x131408, 0x101107, 0x101107, 0x0F1007, 0x0F1007,
+			0x121307, 0x151608, 0x141409, 0x0B0C06, 0x050503, 0x020202, 0x030302, 0x040503, 0x080804, 0x0A0A05,
+			0x0C0D06, 0x0E0F07, 0x111207, 0x141408, 0x151609, 0x151609, 0x151609, 0x121308, 0x0E0F06, 0x0A0A05,
+			0x060604, 0x040403, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x050503, 0x0A0B05, 0x101107, 0x111308, 0x111208, 0x111207, 0x0D0E06, 0x070703, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x030302,
+			0x030402, 0x040402, 0x030403, 0x040403, 0x040403, 0x040403, 0x030303, 0x030303, 0x040402, 0x030302,
+			0x030302, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x020202, 0x020202, 0x030302, 0x030302, 0x030302,
+			0x030302, 0x020302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x030302, 0x030302, 0x030403, 0x020202,
+			0x030302, 0x020202, 0x030302, 0x020202, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030302, 0x030302, 0x020202, 0x020202, 0x020202, 0x030302, 0x040403, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x090906, 0x393A23, 0x858A53, 0x767A3F, 0x51561A, 0x22250C, 0x080804, 0x040402,
+			0x030302, 0x020302, 0x030302, 0x030302, 0x020202, 0x030302, 0x020202, 0x030302, 0x060703, 0x131407,
+			0x3C4013, 0x50551A, 0x5D621E, 0x5C621E, 0x373A12, 0x080804, 0x020202, 0x020202, 0x020202, 0x030302,
+			0x030302, 0x020202, 0x020202, 0x030302, 0x020202, 0x030302, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030302, 0x030302, 0x030302, 0x030302, 0x030302, 0x030302, 0x030302, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020302, 0x030302,
+			0x020202, 0x020202, 0x030302, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x020202, 0x020202, 0x030303, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x030302, 0x030302,
+			0x030302, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x030403, 0x030303,
+			0x030303, 0x030302, 0x030302, 0x040402, 0x030403, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x030302, 0x030302, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x030302, 0x030302, 0x030302, 0x030302,
+			0x030302, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030303, 0x030302, 0x030302, 0x030302, 0x020202, 0x020202, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030302, 0x030302, 0x030302, 0x030302, 0x030302, 0x030303, 0x030402, 0x030302, 0x040402,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030302, 0x030302, 0x040403, 0x040402, 0x040402, 0x030302, 0x030402, 0x030302,
+			0x020302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030402, 0x040403, 0x040402, 0x030302, 0x040403, 0x040403, 0x030302, 0x040403, 0x040403,
+			0x030403, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x040403, 0x040403, 0x040403, 0x040503,
+			0x030402, 0x040403, 0x040403, 0x040403, 0x030403, 0x030303, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x030302, 0x030302, 0x040403, 0x040503, 0x040403, 0x050503, 0x050503, 0x040403, 0x040403,
+			0x030402, 0x030303, 0x030302, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x030303, 0x040403, 0x040403, 0x050503, 0x040403, 0x040403, 0x030302,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x040403, 0x111209, 0x6E713C, 0x7B7F46, 0x666B28, 0x414513, 0x0C0D05,
+			0x030402, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x090A04, 0x34380F, 0x4E5217, 0x565B19, 0x555919, 0x33350F, 0x090904, 0x030302, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x030302, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x060603, 0x2D3010, 0x636926, 0x686D2D, 0x545A16,
+			0x31340E, 0x090A04, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x080903, 0x2E310C, 0x4F5415, 0x515615, 0x4B5014, 0x2C2F0C, 0x070703,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x080803, 0x30330C, 0x515612,
+			0x5A5F1C, 0x535812, 0x30320C, 0x090903, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x0A0A04, 0x32350C, 0x515612, 0x4C5111, 0x43470F,
+			0x202208, 0x050603, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x070703,
+			0x292B09, 0x464B0E, 0x4F5511, 0x565C17, 0x393D0F, 0x0B0B05, 0x030302, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040403, 0x0E0F07, 0x4C501A, 0x515611,
+			0x43480E, 0x363A0C, 0x0E0F04, 0x040402, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x050502, 0x161705, 0x393D09, 0x42470B, 0x535916, 0x5B5F26, 0x121309, 0x060704, 0x030303,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x050504, 0x0C0C07, 0x303319,
+			0x5D6224, 0x464B0C, 0x353909, 0x1E2106, 0x060603, 0x030302, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x080903, 0x282B05, 0x313507, 0x404609, 0x595F20, 0x585B31,
+			0x15150C, 0x0D0E09, 0x080806, 0x050504, 0x030303, 0x020202, 0x030302, 0x060605, 0x0B0B08, 0x11110B,
+			0x353720, 0x60652D, 0x464C09, 0x323607, 0x242705, 0x080803, 0x030402, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x040402, 0x0E0F03, 0x212404, 0x2A2D04,
+			0x3A3E06, 0x515617, 0x6A6F3C, 0x4D5033, 0x393A27, 0x14150D, 0x12130B, 0x11120B, 0x13140C, 0x16170D,
+			0x4E5035, 0x5B5F37, 0x5C6125, 0x3F4406, 0x2D3104, 0x1F2104, 0x0A0B03, 0x040402, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020302, 0x040402,
+			0x090A02, 0x191C02, 0x222502, 0x2B2F02, 0x393E03, 0x484E08, 0x5E622A, 0x696D38, 0x6F7341, 0x707442,
+			0x6C713C, 0x626630, 0x515617, 0x3D4204, 0x2F3303, 0x222602, 0x141602, 0x070702, 0x040402, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x030302, 0x050502, 0x080802, 0x151701, 0x161802, 0x1F2101, 0x292C01, 0x2C3001,
+			0x2E3201, 0x2F3301, 0x2D3201, 0x2B2E01, 0x232502, 0x171902, 0x101102, 0x070702, 0x040402, 0x030302,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x030302, 0x040402, 0x050502, 0x060602,
+			0x070802, 0x080902, 0x090902, 0x090902, 0x080902, 0x080802, 0x060702, 0x050502, 0x030402, 0x030302,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+			0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202, 0x020202,
+		};
+	}
+
+	/**
+		Returns the size and spans of a sprite
+
+		@param id
+		@return sprite
+	*/
+	const Sprite& getSprite(Id id)
+	{
+		return sprites[int(id)];
+	}
+
+	/**
+		Returns the spans of every sprite (A sprite uses [firstSpan, firstSpan + nSpans))
+
+		@return spans
+	*/
+	const Span* getSpans()
+	{
+		return spans;
+	}
+
+	/**
+		Returns the pixels of every span
+
+		@return pixels
+	*/
+	const Color* getPixels()
+	{
+		return pixels;
+	}
+}
@@ -0,0 +1,63 @@
+/**
+	Pixel data of every sprite of the SpriteCodex
+
+	A sprite is kept as the rows of spans of its opaque pixels (the pixels which the sprite draws), so drawing one
+	is a copy per span instead of a call per pixel, and the transparent pixels in between are skipped without being
+	looked at. The pixels of all spans of all sprites are packed one after the other into a single array.
+*/
+
+#pragma once
+#include "Colors.h"
+#include <cstdint>
+
+namespace SpriteAtlas {
+	enum class Id {
+		Tile0,
+		Tile1,
+		Tile2,
+		Tile3,
+		Tile4,
+		Tile5,
+		Tile6,
+		Tile7,
+		Tile8,
+		TileButton,
+		TileCross,
+		TileFlag,
+		TileMine,
+		TileMineRed,
+		Beginner,
+		Intermediate,
+		Expert,
+		BeginnerGlow,
+		IntermediateGlow,
+		ExpertGlow,
+		GameLoss,
+		GameWin,
+		Count
+	};
+
+	/**
+		Run of opaque pixels inside of a single row of a sprite, relative to the top left of the sprite
+	*/
+	struct Span {
+		std::int16_t x;
+		std::int16_t y;
+		std::int16_t length;
+		std::int32_t firstPixel;	// Index of the leftmost pixel of the span in getPixels()
+	};
+
+	/**
+		Bounding box of a sprite and its spans, sorted by row
+	*/
+	struct Sprite {
+		int width;
+		int height;
+		int firstSpan;
+		int nSpans;
+	};
+
+	const Sprite& getSprite(Id id);
+	const Span* getSpans();
+	const Color* getPixels();
+}
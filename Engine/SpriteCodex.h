@@ -1,5 +1,5 @@
 /**
-	Manages the Sprites that are to be drawn onto the screen via Graphics::PutPixel calls
+	Manages the Sprites that are to be drawn onto the screen, blitting them span by span from the SpriteAtlas
 
 	@author Chili
 	@author Benjamin Korady
@@ -9,6 +9,7 @@
 
 #include "Graphics.h"
 #include "Vei2.h"
+#include "SpriteAtlas.h"
 
 class SpriteCodex
 {
@@ -49,4 +50,6 @@ public:
 	static void drawIntermediateGlow(int x, int y, Graphics& gfx);
 	static void drawExpertGlow(int x, int y, Graphics& gfx);
 
+private:
+	static void drawSprite(SpriteAtlas::Id id, int x, int y, Graphics& gfx);
 };
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "Surface.h"
+#include <assert.h>
+
+/**
+	Constructs a surface with every pixel black
+
+	@param widthIn Width of the surface (in pixels)
+	@param heightIn Height of the surface (in pixels)
+*/
+Surface::Surface(int widthIn, int heightIn)
+{
+	resize(widthIn, heightIn);
+}
+
+/**
+	Changes the size of the surface, every pixel becomes black
+	The pixels keep their memory, so a surface which does not grow never allocates
+
+	@param widthIn Width of the surface (in pixels)
+	@param heightIn Height of the surface (in pixels)
+*/
+void Surface::resize(int widthIn, int heightIn)
+{
+	assert(widthIn >= 0 && heightIn >= 0);
+	width = widthIn;
+	height = heightIn;
+	pixels.assign(std::size_t(width) * height, Color());
+}
+
+/**
+	Returns the width of the surface (in pixels)
+
+	@return width
+*/
+int Surface::getWidth() const
+{
+	return width;
+}
+
+/**
+	Returns the height of the surface (in pixels)
+
+	@return height
+*/
+int Surface::getHeight() const
+{
+	return height;
+}
+
+/**
+	Returns the pixels of the surface, row after row
+
+	@return pixels
+*/
+Color* Surface::getPixels()
+{
+	return pixels.data();
+}
+
+/**
+	Returns the pixels of the surface, row after row
+
+	@return pixels
+*/
+const Color* Surface::getPixels() const
+{
+	return pixels.data();
+}
+
+/**
+	Returns the amount of memory held by the surface (in bytes)
+
+	@return bytes
+*/
+std::size_t Surface::getMemoryUsage() const
+{
+	return pixels.capacity() * sizeof(Color);
+}
@@ -0,0 +1,27 @@
+/**
+	Image kept in memory, row after row, which can be drawn into instead of the screen (See Graphics::SetRenderTarget())
+*/
+
+#pragma once
+#include "Colors.h"
+#include <vector>
+#include <cstddef>
+
+class Surface {
+public:
+	Surface() = default;
+	Surface(int widthIn, int heightIn);
+
+	void resize(int widthIn, int heightIn);
+
+	int getWidth() const;
+	int getHeight() const;
+	Color* getPixels();
+	const Color* getPixels() const;
+	std::size_t getMemoryUsage() const;
+
+private:
+	int width = 0;
+	int height = 0;
+	std::vector<Color> pixels;
+};
@@ -0,0 +1,139 @@
+#include "ThreadPool.h"
+#include <algorithm>
+#include <assert.h>
+
+/**
+	Constructs a thread pool with one thread per hardware thread
+*/
+ThreadPool::ThreadPool()
+	:
+	ThreadPool(std::max(1, (int)std::thread::hardware_concurrency()))
+{
+}
+
+/**
+	Constructs a thread pool
+
+	@param nThreadsIn The amount of threads running the tasks (including the thread calling parallelFor())
+*/
+ThreadPool::ThreadPool(int nThreadsIn)
+{
+	assert(nThreadsIn >= 1);
+	for (int i = 1; i < nThreadsIn; ++i) {
+		workers.emplace_back(&ThreadPool::work, this);
+	}
+}
+
+/**
+	Stops and joins the worker threads
+*/
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStopping = true;
+	}
+	taskAvailable.notify_all();
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+}
+
+/**
+	Runs task(0) to task(nTasks - 1) on the threads of the pool and waits for all of them to finish
+	(Must not be called from inside of a task. If a task throws, the tasks which did not start yet are skipped and
+	the first exception is rethrown here once the running ones finished)
+
+	@param nTasks
+	@param task
+*/
+void ThreadPool::parallelFor(int nTasks, const std::function<void(int)>& task)
+{
+	if (nTasks <= 0) {
+		return;
+	}
+	if (workers.empty() || nTasks == 1) {
+		for (int i = 0; i < nTasks; ++i) {
+			task(i);
+		}
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(mutex);
+	assert(loopTask == nullptr);
+	loopTask = &task;
+	nLoopTasks = nTasks;
+	nextTask = 0;
+	nUnfinishedTasks = nTasks;
+	taskAvailable.notify_all();
+
+	runTasks(lock);
+	loopDone.wait(lock, [this] { return nUnfinishedTasks == 0; });
+	loopTask = nullptr;
+	if (loopException) {
+		std::exception_ptr exception = loopException;
+		loopException = nullptr;
+		lock.unlock();
+		std::rethrow_exception(exception);
+	}
+}
+
+/**
+	Returns the amount of threads running the tasks (including the thread calling parallelFor())
+
+	@return nThreads
+*/
+int ThreadPool::getThreadCount() const
+{
+	return (int)workers.size() + 1;
+}
+
+/**
+	Main loop of the worker threads
+*/
+void ThreadPool::work()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true) {
+		taskAvailable.wait(lock, [this] { return isStopping || (loopTask != nullptr && nextTask < nLoopTasks); });
+		if (isStopping) {
+			return;
+		}
+		runTasks(lock);
+	}
+}
+
+/**
+	Takes tasks of the current loop until there are none left (the lock is released while a task runs, and an
+	exception it throws is kept for parallelFor())
+
+	@param lock Lock on the mutex of the pool
+*/
+void ThreadPool::runTasks(std::unique_lock<std::mutex>& lock)
+{
+	while (loopTask != nullptr && nextTask < nLoopTasks) {
+		const std::function<void(int)>& task = *loopTask;
+		const int i = nextTask++;
+		lock.unlock();
+		std::exception_ptr exception;
+		try {
+			task(i);
+		}
+		catch (...) {
+			exception = std::current_exception();
+		}
+		lock.lock();
+		int nFinished = 1;
+		if (exception) {
+			if (!loopException) {
+				loopException = exception;
+			}
+			nFinished += nLoopTasks - nextTask;	// The tasks nobody took yet are skipped
+			nextTask = nLoopTasks;
+		}
+		nUnfinishedTasks -= nFinished;
+		if (nUnfinishedTasks == 0) {
+			loopDone.notify_all();
+		}
+	}
+}
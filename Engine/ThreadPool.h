@@ -0,0 +1,43 @@
+/**
+	Fixed set of worker threads which run the tasks of a parallel loop
+
+	The calling thread takes part in running the tasks and parallelFor() only returns once every task is done,
+	so the tasks may use anything owned by the caller. An exception thrown by a task is rethrown by parallelFor()
+	on the calling thread.
+*/
+
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <exception>
+
+class ThreadPool {
+public:
+	ThreadPool();
+	ThreadPool(int nThreadsIn);
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	~ThreadPool();
+
+	void parallelFor(int nTasks, const std::function<void(int)>& task);
+	int getThreadCount() const;
+
+private:
+	void work();
+	void runTasks(std::unique_lock<std::mutex>& lock);
+
+private:
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable taskAvailable;
+	std::condition_variable loopDone;
+	const std::function<void(int)>* loopTask = nullptr;	// Task of the loop being run (nullptr when idle)
+	int nLoopTasks = 0;
+	int nextTask = 0;
+	int nUnfinishedTasks = 0;
+	std::exception_ptr loopException;	// First exception thrown by a task of the loop being run
+	bool isStopping = false;
+};
@@ -0,0 +1,147 @@
+#include "ThreadedBackend.h"
+#include "Graphics.h"
+#include <string.h>
+#include <chrono>
+#include <utility>
+
+/**
+	Constructs the backend and starts its thread
+
+	@param pShownIn Backend presenting the frames (only called from the thread of this backend)
+	@param processMessagesIn Processes the pending messages of the window presented to (nullptr if presenting never
+		waits on the thread destroying the backend)
+*/
+ThreadedBackend::ThreadedBackend(std::unique_ptr<GraphicsBackend> pShownIn, std::function<void()> processMessagesIn)
+	:
+	pShown(std::move(pShownIn)),
+	processMessages(std::move(processMessagesIn)),
+	newestFrame(Graphics::ScreenWidth, Graphics::ScreenHeight),
+	presentedFrame(Graphics::ScreenWidth, Graphics::ScreenHeight)
+{
+	// A frame has at most a damaged area per row, and more than that is merged into one
+	newestDamage.reserve(Graphics::ScreenHeight + 1);
+	presentedDamage.reserve(Graphics::ScreenHeight + 1);
+	presenter = std::thread(&ThreadedBackend::present, this);
+}
+
+/**
+	Stops the thread (a frame still waiting is not presented), processing the messages of the window until it has
+*/
+ThreadedBackend::~ThreadedBackend()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	isStopping = true;
+	frameHanded.notify_one();
+	if (processMessages) {
+		constexpr auto messageInterval = std::chrono::milliseconds(5);
+		while (!stopped.wait_for(lock, messageInterval, [this] { return hasStopped; })) {
+			lock.unlock();
+			processMessages();	// A present waiting on the window can go on
+			lock.lock();
+		}
+	}
+	lock.unlock();
+	presenter.join();
+}
+
+/**
+	Hands a finished frame to the thread (throws what the other backend threw while presenting a frame before)
+
+	@param pPixels The frame (Graphics::ScreenHeight rows of Graphics::ScreenWidth pixels)
+	@param damage The areas which changed since the last frame
+*/
+void ThreadedBackend::Present(const Color* pPixels, const std::vector<RectI>& damage)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (error) {
+			std::rethrow_exception(error);
+		}
+		copyAreas(pPixels, damage, newestFrame);
+		if (newestDamage.size() + damage.size() > Graphics::ScreenHeight) {
+			newestDamage.clear();
+			newestDamage.emplace_back(0, Graphics::ScreenWidth, 0, Graphics::ScreenHeight);
+		}
+		else {
+			newestDamage.insert(newestDamage.end(), damage.begin(), damage.end());
+		}
+		stats.replacedFrames += hasNewFrame ? 1 : 0;
+		hasNewFrame = true;
+		++stats.handedFrames;
+	}
+	frameHanded.notify_one();
+}
+
+/**
+	Returns the counters of the frames
+
+	@return stats
+*/
+ThreadedBackend::Stats ThreadedBackend::getStats() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return stats;
+}
+
+/**
+	Main loop of the thread, presents the newest frame each time there is one (stops at the first error)
+*/
+void ThreadedBackend::present()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	presentFrames(lock);
+	hasStopped = true;
+	stopped.notify_one();
+}
+
+/**
+	Presents the newest frame each time there is one, until the backend stops or the other backend throws
+
+	@param lock Lock on the mutex of the backend
+*/
+void ThreadedBackend::presentFrames(std::unique_lock<std::mutex>& lock)
+{
+	while (true) {
+		frameHanded.wait(lock, [this] { return hasNewFrame || isStopping; });
+		if (isStopping) {
+			return;
+		}
+		copyAreas(newestFrame.getPixels(), newestDamage, presentedFrame);
+		presentedDamage.assign(newestDamage.begin(), newestDamage.end());
+		newestDamage.clear();
+		hasNewFrame = false;
+		lock.unlock();
+
+		const auto start = std::chrono::steady_clock::now();
+		try {
+			pShown->Present(presentedFrame.getPixels(), presentedDamage);
+		}
+		catch (...) {
+			lock.lock();
+			error = std::current_exception();
+			return;
+		}
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		lock.lock();
+		++stats.presentedFrames;
+		stats.presentSeconds += seconds;
+	}
+}
+
+/**
+	Copies areas of a frame into a surface of the size of the screen
+
+	@param pPixels The frame (Graphics::ScreenHeight rows of Graphics::ScreenWidth pixels)
+	@param areas Areas of the screen to be copied
+	@param target
+*/
+void ThreadedBackend::copyAreas(const Color* pPixels, const std::vector<RectI>& areas, Surface& target)
+{
+	for (const RectI& rect : areas) {
+		for (int y = rect.top; y < rect.bottom; ++y) {
+			memcpy(&target.getPixels()[Graphics::ScreenWidth * y + rect.left], &pPixels[Graphics::ScreenWidth * y + rect.left],
+				sizeof(Color) * (rect.right - rect.left));
+		}
+	}
+}
@@ -0,0 +1,66 @@
+/**
+	Backend which presents the frames on a thread of its own, so the game does not wait for another backend to upload
+	a frame and for the vertical sync
+
+	Present() copies the changed areas of the frame into the newest frame and returns. The thread presents the newest
+	frame whenever it is done with the one before; a frame handed over while the thread is still busy replaces the one
+	waiting (its changes are kept in the damage of the newest frame). What the thread presents is its own copy, which
+	the game never touches.
+	Presenting to a window can wait on the thread of the window (DXGI sends it messages), so when that thread stops
+	the backend it keeps processing its messages until the presenting thread has stopped, instead of blocking in a join.
+*/
+
+#pragma once
+#include "GraphicsBackend.h"
+#include "Surface.h"
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+
+class ThreadedBackend : public GraphicsBackend {
+public:
+	/**
+		Counters of the frames since the backend was constructed
+	*/
+	struct Stats {
+		int handedFrames = 0;	// Frames handed to Present()
+		int presentedFrames = 0;	// Frames the other backend presented
+		int replacedFrames = 0;	// Frames replaced by a newer one before they could be presented
+		double presentSeconds = 0.0;	// Time the other backend spent presenting (uploading and waiting for the sync)
+	};
+
+public:
+	ThreadedBackend(std::unique_ptr<GraphicsBackend> pShownIn, std::function<void()> processMessagesIn = nullptr);
+	ThreadedBackend(const ThreadedBackend&) = delete;
+	ThreadedBackend& operator=(const ThreadedBackend&) = delete;
+	~ThreadedBackend();
+
+	void Present(const Color* pPixels, const std::vector<RectI>& damage) override;
+	Stats getStats() const;
+
+private:
+	void present();
+	void presentFrames(std::unique_lock<std::mutex>& lock);
+	static void copyAreas(const Color* pPixels, const std::vector<RectI>& areas, Surface& target);
+
+private:
+	std::unique_ptr<GraphicsBackend> pShown;	// Presents the frames (D3D11 swap chain, memory, ...)
+	std::function<void()> processMessages;	// Processes the messages of the window while the thread stops (or nullptr)
+	Surface newestFrame;
+	std::vector<RectI> newestDamage;	// Areas of newestFrame which changed since the last presented frame
+	bool hasNewFrame = false;
+	Surface presentedFrame;	// (present thread only)
+	std::vector<RectI> presentedDamage;	// (present thread only)
+	std::exception_ptr error;	// Thrown by the other backend, thrown again by the next Present()
+	bool isStopping = false;
+	bool hasStopped = false;	// The thread left its loop
+	mutable std::mutex mutex;
+	std::condition_variable frameHanded;
+	std::condition_variable stopped;
+	Stats stats;
+	std::thread presenter;	// Started last, once everything it uses is constructed
+};
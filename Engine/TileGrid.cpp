@@ -0,0 +1,1004 @@
+#include "TileGrid.h"
+#include "ScanlineFill.h"
+#include "CounterRng.h"
+#include "MinePlacement.h"
+#include "Bits.h"
+#include <algorithm>
+#include <assert.h>
+#include <cstring>
+#include <functional>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TILEGRID_USE_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TILEGRID_USE_SSE2
+#endif
+
+namespace {
+	/**
+		Returns the amount of revealable states (Hidden or PartiallyRevealed, the high bit is clear) in a byte of the state plane
+
+		@param byte Four 2 bit states
+		@return nRevealable
+	*/
+	int countRevealableStates(std::uint8_t byte)
+	{
+		const int highBits = byte & 0xAA;
+		return 4 - ((highBits >> 1) & 1) - ((highBits >> 3) & 1) - ((highBits >> 5) & 1) - (highBits >> 7);
+	}
+
+	// Extra zeroed bytes at the end of each scratch row, so the vector loops may read past the last tile
+	constexpr int rowSlack = 32;
+
+	// Steps of a byte of the neighbour plane (the flagged neighbours are kept in the low 4 bits, the hidden ones in the high 4 bits)
+	constexpr std::uint8_t flaggedNeighbour = 0x01;
+	constexpr std::uint8_t hiddenNeighbour = 0x10;
+
+	/**
+		Returns a table which expands each bit of a byte into a byte of its own (bit k -> byte k, 0 or 1)
+
+		@return table
+	*/
+	const std::uint64_t* getBitToByteTable()
+	{
+		static const struct Table {
+			Table() {
+				for (int b = 0; b < 256; ++b) {
+					entries[b] = 0;
+					for (int k = 0; k < 8; ++k) {
+						entries[b] |= std::uint64_t((b >> k) & 1) << (8 * k);
+					}
+				}
+			}
+			std::uint64_t entries[256];
+		} table;
+		return table.entries;
+	}
+
+	/**
+		Sums three padded mine rows into a vertical sum row (sum[x] = above[x] + center[x] + below[x])
+
+		@param above
+		@param center
+		@param below
+		@param sum
+		@param n Amount of bytes to sum (may be rounded up to the vector width, rows are padded)
+	*/
+	void sumRows(const std::uint8_t* above, const std::uint8_t* center, const std::uint8_t* below, std::uint8_t* sum, int n)
+	{
+		int x = 0;
+	#if defined(TILEGRID_USE_AVX2)
+		for (; x < n; x += 32) {
+			const __m256i a = _mm256_loadu_si256((const __m256i*)(above + x));
+			const __m256i c = _mm256_loadu_si256((const __m256i*)(center + x));
+			const __m256i b = _mm256_loadu_si256((const __m256i*)(below + x));
+			_mm256_storeu_si256((__m256i*)(sum + x), _mm256_add_epi8(_mm256_add_epi8(a, c), b));
+		}
+	#elif defined(TILEGRID_USE_SSE2)
+		for (; x < n; x += 16) {
+			const __m128i a = _mm_loadu_si128((const __m128i*)(above + x));
+			const __m128i c = _mm_loadu_si128((const __m128i*)(center + x));
+			const __m128i b = _mm_loadu_si128((const __m128i*)(below + x));
+			_mm_storeu_si128((__m128i*)(sum + x), _mm_add_epi8(_mm_add_epi8(a, c), b));
+		}
+	#endif
+		for (; x < n; ++x) {
+			sum[x] = std::uint8_t(above[x] + center[x] + below[x]);
+		}
+	}
+
+	/**
+		Sums three neighbouring columns of a vertical sum row, excluding the center tile itself
+		(counts[x] = sum[x] + sum[x + 1] + sum[x + 2] - center[x + 1], the rows are shifted by the ghost border)
+
+		@param sum Vertical sum row (padded)
+		@param center Mine row of the tiles being counted (padded)
+		@param counts Output adjacent mine counts, one byte per tile (unpadded)
+		@param n Amount of tiles in the row
+	*/
+	void sumColumns(const std::uint8_t* sum, const std::uint8_t* center, std::uint8_t* counts, int n)
+	{
+		int x = 0;
+	#if defined(TILEGRID_USE_AVX2)
+		for (; x + 32 <= n; x += 32) {
+			const __m256i l = _mm256_loadu_si256((const __m256i*)(sum + x));
+			const __m256i m = _mm256_loadu_si256((const __m256i*)(sum + x + 1));
+			const __m256i r = _mm256_loadu_si256((const __m256i*)(sum + x + 2));
+			const __m256i c = _mm256_loadu_si256((const __m256i*)(center + x + 1));
+			_mm256_storeu_si256((__m256i*)(counts + x), _mm256_sub_epi8(_mm256_add_epi8(_mm256_add_epi8(l, m), r), c));
+		}
+	#elif defined(TILEGRID_USE_SSE2)
+		for (; x + 16 <= n; x += 16) {
+			const __m128i l = _mm_loadu_si128((const __m128i*)(sum + x));
+			const __m128i m = _mm_loadu_si128((const __m128i*)(sum + x + 1));
+			const __m128i r = _mm_loadu_si128((const __m128i*)(sum + x + 2));
+			const __m128i c = _mm_loadu_si128((const __m128i*)(center + x + 1));
+			_mm_storeu_si128((__m128i*)(counts + x), _mm_sub_epi8(_mm_add_epi8(_mm_add_epi8(l, m), r), c));
+		}
+	#endif
+		for (; x < n; ++x) {
+			counts[x] = std::uint8_t(sum[x] + sum[x + 1] + sum[x + 2] - center[x + 1]);
+		}
+	}
+
+	/**
+		Runs task(0) to task(nStripes - 1) on the pool, or one after the other on the calling thread if there is no pool
+
+		@param pool
+		@param nStripes
+		@param task
+	*/
+	template<typename Task>
+	void runStripes(ThreadPool* pool, int nStripes, const Task& task)
+	{
+		if (pool != nullptr) {
+			pool->parallelFor(nStripes, std::cref(task));	// Wrapped in a reference, so the std::function never allocates
+		}
+		else {
+			for (int stripe = 0; stripe < nStripes; ++stripe) {
+				task(stripe);
+			}
+		}
+	}
+}
+
+/**
+	Constructs a grid of hidden tiles without any mines
+
+	@param widthIn Width of the grid (in tiles)
+	@param heightIn Height of the grid (in tiles)
+*/
+TileGrid::TileGrid(int widthIn, int heightIn)
+	:
+	width(widthIn),
+	height(heightIn),
+	minePlane((getTileCount() + minesPerWord - 1) / minesPerWord, 0),
+	statePlane((getTileCount() + statesPerByte - 1) / statesPerByte, 0),
+	countPlane((getTileCount() + countsPerByte - 1) / countsPerByte, 0)
+{
+	assert(width > 0 && height > 0);
+}
+
+/**
+	Changes the size of the grid and resets every tile (See clear())
+	The planes keep their memory, so a grid which does not grow never allocates
+
+	@param widthIn Width of the grid (in tiles)
+	@param heightIn Height of the grid (in tiles)
+*/
+void TileGrid::resize(int widthIn, int heightIn)
+{
+	assert(widthIn > 0 && heightIn > 0);
+	width = widthIn;
+	height = heightIn;
+	minePlane.assign((getTileCount() + minesPerWord - 1) / minesPerWord, 0);
+	statePlane.assign((getTileCount() + statesPerByte - 1) / statesPerByte, 0);
+	countPlane.assign((getTileCount() + countsPerByte - 1) / countsPerByte, 0);
+	if (tracksNeighbours) {
+		countNeighbours();
+	}
+	if (tracksChanges) {
+		dirtyTiles.resize(getTileCount());
+	}
+}
+
+/**
+	Resets every tile back to hidden, without a mine and with 0 adjacent mines
+*/
+void TileGrid::clear()
+{
+	clearMines();
+	std::fill(countPlane.begin(), countPlane.end(), std::uint8_t(0));
+	hideAll();
+}
+
+/**
+	Turns every tile back to hidden, keeping the mines and the adjacent mine counts (The same field can be played again)
+*/
+void TileGrid::hideAll()
+{
+	std::fill(statePlane.begin(), statePlane.end(), std::uint8_t(0));	// State::Hidden is 0
+	if (tracksNeighbours) {
+		countNeighbours();
+	}
+	markAllChanged();
+}
+
+/**
+	Clears the grid of all mines
+*/
+void TileGrid::clearMines()
+{
+	std::fill(minePlane.begin(), minePlane.end(), std::uint64_t(0));
+	markAllChanged();
+}
+
+/**
+	Flags every hidden tile which contains a mine (Scans the mine plane a word at a time, skipping empty words)
+
+	@return flagged The amount of tiles which got flagged
+*/
+int TileGrid::flagHiddenMines()
+{
+	int flagged = 0;
+	for (int w = 0; w < (int)minePlane.size(); ++w) {
+		std::uint64_t word = minePlane[w];
+		while (word != 0) {
+			const int bit = Bits::lowestSetBit(word);
+			word &= word - 1;	// Clear the lowest set bit
+
+			const int index = w * minesPerWord + bit;
+			if (getState(index) == State::Hidden) {
+				setState(index, State::Flagged);
+				++flagged;
+			}
+		}
+	}
+	return flagged;
+}
+
+/**
+	Places mines on the grid, keeping the 3x3 box around the safe tile free of mines (so the first click opens an area)
+
+	The mines only depend on the seed and the size of the grid, never on the pool: a seed always gives the same board,
+	however many threads placed it. If the field is too full to keep the whole 3x3 box free,
+	only the safe tile itself is kept free.
+
+	@param nMines The amount of mines to place
+	@param safeIndex Index of the tile which was clicked
+	@param seed Seed of the counter-based random numbers
+	@param pool Threads to spread the work over (nullptr to place the mines on the calling thread)
+*/
+void TileGrid::placeMines(int nMines, int safeIndex, std::uint64_t seed, ThreadPool* pool)
+{
+	const int tileCount = getTileCount();
+	assert(nMines > 0 && nMines < tileCount);
+
+	// Sorted indices of the tiles which must stay free of mines
+	int excluded[9];
+	const int nExcluded = MinePlacement::getExcludedTiles(width, height, nMines, safeIndex, excluded);
+
+	if (tileCount < minSelectTileCount) {
+		shuffleMines(nMines, excluded, nExcluded, seed);
+	}
+	else {
+		selectMines(nMines, excluded, nExcluded, seed, pool);
+	}
+	markAllChanged();
+}
+
+/**
+	Places mines with a partial Fisher-Yates shuffle over the allowed tiles (See MinePlacement::shuffleMines())
+
+	@param nMines The amount of mines to place
+	@param excluded Sorted indices of the tiles which must stay free of mines
+	@param nExcluded
+	@param seed Seed of the counter-based random numbers (draw i uses number i of the sequence)
+*/
+void TileGrid::shuffleMines(int nMines, const int* excluded, int nExcluded, std::uint64_t seed)
+{
+	const int tileCount = getTileCount();
+	candidates.resize(tileCount - nExcluded);
+	clearMines();
+	MinePlacement::shuffleMines(tileCount, nMines, excluded, nExcluded, seed, candidates.data(), [this](int index) {
+		setMine(index, true);
+	});
+}
+
+/**
+	Places mines on the nMines allowed tiles with the smallest random keys (the key of tile i is number i of the sequence)
+
+	A key only depends on the seed and the index of its tile, so the grid is split into stripes of mine words
+	which are worked on independently:
+	1. Every stripe counts how many of its keys fall into each bucket (the top keyBucketBits bits of a key) and keeps
+	   the keys of the few buckets around the bucket where the nMines-th smallest key is expected to be
+	2. The bucket holding the nMines-th smallest allowed key is found from the summed counts, and the exact key is picked
+	   from the kept keys of that bucket (if it was not one of the expected buckets, the stripes collect its keys first)
+	3. Every stripe writes the mine words of its tiles, a tile gets a mine if its key is not above the picked key
+	The excluded tiles are only taken out after each pass, so the loops over the tiles stay free of branches.
+
+	@param nMines The amount of mines to place
+	@param excluded Sorted indices of the tiles which must stay free of mines
+	@param nExcluded
+	@param seed Seed of the counter-based random numbers
+	@param pool Threads to spread the stripes over (nullptr to work on the calling thread)
+*/
+void TileGrid::selectMines(int nMines, const int* excluded, int nExcluded, std::uint64_t seed, ThreadPool* pool)
+{
+	constexpr int nBuckets = 1 << keyBucketBits;
+	constexpr int bucketShift = 64 - keyBucketBits;
+	const int tileCount = getTileCount();
+	const int nWords = (int)minePlane.size();
+	const int nStripes = std::min(getStripeCount(pool), nWords);
+	auto getStripeWord = [nWords, nStripes](int stripe) {
+		return int(std::int64_t(nWords) * stripe / nStripes);
+	};
+	auto isExcluded = [excluded, nExcluded](int index) {
+		return std::binary_search(excluded, excluded + nExcluded, index);
+	};
+
+	// The keys are uniform, so the nMines-th smallest key lands within a bucket of its expected value almost always
+	const int nAllowed = tileCount - nExcluded;
+	const int expectedBucket = int(double(nMines) / double(nAllowed) * nBuckets);
+	const int keptBucketBegin = std::max(expectedBucket - 1, 0);
+	const int keptBucketEnd = std::min(expectedBucket + 2, nBuckets);
+	const std::uint32_t nKeptBuckets = std::uint32_t(keptBucketEnd - keptBucketBegin);
+
+	// 1. Bucket sizes of every stripe, and the keys of the expected buckets
+	keyHistograms.assign(std::size_t(nStripes) * nBuckets, 0);
+	boundaryKeys.resize(std::max((int)boundaryKeys.size(), nStripes));	// Never shrinks, so the buffers of the stripes are kept
+	runStripes(pool, nStripes, [&](int stripe) {
+		std::uint32_t* histogram = keyHistograms.data() + std::size_t(stripe) * nBuckets;
+		std::vector<MineKey>& keys = boundaryKeys[stripe];
+		keys.clear();
+		const int end = std::min(getStripeWord(stripe + 1) * minesPerWord, tileCount);
+		for (int index = getStripeWord(stripe) * minesPerWord; index < end; ++index) {
+			const std::uint64_t key = CounterRng::get(seed, std::uint64_t(index));
+			const int bucket = int(key >> bucketShift);
+			++histogram[bucket];
+			if (std::uint32_t(bucket - keptBucketBegin) < nKeptBuckets) {	// A single compare keeps the loop tight
+				keys.push_back({ key, index });
+			}
+		}
+	});
+	for (int i = 0; i < nExcluded; ++i) {
+		--keyHistograms[CounterRng::get(seed, std::uint64_t(excluded[i])) >> bucketShift];	// Sizes are only used summed
+	}
+
+	// 2. Bucket holding the nMines-th smallest allowed key, then the exact key inside of it
+	int boundaryBucket = 0;
+	int nBelowBoundary = 0;
+	for (;; ++boundaryBucket) {
+		assert(boundaryBucket < nBuckets);
+		int bucketSize = 0;
+		for (int stripe = 0; stripe < nStripes; ++stripe) {
+			bucketSize += keyHistograms[std::size_t(stripe) * nBuckets + boundaryBucket];
+		}
+		if (nBelowBoundary + bucketSize >= nMines) {
+			break;
+		}
+		nBelowBoundary += bucketSize;
+	}
+
+	if (boundaryBucket < keptBucketBegin || boundaryBucket >= keptBucketEnd) {
+		runStripes(pool, nStripes, [&](int stripe) {
+			std::vector<MineKey>& keys = boundaryKeys[stripe];
+			keys.clear();
+			const int end = std::min(getStripeWord(stripe + 1) * minesPerWord, tileCount);
+			for (int index = getStripeWord(stripe) * minesPerWord; index < end; ++index) {
+				const std::uint64_t key = CounterRng::get(seed, std::uint64_t(index));
+				if (int(key >> bucketShift) == boundaryBucket) {
+					keys.push_back({ key, index });
+				}
+			}
+		});
+	}
+	std::vector<MineKey>& keys = boundaryKeys[0];
+	for (int stripe = 1; stripe < nStripes; ++stripe) {
+		keys.insert(keys.end(), boundaryKeys[stripe].begin(), boundaryKeys[stripe].end());
+	}
+	keys.erase(std::remove_if(keys.begin(), keys.end(), [&](const MineKey& mineKey) {
+		return int(mineKey.key >> bucketShift) != boundaryBucket || isExcluded(mineKey.index);
+	}), keys.end());
+	const auto lastMine = keys.begin() + (nMines - nBelowBoundary - 1);
+	std::nth_element(keys.begin(), lastMine, keys.end());
+	const MineKey lastMineKey = *lastMine;
+
+	// 3. Mine words of every stripe (the stripes start on word boundaries, so no word is shared)
+	runStripes(pool, nStripes, [&](int stripe) {
+		const int wordEnd = getStripeWord(stripe + 1);
+		for (int word = getStripeWord(stripe); word < wordEnd; ++word) {
+			const int begin = word * minesPerWord;
+			const int n = std::min(int(minesPerWord), tileCount - begin);
+			std::uint64_t bits = 0;
+			for (int bit = 0; bit < n; ++bit) {
+				// Same as !(lastMineKey < mineKey), without branches (the outcome is random, so it would be mispredicted)
+				const std::uint64_t key = CounterRng::get(seed, std::uint64_t(begin + bit));
+				const int isMine = int(key < lastMineKey.key) | (int(key == lastMineKey.key) & int(begin + bit <= lastMineKey.index));
+				bits |= std::uint64_t(isMine) << bit;
+			}
+			minePlane[word] = bits;
+		}
+	});
+	for (int i = 0; i < nExcluded; ++i) {
+		minePlane[excluded[i] / minesPerWord] &= ~(std::uint64_t(1) << (excluded[i] % minesPerWord));
+	}
+}
+
+/**
+	Sets the adjacent mine count of every tile of the grid
+
+	@param pool Threads to spread the rows over (nullptr to count on the calling thread)
+*/
+void TileGrid::countAdjacentMines(ThreadPool* pool)
+{
+	markAllChanged();
+	if (pool == nullptr) {
+		countAdjacentMines(0, height, countScratch);
+		return;
+	}
+
+	// A stripe must start on an even tile index, so with an odd width the stripes start on even rows
+	const int nStripes = std::min(getStripeCount(pool), height);
+	auto getStripeRow = [this, nStripes](int stripe) {
+		const int row = int(std::int64_t(height) * stripe / nStripes);
+		return std::min(width % 2 != 0 ? row + row % 2 : row, height);
+	};
+
+	stripeScratch.resize(std::max((int)stripeScratch.size(), nStripes));	// Never shrinks, so the buffers of the stripes are kept
+	runStripes(pool, nStripes, [&](int stripe) {
+		countAdjacentMines(getStripeRow(stripe), getStripeRow(stripe + 1), stripeScratch[stripe]);
+	});
+}
+
+/**
+	Sets the adjacent mine counts of the tiles in rows [rowBegin, rowEnd)
+
+	Works a row at a time: the mine rows above, at and below are unpacked into byte rows with a ghost border of empty
+	tiles around them (so no tile needs its 3x3 box clamped), summed vertically and then horizontally with SIMD.
+	Rows only write the count plane of their own tiles, so disjoint row ranges may be counted concurrently
+	as long as each caller passes its own scratch buffer and the ranges start on an even tile index.
+
+	@param rowBegin First row to count
+	@param rowEnd One past the last row to count
+	@param scratch Buffer reused for the padded rows (resized when too small)
+*/
+void TileGrid::countAdjacentMines(int rowBegin, int rowEnd, std::vector<std::uint8_t>& scratch)
+{
+	assert(rowBegin >= 0 && rowBegin <= rowEnd && rowEnd <= height);
+	const int stride = width + 2 + rowSlack;
+	if ((int)scratch.size() < stride * 5) {
+		scratch.resize(stride * 5);
+	}
+	std::memset(scratch.data(), 0, stride * 5);
+
+	std::uint8_t* rows[3] = { scratch.data(), scratch.data() + stride, scratch.data() + stride * 2 };
+	std::uint8_t* sum = scratch.data() + stride * 3;
+	std::uint8_t* counts = scratch.data() + stride * 4;
+
+	// Rows outside of the grid stay zeroed (ghost border)
+	if (rowBegin > 0) {
+		unpackMineRow(rowBegin - 1, rows[0]);
+	}
+	if (rowBegin < height) {
+		unpackMineRow(rowBegin, rows[1]);
+	}
+
+	for (int y = rowBegin; y < rowEnd; ++y) {
+		if (y + 1 < height) {
+			unpackMineRow(y + 1, rows[2]);
+		}
+		else {
+			std::memset(rows[2], 0, stride);
+		}
+
+		sumRows(rows[0], rows[1], rows[2], sum, width + 2);
+		sumColumns(sum, rows[1], counts, width);
+
+		// Pack the byte counts into the nibbles of the count plane
+		int index = y * width;
+		int x = 0;
+		if (index % countsPerByte != 0) {
+			setAdjacentMineCount(index++, counts[x++]);
+		}
+		for (; x + 1 < width; x += 2, index += 2) {
+			countPlane[index / countsPerByte] = std::uint8_t(counts[x] | (counts[x + 1] << 4));
+		}
+		if (x < width) {
+			setAdjacentMineCount(index, counts[x]);
+		}
+
+		// Rotate the rows, the center row becomes the row above
+		std::uint8_t* oldAbove = rows[0];
+		rows[0] = rows[1];
+		rows[1] = rows[2];
+		rows[2] = oldAbove;
+	}
+}
+
+/**
+	Reveals the tile at input index and, if it has 0 adjacent mines, the whole opening around it (See ScanlineFill::reveal)
+
+	@param index Index of a revealable tile without a mine
+	@return revealed The amount of tiles which got revealed
+*/
+int TileGrid::floodReveal(int index)
+{
+	assert(isRevealable(index) && !hasMine(index));
+
+	// Exposes the grid to the scanline fill by tile location
+	struct FillView {
+		TileGrid& grid;
+		bool contains(int x, int y) const { return x >= 0 && x < grid.width && y >= 0 && y < grid.height; }
+		bool isRevealable(int x, int y) const { return grid.isRevealable(y * grid.width + x); }
+		bool isEmpty(int x, int y) const { return grid.getAdjacentMineCount(y * grid.width + x) == 0; }
+		void reveal(int x, int y) { grid.setState(y * grid.width + x, State::Revealed); }
+	} view = { *this };
+
+	return ScanlineFill::reveal(view, index % width, index / width, fillStack);
+}
+
+/**
+	Reveals every revealable tile in [begin, end), four tiles (a byte of the state plane) at a time
+	(A state is revealable when its high bit is clear, Hidden and PartiallyRevealed both become Revealed)
+
+	@param begin Index of the first tile
+	@param end One past the index of the last tile
+	@return revealed The amount of tiles which got revealed
+*/
+int TileGrid::revealRange(int begin, int end)
+{
+	assert(begin >= 0 && begin <= end && end <= getTileCount());
+	int revealed = 0;
+	int index = begin;
+	for (; index < end && index % statesPerByte != 0; ++index) {
+		if (isRevealable(index)) {
+			setState(index, State::Revealed);
+			++revealed;
+		}
+	}
+	for (; index + statesPerByte <= end; index += statesPerByte) {
+		std::uint8_t& byte = statePlane[index / statesPerByte];
+		const std::uint8_t revealable = std::uint8_t(~byte & 0xAA);	// High bit of every revealable state
+		revealed += countRevealableStates(byte);
+		byte = std::uint8_t((byte & ~(revealable | (revealable >> 1))) | revealable);
+		if (tracksNeighbours || tracksChanges) {
+			for (std::uint64_t bits = revealable; bits != 0; bits &= bits - 1) {
+				const int revealedIndex = index + Bits::lowestSetBit(bits) / 2;
+				if (tracksNeighbours) {
+					addToNeighbours(revealedIndex, std::uint8_t(-hiddenNeighbour));
+				}
+				markChanged(revealedIndex);
+			}
+		}
+	}
+	for (; index < end; ++index) {
+		if (isRevealable(index)) {
+			setState(index, State::Revealed);
+			++revealed;
+		}
+	}
+	return revealed;
+}
+
+/**
+	Returns true if the tile at input index has a mine
+
+	@param index
+	@return bool
+*/
+bool TileGrid::hasMine(int index) const
+{
+	assert(index >= 0 && index < getTileCount());
+	return (minePlane[index / minesPerWord] >> (index % minesPerWord)) & 1u;
+}
+
+/**
+	Sets whether or not the tile at input index contains a mine
+
+	@param index
+	@param set mine or !mine
+*/
+void TileGrid::setMine(int index, bool set)
+{
+	assert(hasMine(index) != set);
+	const std::uint64_t bit = std::uint64_t(1) << (index % minesPerWord);
+	if (set) {
+		minePlane[index / minesPerWord] |= bit;
+	}
+	else {
+		minePlane[index / minesPerWord] &= ~bit;
+	}
+	markChanged(index);
+}
+
+/**
+	Returns the state of the tile at input index
+
+	@param index
+	@return state
+*/
+TileGrid::State TileGrid::getState(int index) const
+{
+	assert(index >= 0 && index < getTileCount());
+	const int shift = (index % statesPerByte) * 2;
+	return State((statePlane[index / statesPerByte] >> shift) & 0b11);
+}
+
+/**
+	Returns true if the tile at input index can be revealed (it is hidden or partially revealed)
+
+	@param index
+	@return bool
+*/
+bool TileGrid::isRevealable(int index) const
+{
+	const State state = getState(index);
+	return state == State::Hidden || state == State::PartiallyRevealed;
+}
+
+/**
+	Returns the amount of revealable tiles in [begin, end), four tiles (a byte of the state plane) at a time
+
+	@param begin Index of the first tile
+	@param end One past the index of the last tile
+	@return nRevealable
+*/
+int TileGrid::countRevealable(int begin, int end) const
+{
+	assert(begin >= 0 && begin <= end && end <= getTileCount());
+	int nRevealable = 0;
+	int index = begin;
+	for (; index < end && index % statesPerByte != 0; ++index) {
+		nRevealable += isRevealable(index);
+	}
+	for (; index + statesPerByte <= end; index += statesPerByte) {
+		nRevealable += countRevealableStates(statePlane[index / statesPerByte]);
+	}
+	for (; index < end; ++index) {
+		nRevealable += isRevealable(index);
+	}
+	return nRevealable;
+}
+
+/**
+	Sets the state of the tile at input index
+
+	@param index
+	@param stateIn
+*/
+void TileGrid::setState(int index, State stateIn)
+{
+	const State state = getState(index);
+	switch (stateIn) {
+	case State::Revealed:
+		assert(state == State::Hidden || state == State::PartiallyRevealed);
+		break;
+	case State::PartiallyRevealed:
+		assert(state == State::Hidden);
+		break;
+	case State::Hidden:
+		assert(state != State::Hidden);
+		break;
+	case State::Flagged:
+		assert(state == State::Hidden);
+		break;
+	}
+	const int shift = (index % statesPerByte) * 2;
+	std::uint8_t& byte = statePlane[index / statesPerByte];
+	byte = std::uint8_t((byte & ~(0b11 << shift)) | ((int)stateIn << shift));
+
+	if (tracksNeighbours) {
+		// Hidden and PartiallyRevealed both count as hidden, so only flagging and revealing change the neighbours
+		const int flaggedChange = int(stateIn == State::Flagged) - int(state == State::Flagged);
+		const int hiddenChange = int(int(stateIn) < int(State::Revealed)) - int(int(state) < int(State::Revealed));
+		if (flaggedChange != 0 || hiddenChange != 0) {
+			addToNeighbours(index, std::uint8_t(flaggedChange * flaggedNeighbour + hiddenChange * hiddenNeighbour));
+		}
+	}
+	markChanged(index);
+}
+
+/**
+	Returns the amount of mines adjacent to the tile at input index
+
+	@param index
+	@return adjacentMineCount
+*/
+int TileGrid::getAdjacentMineCount(int index) const
+{
+	assert(index >= 0 && index < getTileCount());
+	const int shift = (index % countsPerByte) * 4;
+	return (countPlane[index / countsPerByte] >> shift) & 0xF;
+}
+
+/**
+	Sets the number of mines which are adjacent to the tile at input index
+
+	@param index
+	@param count
+*/
+void TileGrid::setAdjacentMineCount(int index, int count)
+{
+	assert(index >= 0 && index < getTileCount());
+	assert(count >= 0 && count <= 0xF);
+	const int shift = (index % countsPerByte) * 4;
+	std::uint8_t& byte = countPlane[index / countsPerByte];
+	byte = std::uint8_t((byte & ~(0xF << shift)) | (count << shift));
+}
+
+/**
+	Sets whether every tile keeps count of its flagged and hidden neighbours, updated as the states change
+	(Costs 1 byte per tile and a little work on every reveal, but makes checking a chord a constant time lookup)
+
+	@param tracksNeighboursIn
+*/
+void TileGrid::setTracksNeighbours(bool tracksNeighboursIn)
+{
+	if (tracksNeighboursIn == tracksNeighbours) {
+		return;
+	}
+	tracksNeighbours = tracksNeighboursIn;
+	if (tracksNeighbours) {
+		countNeighbours();
+	}
+	else {
+		neighbourPlane.clear();
+	}
+}
+
+/**
+	Sets whether the grid keeps a list of the tiles which changed (their state or mine) since they were last drawn
+	(See getDirtyTiles(), changes which touch the whole grid mark every tile at once)
+
+	@param tracksChangesIn
+*/
+void TileGrid::setTracksChanges(bool tracksChangesIn)
+{
+	if (tracksChangesIn == tracksChanges) {
+		return;
+	}
+	tracksChanges = tracksChangesIn;
+	if (tracksChanges) {
+		dirtyTiles.resize(getTileCount());
+	}
+	else {
+		dirtyTiles = DirtyTiles();
+	}
+}
+
+/**
+	Returns the tiles which changed since they were last drawn (Only while the changes are tracked),
+	whoever draws them clears the list
+
+	@return dirtyTiles
+*/
+DirtyTiles& TileGrid::getDirtyTiles()
+{
+	assert(tracksChanges);
+	return dirtyTiles;
+}
+
+/**
+	Returns the amount of flagged tiles around the tile at input index (Only while the neighbours are tracked)
+
+	@param index
+	@return nFlagged
+*/
+int TileGrid::getFlaggedNeighbourCount(int index) const
+{
+	assert(tracksNeighbours);
+	assert(index >= 0 && index < getTileCount());
+	return neighbourPlane[index] & 0xF;
+}
+
+/**
+	Returns the amount of hidden (or partially revealed) tiles around the tile at input index (Only while the neighbours are tracked)
+
+	@param index
+	@return nHidden
+*/
+int TileGrid::getHiddenNeighbourCount(int index) const
+{
+	assert(tracksNeighbours);
+	assert(index >= 0 && index < getTileCount());
+	return neighbourPlane[index] >> 4;
+}
+
+/**
+	Returns the width of the grid (in tiles)
+
+	@return width
+*/
+int TileGrid::getWidth() const
+{
+	return width;
+}
+
+/**
+	Returns the height of the grid (in tiles)
+
+	@return height
+*/
+int TileGrid::getHeight() const
+{
+	return height;
+}
+
+/**
+	Returns the amount of tiles in the grid
+
+	@return tileCount
+*/
+int TileGrid::getTileCount() const
+{
+	return width * height;
+}
+
+/**
+	Converts a tile location to the index of the tile in the planes
+
+	@param x
+	@param y
+	@return index
+*/
+int TileGrid::indexOf(int x, int y) const
+{
+	assert(x >= 0 && x < width && y >= 0 && y < height);
+	return y * width + x;
+}
+
+/**
+	Adds input step to the neighbour counts of every tile around the tile at input index
+
+	@param index
+	@param delta Step added to each byte of the neighbour plane (wraps around to subtract)
+*/
+void TileGrid::addToNeighbours(int index, std::uint8_t delta)
+{
+	const int x = index % width;
+	const int y = index / width;
+	if (x > 0 && x < width - 1 && y > 0 && y < height - 1) {
+		std::uint8_t* above = &neighbourPlane[index - width];
+		std::uint8_t* center = &neighbourPlane[index];
+		std::uint8_t* below = &neighbourPlane[index + width];
+		above[-1] += delta;
+		above[0] += delta;
+		above[1] += delta;
+		center[-1] += delta;
+		center[1] += delta;
+		below[-1] += delta;
+		below[0] += delta;
+		below[1] += delta;
+		return;
+	}
+	for (int ny = std::max(0, y - 1); ny <= std::min(height - 1, y + 1); ++ny) {
+		for (int nx = std::max(0, x - 1); nx <= std::min(width - 1, x + 1); ++nx) {
+			if (nx != x || ny != y) {
+				neighbourPlane[ny * width + nx] += delta;
+			}
+		}
+	}
+}
+
+/**
+	Sets the neighbour counts of every tile from the current states
+*/
+void TileGrid::countNeighbours()
+{
+	neighbourPlane.assign(getTileCount(), 0);
+	for (int index = 0; index < getTileCount(); ++index) {
+		const State state = getState(index);
+		if (state == State::Flagged) {
+			addToNeighbours(index, flaggedNeighbour);
+		}
+		else if (state != State::Revealed) {
+			addToNeighbours(index, hiddenNeighbour);
+		}
+	}
+}
+
+/**
+	Lists the tile at input index as changed (if the changes are tracked)
+
+	@param index
+*/
+void TileGrid::markChanged(int index)
+{
+	if (tracksChanges) {
+		dirtyTiles.mark(index);
+	}
+}
+
+/**
+	Marks every tile as changed (if the changes are tracked)
+*/
+void TileGrid::markAllChanged()
+{
+	if (tracksChanges) {
+		dirtyTiles.markAll();
+	}
+}
+
+/**
+	Returns the amount of stripes the grid gets split into for the work spread over a pool
+	(A few per thread, so a thread which finishes early can pick up another stripe)
+
+	@param pool (nullptr if the work is done on the calling thread)
+	@return nStripes
+*/
+int TileGrid::getStripeCount(ThreadPool* pool) const
+{
+	constexpr int stripesPerThread = 4;
+	return pool != nullptr ? pool->getThreadCount() * stripesPerThread : 1;
+}
+
+/**
+	Returns up to 57 consecutive bits of the mine plane starting at input index
+
+	@param index Index of the first tile
+	@param count Amount of bits to return
+	@return bits
+*/
+std::uint64_t TileGrid::getMineBits(int index, int count) const
+{
+	assert(count > 0 && count <= 57);
+	const int word = index / minesPerWord;
+	const int shift = index % minesPerWord;
+	std::uint64_t bits = minePlane[word] >> shift;
+	if (shift + count > minesPerWord) {
+		bits |= minePlane[word + 1] << (minesPerWord - shift);
+	}
+	return bits & ((std::uint64_t(1) << count) - 1);
+}
+
+/**
+	Returns up to 57 consecutive tiles starting at input index as bits, set for the empty tiles (no mine and 0 adjacent mines)
+
+	@param index Index of the first tile
+	@param count Amount of tiles
+	@return bits
+*/
+std::uint64_t TileGrid::getEmptyBits(int index, int count) const
+{
+	std::uint64_t hasCount = 0;
+	for (int i = 0; i < count; ++i) {
+		const int shift = ((index + i) % countsPerByte) * 4;
+		hasCount |= std::uint64_t(((countPlane[(index + i) / countsPerByte] >> shift) & 0xF) != 0) << i;
+	}
+	return ~(getMineBits(index, count) | hasCount) & ((std::uint64_t(1) << count) - 1);
+}
+
+/**
+	Returns the states of up to 28 consecutive tiles starting at input index, 2 bits per tile (as State values)
+
+	@param index Index of the first tile
+	@param count Amount of tiles
+	@return bits
+*/
+std::uint64_t TileGrid::getStateBits(int index, int count) const
+{
+	assert(count > 0 && count <= 28);
+	assert(index >= 0 && index + count <= getTileCount());
+	const int first = index / statesPerByte;
+	const int last = (index + count - 1) / statesPerByte;
+	std::uint64_t bits = 0;
+	for (int byte = last; byte >= first; --byte) {
+		bits = (bits << 8) | statePlane[byte];
+	}
+	return (bits >> ((index % statesPerByte) * 2)) & ((std::uint64_t(1) << (count * 2)) - 1);
+}
+
+/**
+	Unpacks the mines of a row into one byte per tile, leaving a zero byte in front of the row for the ghost border
+
+	@param y Row to unpack
+	@param out Padded output row (width + 2 bytes)
+*/
+void TileGrid::unpackMineRow(int y, std::uint8_t* out) const
+{
+	const std::uint64_t* bitToByte = getBitToByteTable();
+	const int rowStart = y * width;
+	out[0] = 0;
+	int x = 0;
+	for (; x + 8 <= width; x += 8) {
+		const std::uint64_t bytes = bitToByte[getMineBits(rowStart + x, 8)];
+		std::memcpy(out + 1 + x, &bytes, sizeof(bytes));
+	}
+	for (; x < width; ++x) {
+		out[1 + x] = std::uint8_t(hasMine(rowStart + x));
+	}
+	out[width + 1] = 0;
+}
+
+/**
+	Returns the amount of memory held by the planes (in bytes)
+
+	@return bytes
+*/
+std::size_t TileGrid::getMemoryUsage() const
+{
+	return minePlane.size() * sizeof(std::uint64_t) + statePlane.size() + countPlane.size() + neighbourPlane.size()
+		+ dirtyTiles.getMemoryUsage();
+}
@@ -0,0 +1,109 @@
+/**
+	Bit-packed storage of the tiles of a minefield
+
+	Instead of keeping one object per tile, each property of the tiles is kept in its own plane:
+	1 bit per tile for mines, 2 bits per tile for the state and 4 bits per tile for the adjacent mine count.
+	A tile is addressed by its index (y * width + x), its position is never stored.
+*/
+
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Vei2.h"
+#include "ThreadPool.h"
+#include "DirtyTiles.h"
+
+class TileGrid {
+public:
+	enum class State {
+		Hidden,
+		PartiallyRevealed,
+		Revealed,
+		Flagged,
+	};
+
+public:
+	TileGrid() = default;
+	TileGrid(int widthIn, int heightIn);
+
+	void resize(int widthIn, int heightIn);
+	void clear();
+	void clearMines();
+	void hideAll();
+	int flagHiddenMines();
+	void placeMines(int nMines, int safeIndex, std::uint64_t seed, ThreadPool* pool = nullptr);
+	void countAdjacentMines(ThreadPool* pool = nullptr);
+	void countAdjacentMines(int rowBegin, int rowEnd, std::vector<std::uint8_t>& scratch);
+	int floodReveal(int index);
+	int revealRange(int begin, int end);
+	void setTracksNeighbours(bool tracksNeighboursIn);
+	void setTracksChanges(bool tracksChangesIn);
+	DirtyTiles& getDirtyTiles();
+
+	bool hasMine(int index) const;
+	void setMine(int index, bool set);
+	State getState(int index) const;
+	bool isRevealable(int index) const;
+	int countRevealable(int begin, int end) const;
+	void setState(int index, State stateIn);
+	int getAdjacentMineCount(int index) const;
+	std::uint64_t getEmptyBits(int index, int count) const;
+	std::uint64_t getStateBits(int index, int count) const;
+	void setAdjacentMineCount(int index, int count);
+	int getFlaggedNeighbourCount(int index) const;
+	int getHiddenNeighbourCount(int index) const;
+
+	int getWidth() const;
+	int getHeight() const;
+	int getTileCount() const;
+	int indexOf(int x, int y) const;
+	std::size_t getMemoryUsage() const;
+
+private:
+	/**
+		Random key of an allowed tile, the tiles with the smallest keys get the mines (See selectMines())
+	*/
+	struct MineKey {
+		std::uint64_t key;
+		int index;
+		bool operator<(const MineKey& rhs) const { return key < rhs.key || (key == rhs.key && index < rhs.index); }
+	};
+
+private:
+	void shuffleMines(int nMines, const int* excluded, int nExcluded, std::uint64_t seed);
+	void selectMines(int nMines, const int* excluded, int nExcluded, std::uint64_t seed, ThreadPool* pool);
+	int getStripeCount(ThreadPool* pool) const;
+	void addToNeighbours(int index, std::uint8_t delta);
+	void countNeighbours();
+	void markChanged(int index);
+	void markAllChanged();
+	std::uint64_t getMineBits(int index, int count) const;
+	void unpackMineRow(int y, std::uint8_t* out) const;
+
+public:
+	static constexpr int statesPerByte = 4;
+	static constexpr int countsPerByte = 2;
+	static constexpr int minesPerWord = 64;
+	// Grids with at least this many tiles place their mines with selectMines(), which can be split across threads
+	static constexpr int minSelectTileCount = 1 << 20;
+	static constexpr int keyBucketBits = 12;	// The top bits of the mine keys used to bucket them in selectMines()
+
+private:
+	int width = 0;
+	int height = 0;
+	std::vector<std::uint64_t> minePlane;	// 1 bit per tile
+	std::vector<std::uint8_t> statePlane;	// 2 bits per tile
+	std::vector<std::uint8_t> countPlane;	// 4 bits per tile
+	// 1 byte per tile while the neighbours are tracked: flagged neighbours in the low 4 bits, hidden ones in the high 4 bits
+	std::vector<std::uint8_t> neighbourPlane;
+	bool tracksNeighbours = false;
+	DirtyTiles dirtyTiles;	// Tiles which changed since they were last drawn, while the changes are tracked
+	bool tracksChanges = false;
+	std::vector<std::uint8_t> countScratch;	// Padded rows used by countAdjacentMines()
+	std::vector<int> candidates;	// Shuffled positions used by shuffleMines()
+	std::vector<std::uint32_t> keyHistograms;	// Key bucket sizes of each stripe used by selectMines()
+	std::vector<std::vector<MineKey>> boundaryKeys;	// Keys of the boundary bucket of each stripe used by selectMines()
+	std::vector<std::vector<std::uint8_t>> stripeScratch;	// Padded rows of each stripe used by countAdjacentMines()
+	std::vector<Vei2> fillStack;	// Seeds of the spans still to be filled by floodReveal()
+};
@@ -0,0 +1,110 @@
+#include "TileImages.h"
+#include <algorithm>
+#include <assert.h>
+
+/**
+	Returns true once build() was called
+
+	@return bool
+*/
+bool TileImages::isBuilt() const
+{
+	return lookCount > 0;
+}
+
+/**
+	Returns the average color of a look (what it looks like at 1 pixel per tile)
+
+	@param look
+	@return color
+*/
+Color TileImages::getColor(int look) const
+{
+	return getImage(look, 0).getPixels()[0];
+}
+
+/**
+	Returns the amount of memory held by the images (in bytes)
+
+	@return bytes
+*/
+std::size_t TileImages::getMemoryUsage() const
+{
+	std::size_t bytes = images.capacity() * sizeof(Surface);
+	for (const Surface& image : images) {
+		bytes += image.getMemoryUsage();
+	}
+	return bytes;
+}
+
+/**
+	Scales the images drawn at nativeZoom to every other zoom
+*/
+void TileImages::scaleNativeImages()
+{
+	for (int look = 0; look < lookCount; ++look) {
+		const Surface& native = getImage(look, Camera::nativeZoom);
+		for (int zoom = 0; zoom <= Camera::maxZoom; ++zoom) {
+			if (zoom == Camera::nativeZoom) {
+				continue;
+			}
+			const int size = 1 << zoom;
+			Surface& image = getImage(look, zoom);
+			image.resize(size, size);
+			if (size < tileSize) {
+				// Each pixel is the average of the block of native pixels it covers
+				const int block = tileSize / size;
+				for (int y = 0; y < size; ++y) {
+					for (int x = 0; x < size; ++x) {
+						int r = 0, g = 0, b = 0;
+						for (int by = 0; by < block; ++by) {
+							for (int bx = 0; bx < block; ++bx) {
+								const Color c = native.getPixels()[tileSize * (y * block + by) + x * block + bx];
+								r += c.GetR();
+								g += c.GetG();
+								b += c.GetB();
+							}
+						}
+						const int n = block * block;
+						image.getPixels()[size * y + x] = Color((unsigned char)(r / n), (unsigned char)(g / n), (unsigned char)(b / n));
+					}
+				}
+			}
+			else {
+				// Each native pixel becomes a block of pixels
+				const int block = size / tileSize;
+				for (int y = 0; y < size; ++y) {
+					for (int x = 0; x < size; ++x) {
+						image.getPixels()[size * y + x] = native.getPixels()[tileSize * (y / block) + x / block];
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+	Returns the image of a look at a zoom
+
+	@param look
+	@param zoom From 0 to Camera::maxZoom
+	@return image
+*/
+Surface& TileImages::getImage(int look, int zoom)
+{
+	assert(look >= 0 && look < lookCount && zoom >= 0 && zoom <= Camera::maxZoom);
+	return images[std::size_t(zoom) * lookCount + look];
+}
+
+/**
+	Returns the image of a look at a zoom
+
+	@param look
+	@param zoom From 0 to Camera::maxZoom
+	@return image
+*/
+const Surface& TileImages::getImage(int look, int zoom) const
+{
+	assert(look >= 0 && look < lookCount && zoom >= 0 && zoom <= Camera::maxZoom);
+	return images[std::size_t(zoom) * lookCount + look];
+}
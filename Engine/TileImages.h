@@ -0,0 +1,75 @@
+/**
+	Images of every look a tile can have, at every zoom of the camera
+
+	Each look is drawn once at the size of the sprites (through the usual tile drawing code), then scaled to
+	2^zoom pixels for each zoom from 0 to Camera::maxZoom: averaged down when zooming out, repeated when zooming in.
+	Drawing a tile at any zoom is then a copy of a small surface.
+*/
+
+#pragma once
+#include "Graphics.h"
+#include "Surface.h"
+#include "Camera.h"
+#include "SpriteCodex.h"
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+class TileImages {
+public:
+	template<typename DrawLook>
+	void build(Graphics& gfx, int lookCountIn, DrawLook drawLook);
+	bool isBuilt() const;
+	template<typename Target>
+	void draw(Target& target, int look, int zoom, const Vei2& position) const;
+	Color getColor(int look) const;
+	std::size_t getMemoryUsage() const;
+
+	static constexpr int tileSize = SpriteCodex::tileSize;
+
+private:
+	void scaleNativeImages();
+	Surface& getImage(int look, int zoom);
+	const Surface& getImage(int look, int zoom) const;
+
+private:
+	int lookCount = 0;
+	std::vector<Surface> images;	// images[zoom * lookCount + look]
+};
+
+/**
+	Draws every look at the size of the sprites and scales them to every zoom
+
+	@param gfx Graphics processor (its render target is restored to the screen afterwards)
+	@param lookCountIn The amount of looks (looks are numbered from 0)
+	@param drawLook Called as drawLook(look, position) to draw a look over the base color, at its position on the screen
+*/
+template<typename DrawLook>
+void TileImages::build(Graphics& gfx, int lookCountIn, DrawLook drawLook)
+{
+	lookCount = lookCountIn;
+	images.resize(std::size_t(lookCount) * (Camera::maxZoom + 1));
+	for (int look = 0; look < lookCount; ++look) {
+		Surface& image = getImage(look, Camera::nativeZoom);
+		image.resize(tileSize, tileSize);
+		gfx.SetRenderTarget(image, Vei2(0, 0));
+		gfx.DrawRect(0, 0, tileSize, tileSize, SpriteCodex::baseColor);
+		drawLook(look, Vei2(0, 0));
+	}
+	gfx.ResetRenderTarget();
+	scaleNativeImages();
+}
+
+/**
+	Draws a look at input zoom (below zoom 0 it is a single pixel, like at zoom 0)
+
+	@param target Graphics processor or Canvas drawn into
+	@param look The look to be drawn
+	@param zoom Zoom of the camera
+	@param position Screen position of the top-left corner of the tile (the tile is clipped to the render target)
+*/
+template<typename Target>
+void TileImages::draw(Target& target, int look, int zoom, const Vei2& position) const
+{
+	target.DrawSurface(getImage(look, std::max(zoom, 0)), position);
+}
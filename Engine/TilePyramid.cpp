@@ -0,0 +1,365 @@
+#include "TilePyramid.h"
+#include "Bits.h"
+#include <algorithm>
+#include <functional>
+#include <assert.h>
+
+constexpr int TilePyramid::tilesPerChunk;	// Taken by reference by std::min
+
+/**
+	Sizes the levels to the grid and summarizes every tile of it
+
+	@param grid The tiles of the board
+	@param pool Threads to split the rows of each level across (nullptr to build on the calling thread)
+*/
+void TilePyramid::rebuild(const TileGrid& grid, ThreadPool* pool)
+{
+	boardWidth = grid.getWidth();
+	boardHeight = grid.getHeight();
+	levelCount = 0;
+	int width = boardWidth;
+	int height = boardHeight;
+	do {
+		width = (width + 1) / 2;
+		height = (height + 1) / 2;
+		++levelCount;
+	} while (width > 1 || height > 1);
+
+	// The cells are resized in place, so a board no larger than the ones before allocates nothing
+	levels.resize(std::max((int)levels.size(), levelCount));
+	width = boardWidth;
+	height = boardHeight;
+	for (int level = 1; level <= levelCount; ++level) {
+		width = (width + 1) / 2;
+		height = (height + 1) / 2;
+		levels[level - 1].width = width;
+		levels[level - 1].height = height;
+		levels[level - 1].cells.resize(std::size_t(width) * height);
+	}
+
+	// The rows of a level only write their own cells, so each level is split into stripes of rows
+	for (int level = 1; level <= levelCount; ++level) {
+		const int rows = levels[level - 1].height;
+		const int nStripes = pool != nullptr ? std::min(pool->getThreadCount() * stripesPerThread, rows) : 1;
+		auto buildStripe = [&](int stripe) {
+			const int rowBegin = int(std::int64_t(rows) * stripe / nStripes);
+			const int rowEnd = int(std::int64_t(rows) * (stripe + 1) / nStripes);
+			if (level == 1) {
+				buildFirstLevel(grid, rowBegin, rowEnd);
+			}
+			else {
+				buildLevel(level, rowBegin, rowEnd);
+			}
+		};
+		if (nStripes > 1) {
+			pool->parallelFor(nStripes, std::cref(buildStripe));	// Wrapped in a reference, so the std::function never allocates
+		}
+		else {
+			buildStripe(0);
+		}
+	}
+}
+
+/**
+	Brings the cells up to date with the changed tiles of the grid (rebuilt if every tile changed or it was resized)
+
+	@param grid The tiles of the board
+	@param dirtyTiles The tiles which changed since the last update (left as they are, BoardLayer clears them)
+	@param pool Threads to rebuild with (nullptr to rebuild on the calling thread)
+	@return bool True if any tile changed
+*/
+bool TilePyramid::update(const TileGrid& grid, const DirtyTiles& dirtyTiles, ThreadPool* pool)
+{
+	if (dirtyTiles.hasAll() || grid.getWidth() != boardWidth || grid.getHeight() != boardHeight) {
+		rebuild(grid, pool);
+		return true;
+	}
+	for (int index : dirtyTiles.getTiles()) {
+		int x = (index % boardWidth) / 2;
+		int y = (index / boardWidth) / 2;
+		Cell cell = summarizeTiles(grid, x, y);
+		for (int level = 1; getCell(level, x, y) != cell; ++level) {
+			getChangedCell(level, x, y) = cell;
+			if (level == getLevelCount()) {
+				break;
+			}
+			x /= 2;
+			y /= 2;
+			cell = summarizeCells(level + 1, x, y);
+		}
+	}
+	return !dirtyTiles.getTiles().empty();
+}
+
+/**
+	Returns true once the pyramid was built
+
+	@return bool
+*/
+bool TilePyramid::isBuilt() const
+{
+	return levelCount > 0;
+}
+
+/**
+	Returns the amount of levels (the last one is a single cell summarizing the whole board)
+
+	@return levelCount
+*/
+int TilePyramid::getLevelCount() const
+{
+	return levelCount;
+}
+
+/**
+	Returns the size of a level (in cells)
+
+	@param level From 1 to getLevelCount()
+	@return size
+*/
+Vei2 TilePyramid::getLevelSize(int level) const
+{
+	assert(level >= 1 && level <= getLevelCount());
+	return Vei2(levels[level - 1].width, levels[level - 1].height);
+}
+
+/**
+	Returns the summary of the tiles x * 2^level to (x + 1) * 2^level - 1, and the same for y
+
+	@param level From 1 to getLevelCount()
+	@param x
+	@param y
+	@return cell
+*/
+const TilePyramid::Cell& TilePyramid::getCell(int level, int x, int y) const
+{
+	assert(level >= 1 && level <= getLevelCount());
+	const Level& cells = levels[level - 1];
+	assert(x >= 0 && x < cells.width && y >= 0 && y < cells.height);
+	return cells.cells[std::size_t(y) * cells.width + x];
+}
+
+/**
+	Returns the amount of memory held by the levels (in bytes)
+
+	@return bytes
+*/
+std::size_t TilePyramid::getMemoryUsage() const
+{
+	std::size_t bytes = levels.capacity() * sizeof(Level);
+	for (const Level& level : levels) {
+		bytes += level.cells.capacity() * sizeof(Cell);
+	}
+	return bytes;
+}
+
+/**
+	Summarizes the tiles of rows of level 1, a chunk of two rows of tiles at a time: the 2 bit states of a chunk are
+	turned into a bit per revealed and per flagged tile, which are then added up in 4 bits per cell
+
+	@param grid The tiles of the board
+	@param rowBegin First row of cells to build
+	@param rowEnd One past the last row of cells to build
+*/
+void TilePyramid::buildFirstLevel(const TileGrid& grid, int rowBegin, int rowEnd)
+{
+	constexpr std::uint64_t lowBits = 0x5555555555555555ull;	// Low bit of every state
+	constexpr std::uint64_t cellBits = 0x1111111111111111ull;	// Low bit of the first state of every cell
+	Level& level = levels[0];
+	for (int y = rowBegin; y < rowEnd; ++y) {
+		const int tileRowEnd = std::min(2 * y + 2, boardHeight);
+		Cell* const cells = &level.cells[std::size_t(y) * level.width];
+		for (int x = 0; x < boardWidth; x += tilesPerChunk) {
+			const int count = std::min(tilesPerChunk, boardWidth - x);
+			std::uint64_t revealedCounts = 0;
+			std::uint64_t flaggedCounts = 0;
+			std::uint32_t explodedCells = 0;	// A bit per cell of the chunk
+			for (int row = 2 * y; row < tileRowEnd; ++row) {
+				const int chunkStart = row * boardWidth + x;
+				const std::uint64_t states = grid.getStateBits(chunkStart, count);
+				const std::uint64_t high = (states >> 1) & lowBits;
+				const std::uint64_t revealed = high & ~states;	// State::Revealed is 0b10
+				const std::uint64_t flagged = high & states;	// State::Flagged is 0b11
+				revealedCounts += (revealed & cellBits) + ((revealed >> 2) & cellBits);
+				flaggedCounts += (flagged & cellBits) + ((flagged >> 2) & cellBits);
+				for (std::uint64_t bits = revealed; bits != 0; bits &= bits - 1) {
+					const int tile = Bits::lowestSetBit(bits) / 2;
+					if (grid.hasMine(chunkStart + tile)) {
+						explodedCells |= 1u << (tile / 2);
+					}
+				}
+			}
+			for (int i = 0; i < (count + 1) / 2; ++i) {
+				const int cellX = x / 2 + i;
+				const int tiles = getTileCount(1, cellX, y);
+				const std::uint64_t revealed = ((revealedCounts >> (4 * i)) & 0xF) * fullPart;
+				const std::uint64_t flagged = ((flaggedCounts >> (4 * i)) & 0xF) * fullPart;
+				const std::uint8_t hasExplodedMine = std::uint8_t((explodedCells >> i) & 1u);
+				if (tiles == 4) {
+					// Most cells are full, dividing by a constant is much cheaper (and rounds the same as toPart())
+					cells[cellX] = Cell{ std::uint8_t((revealed + 2) / 4), std::uint8_t((flagged + 2) / 4), hasExplodedMine };
+				}
+				else {
+					cells[cellX] = Cell{ toPart(revealed, tiles), toPart(flagged, tiles), hasExplodedMine };
+				}
+			}
+		}
+	}
+}
+
+/**
+	Summarizes rows of cells of a level from the level below (the cells along the right and bottom edges of the board
+	cover fewer tiles and go through summarizeCells())
+
+	@param level From 2 to getLevelCount()
+	@param rowBegin First row of cells to build
+	@param rowEnd One past the last row of cells to build
+*/
+void TilePyramid::buildLevel(int level, int rowBegin, int rowEnd)
+{
+	Level& cells = levels[level - 1];
+	const Level& below = levels[level - 2];
+	const int fullWidth = boardWidth >> level;	// Cells over 2x2 full cells
+	const int fullHeight = boardHeight >> level;
+	for (int y = rowBegin; y < rowEnd; ++y) {
+		Cell* const row = &cells.cells[std::size_t(y) * cells.width];
+		int x = 0;
+		if (y < fullHeight) {
+			const Cell* const top = &below.cells[std::size_t(2 * y) * below.width];
+			const Cell* const bottom = top + below.width;
+			for (; x < fullWidth; ++x) {
+				row[x] = mergeFullCells(top[2 * x], top[2 * x + 1], bottom[2 * x], bottom[2 * x + 1]);
+			}
+		}
+		for (; x < cells.width; ++x) {
+			row[x] = summarizeCells(level, x, y);
+		}
+	}
+}
+
+/**
+	Summarizes the tiles of a cell of level 1 (the same as buildFirstLevel(), a tile at a time)
+
+	@param grid The tiles of the board
+	@param x
+	@param y
+	@return cell
+*/
+TilePyramid::Cell TilePyramid::summarizeTiles(const TileGrid& grid, int x, int y) const
+{
+	int revealed = 0;
+	int flagged = 0;
+	std::uint8_t hasExplodedMine = 0;
+	for (int tileY = 2 * y; tileY < std::min(2 * y + 2, boardHeight); ++tileY) {
+		for (int tileX = 2 * x; tileX < std::min(2 * x + 2, boardWidth); ++tileX) {
+			const int index = tileY * boardWidth + tileX;
+			switch (grid.getState(index)) {
+			case TileGrid::State::Revealed:
+				++revealed;
+				hasExplodedMine |= std::uint8_t(grid.hasMine(index));
+				break;
+			case TileGrid::State::Flagged:
+				++flagged;
+				break;
+			default:
+				break;
+			}
+		}
+	}
+	const int tiles = getTileCount(1, x, y);
+	return Cell{ toPart(std::uint64_t(revealed) * fullPart, tiles), toPart(std::uint64_t(flagged) * fullPart, tiles), hasExplodedMine };
+}
+
+/**
+	Summarizes the (up to) 2x2 cells of the level below a cell, weighing each by the amount of tiles it covers
+
+	@param level From 2 to getLevelCount()
+	@param x
+	@param y
+	@return cell
+*/
+TilePyramid::Cell TilePyramid::summarizeCells(int level, int x, int y) const
+{
+	const Level& below = levels[level - 2];
+	if (((x + 1) << level) <= boardWidth && ((y + 1) << level) <= boardHeight) {
+		const Cell* const top = &below.cells[std::size_t(2 * y) * below.width + 2 * x];
+		const Cell* const bottom = top + below.width;
+		return mergeFullCells(top[0], top[1], bottom[0], bottom[1]);
+	}
+	std::uint64_t revealed = 0;
+	std::uint64_t flagged = 0;
+	std::uint64_t tiles = 0;
+	std::uint8_t hasExplodedMine = 0;
+	for (int cellY = 2 * y; cellY < std::min(2 * y + 2, below.height); ++cellY) {
+		for (int cellX = 2 * x; cellX < std::min(2 * x + 2, below.width); ++cellX) {
+			const Cell& cell = getCell(level - 1, cellX, cellY);
+			const std::uint64_t weight = getTileCount(level - 1, cellX, cellY);
+			revealed += cell.revealed * weight;
+			flagged += cell.flagged * weight;
+			hasExplodedMine |= cell.hasExplodedMine;
+			tiles += weight;
+		}
+	}
+	return Cell{ toPart(revealed, tiles), toPart(flagged, tiles), hasExplodedMine };
+}
+
+/**
+	Returns a cell to be changed
+
+	@param level From 1 to getLevelCount()
+	@param x
+	@param y
+	@return cell
+*/
+TilePyramid::Cell& TilePyramid::getChangedCell(int level, int x, int y)
+{
+	assert(level >= 1 && level <= getLevelCount());
+	Level& cells = levels[level - 1];
+	assert(x >= 0 && x < cells.width && y >= 0 && y < cells.height);
+	return cells.cells[std::size_t(y) * cells.width + x];
+}
+
+/**
+	Returns the amount of tiles of the board a cell covers (fewer than 4^level along the right and bottom edges)
+
+	@param level
+	@param x
+	@param y
+	@return tiles
+*/
+int TilePyramid::getTileCount(int level, int x, int y) const
+{
+	const int side = 1 << level;
+	return std::min(side, boardWidth - x * side) * std::min(side, boardHeight - y * side);
+}
+
+/**
+	Summarizes 2x2 full cells, which all weigh the same (rounds the same as the weighted sum of summarizeCells(),
+	without dividing)
+
+	@param topLeft
+	@param topRight
+	@param bottomLeft
+	@param bottomRight
+	@return cell
+*/
+TilePyramid::Cell TilePyramid::mergeFullCells(const Cell& topLeft, const Cell& topRight, const Cell& bottomLeft, const Cell& bottomRight)
+{
+	return Cell{
+		std::uint8_t((topLeft.revealed + topRight.revealed + bottomLeft.revealed + bottomRight.revealed + 2) / 4),
+		std::uint8_t((topLeft.flagged + topRight.flagged + bottomLeft.flagged + bottomRight.flagged + 2) / 4),
+		std::uint8_t(topLeft.hasExplodedMine | topRight.hasExplodedMine | bottomLeft.hasExplodedMine | bottomRight.hasExplodedMine) };
+}
+
+/**
+	Rounds a part of the tiles of a cell to 1/fullPart
+
+	@param amount The part, times fullPart
+	@param total The amount of tiles
+	@return part
+*/
+std::uint8_t TilePyramid::toPart(std::uint64_t amount, std::uint64_t total)
+{
+	assert(total > 0);
+	return std::uint8_t((amount + total / 2) / total);
+}
@@ -0,0 +1,71 @@
+/**
+	Downsampled summary of the states of a board, read instead of the tiles when a pixel covers several of them
+
+	Level k summarizes blocks of 2^k x 2^k tiles: which part of the tiles of a block is revealed and which part is
+	flagged (the rest is hidden), and whether one of them is an exploded mine. Level 1 is built from the tiles and each
+	level above from 2x2 cells of the level below, up to a level of a single cell. A changed tile only updates the cells
+	above it, and stops at the first cell which comes out unchanged (the cells above it cannot change either).
+*/
+
+#pragma once
+#include "TileGrid.h"
+#include "DirtyTiles.h"
+#include "ThreadPool.h"
+#include "Vei2.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class TilePyramid {
+public:
+	/**
+		Summary of a block of tiles, the parts are in 1/fullPart of the tiles of the block which are on the board
+	*/
+	struct Cell {
+		std::uint8_t revealed;
+		std::uint8_t flagged;
+		std::uint8_t hasExplodedMine;
+		bool operator==(const Cell& rhs) const { return revealed == rhs.revealed && flagged == rhs.flagged && hasExplodedMine == rhs.hasExplodedMine; }
+		bool operator!=(const Cell& rhs) const { return !(*this == rhs); }
+	};
+
+public:
+	void rebuild(const TileGrid& grid, ThreadPool* pool = nullptr);
+	bool update(const TileGrid& grid, const DirtyTiles& dirtyTiles, ThreadPool* pool = nullptr);
+
+	bool isBuilt() const;
+	int getLevelCount() const;
+	Vei2 getLevelSize(int level) const;
+	const Cell& getCell(int level, int x, int y) const;
+	std::size_t getMemoryUsage() const;
+
+	static constexpr int fullPart = 255;
+	static constexpr int tilesPerChunk = 28;	// Tiles of a row read at once when building level 1 (See TileGrid::getStateBits())
+	static constexpr int stripesPerThread = 4;	// Stripes of rows each level is split into per thread of the pool
+
+private:
+	/**
+		Cells of a level, row after row
+	*/
+	struct Level {
+		int width;
+		int height;
+		std::vector<Cell> cells;
+	};
+
+private:
+	void buildFirstLevel(const TileGrid& grid, int rowBegin, int rowEnd);
+	void buildLevel(int level, int rowBegin, int rowEnd);
+	Cell summarizeTiles(const TileGrid& grid, int x, int y) const;
+	Cell summarizeCells(int level, int x, int y) const;
+	Cell& getChangedCell(int level, int x, int y);
+	int getTileCount(int level, int x, int y) const;
+	static Cell mergeFullCells(const Cell& topLeft, const Cell& topRight, const Cell& bottomLeft, const Cell& bottomRight);
+	static std::uint8_t toPart(std::uint64_t amount, std::uint64_t total);
+
+private:
+	int boardWidth = 0;
+	int boardHeight = 0;
+	int levelCount = 0;
+	std::vector<Level> levels;	// levels[k - 1] is level k (never shrinks, so the cells of every level are kept)
+};
@@ -0,0 +1,149 @@
+#include "VisibleBoard.h"
+#include <algorithm>
+#include <assert.h>
+
+/**
+	Constructs a board of hidden tiles
+
+	@param widthIn
+	@param heightIn
+	@param nMinesIn Mines of the whole board
+*/
+VisibleBoard::VisibleBoard(int widthIn, int heightIn, int nMinesIn)
+{
+	resize(widthIn, heightIn, nMinesIn);
+}
+
+/**
+	Resizes the board and hides every tile (the storage never shrinks)
+
+	@param widthIn
+	@param heightIn
+	@param nMinesIn Mines of the whole board
+*/
+void VisibleBoard::resize(int widthIn, int heightIn, int nMinesIn)
+{
+	assert(widthIn > 0 && heightIn > 0);
+	assert(nMinesIn >= 0 && nMinesIn <= widthIn * heightIn);
+	width = widthIn;
+	height = heightIn;
+	nMines = nMinesIn;
+	tiles.resize(width * height);
+	std::fill(tiles.begin(), tiles.end(), std::int8_t(hidden));
+}
+
+/**
+	Copies what a player sees of a grid
+
+	@param grid
+	@param nMinesIn Mines of the whole grid
+*/
+void VisibleBoard::read(const TileGrid& grid, int nMinesIn)
+{
+	width = grid.getWidth();
+	height = grid.getHeight();
+	nMines = nMinesIn;
+	tiles.resize(width * height);
+	for (int index = 0; index < width * height; ++index) {
+		switch (grid.getState(index)) {
+		case TileGrid::State::Revealed:
+			tiles[index] = std::int8_t(grid.getAdjacentMineCount(index));
+			break;
+		case TileGrid::State::Flagged:
+			tiles[index] = std::int8_t(flagged);
+			break;
+		default:
+			tiles[index] = std::int8_t(hidden);
+			break;
+		}
+	}
+}
+
+/**
+	Returns the adjacent mine count of a revealed tile, or hidden or flagged
+
+	@param index
+	@return tile
+*/
+int VisibleBoard::getTile(int index) const
+{
+	assert(index >= 0 && index < (int)tiles.size());
+	return tiles[index];
+}
+
+/**
+	Sets a tile to its adjacent mine count (revealed), or to hidden or flagged
+
+	@param index
+	@param tile
+*/
+void VisibleBoard::setTile(int index, int tile)
+{
+	assert(index >= 0 && index < (int)tiles.size());
+	assert(tile >= flagged && tile <= 8);
+	tiles[index] = std::int8_t(tile);
+}
+
+/**
+	Returns whether a tile shows its adjacent mine count
+
+	@param index
+	@return bool
+*/
+bool VisibleBoard::isRevealed(int index) const
+{
+	return getTile(index) >= 0;
+}
+
+/**
+	Returns the width of the board (in tiles)
+
+	@return width
+*/
+int VisibleBoard::getWidth() const
+{
+	return width;
+}
+
+/**
+	Returns the height of the board (in tiles)
+
+	@return height
+*/
+int VisibleBoard::getHeight() const
+{
+	return height;
+}
+
+/**
+	Returns the amount of tiles on the board
+
+	@return tileCount
+*/
+int VisibleBoard::getTileCount() const
+{
+	return width * height;
+}
+
+/**
+	Returns the amount of mines of the whole board (flagged or not)
+
+	@return nMines
+*/
+int VisibleBoard::getMineCount() const
+{
+	return nMines;
+}
+
+/**
+	Converts a tile location to the index of the tile
+
+	@param x
+	@param y
+	@return index
+*/
+int VisibleBoard::indexOf(int x, int y) const
+{
+	assert(x >= 0 && x < width && y >= 0 && y < height);
+	return y * width + x;
+}
@@ -0,0 +1,38 @@
+/**
+	What a player sees of a minefield: the number of every revealed tile, which tiles are flagged and which are hidden
+
+	This is all the solvers look at, so they can never use where the mines are. A partially revealed tile is only
+	pressed, not revealed, and is hidden here.
+*/
+
+#pragma once
+#include "TileGrid.h"
+#include <vector>
+#include <cstdint>
+
+class VisibleBoard {
+public:
+	VisibleBoard() = default;
+	VisibleBoard(int widthIn, int heightIn, int nMinesIn);
+
+	void resize(int widthIn, int heightIn, int nMinesIn);
+	void read(const TileGrid& grid, int nMinesIn);
+
+	int getTile(int index) const;
+	void setTile(int index, int tile);
+	bool isRevealed(int index) const;
+	int getWidth() const;
+	int getHeight() const;
+	int getTileCount() const;
+	int getMineCount() const;
+	int indexOf(int x, int y) const;
+
+	static constexpr int hidden = -1;
+	static constexpr int flagged = -2;
+
+private:
+	int width = 0;
+	int height = 0;
+	int nMines = 0;
+	std::vector<std::int8_t> tiles;	// Adjacent mine count of each revealed tile (0 to 8), hidden or flagged otherwise
+};
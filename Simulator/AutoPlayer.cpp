@@ -0,0 +1,50 @@
+#include "AutoPlayer.h"
+#include <assert.h>
+
+/**
+	Decides the next moves on a board, see getFlags() and getReveals()
+
+	@param board A game still being played (at least one safe tile is hidden)
+*/
+void AutoPlayer::decide(const VisibleBoard& board)
+{
+	solver.solve(board, true);
+	reveals.assign(solver.getSafeTiles().begin(), solver.getSafeTiles().end());
+	guesses = reveals.empty();
+	if (guesses) {
+		probabilities.compute(board, nullptr, true);
+		const int guess = probabilities.findSafestTile(board);
+		assert(guess >= 0);
+		reveals.push_back(guess);
+	}
+}
+
+/**
+	Returns the tiles to flag after the last decision (they are proven mines)
+
+	@return flags
+*/
+const std::vector<int>& AutoPlayer::getFlags() const
+{
+	return solver.getMineTiles();
+}
+
+/**
+	Returns the tiles to reveal after the last decision: the proven safe tiles, or the one tile guessed
+
+	@return reveals
+*/
+const std::vector<int>& AutoPlayer::getReveals() const
+{
+	return reveals;
+}
+
+/**
+	Returns true if the last decision is a guess
+
+	@return bool
+*/
+bool AutoPlayer::isGuessing() const
+{
+	return guesses;
+}
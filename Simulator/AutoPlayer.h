@@ -0,0 +1,29 @@
+/**
+	Player of the simulated games: makes every move the logic solver proves, and guesses the tile least likely to be a
+	mine when it proves none
+
+	Each decision flags the tiles the solver proves to be mines and reveals the tiles it proves safe. When there are
+	none, the exact mine probabilities pick the single tile to reveal (see MineProbabilities). The player trusts every
+	flag on the board, so only its own flags may be placed.
+*/
+
+#pragma once
+#include "VisibleBoard.h"
+#include "LogicSolver.h"
+#include "MineProbabilities.h"
+#include <vector>
+
+class AutoPlayer {
+public:
+	void decide(const VisibleBoard& board);
+
+	const std::vector<int>& getFlags() const;
+	const std::vector<int>& getReveals() const;
+	bool isGuessing() const;
+
+private:
+	LogicSolver solver;
+	MineProbabilities probabilities;
+	std::vector<int> reveals;	// Tiles to reveal after the last decision
+	bool guesses = false;	// The last decision is a guess
+};
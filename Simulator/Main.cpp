@@ -0,0 +1,122 @@
+/**
+	Plays large numbers of games without a window, on every core, and reports how fast and how well they went:
+	Simulator [games] [difficulty] [threads] [no-guess]
+
+	The difficulty is Beginner, Intermediate, Expert or WIDTHxHEIGHTxMINES (Expert by default), threads is 0 for one
+	per hardware thread (the default), and no-guess places the mines with a NoGuessGenerator. The games come from a
+	fixed seed, so two builds play the same games and their numbers can be compared.
+*/
+
+#include "Simulation.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+namespace {
+	constexpr long long defaultGameCount = 100000;
+	constexpr std::uint64_t simulationSeed = 2026;
+	constexpr long long gamesPerBatch = 64;	// Games a thread takes at once
+
+	/**
+		Size and amount of mines of a board
+	*/
+	struct Difficulty {
+		const char* name;
+		int width;
+		int height;
+		int nMines;
+	};
+
+	constexpr Difficulty standardDifficulties[] = {
+		{ "Beginner", 9, 9, 10 },
+		{ "Intermediate", 16, 16, 40 },
+		{ "Expert", 30, 16, 99 }
+	};
+
+	/**
+		Reads a difficulty from its name or from its size and mines (WIDTHxHEIGHTxMINES)
+
+		@param text
+		@param difficulty Set to the difficulty read
+		@return isValid
+	*/
+	bool parseDifficulty(const char* text, Difficulty& difficulty)
+	{
+		for (const Difficulty& standard : standardDifficulties) {
+			if (std::strcmp(text, standard.name) == 0) {
+				difficulty = standard;
+				return true;
+			}
+		}
+		difficulty.name = text;
+		return std::sscanf(text, "%dx%dx%d", &difficulty.width, &difficulty.height, &difficulty.nMines) == 3 &&
+			difficulty.width > 0 && difficulty.height > 0 && difficulty.nMines > 0 &&
+			difficulty.nMines < difficulty.width * difficulty.height;
+	}
+
+	double toSeconds(std::chrono::steady_clock::duration duration)
+	{
+		return std::chrono::duration<double>(duration).count();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	const long long nGames = argc > 1 ? std::atoll(argv[1]) : defaultGameCount;
+	Difficulty difficulty = standardDifficulties[2];
+	const int requestedThreads = argc > 3 ? std::atoi(argv[3]) : 0;
+	const bool isNoGuess = argc > 4 && std::strcmp(argv[4], "no-guess") == 0;
+	if (nGames <= 0 || (argc > 2 && !parseDifficulty(argv[2], difficulty)) || requestedThreads < 0 ||
+		(argc > 4 && !isNoGuess)) {
+		std::printf("Usage: Simulator [games] [Beginner|Intermediate|Expert|WIDTHxHEIGHTxMINES] [threads] [no-guess]\n");
+		return 1;
+	}
+	const int nThreads = requestedThreads > 0 ? requestedThreads : std::max(1, (int)std::thread::hardware_concurrency());
+
+	// One simulation per thread, each thread taking batches of games until they are all played
+	const Simulation::Setup setup = { difficulty.width, difficulty.height, difficulty.nMines, simulationSeed, isNoGuess };
+	std::vector<std::unique_ptr<Simulation>> simulations;
+	for (int i = 0; i < nThreads; ++i) {
+		simulations.push_back(std::make_unique<Simulation>(setup));
+	}
+	std::atomic<long long> nextGame(0);
+	const auto simulate = [&simulations, &nextGame, nGames](int thread) {
+		for (long long first = nextGame.fetch_add(gamesPerBatch); first < nGames; first = nextGame.fetch_add(gamesPerBatch)) {
+			simulations[thread]->play(first, std::min(gamesPerBatch, nGames - first));
+		}
+	};
+	ThreadPool pool(nThreads);
+	const auto start = std::chrono::steady_clock::now();
+	pool.parallelFor(nThreads, std::cref(simulate));	// Wrapped in a reference, so the std::function never allocates
+	const double seconds = toSeconds(std::chrono::steady_clock::now() - start);
+
+	Simulation::Totals totals;
+	for (const auto& simulation : simulations) {
+		totals.add(simulation->getTotals());
+	}
+	const double games = double(totals.games);
+	const double generation = toSeconds(totals.generationTime);
+	const double reveal = toSeconds(totals.revealTime);
+	const double decision = toSeconds(totals.decisionTime);
+	const double busy = generation + reveal + decision;
+	std::printf("%s (%dx%d, %d mines%s): %lld games on %d threads in %.2f s, seed %llu\n", difficulty.name,
+		difficulty.width, difficulty.height, difficulty.nMines, isNoGuess ? ", no guessing" : "", totals.games, nThreads,
+		seconds, (unsigned long long)simulationSeed);
+	std::printf("  games/s         %12.0f\n", games / seconds);
+	std::printf("  win rate        %11.2f%%\n", 100.0 * totals.wins / games);
+	std::printf("  revealed tiles  %12.1f per game (of %d safe tiles)\n", totals.revealedTiles / games,
+		difficulty.width * difficulty.height - difficulty.nMines);
+	std::printf("  guesses         %12.2f per game\n", totals.guesses / games);
+	std::printf("  time split       generation %5.1f%%   reveal %5.1f%%   decision %5.1f%%\n", 100.0 * generation / busy,
+		100.0 * reveal / busy, 100.0 * decision / busy);
+	std::printf("  time per game    generation %7.2f us   reveal %7.2f us   decision %7.2f us\n", 1e6 * generation / games,
+		1e6 * reveal / games, 1e6 * decision / games);
+	return 0;
+}
@@ -0,0 +1,113 @@
+#include "Simulation.h"
+#include "CounterRng.h"
+#include <assert.h>
+
+/**
+	Adds up the totals of another simulation
+
+	@param other
+*/
+void Simulation::Totals::add(const Totals& other)
+{
+	games += other.games;
+	wins += other.wins;
+	revealedTiles += other.revealedTiles;
+	guesses += other.guesses;
+	generationTime += other.generationTime;
+	revealTime += other.revealTime;
+	decisionTime += other.decisionTime;
+}
+
+/**
+	Constructs a simulation
+
+	@param setupIn
+*/
+Simulation::Simulation(const Setup& setupIn)
+	:
+	setup(setupIn),
+	grid(setupIn.width, setupIn.height)
+{
+	assert(setup.nMines > 0 && setup.nMines < setup.width * setup.height);
+	firstIndex = grid.indexOf(setup.width / 2, setup.height / 2);
+}
+
+/**
+	Plays a range of games, adding them to the totals
+
+	@param firstGame Number of the first game
+	@param nGames
+*/
+void Simulation::play(long long firstGame, long long nGames)
+{
+	using Clock = std::chrono::steady_clock;
+	const int nonMineTiles = grid.getTileCount() - setup.nMines;
+	for (long long game = firstGame; game < firstGame + nGames; ++game) {
+		const Clock::time_point generationStart = Clock::now();
+		generateMines(CounterRng::get(setup.seed, std::uint64_t(game)));
+		const Clock::time_point firstRevealStart = Clock::now();
+		totals.generationTime += firstRevealStart - generationStart;
+		int revealed = grid.floodReveal(firstIndex);
+		bool isLost = false;
+		totals.revealTime += Clock::now() - firstRevealStart;
+
+		while (revealed < nonMineTiles && !isLost) {
+			const Clock::time_point decisionStart = Clock::now();
+			board.read(grid, setup.nMines);
+			player.decide(board);
+			const Clock::time_point revealStart = Clock::now();
+			totals.decisionTime += revealStart - decisionStart;
+
+			for (int index : player.getFlags()) {
+				grid.setState(index, TileGrid::State::Flagged);
+			}
+			for (int index : player.getReveals()) {
+				if (grid.hasMine(index)) {
+					isLost = true;
+					break;
+				}
+				if (grid.isRevealable(index)) {
+					revealed += grid.floodReveal(index);
+				}
+			}
+			totals.guesses += player.isGuessing();
+			totals.revealTime += Clock::now() - revealStart;
+		}
+
+		++totals.games;
+		totals.wins += !isLost;
+		totals.revealedTiles += revealed;
+	}
+}
+
+/**
+	Places the mines of a game on the cleared board and counts them
+
+	@param gameSeed
+*/
+void Simulation::generateMines(std::uint64_t gameSeed)
+{
+	grid.clear();
+	if (setup.isNoGuess) {
+		generator.generate(setup.width, setup.height, setup.nMines, firstIndex, gameSeed);
+		for (int index = 0; index < grid.getTileCount(); ++index) {
+			if (generator.hasMine(index)) {
+				grid.setMine(index, true);
+			}
+		}
+	}
+	else {
+		grid.placeMines(setup.nMines, firstIndex, gameSeed);
+	}
+	grid.countAdjacentMines();
+}
+
+/**
+	Returns the totals of the games played so far
+
+	@return totals
+*/
+const Simulation::Totals& Simulation::getTotals() const
+{
+	return totals;
+}
@@ -0,0 +1,65 @@
+/**
+	Plays games on one thread, with a board and a player of its own, and adds up how they went
+
+	Every game opens at the centre of the board and is played by an AutoPlayer until it is won or lost. The mines of
+	game n come from number n of the counter-based sequence of the seed, so a game plays the same on any thread and the
+	totals of a run do not depend on how its games were shared between the threads (only the times do).
+*/
+
+#pragma once
+#include "TileGrid.h"
+#include "VisibleBoard.h"
+#include "NoGuessGenerator.h"
+#include "AutoPlayer.h"
+#include <chrono>
+#include <cstdint>
+
+class Simulation {
+public:
+	/**
+		Games to play: the size and mines of their board, and where their mines come from
+	*/
+	struct Setup {
+		int width;
+		int height;
+		int nMines;
+		std::uint64_t seed;
+		bool isNoGuess;	// The mines are placed by a NoGuessGenerator
+	};
+
+	/**
+		Outcome of the games played so far, and the time spent on each part of them
+	*/
+	struct Totals {
+		void add(const Totals& other);
+
+		long long games = 0;
+		long long wins = 0;
+		long long revealedTiles = 0;	// Safe tiles revealed when the games ended
+		long long guesses = 0;	// Tiles revealed without being proven safe (the first click is not counted)
+		std::chrono::steady_clock::duration generationTime{ 0 };	// Placing the mines and counting them
+		std::chrono::steady_clock::duration revealTime{ 0 };	// Revealing and flagging tiles on the board
+		std::chrono::steady_clock::duration decisionTime{ 0 };	// Reading the board and deciding the moves
+	};
+
+public:
+	Simulation(const Setup& setupIn);
+	Simulation(const Simulation&) = delete;
+	Simulation& operator=(const Simulation&) = delete;
+
+	void play(long long firstGame, long long nGames);
+
+	const Totals& getTotals() const;
+
+private:
+	void generateMines(std::uint64_t gameSeed);
+
+private:
+	Setup setup;
+	int firstIndex;	// The tile clicked first
+	TileGrid grid;
+	VisibleBoard board;
+	AutoPlayer player;
+	NoGuessGenerator generator;	// Runs on the thread of the simulation
+	Totals totals;
+};